@@ -8,7 +8,7 @@ function(v8_generate_builtins_list target-dir)
     VERBATIM)
   add_custom_command(
     COMMAND bytecode_builtins_list_generator ${output}
-    DEPENDS ${directory}
+    DEPENDS bytecode_builtins_list_generator ${directory}
     OUTPUT ${output}
     COMMENT "Generating ${output}"
     VERBATIM)
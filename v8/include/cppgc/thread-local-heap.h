@@ -0,0 +1,84 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef INCLUDE_CPPGC_THREAD_LOCAL_HEAP_H_
+#define INCLUDE_CPPGC_THREAD_LOCAL_HEAP_H_
+
+#include <memory>
+
+#include "cppgc/heap.h"
+#include "v8config.h"  // NOLINT(build/include_directory)
+
+namespace cppgc {
+
+class AllocationHandle;
+
+namespace internal {
+class ThreadLocalHeap;
+}  // namespace internal
+
+/**
+ * Allows allocating objects on a Heap from a thread other than the one that
+ * created the heap. Each such thread allocates from its own buffers, so that
+ * most allocations do not synchronize with other threads.
+ *
+ * Garbage collections run on the thread that created the heap. They first stop
+ * all threads with a ThreadLocalHeap at a safepoint, and keep them stopped
+ * until the collection is finished. The stacks of these threads are not
+ * scanned: whenever a thread enters a safepoint or is parked, the objects it
+ * uses must be reachable from `subtle::CrossThreadPersistent` handles or from
+ * other reachable objects.
+ */
+class V8_EXPORT ThreadLocalHeap {
+ public:
+  /**
+   * Attaches the calling thread to a heap. The returned ThreadLocalHeap must be
+   * destroyed on the same thread, before the heap is destroyed.
+   *
+   * \param heap the heap to allocate on, created on another thread.
+   * \returns the ThreadLocalHeap of the calling thread.
+   */
+  static std::unique_ptr<ThreadLocalHeap> Create(Heap* heap);
+
+  virtual ~ThreadLocalHeap() = default;
+
+  /**
+   * \returns the opaque handle for allocating objects on this thread using
+   * `MakeGarbageCollected()`.
+   */
+  AllocationHandle& GetAllocationHandle();
+
+  /**
+   * Stops the calling thread until the garbage collection is finished if one
+   * was requested. Threads that are not parked must call this regularly, as a
+   * garbage collection waits for all of them.
+   */
+  void Safepoint();
+
+  /**
+   * Parks the thread for the lifetime of the scope: the thread must not access
+   * the heap, and garbage collections do not wait for it. Should be used around
+   * blocking operations.
+   */
+  class V8_EXPORT ParkedScope final {
+   public:
+    explicit ParkedScope(ThreadLocalHeap& heap);
+    ~ParkedScope();
+
+    ParkedScope(const ParkedScope&) = delete;
+    ParkedScope& operator=(const ParkedScope&) = delete;
+
+   private:
+    ThreadLocalHeap& heap_;
+  };
+
+ private:
+  ThreadLocalHeap() = default;
+
+  friend class internal::ThreadLocalHeap;
+};
+
+}  // namespace cppgc
+
+#endif  // INCLUDE_CPPGC_THREAD_LOCAL_HEAP_H_
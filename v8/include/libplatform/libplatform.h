@@ -23,6 +23,15 @@ enum class MessageLoopBehavior : bool {
   kWaitForWork = true
 };
 
+/**
+ * How worker threads pick up background tasks. With |kSharedQueue| all worker
+ * threads take tasks from one mutex-guarded queue in posting order. With
+ * |kWorkStealing| every worker thread owns per-priority deques and steals from
+ * the other workers when it runs out of tasks, which scales better with the
+ * number of worker threads and runs higher priority tasks first.
+ */
+enum class WorkerThreadsTaskScheduling { kSharedQueue, kWorkStealing };
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -35,13 +44,17 @@ enum class MessageLoopBehavior : bool {
  * calling v8::platform::RunIdleTasks to process the idle tasks.
  * If |tracing_controller| is nullptr, the default platform will create a
  * v8::platform::TracingController instance and use it.
+ * |worker_threads_task_scheduling| selects how tasks are distributed over the
+ * worker threads.
  */
 V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size = 0,
     IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
     InProcessStackDumping in_process_stack_dumping =
         InProcessStackDumping::kDisabled,
-    std::unique_ptr<v8::TracingController> tracing_controller = {});
+    std::unique_ptr<v8::TracingController> tracing_controller = {},
+    WorkerThreadsTaskScheduling worker_threads_task_scheduling =
+        WorkerThreadsTaskScheduling::kSharedQueue);
 
 /**
  * Returns a new instance of the default v8::JobHandle implementation.
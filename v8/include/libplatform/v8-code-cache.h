@@ -0,0 +1,109 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_V8_CODE_CACHE_H_
+#define V8_LIBPLATFORM_V8_CODE_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "libplatform/libplatform-export.h"
+
+namespace v8 {
+namespace platform {
+
+/**
+ * A persistent code cache in a directory on disk, to be shared by processes
+ * that compile the same scripts.
+ *
+ * Entries are the blobs produced by v8::ScriptCompiler::CreateCodeCache. They
+ * are content-addressed by a hash of the script source and by a version tag,
+ * which should be v8::ScriptCompiler::CachedDataVersionTag() so that entries
+ * from other V8 versions or flag configurations are never handed out. Every
+ * entry also stores the full source, which lookups compare, so that scripts
+ * whose hashes collide never share cached data. Entries
+ * are memory-mapped on lookup and written atomically, so several processes may
+ * use the same directory concurrently. Once the directory grows beyond its
+ * size limit, the least recently used entries are evicted.
+ *
+ * A CodeCacheDirectory instance is not thread-safe; embedders sharing one
+ * between threads must synchronize the calls.
+ */
+class V8_PLATFORM_EXPORT CodeCacheDirectory {
+ public:
+  class Entry {
+   public:
+    virtual ~Entry() = default;
+
+    /**
+     * The cached data, suitable for v8::ScriptCompiler::CachedData with
+     * BufferNotOwned. Stays valid for the lifetime of the entry.
+     */
+    virtual const uint8_t* data() const = 0;
+    virtual int length() const = 0;
+  };
+
+  /**
+   * Opens the cache in |path|, creating the directory if it does not exist.
+   * Returns nullptr if the directory cannot be used.
+   */
+  static std::unique_ptr<CodeCacheDirectory> Open(const char* path,
+                                                  size_t max_size_in_bytes,
+                                                  uint32_t version_tag);
+
+  ~CodeCacheDirectory();
+
+  /**
+   * Returns the entry for the given script source, or nullptr if there is
+   * none. A hit marks the entry as recently used.
+   */
+  std::unique_ptr<Entry> Lookup(const char* source, size_t source_length);
+
+  /**
+   * Stores |data| as the entry for the given script source, replacing any
+   * previous entry. Returns false if the entry could not be written.
+   */
+  bool Store(const char* source, size_t source_length, const uint8_t* data,
+             int length);
+
+  /**
+   * Removes the entry for the given script source, e.g. after V8 rejected it.
+   */
+  void Remove(const char* source, size_t source_length);
+
+  /**
+   * Evicts least recently used entries until the directory is no larger than
+   * the size limit.
+   */
+  void Trim();
+
+  size_t size_in_bytes() const { return size_in_bytes_; }
+
+ private:
+  CodeCacheDirectory(const char* path, size_t max_size_in_bytes,
+                     uint32_t version_tag);
+
+  std::string EntryPath(const char* source, size_t source_length) const;
+  void TrimExcept(const std::string& keep_path);
+
+  const std::string path_;
+  const size_t max_size_in_bytes_;
+  const uint32_t version_tag_;
+  // Approximate, since other processes may add or evict entries.
+  size_t size_in_bytes_ = 0;
+  int next_temp_file_id_ = 0;
+
+  friend class CodeCacheDirectoryTest;
+
+  CodeCacheDirectory(const CodeCacheDirectory&) = delete;
+  CodeCacheDirectory& operator=(const CodeCacheDirectory&) = delete;
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_V8_CODE_CACHE_H_
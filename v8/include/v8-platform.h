@@ -447,6 +447,13 @@ class PageAllocator {
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
 
+  /**
+   * Advises the operating system to back the given [address, address + size)
+   * range with huge pages. address and size should be operating system
+   * page-aligned. Returns false if huge pages are not supported.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
+
   /**
    * INTERNAL ONLY: This interface has not been stabilised and may change
    * without notice from one release to another without being deprecated first.
@@ -298,6 +298,54 @@ class V8_EXPORT CpuProfilingOptions {
   int sampling_interval_us_;
 };
 
+/**
+ * Receives the windows of a continuous CPU profile, see
+ * CpuProfiler::StartContinuousProfiling().
+ */
+class V8_EXPORT CpuProfileWindowSink {
+ public:
+  virtual ~CpuProfileWindowSink() = default;
+
+  /**
+   * Called with the samples of a finished window, encoded as a gzip-compressed
+   * profile.proto message of pprof (https://github.com/google/pprof). Called
+   * on the profiler thread, except for the last window, which is passed on the
+   * thread calling StopContinuousProfiling(). The data is only valid for the
+   * duration of the call.
+   */
+  virtual void WriteProfileWindow(const uint8_t* data, size_t size) = 0;
+};
+
+/**
+ * Attributes of a continuous CPU profile.
+ */
+class V8_EXPORT ContinuousCpuProfilingOptions {
+ public:
+  /**
+   * \param window_duration_ms The duration covered by each window.
+   * \param max_nodes The maximum number of call tree nodes per window. A
+   *                  sample whose stack does not fit is attributed to its
+   *                  deepest caller that does.
+   * \param sampling_interval_us The profile-specific target sampling
+   *                             interval, see CpuProfilingOptions.
+   */
+  explicit ContinuousCpuProfilingOptions(int window_duration_ms = 10000,
+                                         unsigned max_nodes = 10000,
+                                         int sampling_interval_us = 10000)
+      : window_duration_ms_(window_duration_ms),
+        max_nodes_(max_nodes),
+        sampling_interval_us_(sampling_interval_us) {}
+
+  int window_duration_ms() const { return window_duration_ms_; }
+  unsigned max_nodes() const { return max_nodes_; }
+  int sampling_interval_us() const { return sampling_interval_us_; }
+
+ private:
+  int window_duration_ms_;
+  unsigned max_nodes_;
+  int sampling_interval_us_;
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -377,6 +425,23 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Starts a continuous profile, which aggregates samples in windows of
+   * |options.window_duration_ms()| and passes each finished window to |sink|
+   * instead of keeping the samples in memory. It can run alongside profiles
+   * started with StartProfiling(). Returns false if a continuous profile is
+   * already running. |sink| must stay alive until StopContinuousProfiling().
+   */
+  bool StartContinuousProfiling(CpuProfileWindowSink* sink,
+                                ContinuousCpuProfilingOptions options =
+                                    ContinuousCpuProfilingOptions());
+
+  /**
+   * Stops the continuous profile after passing its last, partial window to
+   * the sink.
+   */
+  void StopContinuousProfiling();
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -514,7 +579,8 @@ class V8_EXPORT OutputStream {  // NOLINT
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -564,6 +630,25 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format holds the same data in a more compact form that is
+   * cheaper to produce. All numbers are unsigned LEB128 varints:
+   *
+   *   "V8HS", version, node_count, edge_count, trace_function_count,
+   *   nodes (node_count * 7 numbers, in the order of meta.node_fields),
+   *   edges (edge_count * 3 numbers, in the order of meta.edge_fields),
+   *   trace function infos (trace_function_count * 6 numbers),
+   *   has_trace_tree, trace tree nodes in pre-order (id,
+   *     function_info_index, count, size, children_count),
+   *   sample_count, samples (2 numbers each),
+   *   location_count, locations (4 numbers each),
+   *   string_count, strings (UTF-8 byte length followed by the bytes).
+   *
+   * Unlike in the JSON format, edges and locations refer to nodes by their
+   * ordinal instead of their index in the nodes array, and the same string
+   * may occur more than once. The bytes are passed to
+   * OutputStream::WriteAsciiChunk. tools/heap-snapshot-to-json.js converts
+   * the binary format to the JSON format.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -688,6 +773,29 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * Number of young generation garbage collections the sampled object
+     * survived.
+     */
+    unsigned int scavenges_survived;
+
+    /**
+     * Number of full garbage collections the sampled object survived.
+     */
+    unsigned int mark_compacts_survived;
+
+    /**
+     * Whether the sampled object was allocated in the young generation and
+     * has been promoted to the old generation since.
+     */
+    bool promoted;
+
+    /**
+     * Time in milliseconds between the allocation of the sampled object and
+     * the creation of the containing report.
+     */
+    double age_ms;
   };
 
   /**
@@ -704,6 +812,50 @@ class V8_EXPORT AllocationProfile {
   static const int kNoColumnNumberInfo = Message::kNoColumnInfo;
 };
 
+/**
+ * The changes to the sampled live objects of a sampling heap profile since
+ * the previous report, see HeapProfiler::GetAllocationProfileDelta().
+ */
+class V8_EXPORT AllocationProfileDelta {
+ public:
+  /**
+   * A call-graph node created since the previous report.
+   */
+  struct NewNode {
+    /**
+     * id of the parent node, or 0 for the root node.
+     */
+    uint32_t parent_node_id;
+
+    /**
+     * Description of the node. Its children and allocations are empty, the
+     * allocations are reported as samples.
+     */
+    AllocationProfile::Node node;
+  };
+
+  /**
+   * Returns the nodes created since the previous report, parents before their
+   * children. Nodes reported earlier keep their ids.
+   */
+  virtual const std::vector<NewNode>& GetNewNodes() = 0;
+
+  /**
+   * Returns the samples allocated since the previous report that are still
+   * live.
+   */
+  virtual const std::vector<AllocationProfile::Sample>& GetAllocatedSamples() =
+      0;
+
+  /**
+   * Returns the sample ids of samples reported earlier whose objects were
+   * freed since the previous report.
+   */
+  virtual const std::vector<uint64_t>& GetFreedSampleIds() = 0;
+
+  virtual ~AllocationProfileDelta() = default;
+};
+
 /**
  * An object graph consisting of embedder objects and V8 objects.
  * Edges of the graph are strong references between the objects.
@@ -968,6 +1120,15 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Returns the samples allocated and the samples freed since the previous
+   * call, without resetting the profile. The first call reports all samples
+   * that are live. Samples allocated and freed between two calls are not
+   * reported. The ownership of the pointer is transferred to the caller.
+   * Returns nullptr if sampling heap profiler is not active.
+   */
+  AllocationProfileDelta* GetAllocationProfileDelta();
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
@@ -67,6 +67,7 @@ class NumberObject;
 class Object;
 class ObjectOperationDescriptor;
 class ObjectTemplate;
+class OutputStream;
 class Platform;
 class Primitive;
 class Promise;
@@ -2343,6 +2344,22 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but writes the result to |stream| as UTF-8 in chunks of
+   * at most stream->GetChunkSize() bytes instead of creating a string, so
+   * that large objects can be serialized without holding the whole result
+   * in memory. EndOfStream is called once the result is complete.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream to write to.
+   * \return Nothing if an exception was thrown, false if |json_object| has
+   *   no JSON representation (e.g. undefined) or the stream aborted, and
+   *   true otherwise.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 /**
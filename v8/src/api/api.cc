@@ -3137,6 +3137,24 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, StringifyToStream, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(isolate, object, replacer, gap_string, stream);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -10771,6 +10789,16 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenHandle(*title)));
 }
 
+bool CpuProfiler::StartContinuousProfiling(
+    CpuProfileWindowSink* sink, ContinuousCpuProfilingOptions options) {
+  return reinterpret_cast<i::CpuProfiler*>(this)->StartContinuousProfiling(
+      sink, options);
+}
+
+void CpuProfiler::StopContinuousProfiling() {
+  reinterpret_cast<i::CpuProfiler*>(this)->StopContinuousProfiling();
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* isolate) {
   reinterpret_cast<i::Isolate*>(isolate)
       ->set_detailed_source_positions_for_profiling(true);
@@ -10958,10 +10986,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11037,6 +11071,10 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+AllocationProfileDelta* HeapProfiler::GetAllocationProfileDelta() {
+  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfileDelta();
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
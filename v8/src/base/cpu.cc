@@ -425,6 +425,7 @@ CPU::CPU()
       is_atom_(false),
       has_osxsave_(false),
       has_avx_(false),
+      has_avx2_(false),
       has_fma3_(false),
       has_bmi1_(false),
       has_bmi2_(false),
@@ -508,6 +509,7 @@ CPU::CPU()
   if (num_ids >= 7) {
     __cpuid(cpu_info, 7);
     has_bmi1_ = (cpu_info[1] & 0x00000008) != 0;
+    has_avx2_ = (cpu_info[1] & 0x00000020) != 0;
     has_bmi2_ = (cpu_info[1] & 0x00000100) != 0;
   }
 
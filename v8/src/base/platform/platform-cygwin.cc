@@ -172,6 +172,9 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
   return VirtualAlloc(address, size, MEM_COMMIT, protect) != nullptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::DiscardSystemPages(void* address, size_t size) {
   // On Windows, discarded pages are not returned to the system immediately and
@@ -129,6 +129,9 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
                          reinterpret_cast<uintptr_t>(address), size) == ZX_OK;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::DiscardSystemPages(void* address, size_t size) {
   // TODO(hpayer): Does Fuchsia have madvise?
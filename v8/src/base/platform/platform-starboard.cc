@@ -490,6 +490,8 @@ void OS::SignalCodeMovingGC() { SB_NOTIMPLEMENTED(); }
 
 void OS::AdjustSchedulingParams() {}
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 bool OS::DiscardSystemPages(void* address, size_t size) {
   // Starboard API does not support this function yet.
   return true;
@@ -300,6 +300,11 @@ class V8_BASE_EXPORT OS {
   V8_WARN_UNUSED_RESULT static bool DiscardSystemPages(void* address,
                                                        size_t size);
 
+  // Advises the OS to back the given range with huge pages, e.g. transparent
+  // huge pages on Linux. Returns false if this is not supported.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
@@ -0,0 +1,30 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-compiler.h"
+
+#include "src/objects/code.h"
+#include "src/objects/shared-function-info.h"
+
+namespace v8 {
+namespace internal {
+
+// The code generators live in the architecture-specific directories.
+#if !V8_TARGET_ARCH_X64
+
+bool BaselineCompiler::CanCompile(SharedFunctionInfo shared,
+                                  BytecodeArray bytecode) {
+  return false;
+}
+
+MaybeHandle<Code> BaselineCompiler::Compile(Isolate* isolate,
+                                            Handle<SharedFunctionInfo> shared,
+                                            Handle<BytecodeArray> bytecode) {
+  UNREACHABLE();
+}
+
+#endif  // !V8_TARGET_ARCH_X64
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,45 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASELINE_BASELINE_COMPILER_H_
+#define V8_BASELINE_BASELINE_COMPILER_H_
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class BytecodeArray;
+class Code;
+class SharedFunctionInfo;
+
+// Compiles a bytecode array to native code in a single pass over the
+// bytecodes, without any analysis or optimization.  Every bytecode is turned
+// into the call of the IC or builtin its bytecode handler would call, or into
+// a few inline instructions for simple ones, which removes the dispatch
+// overhead of the interpreter.  Currently only implemented on x64.
+//
+// Baseline code is stored in the feedback vector and entered by the
+// interpreter entry trampoline once it has set up the interpreter frame.  The
+// code keeps that frame intact: interpreter registers stay in their stack
+// slots and the bytecode offset slot is updated before every call, so stack
+// walks, exception handling and deoptimization treat the frame as an
+// interpreted one.  Bytecodes that are not supported continue in the
+// interpreter for the rest of the invocation, and so does a loop that is
+// armed for on-stack replacement.
+class BaselineCompiler final : public AllStatic {
+ public:
+  // Whether functions with `bytecode` can be compiled on this platform.
+  static bool CanCompile(SharedFunctionInfo shared, BytecodeArray bytecode);
+
+  static MaybeHandle<Code> Compile(Isolate* isolate,
+                                   Handle<SharedFunctionInfo> shared,
+                                   Handle<BytecodeArray> bytecode);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_BASELINE_BASELINE_COMPILER_H_
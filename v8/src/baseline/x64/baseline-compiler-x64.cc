@@ -0,0 +1,838 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if V8_TARGET_ARCH_X64
+
+#include <deque>
+#include <initializer_list>
+#include <vector>
+
+#include "src/baseline/baseline-compiler.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/interface-descriptors.h"
+#include "src/codegen/macro-assembler.h"
+#include "src/execution/frame-constants.h"
+#include "src/heap/factory.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/interpreter/bytecode-flags.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/feedback-cell.h"
+#include "src/objects/feedback-vector.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/tagged-index.h"
+
+namespace v8 {
+namespace internal {
+
+/*
+ * Baseline code is entered by the interpreter entry trampoline after it has
+ * pushed the interpreter frame, and runs in that frame:
+ *
+ *       - receiver and arguments
+ *       - return address
+ * rbp-> - caller's frame pointer
+ *       - context
+ *       - function
+ *       - argument count
+ *       - bytecode array
+ *       - bytecode offset (Smi)
+ *       - interpreter registers
+ *       - arguments pushed for the current call
+ *
+ * The register convention is
+ * - rax : The accumulator.  It is the only value kept in a register between
+ *         bytecodes, everything else is reloaded from the frame.
+ * - rsi : The current context, loaded before calls that take one.
+ * - r13 : The root register.
+ * - rbx, rcx, rdx, rdi, r8, r9, r10, r11 : Scratch and argument registers.
+ *
+ * Most bytecodes are compiled to a call of the builtin or IC that their
+ * bytecode handler calls, with the operands of the bytecode embedded in the
+ * code.  Before each call the offset of the current bytecode is stored in the
+ * frame, so that the frame looks like an interpreter frame that is executing
+ * that bytecode.  Exceptions are therefore handled by the interpreter, which
+ * continues at the handler.  Bytecodes that are not compiled store their
+ * offset in the frame as well and continue in the interpreter through
+ * InterpreterEnterBytecodeDispatch, with the accumulator in rax.
+ */
+
+namespace {
+
+using interpreter::Bytecode;
+using interpreter::BytecodeArrayIterator;
+
+// An argument of a builtin call, which is loaded into the register the call
+// descriptor of the builtin assigns to it.
+class Arg {
+ public:
+  enum Kind {
+    kAccumulator,
+    kInterpreterRegister,
+    kConstant,
+    kSmi,
+    kTaggedIndex,
+    kRaw,
+    kFeedbackVector,
+    kClosureFeedbackCell,
+  };
+
+  static Arg Accumulator() { return Arg(kAccumulator); }
+  static Arg InterpreterRegister(interpreter::Register reg) {
+    Arg arg(kInterpreterRegister);
+    arg.reg_ = reg;
+    return arg;
+  }
+  static Arg Constant(Handle<Object> constant) {
+    Arg arg(kConstant);
+    arg.constant_ = constant;
+    return arg;
+  }
+  static Arg SmiConstant(int value) { return Arg(kSmi, value); }
+  // Feedback slots of ICs are passed as TaggedIndex.
+  static Arg TaggedIndexConstant(int value) { return Arg(kTaggedIndex, value); }
+  // Untagged int32 or intptr value.
+  static Arg RawConstant(int value) { return Arg(kRaw, value); }
+  static Arg FeedbackVector() { return Arg(kFeedbackVector); }
+  static Arg ClosureFeedbackCell(int index) {
+    return Arg(kClosureFeedbackCell, index);
+  }
+
+  Kind kind() const { return kind_; }
+  interpreter::Register reg() const { return reg_; }
+  Handle<Object> constant() const { return constant_; }
+  int value() const { return value_; }
+
+ private:
+  explicit Arg(Kind kind, int value = 0) : kind_(kind), value_(value) {}
+
+  Kind kind_;
+  interpreter::Register reg_;
+  Handle<Object> constant_;
+  int value_;
+};
+
+#define __ masm_->
+
+class CodeGenerator {
+ public:
+  CodeGenerator(Isolate* isolate, MacroAssembler* masm,
+                Handle<BytecodeArray> bytecode)
+      : isolate_(isolate),
+        masm_(masm),
+        bytecode_(bytecode),
+        iterator_(bytecode),
+        labels_(bytecode->length()) {}
+
+  void Generate() {
+    // The frame holds a different bytecode array if the debugger installed a
+    // copy with break points after the code was compiled.
+    __ Cmp(Operand(rbp, InterpreterFrameConstants::kBytecodeArrayFromFp),
+           bytecode_);
+    __ j(not_equal, ExitLabel(0));
+
+    for (; !iterator_.done(); iterator_.Advance()) {
+      __ bind(&labels_[iterator_.current_offset()]);
+      VisitBytecode();
+    }
+
+    for (Exit& exit : exits_) {
+      __ bind(&exit.label);
+      ExitToInterpreter(exit.offset);
+    }
+  }
+
+ private:
+  struct Exit {
+    explicit Exit(int offset) : offset(offset) {}
+    Label label;
+    const int offset;
+  };
+
+  void VisitBytecode();
+  void VisitCall(ConvertReceiverMode receiver_mode,
+                 const std::vector<interpreter::Register>& args,
+                 int slot_operand_index);
+  void VisitCallRange(ConvertReceiverMode receiver_mode);
+  void VisitCallN(ConvertReceiverMode receiver_mode, int register_count);
+  void VisitJumpLoop();
+  void VisitReturn();
+
+  Operand RegisterOperand(interpreter::Register reg) {
+    return Operand(rbp, reg.ToOperand() * kSystemPointerSize);
+  }
+  Operand RegisterOperand(int operand_index) {
+    return RegisterOperand(iterator_.GetRegisterOperand(operand_index));
+  }
+
+  Handle<Object> ConstantOperand(int operand_index) {
+    return iterator_.GetConstantForIndexOperand(operand_index, isolate_);
+  }
+
+  void LoadConstant(Register dst, Handle<Object> value) {
+    if (value->IsSmi()) {
+      __ Move(dst, Smi::cast(*value));
+    } else {
+      __ Move(dst, Handle<HeapObject>::cast(value));
+    }
+  }
+
+  void LoadContext(Register dst) {
+    __ movq(dst, RegisterOperand(interpreter::Register::current_context()));
+  }
+
+  void LoadFeedbackVector(Register dst) {
+    __ movq(dst, RegisterOperand(interpreter::Register::function_closure()));
+    __ LoadTaggedPointerField(
+        dst, FieldOperand(dst, JSFunction::kFeedbackCellOffset));
+    __ LoadTaggedPointerField(dst,
+                              FieldOperand(dst, FeedbackCell::kValueOffset));
+  }
+
+  // Loads the context in `context_reg` walked up by `depth` contexts.
+  void LoadContextChain(Register dst, interpreter::Register context_reg,
+                        uint32_t depth) {
+    __ movq(dst, RegisterOperand(context_reg));
+    for (uint32_t i = 0; i < depth; i++) {
+      __ LoadTaggedPointerField(
+          dst, FieldOperand(dst, Context::OffsetOfElementAt(
+                                     Context::PREVIOUS_INDEX)));
+    }
+  }
+
+  void LoadContextSlot(Register context, int index) {
+    __ LoadAnyTaggedField(
+        rax, FieldOperand(context, Context::OffsetOfElementAt(index)));
+  }
+
+  void StoreContextSlot(Register context, int index) {
+    int offset = Context::OffsetOfElementAt(index);
+    __ StoreTaggedField(FieldOperand(context, offset), rax);
+    // The write barrier clobbers the value register.
+    __ movq(rdx, rax);
+    __ RecordWriteField(context, offset, rdx, r8, kDontSaveFPRegs);
+  }
+
+  void LoadArg(Register dst, const Arg& arg) {
+    switch (arg.kind()) {
+      case Arg::kAccumulator:
+        __ Move(dst, rax);
+        break;
+      case Arg::kInterpreterRegister:
+        __ movq(dst, RegisterOperand(arg.reg()));
+        break;
+      case Arg::kConstant:
+        LoadConstant(dst, arg.constant());
+        break;
+      case Arg::kSmi:
+        __ Move(dst, Smi::FromInt(arg.value()));
+        break;
+      case Arg::kTaggedIndex:
+        __ Set(dst, static_cast<int64_t>(
+                        TaggedIndex::FromIntptr(arg.value()).ptr()));
+        break;
+      case Arg::kRaw:
+        __ Set(dst, arg.value());
+        break;
+      case Arg::kFeedbackVector:
+        LoadFeedbackVector(dst);
+        break;
+      case Arg::kClosureFeedbackCell:
+        LoadFeedbackVector(dst);
+        __ LoadTaggedPointerField(
+            dst, FieldOperand(dst,
+                              FeedbackVector::kClosureFeedbackCellArrayOffset));
+        __ LoadTaggedPointerField(
+            dst, FieldOperand(dst, FixedArray::OffsetOfElementAt(arg.value())));
+        break;
+    }
+  }
+
+  // Calls `builtin` with the register arguments `args` and leaves the result
+  // in the accumulator.
+  void CallBuiltin(Builtins::Name builtin, std::initializer_list<Arg> args) {
+    CallInterfaceDescriptor descriptor =
+        Builtins::CallInterfaceDescriptorFor(builtin);
+    DCHECK_EQ(descriptor.GetRegisterParameterCount(),
+              static_cast<int>(args.size()));
+    DCHECK_EQ(descriptor.GetStackParameterCount(), 0);
+    StoreBytecodeOffset(iterator_.current_offset());
+    // Move the accumulator first, the other arguments don't read rax.
+    int index = 0;
+    for (const Arg& arg : args) {
+      if (arg.kind() == Arg::kAccumulator) {
+        LoadArg(descriptor.GetRegisterParameter(index), arg);
+      }
+      index++;
+    }
+    index = 0;
+    for (const Arg& arg : args) {
+      if (arg.kind() != Arg::kAccumulator) {
+        LoadArg(descriptor.GetRegisterParameter(index), arg);
+      }
+      index++;
+    }
+    if (descriptor.HasContextParameter()) LoadContext(kContextRegister);
+    __ Call(isolate_->builtins()->builtin_handle(builtin),
+            RelocInfo::CODE_TARGET);
+  }
+
+  // Like CallBuiltin, but keeps the accumulator, which stores don't update.
+  void CallBuiltinPreservingAccumulator(Builtins::Name builtin,
+                                        std::initializer_list<Arg> args) {
+    __ Push(rax);
+    CallBuiltin(builtin, args);
+    __ Pop(rax);
+  }
+
+  void CallRuntimePreservingAccumulator(Runtime::FunctionId id,
+                                        std::initializer_list<Arg> args) {
+    StoreBytecodeOffset(iterator_.current_offset());
+    __ Push(rax);
+    for (const Arg& arg : args) {
+      LoadArg(rcx, arg);
+      __ Push(rcx);
+    }
+    LoadContext(kContextRegister);
+    __ CallRuntime(id, static_cast<int>(args.size()));
+    __ Pop(rax);
+  }
+
+  // Sets the accumulator to true if `cc` holds, and to false otherwise.
+  void SelectBoolean(Condition cc) {
+    Label if_false, done;
+    __ j(NegateCondition(cc), &if_false, Label::kNear);
+    __ LoadRoot(rax, RootIndex::kTrueValue);
+    __ jmp(&done, Label::kNear);
+    __ bind(&if_false);
+    __ LoadRoot(rax, RootIndex::kFalseValue);
+    __ bind(&done);
+  }
+
+  void StoreBytecodeOffset(int offset) {
+    __ Move(Operand(rbp, InterpreterFrameConstants::kBytecodeOffsetFromFp),
+            Smi::FromInt(BytecodeArray::kHeaderSize - kHeapObjectTag + offset));
+  }
+
+  // Adds `delta` to the interrupt budget of the function, like the interpreter
+  // does on jumps and returns.  The runtime profiler is called once a
+  // negative delta uses up the budget.
+  void UpdateInterruptBudget(int delta) {
+    __ movq(rcx, RegisterOperand(interpreter::Register::function_closure()));
+    __ LoadTaggedPointerField(
+        rcx, FieldOperand(rcx, JSFunction::kFeedbackCellOffset));
+    Operand budget = FieldOperand(rcx, FeedbackCell::kInterruptBudgetOffset);
+    if (delta >= 0) {
+      if (delta > 0) __ addl(budget, Immediate(delta));
+      return;
+    }
+    Label done;
+    __ subl(budget, Immediate(-delta));
+    __ j(not_sign, &done);
+    CallRuntimePreservingAccumulator(
+        Runtime::kBytecodeBudgetInterruptFromBytecode,
+        {Arg::InterpreterRegister(interpreter::Register::function_closure())});
+    __ bind(&done);
+  }
+
+  // Jumps to the target of the current jump bytecode.
+  void Jump() {
+    int target = iterator_.GetJumpTargetOffset();
+    DCHECK_GT(target, iterator_.current_offset());
+    UpdateInterruptBudget(target - iterator_.current_offset() -
+                          iterator_.current_bytecode_size());
+    __ jmp(&labels_[target]);
+  }
+
+  void JumpIf(Condition cc) {
+    Label done;
+    __ j(NegateCondition(cc), &done);
+    Jump();
+    __ bind(&done);
+  }
+
+  void JumpIfRoot(RootIndex index, bool if_equal) {
+    __ CompareRoot(rax, index);
+    JumpIf(if_equal ? equal : not_equal);
+  }
+
+  void JumpIfToBoolean(bool if_true) {
+    __ Push(rax);
+    CallBuiltin(Builtins::kToBoolean, {Arg::Accumulator()});
+    __ movq(rcx, rax);
+    __ Pop(rax);
+    __ CompareRoot(rcx, RootIndex::kTrueValue);
+    JumpIf(if_true ? equal : not_equal);
+  }
+
+  Label* ExitLabel(int offset) {
+    exits_.emplace_back(offset);
+    return &exits_.back().label;
+  }
+
+  // Continues execution in the interpreter at the bytecode at `offset`.
+  void ExitToInterpreter(int offset) {
+    StoreBytecodeOffset(offset);
+    __ Jump(BUILTIN_CODE(isolate_, InterpreterEnterBytecodeDispatch),
+            RelocInfo::CODE_TARGET);
+  }
+
+  Isolate* const isolate_;
+  MacroAssembler* const masm_;
+  const Handle<BytecodeArray> bytecode_;
+  BytecodeArrayIterator iterator_;
+  // Labels of the bytecodes, indexed by bytecode offset.
+  std::vector<Label> labels_;
+  std::deque<Exit> exits_;
+};
+
+void CodeGenerator::VisitBytecode() {
+  switch (iterator_.current_bytecode()) {
+    case Bytecode::kLdaZero:
+      __ Move(rax, Smi::zero());
+      break;
+    case Bytecode::kLdaSmi:
+      __ Move(rax, Smi::FromInt(iterator_.GetImmediateOperand(0)));
+      break;
+    case Bytecode::kLdaUndefined:
+      __ LoadRoot(rax, RootIndex::kUndefinedValue);
+      break;
+    case Bytecode::kLdaNull:
+      __ LoadRoot(rax, RootIndex::kNullValue);
+      break;
+    case Bytecode::kLdaTheHole:
+      __ LoadRoot(rax, RootIndex::kTheHoleValue);
+      break;
+    case Bytecode::kLdaTrue:
+      __ LoadRoot(rax, RootIndex::kTrueValue);
+      break;
+    case Bytecode::kLdaFalse:
+      __ LoadRoot(rax, RootIndex::kFalseValue);
+      break;
+    case Bytecode::kLdaConstant:
+      LoadConstant(rax, ConstantOperand(0));
+      break;
+    case Bytecode::kLdar:
+      __ movq(rax, RegisterOperand(0));
+      break;
+    case Bytecode::kStar:
+      __ movq(RegisterOperand(0), rax);
+      break;
+    case Bytecode::kMov:
+      __ movq(rcx, RegisterOperand(0));
+      __ movq(RegisterOperand(1), rcx);
+      break;
+
+    case Bytecode::kLdaContextSlot:
+    case Bytecode::kLdaImmutableContextSlot:
+      LoadContextChain(rcx, iterator_.GetRegisterOperand(0),
+                       iterator_.GetUnsignedImmediateOperand(2));
+      LoadContextSlot(rcx, iterator_.GetIndexOperand(1));
+      break;
+    case Bytecode::kLdaCurrentContextSlot:
+    case Bytecode::kLdaImmutableCurrentContextSlot:
+      LoadContext(rcx);
+      LoadContextSlot(rcx, iterator_.GetIndexOperand(0));
+      break;
+    case Bytecode::kStaContextSlot:
+      LoadContextChain(rcx, iterator_.GetRegisterOperand(0),
+                       iterator_.GetUnsignedImmediateOperand(2));
+      StoreContextSlot(rcx, iterator_.GetIndexOperand(1));
+      break;
+    case Bytecode::kStaCurrentContextSlot:
+      LoadContext(rcx);
+      StoreContextSlot(rcx, iterator_.GetIndexOperand(0));
+      break;
+    case Bytecode::kPushContext:
+      LoadContext(rcx);
+      __ movq(RegisterOperand(0), rcx);
+      __ movq(RegisterOperand(interpreter::Register::current_context()), rax);
+      break;
+    case Bytecode::kPopContext:
+      __ movq(rcx, RegisterOperand(0));
+      __ movq(RegisterOperand(interpreter::Register::current_context()), rcx);
+      break;
+
+    case Bytecode::kLdaGlobal:
+    case Bytecode::kLdaGlobalInsideTypeof:
+      CallBuiltin(iterator_.current_bytecode() == Bytecode::kLdaGlobal
+                      ? Builtins::kLoadGlobalIC
+                      : Builtins::kLoadGlobalICInsideTypeof,
+                  {Arg::Constant(ConstantOperand(0)),
+                   Arg::TaggedIndexConstant(iterator_.GetIndexOperand(1)),
+                   Arg::FeedbackVector()});
+      break;
+    case Bytecode::kStaGlobal:
+      CallBuiltinPreservingAccumulator(
+          Builtins::kStoreGlobalIC,
+          {Arg::Constant(ConstantOperand(0)), Arg::Accumulator(),
+           Arg::TaggedIndexConstant(iterator_.GetIndexOperand(1)),
+           Arg::FeedbackVector()});
+      break;
+    case Bytecode::kLdaNamedProperty:
+      CallBuiltin(Builtins::kLoadIC,
+                  {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)),
+                   Arg::Constant(ConstantOperand(1)),
+                   Arg::TaggedIndexConstant(iterator_.GetIndexOperand(2)),
+                   Arg::FeedbackVector()});
+      break;
+    case Bytecode::kLdaKeyedProperty:
+      CallBuiltin(Builtins::kKeyedLoadIC,
+                  {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)),
+                   Arg::Accumulator(),
+                   Arg::TaggedIndexConstant(iterator_.GetIndexOperand(1)),
+                   Arg::FeedbackVector()});
+      break;
+    case Bytecode::kStaNamedProperty:
+      CallBuiltinPreservingAccumulator(
+          Builtins::kStoreIC,
+          {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)),
+           Arg::Constant(ConstantOperand(1)), Arg::Accumulator(),
+           Arg::TaggedIndexConstant(iterator_.GetIndexOperand(2)),
+           Arg::FeedbackVector()});
+      break;
+    case Bytecode::kStaKeyedProperty:
+      CallBuiltinPreservingAccumulator(
+          Builtins::kKeyedStoreIC,
+          {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)),
+           Arg::InterpreterRegister(iterator_.GetRegisterOperand(1)),
+           Arg::Accumulator(),
+           Arg::TaggedIndexConstant(iterator_.GetIndexOperand(2)),
+           Arg::FeedbackVector()});
+      break;
+
+#define BINARY_OP_CASE(Name, Builtin)                                       \
+  case Bytecode::k##Name:                                                   \
+    CallBuiltin(Builtins::k##Builtin##_WithFeedback,                        \
+                {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)), \
+                 Arg::Accumulator(),                                        \
+                 Arg::RawConstant(iterator_.GetIndexOperand(1)),            \
+                 Arg::FeedbackVector()});                                   \
+    break;                                                                  \
+  case Bytecode::k##Name##Smi:                                              \
+    CallBuiltin(Builtins::k##Builtin##_WithFeedback,                        \
+                {Arg::Accumulator(),                                        \
+                 Arg::SmiConstant(iterator_.GetImmediateOperand(0)),        \
+                 Arg::RawConstant(iterator_.GetIndexOperand(1)),            \
+                 Arg::FeedbackVector()});                                   \
+    break;
+      BINARY_OP_CASE(Add, Add)
+      BINARY_OP_CASE(Sub, Subtract)
+      BINARY_OP_CASE(Mul, Multiply)
+      BINARY_OP_CASE(Div, Divide)
+      BINARY_OP_CASE(Mod, Modulus)
+      BINARY_OP_CASE(Exp, Exponentiate)
+      BINARY_OP_CASE(BitwiseOr, BitwiseOr)
+      BINARY_OP_CASE(BitwiseXor, BitwiseXor)
+      BINARY_OP_CASE(BitwiseAnd, BitwiseAnd)
+      BINARY_OP_CASE(ShiftLeft, ShiftLeft)
+      BINARY_OP_CASE(ShiftRight, ShiftRight)
+      BINARY_OP_CASE(ShiftRightLogical, ShiftRightLogical)
+#undef BINARY_OP_CASE
+
+#define COMPARE_OP_CASE(Name, Builtin)                                      \
+  case Bytecode::k##Name:                                                   \
+    CallBuiltin(Builtins::k##Builtin##_WithFeedback,                        \
+                {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)), \
+                 Arg::Accumulator(),                                        \
+                 Arg::RawConstant(iterator_.GetIndexOperand(1)),            \
+                 Arg::FeedbackVector()});                                   \
+    break;
+      COMPARE_OP_CASE(TestEqual, Equal)
+      COMPARE_OP_CASE(TestEqualStrict, StrictEqual)
+      COMPARE_OP_CASE(TestLessThan, LessThan)
+      COMPARE_OP_CASE(TestGreaterThan, GreaterThan)
+      COMPARE_OP_CASE(TestLessThanOrEqual, LessThanOrEqual)
+      COMPARE_OP_CASE(TestGreaterThanOrEqual, GreaterThanOrEqual)
+      COMPARE_OP_CASE(TestInstanceOf, InstanceOf)
+#undef COMPARE_OP_CASE
+
+#define UNARY_OP_CASE(Name, Builtin)                                 \
+  case Bytecode::k##Name:                                            \
+    CallBuiltin(Builtins::k##Builtin##_WithFeedback,                 \
+                {Arg::Accumulator(),                                 \
+                 Arg::RawConstant(iterator_.GetIndexOperand(0)),     \
+                 Arg::FeedbackVector()});                            \
+    break;
+      UNARY_OP_CASE(Inc, Increment)
+      UNARY_OP_CASE(Dec, Decrement)
+      UNARY_OP_CASE(Negate, Negate)
+      UNARY_OP_CASE(BitwiseNot, BitwiseNot)
+#undef UNARY_OP_CASE
+
+    case Bytecode::kTestReferenceEqual:
+      __ cmp_tagged(rax, RegisterOperand(0));
+      SelectBoolean(equal);
+      break;
+    case Bytecode::kTestNull:
+      __ CompareRoot(rax, RootIndex::kNullValue);
+      SelectBoolean(equal);
+      break;
+    case Bytecode::kTestUndefined:
+      __ CompareRoot(rax, RootIndex::kUndefinedValue);
+      SelectBoolean(equal);
+      break;
+    case Bytecode::kLogicalNot:
+      __ CompareRoot(rax, RootIndex::kTrueValue);
+      SelectBoolean(not_equal);
+      break;
+    case Bytecode::kToBooleanLogicalNot:
+      CallBuiltin(Builtins::kToBoolean, {Arg::Accumulator()});
+      __ CompareRoot(rax, RootIndex::kTrueValue);
+      SelectBoolean(not_equal);
+      break;
+    case Bytecode::kTypeOf:
+      CallBuiltin(Builtins::kTypeof, {Arg::Accumulator()});
+      break;
+
+    case Bytecode::kCreateClosure:
+      if (interpreter::CreateClosureFlags::FastNewClosureBit::decode(
+              iterator_.GetFlagOperand(2))) {
+        CallBuiltin(Builtins::kFastNewClosure,
+                    {Arg::Constant(ConstantOperand(0)),
+                     Arg::ClosureFeedbackCell(iterator_.GetIndexOperand(1))});
+      } else {
+        ExitToInterpreter(iterator_.current_offset());
+      }
+      break;
+
+    case Bytecode::kCallAnyReceiver:
+      VisitCallRange(ConvertReceiverMode::kAny);
+      break;
+    case Bytecode::kCallProperty:
+      VisitCallRange(ConvertReceiverMode::kNotNullOrUndefined);
+      break;
+    case Bytecode::kCallProperty0:
+      VisitCallN(ConvertReceiverMode::kNotNullOrUndefined, 1);
+      break;
+    case Bytecode::kCallProperty1:
+      VisitCallN(ConvertReceiverMode::kNotNullOrUndefined, 2);
+      break;
+    case Bytecode::kCallProperty2:
+      VisitCallN(ConvertReceiverMode::kNotNullOrUndefined, 3);
+      break;
+    case Bytecode::kCallUndefinedReceiver:
+      VisitCallRange(ConvertReceiverMode::kNullOrUndefined);
+      break;
+    case Bytecode::kCallUndefinedReceiver0:
+      VisitCallN(ConvertReceiverMode::kNullOrUndefined, 0);
+      break;
+    case Bytecode::kCallUndefinedReceiver1:
+      VisitCallN(ConvertReceiverMode::kNullOrUndefined, 1);
+      break;
+    case Bytecode::kCallUndefinedReceiver2:
+      VisitCallN(ConvertReceiverMode::kNullOrUndefined, 2);
+      break;
+
+    case Bytecode::kJump:
+    case Bytecode::kJumpConstant:
+      Jump();
+      break;
+    case Bytecode::kJumpIfTrue:
+    case Bytecode::kJumpIfTrueConstant:
+      JumpIfRoot(RootIndex::kTrueValue, true);
+      break;
+    case Bytecode::kJumpIfFalse:
+    case Bytecode::kJumpIfFalseConstant:
+      JumpIfRoot(RootIndex::kFalseValue, true);
+      break;
+    case Bytecode::kJumpIfNull:
+    case Bytecode::kJumpIfNullConstant:
+      JumpIfRoot(RootIndex::kNullValue, true);
+      break;
+    case Bytecode::kJumpIfNotNull:
+    case Bytecode::kJumpIfNotNullConstant:
+      JumpIfRoot(RootIndex::kNullValue, false);
+      break;
+    case Bytecode::kJumpIfUndefined:
+    case Bytecode::kJumpIfUndefinedConstant:
+      JumpIfRoot(RootIndex::kUndefinedValue, true);
+      break;
+    case Bytecode::kJumpIfNotUndefined:
+    case Bytecode::kJumpIfNotUndefinedConstant:
+      JumpIfRoot(RootIndex::kUndefinedValue, false);
+      break;
+    case Bytecode::kJumpIfUndefinedOrNull:
+    case Bytecode::kJumpIfUndefinedOrNullConstant: {
+      Label if_undefined_or_null, done;
+      __ JumpIfRoot(rax, RootIndex::kUndefinedValue, &if_undefined_or_null,
+                    Label::kNear);
+      __ JumpIfNotRoot(rax, RootIndex::kNullValue, &done);
+      __ bind(&if_undefined_or_null);
+      Jump();
+      __ bind(&done);
+      break;
+    }
+    case Bytecode::kJumpIfJSReceiver:
+    case Bytecode::kJumpIfJSReceiverConstant: {
+      Label done;
+      __ JumpIfSmi(rax, &done);
+      __ CmpObjectType(rax, FIRST_JS_RECEIVER_TYPE, rcx);
+      JumpIf(above_equal);
+      __ bind(&done);
+      break;
+    }
+    case Bytecode::kJumpIfToBooleanTrue:
+    case Bytecode::kJumpIfToBooleanTrueConstant:
+      JumpIfToBoolean(true);
+      break;
+    case Bytecode::kJumpIfToBooleanFalse:
+    case Bytecode::kJumpIfToBooleanFalseConstant:
+      JumpIfToBoolean(false);
+      break;
+    case Bytecode::kJumpLoop:
+      VisitJumpLoop();
+      break;
+    case Bytecode::kReturn:
+      VisitReturn();
+      break;
+
+    default:
+      ExitToInterpreter(iterator_.current_offset());
+      break;
+  }
+}
+
+void CodeGenerator::VisitCall(ConvertReceiverMode receiver_mode,
+                              const std::vector<interpreter::Register>& args,
+                              int slot_operand_index) {
+  bool implicit_receiver =
+      receiver_mode == ConvertReceiverMode::kNullOrUndefined;
+  int pushed_count =
+      static_cast<int>(args.size()) + (implicit_receiver ? 1 : 0);
+  __ Set(rcx, pushed_count);
+  __ StackOverflowCheck(rcx, rdx, ExitLabel(iterator_.current_offset()));
+
+  // The receiver ends up on top of the stack, followed by the arguments.
+  for (auto it = args.rbegin(); it != args.rend(); ++it) {
+    __ Push(RegisterOperand(*it));
+  }
+  if (implicit_receiver) __ PushRoot(RootIndex::kUndefinedValue);
+
+  Builtins::Name builtin;
+  switch (receiver_mode) {
+    case ConvertReceiverMode::kNullOrUndefined:
+      builtin = Builtins::kCall_ReceiverIsNullOrUndefined_WithFeedback;
+      break;
+    case ConvertReceiverMode::kNotNullOrUndefined:
+      builtin = Builtins::kCall_ReceiverIsNotNullOrUndefined_WithFeedback;
+      break;
+    case ConvertReceiverMode::kAny:
+      builtin = Builtins::kCall_ReceiverIsAny_WithFeedback;
+      break;
+  }
+  // The callee drops the receiver and the arguments.
+  CallBuiltin(builtin,
+              {Arg::InterpreterRegister(iterator_.GetRegisterOperand(0)),
+               Arg::RawConstant(pushed_count - 1),
+               Arg::RawConstant(iterator_.GetIndexOperand(slot_operand_index)),
+               Arg::FeedbackVector()});
+}
+
+void CodeGenerator::VisitCallRange(ConvertReceiverMode receiver_mode) {
+  interpreter::Register first = iterator_.GetRegisterOperand(1);
+  uint32_t count = iterator_.GetRegisterCountOperand(2);
+  std::vector<interpreter::Register> args;
+  for (uint32_t i = 0; i < count; i++) {
+    args.push_back(interpreter::Register(first.index() + i));
+  }
+  VisitCall(receiver_mode, args, 3);
+}
+
+void CodeGenerator::VisitCallN(ConvertReceiverMode receiver_mode,
+                               int register_count) {
+  std::vector<interpreter::Register> args;
+  for (int i = 0; i < register_count; i++) {
+    args.push_back(iterator_.GetRegisterOperand(1 + i));
+  }
+  VisitCall(receiver_mode, args, 1 + register_count);
+}
+
+void CodeGenerator::VisitJumpLoop() {
+  int offset = iterator_.current_offset();
+  int target = iterator_.GetJumpTargetOffset();
+  DCHECK_LE(target, offset);
+
+  // Interrupts are handled by the stack guard, like in the interpreter.
+  Label stack_check_done;
+  __ cmpq(rsp, __ StackLimitAsOperand(StackLimitKind::kInterruptStackLimit));
+  __ j(above_equal, &stack_check_done);
+  CallRuntimePreservingAccumulator(Runtime::kStackGuard, {});
+  __ bind(&stack_check_done);
+
+  // Let the interpreter perform on-stack replacement if the loop is armed for
+  // it, or continue if the debugger replaced the bytecode array.
+  __ movq(rcx, Operand(rbp, InterpreterFrameConstants::kBytecodeArrayFromFp));
+  __ Cmp(rcx, bytecode_);
+  __ j(not_equal, ExitLabel(offset));
+  __ cmpb(FieldOperand(rcx, BytecodeArray::kOsrNestingLevelOffset),
+          Immediate(iterator_.GetImmediateOperand(1)));
+  __ j(greater, ExitLabel(offset));
+
+  UpdateInterruptBudget(-(offset - target + iterator_.current_bytecode_size()));
+  __ jmp(&labels_[target]);
+}
+
+void CodeGenerator::VisitReturn() {
+  // Simulate a back edge to the start of the function.
+  UpdateInterruptBudget(
+      -(iterator_.current_offset() + iterator_.current_bytecode_size()));
+
+  // Leave the frame like the interpreter entry trampoline does.
+  int params_size = bytecode_->parameter_count() * kSystemPointerSize;
+#ifdef V8_NO_ARGUMENTS_ADAPTOR
+  // Drop the actual arguments if there are more than formal parameters.
+  Label corrected_args_count;
+  __ movq(rcx, Operand(rbp, StandardFrameConstants::kArgCOffset));
+  __ leaq(rcx, Operand(rcx, times_system_pointer_size, kSystemPointerSize));
+  __ cmpq(rcx, Immediate(params_size));
+  __ j(greater_equal, &corrected_args_count, Label::kNear);
+  __ Set(rcx, params_size);
+  __ bind(&corrected_args_count);
+  __ leave();
+  __ PopReturnAddressTo(rbx);
+  __ addq(rsp, rcx);
+  __ PushReturnAddressFrom(rbx);
+  __ ret(0);
+#else
+  __ leave();
+  __ Ret(params_size, rcx);
+#endif
+}
+
+#undef __
+
+}  // namespace
+
+bool BaselineCompiler::CanCompile(SharedFunctionInfo shared,
+                                  BytecodeArray bytecode) {
+  // Generators and async functions are suspended and resumed by bytecodes
+  // that only the interpreter implements.
+  return !IsResumableFunction(shared.kind());
+}
+
+MaybeHandle<Code> BaselineCompiler::Compile(Isolate* isolate,
+                                            Handle<SharedFunctionInfo> shared,
+                                            Handle<BytecodeArray> bytecode) {
+  DCHECK(CanCompile(*shared, *bytecode));
+
+  MacroAssembler masm(isolate, CodeObjectRequired::kNo,
+                      NewAssemblerBuffer(AssemblerBase::kDefaultBufferSize));
+  {
+    // The code runs in the frame of the interpreter entry trampoline.
+    FrameScope scope(&masm, StackFrame::MANUAL);
+    CodeGenerator generator(isolate, &masm, bytecode);
+    generator.Generate();
+  }
+
+  CodeDesc code_desc;
+  masm.GetCode(isolate, &code_desc);
+  return Factory::CodeBuilder(isolate, code_desc, CodeKind::BASELINE)
+      .TryBuild();
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_X64
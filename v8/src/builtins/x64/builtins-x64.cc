@@ -1163,6 +1163,23 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
 
   // The accumulator is already loaded with undefined.
 
+  // Run baseline code in the frame if the function has any.
+  Label no_baseline_code;
+  __ movq(rcx, Operand(rbp, StandardFrameConstants::kFunctionOffset));
+  __ LoadTaggedPointerField(
+      rcx, FieldOperand(rcx, JSFunction::kFeedbackCellOffset));
+  __ LoadTaggedPointerField(rcx, FieldOperand(rcx, Cell::kValueOffset));
+  __ LoadTaggedPointerField(r11, FieldOperand(rcx, HeapObject::kMapOffset));
+  __ CmpInstanceType(r11, FEEDBACK_VECTOR_TYPE);
+  __ j(not_equal, &no_baseline_code, Label::kNear);
+  __ LoadTaggedPointerField(
+      rcx, FieldOperand(rcx, FeedbackVector::kBaselineCodeOffset));
+  __ JumpIfRoot(rcx, RootIndex::kUndefinedValue, &no_baseline_code,
+                Label::kNear);
+  __ LoadCodeObjectEntry(rcx, rcx);
+  __ jmp(rcx);
+  __ bind(&no_baseline_code);
+
   // Load the dispatch table into a register and dispatch to the bytecode
   // handler at the current bytecode offset.
   Label do_dispatch;
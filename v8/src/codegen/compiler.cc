@@ -13,6 +13,8 @@
 #include "src/ast/scopes.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
+#include "src/baseline/baseline-compiler.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -38,8 +40,10 @@
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/tracing-flags.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/objects/map.h"
@@ -695,6 +699,50 @@ bool RecursivelyExecuteUnoptimizedCompilationJobs(
   return true;
 }
 
+// Finalizes |job| and, if it cannot be finalized off-thread, queues it up to
+// be retried on the main thread. Returns false if finalization failed.
+template <typename LocalIsolate>
+bool FinalizeOrDeferUnoptimizedCompilationJob(
+    LocalIsolate* isolate, std::unique_ptr<UnoptimizedCompilationJob> job,
+    Handle<SharedFunctionInfo> shared_info,
+    Handle<SharedFunctionInfo> outer_shared_info,
+    IsCompiledScope* is_compiled_scope,
+    FinalizeUnoptimizedCompilationDataList*
+        finalize_unoptimized_compilation_data_list,
+    DeferredFinalizationJobDataList*
+        jobs_to_retry_finalization_on_main_thread) {
+  auto finalization_status = FinalizeSingleUnoptimizedCompilationJob(
+      job.get(), shared_info, isolate,
+      finalize_unoptimized_compilation_data_list);
+
+  switch (finalization_status) {
+    case CompilationJob::SUCCEEDED:
+      if (shared_info.is_identical_to(outer_shared_info)) {
+        // Ensure that the top level function is retained.
+        *is_compiled_scope = shared_info->is_compiled_scope(isolate);
+        DCHECK(is_compiled_scope->is_compiled());
+      }
+      break;
+
+    case CompilationJob::FAILED:
+      return false;
+
+    case CompilationJob::RETRY_ON_MAIN_THREAD:
+      // This should not happen on the main thread.
+      DCHECK((!std::is_same<LocalIsolate, Isolate>::value));
+      DCHECK_NOT_NULL(jobs_to_retry_finalization_on_main_thread);
+
+      // Clear the literal and ParseInfo to prevent further attempts to access
+      // them.
+      job->compilation_info()->ClearLiteral();
+      job->ClearParseInfo();
+      jobs_to_retry_finalization_on_main_thread->emplace_back(
+          isolate, shared_info, std::move(job));
+      break;
+  }
+  return true;
+}
+
 template <typename LocalIsolate>
 bool IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
     LocalIsolate* isolate, Handle<SharedFunctionInfo> outer_shared_info,
@@ -723,34 +771,166 @@ bool IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
 
     UpdateSharedFunctionFlagsAfterCompilation(literal, *shared_info);
 
-    auto finalization_status = FinalizeSingleUnoptimizedCompilationJob(
-        job.get(), shared_info, isolate,
-        finalize_unoptimized_compilation_data_list);
+    if (!FinalizeOrDeferUnoptimizedCompilationJob(
+            isolate, std::move(job), shared_info, outer_shared_info,
+            is_compiled_scope, finalize_unoptimized_compilation_data_list,
+            jobs_to_retry_finalization_on_main_thread)) {
+      return false;
+    }
+  }
+
+  // Report any warnings generated during compilation.
+  if (parse_info->pending_error_handler()->has_pending_warnings()) {
+    parse_info->pending_error_handler()->PrepareWarnings(isolate);
+  }
 
-    switch (finalization_status) {
-      case CompilationJob::SUCCEEDED:
-        if (shared_info.is_identical_to(outer_shared_info)) {
-          // Ensure that the top level function is retained.
-          *is_compiled_scope = shared_info->is_compiled_scope(isolate);
-          DCHECK(is_compiled_scope->is_compiled());
+  return true;
+}
+
+// Executes the compilation jobs of the eager inner functions of a script,
+// e.g. IIFEs, on worker threads. Executing a job doesn't access the heap, and
+// only modifies the AST nodes of the function it compiles, so every function
+// is compiled by exactly one job. Each Run() gets its own ParseInfo, with its
+// own compile state and stack limit, rather than sharing the script's. The
+// executed jobs are finalized afterwards by the thread owning the
+// LocalIsolate. asm.js modules are handed back to that thread as well, since
+// their validation uses the script's character stream.
+class EagerInnerFunctionsCompileJob final : public JobTask {
+ public:
+  struct Results {
+    // The ParseInfos of the jobs must outlive them, until they are finalized.
+    std::vector<std::unique_ptr<UnoptimizedCompileState>> compile_states;
+    std::vector<std::unique_ptr<ParseInfo>> parse_infos;
+    UnoptimizedCompilationJobList jobs;
+    std::vector<FunctionLiteral*> asm_wasm_literals;
+    bool failed = false;
+  };
+
+  EagerInnerFunctionsCompileJob(ParseInfo* parse_info,
+                                AccountingAllocator* allocator,
+                                std::vector<FunctionLiteral*> literals,
+                                Results* results)
+      : parse_info_(parse_info),
+        allocator_(allocator),
+        pending_literals_(std::move(literals)),
+        results_(results) {}
+
+  void Run(JobDelegate* delegate) override {
+    ParseInfo* parse_info = nullptr;
+    while (!delegate->ShouldYield()) {
+      FunctionLiteral* literal;
+      {
+        base::MutexGuard guard(&mutex_);
+        if (pending_literals_.empty() || results_->failed) return;
+        literal = pending_literals_.back();
+        pending_literals_.pop_back();
+        if (UseAsmWasm(literal, parse_info_->flags().is_asm_wasm_broken())) {
+          results_->asm_wasm_literals.push_back(literal);
+          continue;
         }
-        break;
+        if (parse_info == nullptr) parse_info = NewParseInfo(delegate);
+      }
+
+      std::vector<FunctionLiteral*> eager_inner_literals;
+      std::unique_ptr<UnoptimizedCompilationJob> job =
+          interpreter::Interpreter::NewCompilationJob(
+              parse_info, literal, allocator_, &eager_inner_literals);
+      bool succeeded = job->ExecuteJob() == CompilationJob::SUCCEEDED;
+
+      {
+        base::MutexGuard guard(&mutex_);
+        if (!succeeded) {
+          results_->failed = true;
+          return;
+        }
+        results_->jobs.emplace_front(std::move(job));
+        pending_literals_.insert(pending_literals_.end(),
+                                 eager_inner_literals.begin(),
+                                 eager_inner_literals.end());
+      }
+      if (!eager_inner_literals.empty()) delegate->NotifyConcurrencyIncrease();
+    }
+  }
 
-      case CompilationJob::FAILED:
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    base::MutexGuard guard(&mutex_);
+    if (results_->failed) return 0;
+    return pending_literals_.size() + worker_count;
+  }
+
+ private:
+  // Creates the ParseInfo for the jobs executed by this Run(). Must be called
+  // with |mutex_| held.
+  ParseInfo* NewParseInfo(JobDelegate* delegate) {
+    // The joining thread is the one that parsed, so it can keep using the
+    // script's stack limit.
+    const uintptr_t stack_limit =
+        delegate->IsJoiningThread()
+            ? parse_info_->stack_limit()
+            : GetCurrentStackPosition() - FLAG_stack_size * KB;
+    results_->compile_states.push_back(
+        std::make_unique<UnoptimizedCompileState>(*parse_info_->state()));
+    results_->parse_infos.push_back(ParseInfo::ForEagerInnerFunctions(
+        parse_info_, results_->compile_states.back().get(), stack_limit));
+    return results_->parse_infos.back().get();
+  }
+
+  ParseInfo* const parse_info_;
+  AccountingAllocator* const allocator_;
+  mutable base::Mutex mutex_;
+  std::vector<FunctionLiteral*> pending_literals_;
+  Results* const results_;
+};
+
+// Like IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs, but executes
+// the jobs of the eager inner functions in parallel before finalizing them all
+// on this thread. See --parallel-streaming-compile.
+bool ParallelExecuteAndFinalizeUnoptimizedCompilationJobs(
+    LocalIsolate* isolate, Handle<SharedFunctionInfo> outer_shared_info,
+    Handle<Script> script, ParseInfo* parse_info,
+    AccountingAllocator* allocator, IsCompiledScope* is_compiled_scope,
+    FinalizeUnoptimizedCompilationDataList*
+        finalize_unoptimized_compilation_data_list,
+    DeferredFinalizationJobDataList*
+        jobs_to_retry_finalization_on_main_thread) {
+  DeclarationScope::AllocateScopeInfos(parse_info, isolate);
+
+  // Compiling the top-level function discovers the functions to fan out.
+  std::vector<FunctionLiteral*> eager_inner_literals;
+  std::unique_ptr<UnoptimizedCompilationJob> outer_job =
+      ExecuteSingleUnoptimizedCompilationJob(parse_info, parse_info->literal(),
+                                             allocator, &eager_inner_literals);
+  if (!outer_job) return false;
+
+  EagerInnerFunctionsCompileJob::Results results;
+  if (!eager_inner_literals.empty()) {
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserVisible,
+                  std::make_unique<EagerInnerFunctionsCompileJob>(
+                      parse_info, allocator, std::move(eager_inner_literals),
+                      &results))
+        ->Join();
+    if (results.failed) return false;
+    for (FunctionLiteral* literal : results.asm_wasm_literals) {
+      if (!RecursivelyExecuteUnoptimizedCompilationJobs(
+              parse_info, literal, allocator, &results.jobs)) {
         return false;
+      }
+    }
+  }
+  results.jobs.emplace_front(std::move(outer_job));
 
-      case CompilationJob::RETRY_ON_MAIN_THREAD:
-        // This should not happen on the main thread.
-        DCHECK((!std::is_same<LocalIsolate, Isolate>::value));
-        DCHECK_NOT_NULL(jobs_to_retry_finalization_on_main_thread);
-
-        // Clear the literal and ParseInfo to prevent further attempts to access
-        // them.
-        job->compilation_info()->ClearLiteral();
-        job->ClearParseInfo();
-        jobs_to_retry_finalization_on_main_thread->emplace_back(
-            isolate, shared_info, std::move(job));
-        break;
+  for (auto& job : results.jobs) {
+    FunctionLiteral* literal = job->compilation_info()->literal();
+    Handle<SharedFunctionInfo> shared_info =
+        Compiler::GetSharedFunctionInfo(literal, script, isolate);
+    if (shared_info->is_compiled()) continue;
+    UpdateSharedFunctionFlagsAfterCompilation(literal, *shared_info);
+    if (!FinalizeOrDeferUnoptimizedCompilationJob(
+            isolate, std::move(job), shared_info, outer_shared_info,
+            is_compiled_scope, finalize_unoptimized_compilation_data_list,
+            jobs_to_retry_finalization_on_main_thread)) {
+      return false;
     }
   }
 
@@ -983,7 +1163,8 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
                            Isolate* isolate,
                            OptimizedCompilationInfo* compilation_info,
                            CodeKind code_kind, Handle<JSFunction> function) {
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable(
+          compilation_info)) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -1378,12 +1559,22 @@ MaybeHandle<SharedFunctionInfo> CompileAndFinalizeOnBackgroundThread(
   Handle<SharedFunctionInfo> shared_info =
       CreateTopLevelSharedFunctionInfo(parse_info, script, isolate);
 
-  if (!IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
-          isolate, shared_info, script, parse_info, allocator,
-          is_compiled_scope, finalize_unoptimized_compilation_data_list,
-          jobs_to_retry_finalization_on_main_thread)) {
-    return kNullMaybeHandle;
+  // The worker threads can't record runtime call stats into the ParseInfo's
+  // thread-specific table, so stay on this thread when they are enabled.
+  bool success;
+  if (FLAG_parallel_streaming_compile &&
+      !TracingFlags::is_runtime_stats_enabled()) {
+    success = ParallelExecuteAndFinalizeUnoptimizedCompilationJobs(
+        isolate, shared_info, script, parse_info, allocator, is_compiled_scope,
+        finalize_unoptimized_compilation_data_list,
+        jobs_to_retry_finalization_on_main_thread);
+  } else {
+    success = IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
+        isolate, shared_info, script, parse_info, allocator,
+        is_compiled_scope, finalize_unoptimized_compilation_data_list,
+        jobs_to_retry_finalization_on_main_thread);
   }
+  if (!success) return kNullMaybeHandle;
 
   // Character stream shouldn't be used again.
   parse_info->ResetCharacterStream();
@@ -1950,6 +2141,43 @@ bool Compiler::CompileOptimized(Handle<JSFunction> function,
   return true;
 }
 
+// static
+bool Compiler::CompileBaseline(Isolate* isolate, Handle<JSFunction> function) {
+  if (!FLAG_baseline_jit || !function->has_feedback_vector()) return false;
+  Handle<FeedbackVector> feedback_vector(function->feedback_vector(), isolate);
+  if (feedback_vector->has_baseline_code()) return true;
+
+  // Break points are set in a copy of the bytecode array, which baseline code
+  // would not see.
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+  if (isolate->debug()->is_active() || shared->HasBreakInfo()) return false;
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(), isolate);
+  if (!BaselineCompiler::CanCompile(*shared, *bytecode)) return false;
+
+  base::ElapsedTimer timer;
+  timer.Start();
+  Handle<Code> code;
+  if (!BaselineCompiler::Compile(isolate, shared, bytecode).ToHandle(&code)) {
+    return false;
+  }
+  double time_taken_ms = timer.Elapsed().InMillisecondsF();
+
+  Handle<Script> script(Script::cast(shared->script()), isolate);
+  LogFunctionCompilation(CodeEventListener::FUNCTION_TAG, shared, script,
+                         Handle<AbstractCode>::cast(code), false,
+                         time_taken_ms, isolate);
+  if (FLAG_trace_baseline_jit) {
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[compiled baseline code for ");
+    function->ShortPrint(scope.file());
+    PrintF(scope.file(),
+           " (%d bytes of bytecode, %d bytes of code) took %0.3f ms]\n",
+           bytecode->length(), code->InstructionSize(), time_taken_ms);
+  }
+  feedback_vector->set_baseline_code(*code);
+  return true;
+}
+
 // static
 MaybeHandle<SharedFunctionInfo> Compiler::CompileForLiveEdit(
     ParseInfo* parse_info, Handle<Script> script, Isolate* isolate) {
@@ -73,6 +73,11 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool CompileOptimized(Handle<JSFunction> function,
                                ConcurrencyMode mode, CodeKind code_kind);
 
+  // Compiles baseline code for a function that has a feedback vector and
+  // stores it in the vector, see --baseline-jit. Returns {false} if the
+  // function can't be compiled, which is not an error.
+  static bool CompileBaseline(Isolate* isolate, Handle<JSFunction> function);
+
   // Collect source positions for a function that has already been compiled to
   // bytecode, but for which source positions were not collected (e.g. because
   // they were not immediately needed).
@@ -28,6 +28,7 @@
 #include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-interpreter.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
+#include "src/regexp/regexp-prefilter.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/strings/string-search.h"
 #include "src/wasm/wasm-external-refs.h"
@@ -530,6 +531,9 @@ FUNCTION_REFERENCE(re_match_for_call_from_js,
 FUNCTION_REFERENCE(re_experimental_match_for_call_from_js,
                    ExperimentalRegExp::MatchForCallFromJs)
 
+FUNCTION_REFERENCE(re_prefilter_find_candidate,
+                   RegExpPrefilter::FindCandidate)
+
 FUNCTION_REFERENCE_WITH_ISOLATE(
     re_case_insensitive_compare_unicode,
     NativeRegExpMacroAssembler::CaseInsensitiveCompareUnicode)
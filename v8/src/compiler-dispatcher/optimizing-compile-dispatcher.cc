@@ -104,32 +104,61 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
     DCHECK_EQ(0, ref_count_);
   }
 #endif
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
 }
 
-OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
+// static
+OptimizingCompileDispatcher::Hotness OptimizingCompileDispatcher::HotnessOf(
+    OptimizedCompilationInfo* info) {
+  JSFunction function = *info->closure();
+  int invocation_count = function.has_feedback_vector()
+                             ? function.feedback_vector().invocation_count()
+                             : 0;
+  return {info->is_osr(), invocation_count};
+}
+
+size_t OptimizingCompileDispatcher::ColdestInput() const {
+  DCHECK(!input_queue_.empty());
+  size_t coldest = 0;
+  for (size_t i = 1; i < input_queue_.size(); i++) {
+    // Among jobs of equal hotness, prefer displacing the youngest one.
+    if (!input_queue_[i].hotness.IsHotterThan(input_queue_[coldest].hotness)) {
+      coldest = i;
+    }
+  }
+  return coldest;
+}
+
+OptimizingCompileDispatcher::QueuedJob OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate, bool check_if_flushing) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-  DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  if (input_queue_.empty()) return {};
+  // The queue is short, so a linear scan is cheaper than keeping a heap.
+  auto hottest = input_queue_.begin();
+  for (auto it = hottest + 1; it != input_queue_.end(); ++it) {
+    if (it->hotness.IsHotterThan(hottest->hotness)) hottest = it;
+  }
+  QueuedJob next = *hottest;
+  DCHECK_NOT_NULL(next.job);
+  input_queue_.erase(hottest);
   if (check_if_flushing) {
     if (mode_ == FLUSH) {
       UnparkedScope scope(local_isolate->heap());
       AllowHandleDereference allow_handle_dereference;
-      DisposeCompilationJob(job, true);
-      return nullptr;
+      DisposeCompilationJob(next.job, true);
+      return {};
     }
   }
-  return job;
+  next.queue_latency = base::TimeTicks::Now() - next.queued_at;
+  isolate_->counters()->turbofan_optimize_queue_latency()->AddSample(
+      static_cast<int>(next.queue_latency.InMicroseconds()));
+  return next;
 }
 
-void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
+void OptimizingCompileDispatcher::CompileNext(QueuedJob next,
                                               RuntimeCallStats* stats,
                                               LocalIsolate* local_isolate) {
+  OptimizedCompilationJob* job = next.job;
   if (!job) return;
 
   // The function may have already been optimized by OSR.  Simply continue.
@@ -141,7 +170,8 @@ void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
     // Use a mutex to make sure that functions marked for install
     // are always also queued.
     base::MutexGuard access_output_queue_(&output_queue_mutex_);
-    output_queue_.push(job);
+    next.queued_at = base::TimeTicks::Now();
+    output_queue_.push(next);
   }
 
   isolate_->stack_guard()->RequestInstallCode();
@@ -153,7 +183,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
     {
       base::MutexGuard access_output_queue_(&output_queue_mutex_);
       if (output_queue_.empty()) return;
-      job = output_queue_.front();
+      job = output_queue_.front().job;
       output_queue_.pop();
     }
 
@@ -165,13 +195,10 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
     base::MutexGuard access_input_queue_(&input_queue_mutex_);
-    while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-      DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
-      DisposeCompilationJob(job, true);
+    for (const QueuedJob& queued : input_queue_) {
+      DisposeCompilationJob(queued.job, true);
     }
+    input_queue_.clear();
     FlushOutputQueue(true);
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Flushed concurrent recompilation queues (not blocking).\n");
@@ -201,8 +228,8 @@ void OptimizingCompileDispatcher::Stop() {
   }
 
   // At this point the optimizing compiler thread's event loop has stopped.
-  // There is no need for a mutex when reading input_queue_length_.
-  DCHECK_EQ(input_queue_length_, 0);
+  // There is no need for a mutex when reading input_queue_.
+  DCHECK(input_queue_.empty());
   FlushOutputQueue(false);
 }
 
@@ -210,15 +237,26 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
 
   for (;;) {
-    OptimizedCompilationJob* job = nullptr;
+    QueuedJob next;
     {
       base::MutexGuard access_output_queue_(&output_queue_mutex_);
       if (output_queue_.empty()) return;
-      job = output_queue_.front();
+      next = output_queue_.front();
       output_queue_.pop();
     }
+    OptimizedCompilationJob* job = next.job;
     OptimizedCompilationInfo* info = job->compilation_info();
     Handle<JSFunction> function(*info->closure(), isolate_);
+    base::TimeDelta install_latency = base::TimeTicks::Now() - next.queued_at;
+    isolate_->counters()->turbofan_optimize_install_latency()->AddSample(
+        static_cast<int>(install_latency.InMicroseconds()));
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Compiled ");
+      function->ShortPrint();
+      PrintF(" after %.3f ms in the input queue, installing after %.3f ms.\n",
+             next.queue_latency.InMillisecondsF(),
+             install_latency.InMillisecondsF());
+    }
     if (function->HasAvailableCodeKind(info->code_kind())) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
@@ -232,15 +270,45 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+bool OptimizingCompileDispatcher::IsQueueAvailable(
+    OptimizedCompilationInfo* info) {
+  Hotness hotness = HotnessOf(info);
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  if (input_queue_.size() < input_queue_capacity_) return true;
+  if (input_queue_.empty()) return false;
+  return hotness.IsHotterThan(input_queue_[ColdestInput()].hotness);
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
-  DCHECK(IsQueueAvailable());
+  DCHECK(IsQueueAvailable(job->compilation_info()));
+  QueuedJob queued = {job, HotnessOf(job->compilation_info()),
+                      base::TimeTicks::Now(), base::TimeDelta()};
+  OptimizedCompilationJob* displaced = nullptr;
   {
-    // Add job to the back of the input queue.
+    // Add job to the back of the input queue. If the queue is full, the
+    // coldest waiting job makes room; worker threads only ever remove jobs,
+    // so it is still colder than {job}.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    if (input_queue_.size() == input_queue_capacity_) {
+      auto coldest = input_queue_.begin() + ColdestInput();
+      DCHECK(queued.hotness.IsHotterThan(coldest->hotness));
+      displaced = coldest->job;
+      input_queue_.erase(coldest);
+    }
+    DCHECK_LT(input_queue_.size(), input_queue_capacity_);
+    input_queue_.push_back(queued);
+  }
+  if (displaced != nullptr) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Compilation queue full, displacing ");
+      displaced->compilation_info()->closure()->ShortPrint();
+      PrintF(" in favor of ");
+      job->compilation_info()->closure()->ShortPrint();
+      PrintF(".\n");
+    }
+    // The displaced job's task will find one job less in the queue.
+    DisposeCompilationJob(displaced, true);
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
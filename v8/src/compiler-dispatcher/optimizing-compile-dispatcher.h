@@ -7,10 +7,12 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
@@ -19,6 +21,7 @@ namespace v8 {
 namespace internal {
 
 class LocalHeap;
+class OptimizedCompilationInfo;
 class OptimizedCompilationJob;
 class RuntimeCallStats;
 class SharedFunctionInfo;
@@ -28,13 +31,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   explicit OptimizingCompileDispatcher(Isolate* isolate)
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_.reserve(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -46,11 +47,16 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void Unblock();
   void InstallOptimizedFunctions();
 
+  // Whether a job can be queued without displacing another one.
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return input_queue_.size() < input_queue_capacity_;
   }
 
+  // Whether the job for {info} can be queued, either into a free slot or by
+  // displacing a colder job that has not started compiling yet.
+  bool IsQueueAvailable(OptimizedCompilationInfo* info);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
@@ -58,30 +64,54 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  // Jobs waiting for a worker thread are ordered by the hotness of their
+  // function, computed on the main thread when they are queued: OSR jobs
+  // come first since their function is stuck in a loop until the optimized
+  // code arrives, then jobs for functions with more invocations. Jobs of
+  // equal hotness are compiled in FIFO order.
+  struct Hotness {
+    bool is_osr;
+    int invocation_count;
+
+    bool IsHotterThan(const Hotness& other) const {
+      if (is_osr != other.is_osr) return is_osr;
+      return invocation_count > other.invocation_count;
+    }
+  };
+
+  struct QueuedJob {
+    OptimizedCompilationJob* job;
+    Hotness hotness;
+    // When the job entered its current queue.
+    base::TimeTicks queued_at;
+    // How long the job waited in the input queue.
+    base::TimeDelta queue_latency;
+  };
+
+  static Hotness HotnessOf(OptimizedCompilationInfo* info);
+
   void FlushOutputQueue(bool restore_function_code);
-  void CompileNext(OptimizedCompilationJob* job, RuntimeCallStats* stats,
+  void CompileNext(QueuedJob next, RuntimeCallStats* stats,
                    LocalIsolate* local_isolate);
-  OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate,
-                                     bool check_if_flushing = false);
-
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  QueuedJob NextInput(LocalIsolate* local_isolate,
+                      bool check_if_flushing = false);
+
+  // Index of the coldest job in the input queue. The input queue mutex must
+  // be held.
+  size_t ColdestInput() const;
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
-  int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
+  // Incoming recompilation jobs (including OSR), in the order they were
+  // queued. Worker threads always take the hottest one, so that hot
+  // functions do not wait behind cold ones if there are more jobs than
+  // worker threads.
+  std::vector<QueuedJob> input_queue_;
+  size_t input_queue_capacity_;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
-  std::queue<OptimizedCompilationJob*> output_queue_;
+  std::queue<QueuedJob> output_queue_;
   // Used for job based recompilation which has multiple producers on
   // different threads.
   base::Mutex output_queue_mutex_;
@@ -3913,6 +3913,14 @@ void BytecodeGraphBuilder::VisitIllegal() {
   UNREACHABLE();
 }
 
+#define DEFINE_VISIT_SUPERINSTRUCTION(Name, ...) \
+  void BytecodeGraphBuilder::Visit##Name() {     \
+    /* Unfused by the BytecodeArrayIterator. */  \
+    UNREACHABLE();                               \
+  }
+SUPERINSTRUCTION_LIST(DEFINE_VISIT_SUPERINSTRUCTION)
+#undef DEFINE_VISIT_SUPERINSTRUCTION
+
 void BytecodeGraphBuilder::SwitchToMergeEnvironment(int current_offset) {
   auto it = merge_environments_.find(current_offset);
   if (it != merge_environments_.end()) {
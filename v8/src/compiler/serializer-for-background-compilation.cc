@@ -106,10 +106,13 @@ namespace compiler {
   V(ThrowSuperNotCalledIfHole)        \
   V(ToObject)
 
+// Superinstructions are reported as the bytecode they were fused from by the
+// BytecodeArrayIterator.
 #define UNREACHABLE_BYTECODE_LIST(V) \
   V(ExtraWide)                       \
   V(Illegal)                         \
-  V(Wide)
+  V(Wide)                            \
+  SUPERINSTRUCTION_LIST(V)
 
 #define BINARY_OP_LIST(V) \
   V(Add)                  \
@@ -1318,9 +1321,9 @@ void SerializerForBackgroundCompilation::TraverseBytecode() {
     }
 
     switch (iterator.current_bytecode()) {
-#define DEFINE_BYTECODE_CASE(name)     \
-  case interpreter::Bytecode::k##name: \
-    Visit##name(&iterator);            \
+#define DEFINE_BYTECODE_CASE(name, ...) \
+  case interpreter::Bytecode::k##name:  \
+    Visit##name(&iterator);             \
     break;
       SUPPORTED_BYTECODE_LIST(DEFINE_BYTECODE_CASE)
 #undef DEFINE_BYTECODE_CASE
@@ -469,6 +469,7 @@ std::map<v8::Isolate*, int> Shell::isolate_running_streaming_tasks_;
 base::LazyMutex Shell::cached_code_mutex_;
 std::map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
     Shell::cached_code_map_;
+std::unique_ptr<platform::CodeCacheDirectory> Shell::code_cache_directory_;
 std::atomic<int> Shell::unhandled_promise_rejections_{0};
 
 Global<Context> Shell::evaluation_context_;
@@ -510,6 +511,24 @@ void Shell::StoreInCodeCache(Isolate* isolate, Local<Value> source,
                                      ScriptCompiler::CachedData::BufferOwned));
 }
 
+std::unique_ptr<platform::CodeCacheDirectory::Entry>
+Shell::LookupCodeCacheDirectory(const String::Utf8Value& source) {
+  base::MutexGuard lock_guard(cached_code_mutex_.Pointer());
+  DCHECK(*source);
+  return code_cache_directory_->Lookup(*source, source.length());
+}
+
+void Shell::StoreInCodeCacheDirectory(const String::Utf8Value& source,
+                                      Local<UnboundScript> script) {
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(script));
+  if (!cached_data) return;
+  base::MutexGuard lock_guard(cached_code_mutex_.Pointer());
+  DCHECK(*source);
+  code_cache_directory_->Store(*source, source.length(), cached_data->data,
+                               cached_data->length);
+}
+
 // Dummy external source stream which returns the whole source in one go.
 // TODO(leszeks): Also test chunking the data.
 class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
@@ -617,8 +636,31 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
     MaybeLocal<Script> maybe_script;
     Local<Context> context(isolate->GetCurrentContext());
     ScriptOrigin origin(name);
-
-    if (options.compile_options == ScriptCompiler::kConsumeCodeCache) {
+    // Keeps the mapped cache data alive until compilation is done.
+    std::unique_ptr<platform::CodeCacheDirectory::Entry> disk_cache_entry;
+    std::unique_ptr<String::Utf8Value> disk_cache_key;
+
+    if (code_cache_directory_ &&
+        options.compile_options != ScriptCompiler::kConsumeCodeCache) {
+      disk_cache_key = std::make_unique<String::Utf8Value>(isolate, source);
+      disk_cache_entry = LookupCodeCacheDirectory(*disk_cache_key);
+      ScriptCompiler::CachedData* cached_code = nullptr;
+      if (disk_cache_entry) {
+        cached_code = new ScriptCompiler::CachedData(
+            disk_cache_entry->data(), disk_cache_entry->length(),
+            ScriptCompiler::CachedData::BufferNotOwned);
+      }
+      ScriptCompiler::Source script_source(source, origin, cached_code);
+      maybe_script = ScriptCompiler::Compile(
+          context, &script_source,
+          cached_code ? ScriptCompiler::kConsumeCodeCache
+                      : options.compile_options.get());
+      if (cached_code && !cached_code->rejected) {
+        // Nothing to store, the cache entry is up to date.
+        disk_cache_key.reset();
+      }
+      disk_cache_entry.reset();
+    } else if (options.compile_options == ScriptCompiler::kConsumeCodeCache) {
       ScriptCompiler::CachedData* cached_code =
           LookupCodeCache(isolate, source);
       if (cached_code != nullptr) {
@@ -664,6 +706,11 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
       delete cached_data;
     }
     maybe_result = script->Run(realm);
+    if (disk_cache_key) {
+      // Serialize after execution so that the functions compiled while
+      // running the script are included, and store it for later processes.
+      StoreInCodeCacheDirectory(*disk_cache_key, script->GetUnboundScript());
+    }
     if (options.code_cache_options ==
         ShellOptions::CodeCacheOptions::kProduceCacheAfterExecute) {
       // Serialize and store it in memory for the next execution.
@@ -3450,6 +3497,13 @@ bool Shell::SetOptions(int argc, char* argv[]) {
         return false;
       }
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--code-cache-dir=", 17) == 0) {
+      options.code_cache_dir = argv[i] + 17;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--code-cache-dir-max-size=", 26) == 0) {
+      options.code_cache_dir_max_size_mb =
+          static_cast<size_t>(atoi(argv[i] + 26));
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--streaming-compile") == 0) {
       options.streaming_compile = true;
       argv[i] = nullptr;
@@ -3489,6 +3543,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--work-stealing-worker-threads") == 0) {
+      options.work_stealing_worker_threads = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -3500,6 +3557,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.cpu_profiler = true;
       options.cpu_profiler_print = true;
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--cpu-profiler-pprof=", 21) == 0) {
+      options.cpu_profiler_pprof = argv[i] + 21;
+      argv[i] = nullptr;
 #ifdef V8_FUZZILLI
     } else if (strcmp(argv[i], "--no-fuzzilli-enable-builtins-coverage") == 0) {
       options.fuzzilli_enable_builtins_coverage = false;
@@ -4059,6 +4119,32 @@ void Shell::WaitForRunningWorkers() {
   allow_new_workers_ = true;
 }
 
+namespace {
+
+// Writes the windows of a continuous CPU profile to <prefix>.<n>.pb.gz.
+class PprofFileSink final : public CpuProfileWindowSink {
+ public:
+  explicit PprofFileSink(const char* prefix) : prefix_(prefix) {}
+
+  void WriteProfileWindow(const uint8_t* data, size_t size) override {
+    std::string file_name = std::string(prefix_) + "." +
+                            std::to_string(next_window_++) + ".pb.gz";
+    FILE* file = FOpen(file_name.c_str(), "wb");
+    if (file == nullptr) {
+      fprintf(stderr, "Failed to open %s\n", file_name.c_str());
+      return;
+    }
+    fwrite(data, 1, size, file);
+    fclose(file);
+  }
+
+ private:
+  const char* const prefix_;
+  int next_window_ = 0;
+};
+
+}  // namespace
+
 int Shell::Main(int argc, char* argv[]) {
   v8::base::EnsureConsoleOutput();
   if (!SetOptions(argc, argv)) return 1;
@@ -4111,7 +4197,10 @@ int Shell::Main(int argc, char* argv[]) {
   platform::tracing::TracingController* tracing_controller = tracing.get();
   g_platform = v8::platform::NewDefaultPlatform(
       options.thread_pool_size, v8::platform::IdleTaskSupport::kEnabled,
-      in_process_stack_dumping, std::move(tracing));
+      in_process_stack_dumping, std::move(tracing),
+      options.work_stealing_worker_threads
+          ? v8::platform::WorkerThreadsTaskScheduling::kWorkStealing
+          : v8::platform::WorkerThreadsTaskScheduling::kSharedQueue);
   g_default_platform = g_platform.get();
   if (i::FLAG_verify_predictable) {
     g_platform = MakePredictablePlatform(std::move(g_platform));
@@ -4132,6 +4221,17 @@ int Shell::Main(int argc, char* argv[]) {
   }
   v8::V8::InitializePlatform(g_platform.get());
   v8::V8::Initialize();
+  if (options.code_cache_dir) {
+    // The version tag covers the V8 version and the flag hash, so it has to
+    // be computed after all flags are set.
+    code_cache_directory_ = platform::CodeCacheDirectory::Open(
+        options.code_cache_dir, options.code_cache_dir_max_size_mb * i::MB,
+        ScriptCompiler::CachedDataVersionTag());
+    if (!code_cache_directory_) {
+      fprintf(stderr, "Cannot open code cache directory '%s'\n",
+              options.code_cache_dir.get());
+    }
+  }
   if (options.snapshot_blob) {
     v8::V8::InitializeExternalStartupDataFromFile(options.snapshot_blob);
   } else {
@@ -4230,6 +4330,14 @@ int Shell::Main(int argc, char* argv[]) {
         CpuProfilingOptions profile_options;
         cpu_profiler->StartProfiling(String::Empty(isolate), profile_options);
       }
+      CpuProfiler* continuous_profiler = nullptr;
+      std::unique_ptr<PprofFileSink> pprof_sink;
+      if (options.cpu_profiler_pprof) {
+        continuous_profiler = CpuProfiler::New(isolate);
+        pprof_sink = std::make_unique<PprofFileSink>(
+            options.cpu_profiler_pprof);
+        continuous_profiler->StartContinuousProfiling(pprof_sink.get());
+      }
 
       if (options.stress_opt) {
         options.stress_runs = D8Testing::GetStressRuns();
@@ -4311,9 +4419,14 @@ int Shell::Main(int argc, char* argv[]) {
         profile->Delete();
         cpu_profiler->Dispose();
       }
+      if (continuous_profiler) {
+        continuous_profiler->StopContinuousProfiling();
+        continuous_profiler->Dispose();
+      }
 
       // Shut down contexts and collect garbage.
       cached_code_map_.clear();
+      code_cache_directory_.reset();
       evaluation_context_.Reset();
       stringify_function_.Reset();
       CollectGarbage(isolate);
@@ -14,6 +14,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "include/libplatform/v8-code-cache.h"
 #include "src/base/once.h"
 #include "src/base/platform/time.h"
 #include "src/d8/async-hooks-wrapper.h"
@@ -363,6 +364,10 @@ class ShellOptions {
   DisallowReassignment<CodeCacheOptions, true> code_cache_options = {
       "cache", CodeCacheOptions::kNoProduceCache};
   DisallowReassignment<bool> streaming_compile = {"streaming-compile", false};
+  DisallowReassignment<const char*> code_cache_dir = {"code-cache-dir",
+                                                      nullptr};
+  DisallowReassignment<size_t> code_cache_dir_max_size_mb = {
+      "code-cache-dir-max-size", 256};
   DisallowReassignment<SourceGroup*> isolate_sources = {"isolate-sources",
                                                         nullptr};
   DisallowReassignment<const char*> icu_data_file = {"icu-data-file", nullptr};
@@ -378,11 +383,15 @@ class ShellOptions {
   DisallowReassignment<bool> enable_os_system = {"enable-os-system", false};
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
+  DisallowReassignment<bool> work_stealing_worker_threads = {
+      "work-stealing-worker-threads", false};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
   DisallowReassignment<bool> include_arguments = {"arguments", true};
   DisallowReassignment<bool> cpu_profiler = {"cpu-profiler", false};
   DisallowReassignment<bool> cpu_profiler_print = {"cpu-profiler-print", false};
+  DisallowReassignment<const char*> cpu_profiler_pprof = {"cpu-profiler-pprof",
+                                                          nullptr};
   DisallowReassignment<bool> fuzzy_module_file_extensions = {
       "fuzzy-module-file-extensions", true};
 };
@@ -615,6 +624,10 @@ class Shell : public i::AllStatic {
                                                      Local<Value> name);
   static void StoreInCodeCache(Isolate* isolate, Local<Value> name,
                                const ScriptCompiler::CachedData* data);
+  static std::unique_ptr<platform::CodeCacheDirectory::Entry>
+  LookupCodeCacheDirectory(const String::Utf8Value& source);
+  static void StoreInCodeCacheDirectory(const String::Utf8Value& source,
+                                        Local<UnboundScript> script);
   // We may have multiple isolates running concurrently, so the access to
   // the isolate_status_ needs to be concurrency-safe.
   static base::LazyMutex isolate_status_lock_;
@@ -624,6 +637,8 @@ class Shell : public i::AllStatic {
   static base::LazyMutex cached_code_mutex_;
   static std::map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
       cached_code_map_;
+  // Persistent code cache shared across d8 processes (--code-cache-dir).
+  static std::unique_ptr<platform::CodeCacheDirectory> code_cache_directory_;
   static std::atomic<int> unhandled_promise_rejections_;
 };
 
@@ -1240,9 +1240,14 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
 
       bool is_compiled = latin1_code.IsCode();
       if (is_compiled) {
-        CHECK_EQ(Code::cast(latin1_code).builtin_index(),
-                 Builtins::kRegExpExperimentalTrampoline);
-        CHECK_EQ(uc16_code, latin1_code);
+        // Either the trampoline to the interpreter or native code for the
+        // respective encoding.
+        for (Object code : {latin1_code, uc16_code}) {
+          CHECK(code.IsCode());
+          CHECK(Code::cast(code).builtin_index() ==
+                    Builtins::kRegExpExperimentalTrampoline ||
+                Code::cast(code).kind() == CodeKind::REGEXP);
+        }
 
         CHECK(latin1_bytecode.IsByteArray());
         CHECK_EQ(uc16_bytecode, latin1_bytecode);
@@ -1258,8 +1263,7 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
                uninitialized);
       CHECK(arr.get(JSRegExp::kIrregexpCaptureCountIndex).IsSmi());
       CHECK_GE(Smi::ToInt(arr.get(JSRegExp::kIrregexpCaptureCountIndex)), 0);
-      CHECK_EQ(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex),
-               uninitialized);
+      CHECK(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex).IsSmi());
       CHECK_EQ(arr.get(JSRegExp::kIrregexpBacktrackLimit), uninitialized);
       break;
     }
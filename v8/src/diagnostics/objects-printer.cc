@@ -893,6 +893,9 @@ void FeedbackVector::FeedbackVectorPrint(std::ostream& os) {  // NOLINT
   } else {
     os << "\n - no optimized code";
   }
+  if (has_baseline_code()) {
+    os << "\n - baseline code: " << Brief(baseline_code());
+  }
   os << "\n - optimization marker: " << optimization_marker();
   os << "\n - optimization tier: " << optimization_tier();
   os << "\n - invocation count: " << invocation_count();
@@ -223,7 +223,7 @@ bool IsInterpreterFramePc(Isolate* isolate, Address pc,
       interpreter_bytecode_advance.contains(pc) ||
       interpreter_bytecode_dispatch.contains(pc)) {
     return true;
-  } else if (FLAG_interpreted_frames_native_stack) {
+  } else if (FLAG_interpreted_frames_native_stack || FLAG_baseline_jit) {
     intptr_t marker = Memory<intptr_t>(
         state->fp + CommonFrameConstants::kContextOrFrameTypeOffset);
     MSAN_MEMORY_IS_INITIALIZED(
@@ -240,7 +240,8 @@ bool IsInterpreterFramePc(Isolate* isolate, Address pc,
     }
     interpreter_entry_trampoline =
         isolate->heap()->GcSafeFindCodeForInnerPointer(pc);
-    return interpreter_entry_trampoline.is_interpreter_trampoline_builtin();
+    return interpreter_entry_trampoline.is_interpreter_trampoline_builtin() ||
+           CodeKindIsBaselinedJSFunction(interpreter_entry_trampoline.kind());
   } else {
     return false;
   }
@@ -596,6 +597,10 @@ StackFrame::Type StackFrame::ComputeType(const StackFrameIteratorBase* iterator,
               return OPTIMIZED;
             }
             return BUILTIN;
+          case CodeKind::BASELINE:
+            // Baseline code runs in the frame set up by the interpreter entry
+            // trampoline and keeps it up to date.
+            return INTERPRETED;
           case CodeKind::TURBOFAN:
           case CodeKind::NATIVE_CONTEXT_INDEPENDENT:
           case CodeKind::TURBOPROP:
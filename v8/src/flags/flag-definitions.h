@@ -510,6 +510,8 @@ DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse common bytecode pairs into superinstructions")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
@@ -543,6 +545,13 @@ DEFINE_STRING(trace_ignition_dispatches_output_file, nullptr,
               "the file to which the bytecode handler dispatch table is "
               "written (by default, the table is not written to a file)")
 
+// Flags for the baseline compiler.
+DEFINE_BOOL(baseline_jit, false,
+            "compile functions with a hot interrupt budget to baseline code "
+            "which calls builtins and ICs in place of bytecode dispatch")
+DEFINE_NEG_IMPLICATION(jitless, baseline_jit)
+DEFINE_BOOL(trace_baseline_jit, false, "trace baseline compilation")
+
 DEFINE_BOOL(fast_math, true, "faster (but maybe less accurate) math functions")
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
@@ -788,6 +797,10 @@ DEFINE_BOOL(wasm_write_protect_code_memory, false,
             "write protect code memory on the wasm native heap")
 DEFINE_DEBUG_BOOL(trace_wasm_serialization, false,
                   "trace serialization/deserialization")
+DEFINE_STRING(wasm_disk_cache_dir, nullptr,
+              "directory in which to cache fully optimized wasm modules "
+              "across processes")
+DEFINE_BOOL(trace_wasm_disk_cache, false, "trace the wasm disk cache")
 DEFINE_BOOL(wasm_async_compilation, true,
             "enable actual asynchronous compilation for WebAssembly.compile")
 DEFINE_BOOL(wasm_test_streaming, false,
@@ -802,7 +815,10 @@ DEFINE_BOOL(wasm_tier_up, true,
             "enable tier up to the optimizing compiler (requires --liftoff to "
             "have an effect)")
 DEFINE_BOOL(wasm_dynamic_tiering, false,
-            "enable dynamic tier up to the optimizing compiler")
+            "enable dynamic tier up to the optimizing compiler instead of "
+            "eagerly compiling all functions with it")
+DEFINE_INT(wasm_tiering_budget, 1800000,
+           "budget for dynamic tiering (rough approximation of bytes executed)")
 DEFINE_DEBUG_BOOL(trace_wasm_decoder, false, "trace decoding of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_compiler, false, "trace compiling of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_interpreter, false,
@@ -1008,6 +1024,12 @@ DEFINE_INT(scavenge_task_trigger, 80,
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_BOOL(adaptive_scavenge_tasks, true,
+            "choose the number of scavenger tasks from the survival rate and "
+            "remembered set size of recent scavenges")
+DEFINE_BOOL(adaptive_scavenge_lab_size, true,
+            "size the local allocation buffers of scavenger tasks by their "
+            "expected and actual amount of copied objects")
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
 #if defined(V8_ATOMIC_MARKING_STATE) && defined(V8_ATOMIC_OBJECT_FIELD_WRITES)
 #define V8_CONCURRENT_MARKING_BOOL true
@@ -1101,6 +1123,9 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages, false,
+            "pack old space and code space pages into memory that is advised "
+            "to be backed by huge pages")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
@@ -1225,6 +1250,10 @@ DEFINE_BOOL(stress_background_compile, false,
 DEFINE_BOOL(
     finalize_streaming_on_background, false,
     "perform the script streaming finalization on the background thread")
+DEFINE_BOOL(parallel_streaming_compile, false,
+            "compile the eager inner functions of streamed scripts on worker "
+            "threads")
+DEFINE_IMPLICATION(parallel_streaming_compile, finalize_streaming_on_background)
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -1339,6 +1368,8 @@ DEFINE_BOOL(heap_profiler_use_embedder_graph, true,
             "Use the new EmbedderGraph API to get embedder nodes")
 DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
+DEFINE_BOOL(heap_snapshot_parallel_serialization, false,
+            "encode binary heap snapshots on worker threads")
 
 // sampling-heap-profiler.cc
 DEFINE_BOOL(sampling_heap_profiler_suppress_randomness, false,
@@ -1375,6 +1406,16 @@ DEFINE_BOOL(trace_maps, false, "trace map creation")
 DEFINE_BOOL(trace_maps_details, true, "also log map details")
 DEFINE_IMPLICATION(trace_maps, log_code)
 
+// utf8-simd.cc
+DEFINE_BOOL(utf8_simd, true,
+            "validate and decode well-formed UTF-8 with vector instructions "
+            "instead of the DFA")
+
+// scanner-simd.cc
+DEFINE_BOOL(scanner_simd, false,
+            "scan identifiers, whitespace and string literals with vector "
+            "instructions")
+
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
 DEFINE_BOOL(allow_natives_for_differential_fuzzing, false,
@@ -1469,8 +1510,13 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "Decompress chunks of a compressed snapshot on worker threads.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_prefilter, false,
+            "search for the leading literals of unanchored regexps before "
+            "running the generated code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
 #ifdef V8_TARGET_BIG_ENDIAN
@@ -1502,6 +1548,16 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_dfa, false,
+            "find matches of the experimental regexp engine with a lazily "
+            "built dfa before computing captures")
+DEFINE_SIZE_T(experimental_regexp_engine_dfa_cache_size, 1024,
+              "memory budget (in KB) for the states of each lazy dfa of the "
+              "experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_jit, false,
+            "compile experimental regexps to native code, following the "
+            "regexp tier up flags")
+DEFINE_NEG_IMPLICATION(regexp_interpret_all, experimental_regexp_engine_jit)
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -1550,6 +1606,9 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_STRING(snapshot_compression_codec, "zlib",
+              "Codec used to compress the snapshot when snapshot compression "
+              "is enabled: zlib or lz4. (mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
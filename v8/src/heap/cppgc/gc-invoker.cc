@@ -30,30 +30,42 @@ class GCInvoker::GCInvokerImpl final : public GarbageCollector {
    public:
     using Handle = SingleThreadedHandle;
 
-    static Handle Post(GarbageCollector* collector, cppgc::TaskRunner* runner) {
-      auto task = std::make_unique<GCInvoker::GCInvokerImpl::GCTask>(collector);
+    static Handle Post(
+        GarbageCollector* collector, cppgc::TaskRunner* runner,
+        GarbageCollector::Config::CollectionType collection_type) {
+      auto task = std::make_unique<GCInvoker::GCInvokerImpl::GCTask>(
+          collector, collection_type);
       auto handle = task->GetHandle();
       runner->PostNonNestableTask(std::move(task));
       return handle;
     }
 
-    explicit GCTask(GarbageCollector* collector)
+    GCTask(GarbageCollector* collector,
+           GarbageCollector::Config::CollectionType collection_type)
         : collector_(collector),
+          collection_type_(collection_type),
           handle_(Handle::NonEmptyTag{}),
           saved_epoch_(collector->epoch()) {}
 
    private:
     void Run() final {
-      if (handle_.IsCanceled() || (collector_->epoch() != saved_epoch_)) return;
-
-      collector_->CollectGarbage(
-          GarbageCollector::Config::PreciseAtomicConfig());
+      if (handle_.IsCanceled()) return;
+
+      // Skip the GC if another one ran in the meantime, but still release the
+      // handle so that further GCs can be posted.
+      if (collector_->epoch() == saved_epoch_) {
+        collector_->CollectGarbage(
+            collection_type_ == GarbageCollector::Config::CollectionType::kMinor
+                ? GarbageCollector::Config::MinorPreciseAtomicConfig()
+                : GarbageCollector::Config::PreciseAtomicConfig());
+      }
       handle_.Cancel();
     }
 
     Handle GetHandle() { return handle_; }
 
     GarbageCollector* collector_;
+    const GarbageCollector::Config::CollectionType collection_type_;
     Handle handle_;
     size_t saved_epoch_;
   };
@@ -78,15 +90,19 @@ GCInvoker::GCInvokerImpl::~GCInvokerImpl() {
 }
 
 void GCInvoker::GCInvokerImpl::CollectGarbage(GarbageCollector::Config config) {
+  // Minor GCs don't scan the stack, so they always wait for a task.
   if ((config.stack_state ==
        GarbageCollector::Config::StackState::kNoHeapPointers) ||
-      (stack_support_ ==
-       cppgc::Heap::StackSupport::kSupportsConservativeStackScan)) {
+      ((stack_support_ ==
+        cppgc::Heap::StackSupport::kSupportsConservativeStackScan) &&
+       (config.collection_type ==
+        GarbageCollector::Config::CollectionType::kMajor))) {
     collector_->CollectGarbage(config);
   } else if (platform_->GetForegroundTaskRunner()->NonNestableTasksEnabled()) {
     if (!gc_task_handle_) {
       gc_task_handle_ =
-          GCTask::Post(collector_, platform_->GetForegroundTaskRunner().get());
+          GCTask::Post(collector_, platform_->GetForegroundTaskRunner().get(),
+                       config.collection_type);
     }
   }
 }
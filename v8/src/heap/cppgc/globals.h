@@ -23,6 +23,10 @@ constexpr size_t kGB = kMB * 1024;
 // AccessMode used for choosing between atomic and non-atomic accesses.
 enum class AccessMode : uint8_t { kNonAtomic, kAtomic };
 
+// Minor collections only reclaim objects allocated since the previous
+// collection (young generation). Major collections reclaim the whole heap.
+enum class CollectionType : uint8_t { kMinor, kMajor };
+
 // See 6.7.6 (http://eel.is/c++draft/basic.align) for alignment restrictions. We
 // do not fully support all alignment restrictions (following
 // alignof(std​::​max_­align_­t)) but limit to alignof(double).
@@ -89,6 +89,12 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
   } else if (allocated_object_size > limit_for_incremental_gc_) {
     collector_->StartIncrementalGarbageCollection(
         GarbageCollector::Config::ConservativeIncrementalConfig());
+#if defined(CPPGC_YOUNG_GENERATION)
+  } else if (stats_collector_->allocated_bytes_since_end_of_marking() >
+             static_cast<int64_t>(kYoungGenerationLimit)) {
+    collector_->CollectGarbage(
+        GarbageCollector::Config::MinorConservativeAtomicConfig());
+#endif
   }
 }
 
@@ -150,6 +156,10 @@ void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
 // static
 constexpr double HeapGrowing::kGrowingFactor;
+#if defined(CPPGC_YOUNG_GENERATION)
+// static
+constexpr size_t HeapGrowing::kYoungGenerationLimit;
+#endif
 
 }  // namespace internal
 }  // namespace cppgc
@@ -32,6 +32,11 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
   // before triggering GC again.
   static constexpr size_t kMinLimitIncrease =
       kPageSize * RawHeap::kNumberOfRegularSpaces;
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Bytes allocated since the last GC after which the young generation is
+  // collected by a minor GC, unless a major GC is due.
+  static constexpr size_t kYoungGenerationLimit = 4 * kMB;
+#endif
 
   HeapGrowing(GarbageCollector*, StatsCollector*,
               cppgc::Heap::ResourceConstraints);
@@ -106,9 +106,16 @@ class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
   FreeList& free_list() { return free_list_; }
   const FreeList& free_list() const { return free_list_; }
 
+  // Guards the free list outside of garbage collections, when
+  // ThreadLocalHeaps may allocate from it concurrently.
+  v8::base::Mutex& free_list_mutex() { return free_list_mutex_; }
+
  private:
+  // The buffer of the thread owning the heap. ThreadLocalHeaps keep their own
+  // buffers in their ObjectAllocator.
   LinearAllocationBuffer current_lab_;
   FreeList free_list_;
+  v8::base::Mutex free_list_mutex_;
 };
 
 class V8_EXPORT_PRIVATE LargePageSpace final : public BaseSpace {
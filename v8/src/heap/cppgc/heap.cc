@@ -72,6 +72,10 @@ void CheckConfig(Heap::Config config) {
       (config.collection_type != Heap::Config::CollectionType::kMinor) ||
           (config.stack_state == Heap::Config::StackState::kNoHeapPointers),
       "Minor GCs with stack is currently not supported");
+  CHECK_WITH_MSG(
+      (config.collection_type != Heap::Config::CollectionType::kMinor) ||
+          (config.sweeping_type == Heap::Config::SweepingType::kAtomic),
+      "Minor GCs with incremental sweeping is currently not supported");
 }
 
 }  // namespace
@@ -81,12 +85,16 @@ Heap::Heap(std::shared_ptr<cppgc::Platform> platform,
     : HeapBase(platform, options.custom_spaces, options.stack_support),
       gc_invoker_(this, platform_.get(), options.stack_support),
       growing_(&gc_invoker_, stats_collector_.get(),
-               options.resource_constraints) {}
+               options.resource_constraints),
+      safepoint_(*this, platform_.get()) {}
 
 Heap::~Heap() {
   NoGCScope no_gc(*this);
   // Finish already running GC if any, but don't finalize live objects.
   sweeper_.FinishIfRunning();
+  // A garbage collection that was started but never finalized still holds the
+  // safepoint.
+  if (safepoint_.IsActive()) safepoint_.Leave();
 }
 
 void Heap::CollectGarbage(Config config) {
@@ -95,6 +103,11 @@ void Heap::CollectGarbage(Config config) {
 
   if (in_no_gc_scope()) return;
 
+  // A running major GC also collects the young generation.
+  if (gc_in_progress_ &&
+      config.collection_type == Config::CollectionType::kMinor)
+    return;
+
   config_ = config;
 
   if (!gc_in_progress_) StartGarbageCollection(config);
@@ -133,6 +146,9 @@ void Heap::StartGarbageCollection(Config config) {
   // Finish sweeping in case it is still running.
   sweeper_.FinishIfRunning();
 
+  // Stop all ThreadLocalHeaps until the garbage collection is finished.
+  safepoint_.Enter();
+
   gc_in_progress_ = true;
   epoch_++;
 
@@ -170,9 +186,11 @@ void Heap::FinalizeGarbageCollection(Config::StackState stack_state) {
     NoGCScope no_gc(*this);
     const Sweeper::SweepingConfig sweeping_config{
         config_.sweeping_type,
-        Sweeper::SweepingConfig::CompactableSpaceHandling::kSweep};
+        Sweeper::SweepingConfig::CompactableSpaceHandling::kSweep,
+        config_.collection_type};
     sweeper_.Start(sweeping_config);
   }
+  safepoint_.Leave();
   gc_in_progress_ = false;
 }
 
@@ -12,6 +12,7 @@
 #include "src/heap/cppgc/gc-invoker.h"
 #include "src/heap/cppgc/heap-base.h"
 #include "src/heap/cppgc/heap-growing.h"
+#include "src/heap/cppgc/safepoint.h"
 
 namespace cppgc {
 namespace internal {
@@ -38,6 +39,8 @@ class V8_EXPORT_PRIVATE Heap final : public HeapBase,
 
   size_t epoch() const final { return epoch_; }
 
+  GlobalSafepoint& safepoint() { return safepoint_; }
+
   void DisableHeapGrowingForTesting();
 
  private:
@@ -52,6 +55,7 @@ class V8_EXPORT_PRIVATE Heap final : public HeapBase,
   Config config_;
   GCInvoker gc_invoker_;
   HeapGrowing growing_;
+  GlobalSafepoint safepoint_;
 
   bool gc_in_progress_ = false;
   size_t epoch_ = 0;
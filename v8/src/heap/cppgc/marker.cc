@@ -67,9 +67,11 @@ void VisitRememberedSlots(HeapBase& heap,
     // top level (with the guarantee that no objects are currently being in
     // construction). This can be ensured by running young GCs from safe points
     // or by reintroducing nested allocation scopes that avoid finalization.
-    DCHECK(!header.IsInConstruction<AccessMode::kNonAtomic>());
+    DCHECK(!slot_header.IsInConstruction<AccessMode::kNonAtomic>());
 
+    // The slot may have been cleared after the barrier recorded it.
     void* value = *reinterpret_cast<void**>(slot);
+    if (!value || value == kSentinelPointer) continue;
     mutator_marking_state.DynamicallyMarkAddress(static_cast<Address>(value));
   }
 #endif
@@ -195,7 +197,7 @@ MarkerBase::~MarkerBase() {
 
 void MarkerBase::StartMarking() {
   DCHECK(!is_marking_started_);
-  heap().stats_collector()->NotifyMarkingStarted();
+  heap().stats_collector()->NotifyMarkingStarted(config_.collection_type);
 
   is_marking_started_ = true;
   if (EnterIncrementalMarkingIfNeeded(config_, heap())) {
@@ -241,8 +243,10 @@ void MarkerBase::LeaveAtomicPause() {
   DCHECK(!incremental_marking_handle_);
   ResetRememberedSet(heap());
   heap().stats_collector()->NotifyMarkingCompleted(
-      // GetOverallMarkedBytes also includes concurrently marked bytes.
-      schedule_.GetOverallMarkedBytes());
+      // The schedule only tracks bytes marked outside of the atomic pause, so
+      // add the concurrently marked bytes to all bytes marked on the mutator.
+      mutator_marking_state_.marked_bytes() +
+      schedule_.GetConcurrentlyMarkedBytes());
   is_marking_started_ = false;
   ProcessWeakness();
   g_process_mutex.Pointer()->Unlock();
@@ -39,10 +39,7 @@ class MarkerFactory;
 class V8_EXPORT_PRIVATE MarkerBase {
  public:
   struct MarkingConfig {
-    enum class CollectionType : uint8_t {
-      kMinor,
-      kMajor,
-    };
+    using CollectionType = cppgc::internal::CollectionType;
     using StackState = cppgc::Heap::StackState;
     enum MarkingType : uint8_t {
       kAtomic,
@@ -6,6 +6,7 @@
 
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/cppgc/free-list.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-object-header.h"
@@ -17,6 +18,7 @@
 #include "src/heap/cppgc/page-memory.h"
 #include "src/heap/cppgc/stats-collector.h"
 #include "src/heap/cppgc/sweeper.h"
+#include "src/heap/cppgc/thread-local-heap.h"
 
 namespace cppgc {
 namespace internal {
@@ -53,51 +55,6 @@ void MarkRangeAsYoung(BasePage* page, Address begin, Address end) {
 #endif
 }
 
-void AddToFreeList(NormalPageSpace* space, Address start, size_t size) {
-  auto& free_list = space->free_list();
-  free_list.Add({start, size});
-  NormalPage::From(BasePage::FromPayload(start))
-      ->object_start_bitmap()
-      .SetBit(start);
-}
-
-void ReplaceLinearAllocationBuffer(NormalPageSpace* space,
-                                   StatsCollector* stats_collector,
-                                   Address new_buffer, size_t new_size) {
-  DCHECK_NOT_NULL(space);
-  DCHECK_NOT_NULL(stats_collector);
-
-  auto& lab = space->linear_allocation_buffer();
-  if (lab.size()) {
-    AddToFreeList(space, lab.start(), lab.size());
-    stats_collector->NotifyExplicitFree(lab.size());
-  }
-
-  lab.Set(new_buffer, new_size);
-  if (new_size) {
-    DCHECK_NOT_NULL(new_buffer);
-    stats_collector->NotifyAllocation(new_size);
-    auto* page = NormalPage::From(BasePage::FromPayload(new_buffer));
-    page->object_start_bitmap().ClearBit(new_buffer);
-    MarkRangeAsYoung(page, new_buffer, new_buffer + new_size);
-  }
-}
-
-void* AllocateLargeObject(PageBackend* page_backend, LargePageSpace* space,
-                          StatsCollector* stats_collector, size_t size,
-                          GCInfoIndex gcinfo) {
-  LargePage* page = LargePage::Create(page_backend, space, size);
-  space->AddPage(page);
-
-  auto* header = new (page->ObjectHeader())
-      HeapObjectHeader(HeapObjectHeader::kLargeObjectSizeInHeader, gcinfo);
-
-  stats_collector->NotifyAllocation(size);
-  MarkRangeAsYoung(page, page->PayloadStart(), page->PayloadEnd());
-
-  return header->Payload();
-}
-
 }  // namespace
 
 ObjectAllocator::ObjectAllocator(RawHeap* heap, PageBackend* page_backend,
@@ -106,9 +63,25 @@ ObjectAllocator::ObjectAllocator(RawHeap* heap, PageBackend* page_backend,
       page_backend_(page_backend),
       stats_collector_(stats_collector) {}
 
+ObjectAllocator::ObjectAllocator(RawHeap* heap, PageBackend* page_backend,
+                                 StatsCollector* stats_collector,
+                                 ThreadLocalHeap* thread_local_heap)
+    : raw_heap_(heap),
+      page_backend_(page_backend),
+      stats_collector_(stats_collector),
+      thread_local_heap_(thread_local_heap),
+      thread_local_labs_(heap->size()) {
+  DCHECK_NOT_NULL(thread_local_heap);
+}
+
 void* ObjectAllocator::OutOfLineAllocate(NormalPageSpace* space, size_t size,
                                          GCInfoIndex gcinfo) {
   void* memory = OutOfLineAllocateImpl(space, size, gcinfo);
+  if (is_thread_local()) {
+    // Garbage collections only run on the thread owning the heap.
+    thread_local_heap_->heap().safepoint().NotifyAllocationOnThread();
+    return memory;
+  }
   stats_collector_->NotifySafePointForConservativeCollection();
   raw_heap_->heap()->AdvanceIncrementalGarbageCollectionOnAllocationIfNeeded();
   return memory;
@@ -121,10 +94,7 @@ void* ObjectAllocator::OutOfLineAllocateImpl(NormalPageSpace* space,
 
   // 1. If this allocation is big enough, allocate a large object.
   if (size >= kLargeObjectSizeThreshold) {
-    auto* large_space = LargePageSpace::From(
-        raw_heap_->Space(RawHeap::RegularSpaceType::kLarge));
-    return AllocateLargeObject(page_backend_, large_space, stats_collector_,
-                               size, gcinfo);
+    return AllocateLargeObject(size, gcinfo);
   }
 
   // 2. Try to allocate from the freelist.
@@ -132,20 +102,26 @@ void* ObjectAllocator::OutOfLineAllocateImpl(NormalPageSpace* space,
     return result;
   }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+  // 2a. Reuse memory that was freed in the old generation.
+  if (void* result = AllocateFromOldGenerationFreeList(space, size, gcinfo)) {
+    return result;
+  }
+#endif
+
   // 3. Lazily sweep pages of this heap until we find a freed area for
   // this allocation or we finish sweeping all pages of this heap.
   // TODO(chromium:1056170): Add lazy sweep.
 
-  // 4. Complete sweeping.
-  raw_heap_->heap()->sweeper().FinishIfRunning();
+  // 4. Complete sweeping. The sweeper belongs to the thread owning the heap.
+  if (!is_thread_local()) raw_heap_->heap()->sweeper().FinishIfRunning();
 
   // 5. Add a new page to this heap.
   auto* new_page = NormalPage::Create(page_backend_, space);
   space->AddPage(new_page);
 
   // 6. Set linear allocation buffer to new page.
-  ReplaceLinearAllocationBuffer(space, stats_collector_,
-                                new_page->PayloadStart(),
+  ReplaceLinearAllocationBuffer(space, new_page->PayloadStart(),
                                 new_page->PayloadSize());
 
   // 7. Allocate from it. The allocation must succeed.
@@ -157,30 +133,132 @@ void* ObjectAllocator::OutOfLineAllocateImpl(NormalPageSpace* space,
 
 void* ObjectAllocator::AllocateFromFreeList(NormalPageSpace* space, size_t size,
                                             GCInfoIndex gcinfo) {
-  const FreeList::Block entry = space->free_list().Allocate(size);
+  FreeList::Block entry;
+  {
+    v8::base::MutexGuard guard(&space->free_list_mutex());
+    entry = space->free_list().Allocate(size);
+  }
+  if (!entry.address) return nullptr;
+
+  ReplaceLinearAllocationBuffer(space, static_cast<Address>(entry.address),
+                                entry.size);
+
+  return AllocateObjectOnSpace(space, size, gcinfo);
+}
+
+#if defined(CPPGC_YOUNG_GENERATION)
+void* ObjectAllocator::AllocateFromOldGenerationFreeList(NormalPageSpace* space,
+                                                         size_t size,
+                                                         GCInfoIndex gcinfo) {
+  if (space != raw_heap_->Space(RawHeap::RegularSpaceType::kNursery))
+    return nullptr;
+
+  // Sweeping promotes nursery pages to kNormal4, so that is where the old
+  // generation keeps its free memory.
+  auto* old_space = NormalPageSpace::From(
+      raw_heap_->Space(RawHeap::RegularSpaceType::kNormal4));
+  FreeList::Block entry;
+  {
+    v8::base::MutexGuard guard(&old_space->free_list_mutex());
+    entry = old_space->free_list().Allocate(size);
+  }
   if (!entry.address) return nullptr;
 
-  ReplaceLinearAllocationBuffer(
-      space, stats_collector_, static_cast<Address>(entry.address), entry.size);
+  // Move the page to the nursery so that the next minor collection sweeps it.
+  // Its other free list entries stay in the old generation's free list.
+  BasePage* page = BasePage::FromPayload(entry.address);
+  if (page->space() != space) {
+    old_space->RemovePage(page);
+    page->set_space(space);
+    space->AddPage(page);
+  }
+
+  ReplaceLinearAllocationBuffer(space, static_cast<Address>(entry.address),
+                                entry.size);
 
   return AllocateObjectOnSpace(space, size, gcinfo);
 }
+#endif
+
+void ObjectAllocator::AddToFreeList(NormalPageSpace* space, Address start,
+                                    size_t size) {
+  {
+    v8::base::MutexGuard guard(&space->free_list_mutex());
+    space->free_list().Add({start, size});
+  }
+  // Buffers of other threads may share the bitmap cell.
+  NormalPage::From(BasePage::FromPayload(start))
+      ->object_start_bitmap()
+      .SetBit<AccessMode::kAtomic>(start);
+}
+
+void ObjectAllocator::ReplaceLinearAllocationBuffer(NormalPageSpace* space,
+                                                    Address new_buffer,
+                                                    size_t new_size) {
+  DCHECK_NOT_NULL(space);
+
+  auto& lab = GetLinearAllocationBuffer(space);
+  if (lab.size()) {
+    AddToFreeList(space, lab.start(), lab.size());
+    NotifyExplicitFree(lab.size());
+  }
+
+  lab.Set(new_buffer, new_size);
+  if (new_size) {
+    DCHECK_NOT_NULL(new_buffer);
+    NotifyAllocation(new_size);
+    auto* page = NormalPage::From(BasePage::FromPayload(new_buffer));
+    page->object_start_bitmap().ClearBit<AccessMode::kAtomic>(new_buffer);
+    MarkRangeAsYoung(page, new_buffer, new_buffer + new_size);
+  }
+}
+
+void* ObjectAllocator::AllocateLargeObject(size_t size, GCInfoIndex gcinfo) {
+  auto* space =
+      LargePageSpace::From(raw_heap_->Space(RawHeap::RegularSpaceType::kLarge));
+  LargePage* page = LargePage::Create(page_backend_, space, size);
+  space->AddPage(page);
+
+  auto* header = new (page->ObjectHeader())
+      HeapObjectHeader(HeapObjectHeader::kLargeObjectSizeInHeader, gcinfo);
+
+  NotifyAllocation(size);
+  MarkRangeAsYoung(page, page->PayloadStart(), page->PayloadEnd());
+
+  return header->Payload();
+}
+
+void ObjectAllocator::NotifyAllocation(size_t bytes) {
+  if (is_thread_local()) {
+    stats_collector_->NotifyAllocationOnThread(bytes);
+  } else {
+    stats_collector_->NotifyAllocation(bytes);
+  }
+}
+
+void ObjectAllocator::NotifyExplicitFree(size_t bytes) {
+  if (is_thread_local()) {
+    stats_collector_->NotifyExplicitFreeOnThread(bytes);
+  } else {
+    stats_collector_->NotifyExplicitFree(bytes);
+  }
+}
 
 void ObjectAllocator::ResetLinearAllocationBuffers() {
   class Resetter : public HeapVisitor<Resetter> {
    public:
-    explicit Resetter(StatsCollector* stats) : stats_collector_(stats) {}
+    explicit Resetter(ObjectAllocator* allocator) : allocator_(allocator) {}
 
     bool VisitLargePageSpace(LargePageSpace*) { return true; }
 
     bool VisitNormalPageSpace(NormalPageSpace* space) {
-      ReplaceLinearAllocationBuffer(space, stats_collector_, nullptr, 0);
+      allocator_->ReplaceLinearAllocationBuffer(space, nullptr, 0);
       return true;
     }
 
    private:
-    StatsCollector* stats_collector_;
-  } visitor(stats_collector_);
+    ObjectAllocator* allocator_;
+  } visitor(this);
 
   visitor.Traverse(raw_heap_);
 }
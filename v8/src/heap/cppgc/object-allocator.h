@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_CPPGC_OBJECT_ALLOCATOR_H_
 #define V8_HEAP_CPPGC_OBJECT_ALLOCATOR_H_
 
+#include <vector>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/internal/gc-info.h"
 #include "include/cppgc/macros.h"
@@ -28,6 +30,7 @@ namespace internal {
 
 class StatsCollector;
 class PageBackend;
+class ThreadLocalHeap;
 
 class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
  public:
@@ -49,6 +52,12 @@ class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
 
   ObjectAllocator(RawHeap* heap, PageBackend* page_backend,
                   StatsCollector* stats_collector);
+  // Creates the allocator of a ThreadLocalHeap. It keeps its own linear
+  // allocation buffers and synchronizes with other threads when refilling
+  // them.
+  ObjectAllocator(RawHeap* heap, PageBackend* page_backend,
+                  StatsCollector* stats_collector,
+                  ThreadLocalHeap* thread_local_heap);
 
   inline void* AllocateObject(size_t size, GCInfoIndex gcinfo);
   inline void* AllocateObject(size_t size, GCInfoIndex gcinfo,
@@ -63,16 +72,32 @@ class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
       size_t size);
 
   bool is_allocation_allowed() const { return no_allocation_scope_ == 0; }
+  bool is_thread_local() const { return thread_local_heap_; }
+
+  inline NormalPageSpace::LinearAllocationBuffer& GetLinearAllocationBuffer(
+      NormalPageSpace* space);
+  void ReplaceLinearAllocationBuffer(NormalPageSpace*, Address, size_t);
+  void AddToFreeList(NormalPageSpace*, Address, size_t);
+  void* AllocateLargeObject(size_t, GCInfoIndex);
+  void NotifyAllocation(size_t);
+  void NotifyExplicitFree(size_t);
 
   inline void* AllocateObjectOnSpace(NormalPageSpace* space, size_t size,
                                      GCInfoIndex gcinfo);
   void* OutOfLineAllocate(NormalPageSpace*, size_t, GCInfoIndex);
   void* OutOfLineAllocateImpl(NormalPageSpace*, size_t, GCInfoIndex);
   void* AllocateFromFreeList(NormalPageSpace*, size_t, GCInfoIndex);
+#if defined(CPPGC_YOUNG_GENERATION)
+  void* AllocateFromOldGenerationFreeList(NormalPageSpace*, size_t,
+                                          GCInfoIndex);
+#endif
 
   RawHeap* raw_heap_;
   PageBackend* page_backend_;
   StatsCollector* stats_collector_;
+  ThreadLocalHeap* const thread_local_heap_ = nullptr;
+  // Linear allocation buffers of a ThreadLocalHeap, indexed by space.
+  std::vector<NormalPageSpace::LinearAllocationBuffer> thread_local_labs_;
   size_t no_allocation_scope_ = 0;
 };
 
@@ -80,8 +105,12 @@ void* ObjectAllocator::AllocateObject(size_t size, GCInfoIndex gcinfo) {
   DCHECK(is_allocation_allowed());
   const size_t allocation_size =
       RoundUp<kAllocationGranularity>(size + sizeof(HeapObjectHeader));
+#if defined(CPPGC_YOUNG_GENERATION)
+  const RawHeap::RegularSpaceType type = RawHeap::RegularSpaceType::kNursery;
+#else
   const RawHeap::RegularSpaceType type =
       GetInitialSpaceIndexForSize(allocation_size);
+#endif
   return AllocateObjectOnSpace(NormalPageSpace::From(raw_heap_->Space(type)),
                                allocation_size, gcinfo);
 }
@@ -107,12 +136,19 @@ RawHeap::RegularSpaceType ObjectAllocator::GetInitialSpaceIndexForSize(
   return RawHeap::RegularSpaceType::kNormal4;
 }
 
+NormalPageSpace::LinearAllocationBuffer&
+ObjectAllocator::GetLinearAllocationBuffer(NormalPageSpace* space) {
+  if (V8_LIKELY(!is_thread_local())) return space->linear_allocation_buffer();
+  DCHECK_LT(space->index(), thread_local_labs_.size());
+  return thread_local_labs_[space->index()];
+}
+
 void* ObjectAllocator::AllocateObjectOnSpace(NormalPageSpace* space,
                                              size_t size, GCInfoIndex gcinfo) {
   DCHECK_LT(0u, gcinfo);
 
   NormalPageSpace::LinearAllocationBuffer& current_lab =
-      space->linear_allocation_buffer();
+      GetLinearAllocationBuffer(space);
   if (current_lab.size() < size) {
     return OutOfLineAllocate(space, size, gcinfo);
   }
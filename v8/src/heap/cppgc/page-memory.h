@@ -13,6 +13,7 @@
 
 #include "include/cppgc/platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/cppgc/globals.h"
 
 namespace cppgc {
@@ -191,6 +192,10 @@ class V8_EXPORT_PRIVATE NormalPageMemoryPool final {
 //
 // Internally maintaints a set of PageMemoryRegions. The backend keeps its used
 // regions alive.
+//
+// Allocating and freeing is thread-safe, as pages are handed out to
+// ThreadLocalHeaps as well. Lookup() is not synchronized and may only be used
+// while no other thread allocates, e.g. during garbage collection.
 class V8_EXPORT_PRIVATE PageBackend final {
  public:
   explicit PageBackend(PageAllocator*);
@@ -223,6 +228,7 @@ class V8_EXPORT_PRIVATE PageBackend final {
   PageBackend& operator=(const PageBackend&) = delete;
 
  private:
+  v8::base::Mutex mutex_;
   PageAllocator* allocator_;
   NormalPageMemoryPool page_pool_;
   PageMemoryRegionTree page_memory_region_tree_;
@@ -28,6 +28,11 @@ class V8_EXPORT_PRIVATE RawHeap final {
   // - kNormal3:  < 128 bytes
   // - kNormal4: >= 128 bytes
   //
+  // With young generation enabled, objects of all these sizes are allocated in
+  // the nursery (kNursery) instead. The nursery only holds pages that received
+  // allocations since the last garbage collection, so that minor collections
+  // only need to sweep those. Sweeping promotes its pages to kNormal4.
+  //
   // Objects of size greater than 2^16 get stored in the large space.
   //
   // Users can override where objects are allocated via cppgc::CustomSpace to
@@ -37,6 +42,9 @@ class V8_EXPORT_PRIVATE RawHeap final {
     kNormal2,
     kNormal3,
     kNormal4,
+#if defined(CPPGC_YOUNG_GENERATION)
+    kNursery,
+#endif
     kLarge,
   };
 
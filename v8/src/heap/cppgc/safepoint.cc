@@ -0,0 +1,157 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/cppgc/safepoint.h"
+
+#include <algorithm>
+
+#include "src/heap/cppgc/heap-base.h"
+#include "src/heap/cppgc/stats-collector.h"
+#include "src/heap/cppgc/thread-local-heap.h"
+
+namespace cppgc {
+namespace internal {
+
+class GlobalSafepoint::AllocationSafepointTask final : public cppgc::Task {
+ public:
+  AllocationSafepointTask(GlobalSafepoint* safepoint,
+                          SingleThreadedHandle handle)
+      : safepoint_(safepoint), handle_(std::move(handle)) {}
+
+ private:
+  void Run() final {
+    if (handle_.IsCanceled()) return;
+
+    safepoint_->allocation_task_pending_.store(false,
+                                               std::memory_order_relaxed);
+    HeapBase& heap = safepoint_->heap_;
+    heap.stats_collector()->NotifySafePointForConservativeCollection();
+    heap.AdvanceIncrementalGarbageCollectionOnAllocationIfNeeded();
+  }
+
+  GlobalSafepoint* const safepoint_;
+  const SingleThreadedHandle handle_;
+};
+
+GlobalSafepoint::GlobalSafepoint(HeapBase& heap, cppgc::Platform* platform)
+    : heap_(heap),
+      foreground_task_runner_(platform->GetForegroundTaskRunner()) {}
+
+GlobalSafepoint::~GlobalSafepoint() {
+  DCHECK(!is_active_);
+  DCHECK(thread_local_heaps_.empty());
+  handle_.Cancel();
+}
+
+void GlobalSafepoint::Enter() {
+  DCHECK(!is_active_);
+  thread_local_heaps_mutex_.Lock();
+  is_active_ = true;
+
+  barrier_.Arm();
+
+  for (ThreadLocalHeap* thread_local_heap : thread_local_heaps_) {
+    thread_local_heap->RequestSafepoint();
+  }
+
+  for (ThreadLocalHeap* thread_local_heap : thread_local_heaps_) {
+    thread_local_heap->state_mutex_.Lock();
+    while (thread_local_heap->state_ ==
+           ThreadLocalHeap::ThreadState::kRunning) {
+      thread_local_heap->state_change_.Wait(&thread_local_heap->state_mutex_);
+    }
+    // The thread cannot resume before Leave() releases its state, so its
+    // buffers can be given up to make the heap iterable.
+    thread_local_heap->object_allocator().ResetLinearAllocationBuffers();
+  }
+}
+
+void GlobalSafepoint::Leave() {
+  DCHECK(is_active_);
+
+  for (ThreadLocalHeap* thread_local_heap : thread_local_heaps_) {
+    thread_local_heap->state_mutex_.Unlock();
+  }
+
+  barrier_.Disarm();
+
+  is_active_ = false;
+  thread_local_heaps_mutex_.Unlock();
+}
+
+bool GlobalSafepoint::HasThreadLocalHeaps() {
+  v8::base::MutexGuard guard(&thread_local_heaps_mutex_);
+  return !thread_local_heaps_.empty();
+}
+
+void GlobalSafepoint::NotifyAllocationOnThread() {
+  if (!foreground_task_runner_ ||
+      !foreground_task_runner_->NonNestableTasksEnabled())
+    return;
+  if (allocation_task_pending_.exchange(true, std::memory_order_relaxed))
+    return;
+  foreground_task_runner_->PostNonNestableTask(
+      std::make_unique<AllocationSafepointTask>(this, handle_));
+}
+
+void GlobalSafepoint::AddThreadLocalHeap(ThreadLocalHeap* thread_local_heap) {
+  v8::base::MutexGuard guard(&thread_local_heaps_mutex_);
+  DCHECK_EQ(thread_local_heaps_.end(),
+            std::find(thread_local_heaps_.begin(), thread_local_heaps_.end(),
+                      thread_local_heap));
+  thread_local_heaps_.push_back(thread_local_heap);
+}
+
+void GlobalSafepoint::RemoveThreadLocalHeap(
+    ThreadLocalHeap* thread_local_heap) {
+  DCHECK(thread_local_heap->IsParked());
+  v8::base::MutexGuard guard(&thread_local_heaps_mutex_);
+  // No garbage collection can be running while the lock is held, so the
+  // buffers of the parked thread can be given up here.
+  thread_local_heap->object_allocator().ResetLinearAllocationBuffers();
+  auto it = std::find(thread_local_heaps_.begin(), thread_local_heaps_.end(),
+                      thread_local_heap);
+  DCHECK_NE(thread_local_heaps_.end(), it);
+  thread_local_heaps_.erase(it);
+}
+
+void GlobalSafepoint::EnterFromThread(ThreadLocalHeap* thread_local_heap) {
+  {
+    v8::base::MutexGuard guard(&thread_local_heap->state_mutex_);
+    DCHECK_EQ(ThreadLocalHeap::ThreadState::kRunning,
+              thread_local_heap->state_);
+    thread_local_heap->state_ = ThreadLocalHeap::ThreadState::kSafepoint;
+    thread_local_heap->state_change_.NotifyAll();
+  }
+
+  barrier_.Wait();
+
+  {
+    v8::base::MutexGuard guard(&thread_local_heap->state_mutex_);
+    thread_local_heap->state_ = ThreadLocalHeap::ThreadState::kRunning;
+  }
+}
+
+void GlobalSafepoint::Barrier::Arm() {
+  v8::base::MutexGuard guard(&mutex_);
+  CHECK(!armed_);
+  armed_ = true;
+}
+
+void GlobalSafepoint::Barrier::Disarm() {
+  v8::base::MutexGuard guard(&mutex_);
+  CHECK(armed_);
+  armed_ = false;
+  cond_.NotifyAll();
+}
+
+void GlobalSafepoint::Barrier::Wait() {
+  v8::base::MutexGuard guard(&mutex_);
+  while (armed_) {
+    cond_.Wait(&mutex_);
+  }
+}
+
+}  // namespace internal
+}  // namespace cppgc
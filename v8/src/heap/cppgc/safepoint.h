@@ -0,0 +1,90 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CPPGC_SAFEPOINT_H_
+#define V8_HEAP_CPPGC_SAFEPOINT_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/cppgc/platform.h"
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/heap/cppgc/task-handle.h"
+
+namespace cppgc {
+namespace internal {
+
+class HeapBase;
+class ThreadLocalHeap;
+
+// Used to bring all ThreadLocalHeaps of a heap to a safepoint, such that the
+// thread owning the heap can perform a garbage collection. Works like the
+// safepoint of V8's heap: threads either run and have to invoke Safepoint()
+// regularly, or are parked and must not access the heap.
+class V8_EXPORT_PRIVATE GlobalSafepoint final {
+ public:
+  GlobalSafepoint(HeapBase& heap, cppgc::Platform* platform);
+  ~GlobalSafepoint();
+
+  GlobalSafepoint(const GlobalSafepoint&) = delete;
+  GlobalSafepoint& operator=(const GlobalSafepoint&) = delete;
+
+  // Stops all running ThreadLocalHeaps and gives up their linear allocation
+  // buffers. Threads stay stopped until Leave() is called. Called on the thread
+  // owning the heap.
+  void Enter();
+  void Leave();
+
+  bool IsActive() const { return is_active_; }
+
+  bool HasThreadLocalHeaps();
+
+  // Called by ThreadLocalHeaps after refilling a linear allocation buffer.
+  // Posts a task that accounts their allocations on the thread owning the heap,
+  // which may start a garbage collection.
+  void NotifyAllocationOnThread();
+
+ private:
+  class Barrier final {
+   public:
+    void Arm();
+    void Disarm();
+    void Wait();
+
+   private:
+    v8::base::Mutex mutex_;
+    v8::base::ConditionVariable cond_;
+    bool armed_ = false;
+  };
+
+  class AllocationSafepointTask;
+
+  void AddThreadLocalHeap(ThreadLocalHeap*);
+  void RemoveThreadLocalHeap(ThreadLocalHeap*);
+
+  // Called by a ThreadLocalHeap that was asked to stop.
+  void EnterFromThread(ThreadLocalHeap*);
+
+  HeapBase& heap_;
+  std::shared_ptr<cppgc::TaskRunner> foreground_task_runner_;
+  // Cancelled on destruction, so that pending tasks don't access the heap.
+  SingleThreadedHandle handle_{SingleThreadedHandle::NonEmptyTag{}};
+  std::atomic<bool> allocation_task_pending_{false};
+
+  Barrier barrier_;
+  // Held while the safepoint is active, so that no threads attach or detach.
+  v8::base::Mutex thread_local_heaps_mutex_;
+  std::vector<ThreadLocalHeap*> thread_local_heaps_;
+  bool is_active_ = false;
+
+  friend class ThreadLocalHeap;
+};
+
+}  // namespace internal
+}  // namespace cppgc
+
+#endif  // V8_HEAP_CPPGC_SAFEPOINT_H_
@@ -40,7 +40,20 @@ void StatsCollector::NotifyExplicitFree(size_t bytes) {
   explicitly_freed_bytes_since_safepoint_ += bytes;
 }
 
+void StatsCollector::NotifyAllocationOnThread(size_t bytes) {
+  allocated_bytes_on_threads_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void StatsCollector::NotifyExplicitFreeOnThread(size_t bytes) {
+  explicitly_freed_bytes_on_threads_.fetch_add(bytes,
+                                               std::memory_order_relaxed);
+}
+
 void StatsCollector::NotifySafePointForConservativeCollection() {
+  allocated_bytes_since_safepoint_ +=
+      allocated_bytes_on_threads_.exchange(0, std::memory_order_relaxed);
+  explicitly_freed_bytes_since_safepoint_ +=
+      explicitly_freed_bytes_on_threads_.exchange(0, std::memory_order_relaxed);
   if (std::abs(allocated_bytes_since_safepoint_ -
                explicitly_freed_bytes_since_safepoint_) >=
       static_cast<int64_t>(kAllocationThresholdBytes)) {
@@ -71,17 +84,26 @@ void StatsCollector::AllocatedObjectSizeSafepointImpl() {
   explicitly_freed_bytes_since_safepoint_ = 0;
 }
 
-void StatsCollector::NotifyMarkingStarted() {
+void StatsCollector::NotifyMarkingStarted(CollectionType collection_type) {
   DCHECK_EQ(GarbageCollectionState::kNotRunning, gc_state_);
   gc_state_ = GarbageCollectionState::kMarking;
+  current_.collection_type = collection_type;
+  time_of_last_start_of_marking_ = v8::base::TimeTicks::Now();
 }
 
 void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
+  if (current_.collection_type == CollectionType::kMinor) {
+    // Old objects keep their mark bits and are not accounted again.
+    minor_gc_statistics_.promoted_bytes += marked_bytes;
+    marked_bytes += previous_.marked_bytes;
+  }
   current_.marked_bytes = marked_bytes;
   allocated_bytes_since_safepoint_ = 0;
   explicitly_freed_bytes_since_safepoint_ = 0;
+  allocated_bytes_on_threads_.store(0, std::memory_order_relaxed);
+  explicitly_freed_bytes_on_threads_.store(0, std::memory_order_relaxed);
 
   ForAllAllocationObservers([marked_bytes](AllocationObserver* observer) {
     observer->ResetAllocatedObjectSize(marked_bytes);
@@ -91,6 +113,8 @@ void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   // execution of ResetAllocatedObjectSize.
   allocated_bytes_since_end_of_marking_ = 0;
   time_of_last_end_of_marking_ = v8::base::TimeTicks::Now();
+  current_.marking_time =
+      time_of_last_end_of_marking_ - time_of_last_start_of_marking_;
 }
 
 double StatsCollector::GetRecentAllocationSpeedInBytesPerMs() const {
@@ -104,6 +128,16 @@ double StatsCollector::GetRecentAllocationSpeedInBytesPerMs() const {
 const StatsCollector::Event& StatsCollector::NotifySweepingCompleted() {
   DCHECK_EQ(GarbageCollectionState::kSweeping, gc_state_);
   gc_state_ = GarbageCollectionState::kNotRunning;
+  current_.sweeping_time =
+      v8::base::TimeTicks::Now() - time_of_last_end_of_marking_;
+  if (current_.collection_type == CollectionType::kMinor) {
+    const v8::base::TimeDelta pause =
+        current_.marking_time + current_.sweeping_time;
+    minor_gc_statistics_.count++;
+    minor_gc_statistics_.total_pause += pause;
+    minor_gc_statistics_.max_pause =
+        std::max(minor_gc_statistics_.max_pause, pause);
+  }
   previous_ = std::move(current_);
   current_ = Event();
   return previous_;
@@ -8,10 +8,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <vector>
 
 #include "src/base/macros.h"
 #include "src/base/platform/time.h"
+#include "src/heap/cppgc/globals.h"
 
 namespace cppgc {
 namespace internal {
@@ -24,8 +26,24 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // The event is always fully populated when looking at previous events but
   // may only be partially populated when looking at the current event.
   struct Event final {
-    // Marked bytes collected during marking.
+    CollectionType collection_type = CollectionType::kMajor;
+    // Marked bytes collected during marking. Minor collections only mark
+    // young objects and add them to the marked bytes of the previous event.
     size_t marked_bytes = 0;
+    // Time from the start of marking to its end and from the end of marking
+    // to the end of sweeping.
+    v8::base::TimeDelta marking_time;
+    v8::base::TimeDelta sweeping_time;
+  };
+
+  // Statistics of all minor garbage collections. Minor collections are always
+  // atomic, so their duration is a pause of the mutator.
+  struct MinorGCStatistics final {
+    size_t count = 0;
+    // Bytes of young objects that survived and were promoted.
+    size_t promoted_bytes = 0;
+    v8::base::TimeDelta total_pause;
+    v8::base::TimeDelta max_pause;
   };
 
   // Observer for allocated object size. May be used to implement heap growing
@@ -62,13 +80,18 @@ class V8_EXPORT_PRIVATE StatsCollector final {
 
   void NotifyAllocation(size_t);
   void NotifyExplicitFree(size_t);
+  // Variants for ThreadLocalHeaps that may be called from any thread. The bytes
+  // are accounted at the next safepoint of the thread owning the heap.
+  void NotifyAllocationOnThread(size_t);
+  void NotifyExplicitFreeOnThread(size_t);
   // Safepoints should only be invoked when garabge collections are possible.
   // This is necessary as increments and decrements are reported as close to
   // their actual allocation/reclamation as possible.
   void NotifySafePointForConservativeCollection();
 
   // Indicates a new garbage collection cycle.
-  void NotifyMarkingStarted();
+  void NotifyMarkingStarted(
+      CollectionType collection_type = CollectionType::kMajor);
   // Indicates that marking of the current garbage collection cycle is
   // completed.
   void NotifyMarkingCompleted(size_t marked_bytes);
@@ -80,8 +103,18 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // bytes and the bytes allocated since last marking.
   size_t allocated_object_size() const;
 
+  // Bytes allocated since the end of the last marking phase, minus bytes
+  // explicitly freed. Only updated at safepoints.
+  int64_t allocated_bytes_since_end_of_marking() const {
+    return allocated_bytes_since_end_of_marking_;
+  }
+
   double GetRecentAllocationSpeedInBytesPerMs() const;
 
+  const MinorGCStatistics& minor_gc_statistics() const {
+    return minor_gc_statistics_;
+  }
+
  private:
   enum class GarbageCollectionState : uint8_t {
     kNotRunning,
@@ -101,12 +134,16 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // cycle.
   int64_t allocated_bytes_since_end_of_marking_ = 0;
   v8::base::TimeTicks time_of_last_end_of_marking_ = v8::base::TimeTicks::Now();
+  v8::base::TimeTicks time_of_last_start_of_marking_;
   // Counters for allocation and free. The individual values are never negative
   // but their delta may be because of the same reason the overall
   // allocated_bytes_since_end_of_marking_ may be negative. Keep integer
   // arithmetic for simplicity.
   int64_t allocated_bytes_since_safepoint_ = 0;
   int64_t explicitly_freed_bytes_since_safepoint_ = 0;
+  // Same for ThreadLocalHeaps, added to the counters above at safepoints.
+  std::atomic<int64_t> allocated_bytes_on_threads_{0};
+  std::atomic<int64_t> explicitly_freed_bytes_on_threads_{0};
 
   // vector to allow fast iteration of observers. Register/Unregisters only
   // happens on startup/teardown.
@@ -119,6 +156,8 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   Event current_;
   // The previous GC event which is populated at NotifySweepingFinished.
   Event previous_;
+
+  MinorGCStatistics minor_gc_statistics_;
 };
 
 template <typename Callback>
@@ -132,6 +132,7 @@ class InlinedFinalizationBuilder final {
 
   void AddFreeListEntry(Address start, size_t size) {
     auto* space = NormalPageSpace::From(page_->space());
+    v8::base::MutexGuard guard(&space->free_list_mutex());
     space->free_list().Add({start, size});
   }
 
@@ -225,6 +226,60 @@ typename FinalizationBuilder::ResultType SweepNormalPage(NormalPage* page) {
   return builder.GetResult(is_empty);
 }
 
+// Sweeps a page after a minor collection. Only unmarked objects are young and
+// dead. Free list entries on the page are still linked into the free list of
+// the space, so they are neither coalesced with new gaps nor re-added, and the
+// page is never released.
+template <typename FinalizationBuilder>
+typename FinalizationBuilder::ResultType SweepYoungObjectsOnNormalPage(
+    NormalPage* page) {
+  constexpr auto kAtomicAccess = AccessMode::kAtomic;
+  FinalizationBuilder builder(page);
+
+  PlatformAwareObjectStartBitmap& bitmap = page->object_start_bitmap();
+
+  Address start_of_gap = nullptr;
+  for (Address begin = page->PayloadStart(), end = page->PayloadEnd();
+       begin != end;) {
+    HeapObjectHeader* header = reinterpret_cast<HeapObjectHeader*>(begin);
+    const size_t size = header->GetSize();
+    if (!header->IsFree<kAtomicAccess>() &&
+        !header->IsMarked<kAtomicAccess>()) {
+      builder.AddFinalizer(header, size);
+      // The gap starts at its first object, so that bit stays set.
+      if (start_of_gap) {
+        bitmap.ClearBit(begin);
+      } else {
+        start_of_gap = begin;
+      }
+      begin += size;
+      continue;
+    }
+    if (start_of_gap) {
+      builder.AddFreeListEntry(start_of_gap,
+                               static_cast<size_t>(begin - start_of_gap));
+      start_of_gap = nullptr;
+    }
+    begin += size;
+  }
+
+  if (start_of_gap) {
+    builder.AddFreeListEntry(
+        start_of_gap, static_cast<size_t>(page->PayloadEnd() - start_of_gap));
+  }
+
+  return builder.GetResult(false);
+}
+
+template <typename FinalizationBuilder>
+typename FinalizationBuilder::ResultType SweepNormalPage(
+    NormalPage* page, CollectionType collection_type) {
+  if (collection_type == CollectionType::kMinor) {
+    return SweepYoungObjectsOnNormalPage<FinalizationBuilder>(page);
+  }
+  return SweepNormalPage<FinalizationBuilder>(page);
+}
+
 // SweepFinalizer is responsible for heap/space/page finalization. Finalization
 // is defined as a step following concurrent sweeping which:
 // - calls finalizers;
@@ -286,14 +341,17 @@ class SweepFinalizer final {
 
     DCHECK(!page->is_large());
 
-    // Merge freelists without finalizers.
-    FreeList& space_freelist =
-        NormalPageSpace::From(page->space())->free_list();
-    space_freelist.Append(std::move(page_state->cached_free_list));
+    {
+      NormalPageSpace* space = NormalPageSpace::From(page->space());
+      v8::base::MutexGuard guard(&space->free_list_mutex());
+      // Merge freelists without finalizers.
+      FreeList& space_freelist = space->free_list();
+      space_freelist.Append(std::move(page_state->cached_free_list));
 
-    // Merge freelist with finalizers.
-    for (auto entry : page_state->unfinalized_free_list) {
-      space_freelist.Add(std::move(entry));
+      // Merge freelist with finalizers.
+      for (auto entry : page_state->unfinalized_free_list) {
+        space_freelist.Add(std::move(entry));
+      }
     }
 
     // Add the page to the space.
@@ -308,8 +366,11 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   friend class HeapVisitor<MutatorThreadSweeper>;
 
  public:
-  explicit MutatorThreadSweeper(SpaceStates* states, cppgc::Platform* platform)
-      : states_(states), platform_(platform) {}
+  MutatorThreadSweeper(SpaceStates* states, cppgc::Platform* platform,
+                       CollectionType collection_type)
+      : states_(states),
+        platform_(platform),
+        collection_type_(collection_type) {}
 
   void Sweep() {
     for (SpaceState& state : *states_) {
@@ -361,7 +422,8 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   }
 
   bool VisitNormalPage(NormalPage* page) {
-    const bool is_empty = SweepNormalPage<InlinedFinalizationBuilder>(page);
+    const bool is_empty =
+        SweepNormalPage<InlinedFinalizationBuilder>(page, collection_type_);
     if (is_empty) {
       NormalPage::Destroy(page);
     } else {
@@ -384,6 +446,7 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
 
   SpaceStates* states_;
   cppgc::Platform* platform_;
+  const CollectionType collection_type_;
 };
 
 class ConcurrentSweepTask final : public cppgc::JobTask,
@@ -391,7 +454,8 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
   friend class HeapVisitor<ConcurrentSweepTask>;
 
  public:
-  explicit ConcurrentSweepTask(SpaceStates* states) : states_(states) {}
+  ConcurrentSweepTask(SpaceStates* states, CollectionType collection_type)
+      : states_(states), collection_type_(collection_type) {}
 
   void Run(cppgc::JobDelegate* delegate) final {
     for (SpaceState& state : *states_) {
@@ -410,7 +474,7 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
  private:
   bool VisitNormalPage(NormalPage* page) {
     SpaceState::SweptPageState sweep_result =
-        SweepNormalPage<DeferredFinalizationBuilder>(page);
+        SweepNormalPage<DeferredFinalizationBuilder>(page, collection_type_);
     const size_t space_index = page->space()->index();
     DCHECK_GT(states_->size(), space_index);
     SpaceState& space_state = (*states_)[space_index];
@@ -438,12 +502,15 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
   }
 
   SpaceStates* states_;
+  const CollectionType collection_type_;
   std::atomic_bool is_completed_{false};
 };
 
 // This visitor:
-// - resets linear allocation buffers and clears free lists for all spaces;
-// - moves all Heap pages to local Sweeper's state (SpaceStates).
+// - clears free lists for all spaces (for major collections);
+// - moves all Heap pages to local Sweeper's state (SpaceStates), or only the
+//   pages that may hold young objects for minor collections;
+// - promotes the pages of the nursery to the old generation.
 class PrepareForSweepVisitor final
     : public HeapVisitor<PrepareForSweepVisitor> {
   using CompactableSpaceHandling =
@@ -451,21 +518,48 @@ class PrepareForSweepVisitor final
 
  public:
   PrepareForSweepVisitor(SpaceStates* states,
-                         CompactableSpaceHandling compactable_space_handling)
+                         CompactableSpaceHandling compactable_space_handling,
+                         CollectionType collection_type)
       : states_(states),
-        compactable_space_handling_(compactable_space_handling) {}
+        compactable_space_handling_(compactable_space_handling),
+        collection_type_(collection_type) {}
 
   bool VisitNormalPageSpace(NormalPageSpace* space) {
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
         space->is_compactable())
       return true;
     DCHECK(!space->linear_allocation_buffer().size());
-    space->free_list().Clear();
+#if defined(CPPGC_YOUNG_GENERATION)
+    RawHeap* heap = space->raw_heap();
+    if (space == heap->Space(RawHeap::RegularSpaceType::kNursery)) {
+      PromoteNurseryPages(space, NormalPageSpace::From(heap->Space(
+                                     RawHeap::RegularSpaceType::kNormal4)));
+      return true;
+    }
+    // Only the nursery and custom spaces receive allocations.
+    if (collection_type_ == CollectionType::kMinor &&
+        space->index() < RawHeap::kNumberOfRegularSpaces)
+      return true;
+#endif
+    if (collection_type_ == CollectionType::kMajor) space->free_list().Clear();
     ExtractPages(space);
     return true;
   }
 
   bool VisitLargePageSpace(LargePageSpace* space) {
+    if (collection_type_ == CollectionType::kMinor) {
+      // Large objects that survived a previous collection keep their mark
+      // bits. The unmarked ones are young and dead.
+      BaseSpace::Pages space_pages = space->RemoveAllPages();
+      for (BasePage* page : space_pages) {
+        if (LargePage::From(page)->ObjectHeader()->IsMarked()) {
+          space->AddPage(page);
+        } else {
+          (*states_)[space->index()].unswept_pages.Push(page);
+        }
+      }
+      return true;
+    }
     ExtractPages(space);
     return true;
   }
@@ -477,8 +571,26 @@ class PrepareForSweepVisitor final
                                                     space_pages.end());
   }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Nursery pages are swept as pages of the old generation, which they are
+  // returned to after sweeping.
+  void PromoteNurseryPages(NormalPageSpace* nursery,
+                           NormalPageSpace* old_space) {
+    if (collection_type_ == CollectionType::kMajor) {
+      nursery->free_list().Clear();
+    } else {
+      old_space->free_list().Append(std::move(nursery->free_list()));
+    }
+    BaseSpace::Pages nursery_pages = nursery->RemoveAllPages();
+    for (BasePage* page : nursery_pages) page->set_space(old_space);
+    (*states_)[old_space->index()].unswept_pages.Insert(nursery_pages.begin(),
+                                                        nursery_pages.end());
+  }
+#endif
+
   SpaceStates* states_;
   CompactableSpaceHandling compactable_space_handling_;
+  const CollectionType collection_type_;
 };
 
 }  // namespace
@@ -496,12 +608,19 @@ class Sweeper::SweeperImpl final {
   ~SweeperImpl() { CancelSweepers(); }
 
   void Start(SweepingConfig config) {
+    // Minor sweeping leaves free list entries on pages it sweeps in place,
+    // which must not be allocated from before the pages are swept.
+    DCHECK_IMPLIES(config.collection_type == CollectionType::kMinor,
+                   config.sweeping_type ==
+                       SweepingConfig::SweepingType::kAtomic);
     is_in_progress_ = true;
 #if DEBUG
     // Verify bitmap for all spaces regardless of |compactable_space_handling|.
     ObjectStartBitmapVerifier().Verify(heap_);
 #endif
-    PrepareForSweepVisitor(&space_states_, config.compactable_space_handling)
+    collection_type_ = config.collection_type;
+    PrepareForSweepVisitor(&space_states_, config.compactable_space_handling,
+                           config.collection_type)
         .Traverse(heap_);
 
     if (config.sweeping_type == SweepingConfig::SweepingType::kAtomic) {
@@ -533,7 +652,7 @@ class Sweeper::SweeperImpl final {
     finalizer.FinalizeHeap(&space_states_);
 
     // Then, help out the concurrent thread.
-    MutatorThreadSweeper sweeper(&space_states_, platform_);
+    MutatorThreadSweeper sweeper(&space_states_, platform_, collection_type_);
     sweeper.Sweep();
 
     // Synchronize with the concurrent sweeper and call remaining finalizers.
@@ -568,7 +687,8 @@ class Sweeper::SweeperImpl final {
       if (handle_.IsCanceled() || !sweeper_->is_in_progress_) return;
 
       MutatorThreadSweeper sweeper(&sweeper_->space_states_,
-                                   sweeper_->platform_);
+                                   sweeper_->platform_,
+                                   sweeper_->collection_type_);
       const bool sweep_complete =
           sweeper.SweepWithDeadline(deadline_in_seconds);
 
@@ -601,7 +721,8 @@ class Sweeper::SweeperImpl final {
 
     concurrent_sweeper_handle_ = platform_->PostJob(
         cppgc::TaskPriority::kUserVisible,
-        std::make_unique<ConcurrentSweepTask>(&space_states_));
+        std::make_unique<ConcurrentSweepTask>(&space_states_,
+                                              collection_type_));
   }
 
   void CancelSweepers() {
@@ -625,6 +746,7 @@ class Sweeper::SweeperImpl final {
   IncrementalSweepTask::Handle incremental_sweeper_handle_;
   std::unique_ptr<cppgc::JobHandle> concurrent_sweeper_handle_;
   bool is_in_progress_ = false;
+  CollectionType collection_type_ = CollectionType::kMajor;
 };
 
 Sweeper::Sweeper(RawHeap* heap, cppgc::Platform* platform,
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "src/base/macros.h"
+#include "src/heap/cppgc/globals.h"
 
 namespace cppgc {
 
@@ -28,6 +29,9 @@ class V8_EXPORT_PRIVATE Sweeper final {
     SweepingType sweeping_type = SweepingType::kIncrementalAndConcurrent;
     CompactableSpaceHandling compactable_space_handling =
         CompactableSpaceHandling::kSweep;
+    // Minor collections only sweep pages that may hold young objects and
+    // leave existing free list entries in place.
+    CollectionType collection_type = CollectionType::kMajor;
   };
 
   Sweeper(RawHeap*, cppgc::Platform*, StatsCollector*);
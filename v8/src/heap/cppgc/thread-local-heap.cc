@@ -0,0 +1,79 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/cppgc/thread-local-heap.h"
+
+#include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/safepoint.h"
+
+namespace cppgc {
+
+// static
+std::unique_ptr<ThreadLocalHeap> ThreadLocalHeap::Create(Heap* heap) {
+  return std::make_unique<internal::ThreadLocalHeap>(
+      *internal::Heap::From(heap));
+}
+
+AllocationHandle& ThreadLocalHeap::GetAllocationHandle() {
+  return internal::ThreadLocalHeap::From(this)->object_allocator();
+}
+
+void ThreadLocalHeap::Safepoint() {
+  internal::ThreadLocalHeap::From(this)->Safepoint();
+}
+
+ThreadLocalHeap::ParkedScope::ParkedScope(ThreadLocalHeap& heap)
+    : heap_(heap) {
+  internal::ThreadLocalHeap::From(&heap_)->Park();
+}
+
+ThreadLocalHeap::ParkedScope::~ParkedScope() {
+  internal::ThreadLocalHeap::From(&heap_)->Unpark();
+}
+
+namespace internal {
+
+ThreadLocalHeap::ThreadLocalHeap(Heap& heap)
+    : heap_(heap),
+      object_allocator_(&heap.raw_heap(), heap.page_backend(),
+                        heap.stats_collector(), this) {
+  heap_.safepoint().AddThreadLocalHeap(this);
+}
+
+ThreadLocalHeap::~ThreadLocalHeap() {
+  // Park first, so that a garbage collection does not wait for this thread
+  // while it waits for the collection to finish.
+  Park();
+  heap_.safepoint().RemoveThreadLocalHeap(this);
+}
+
+void ThreadLocalHeap::Park() {
+  v8::base::MutexGuard guard(&state_mutex_);
+  DCHECK_EQ(ThreadState::kRunning, state_);
+  state_ = ThreadState::kParked;
+  state_change_.NotifyAll();
+}
+
+void ThreadLocalHeap::Unpark() {
+  // Blocks while a garbage collection holds the state.
+  v8::base::MutexGuard guard(&state_mutex_);
+  DCHECK_EQ(ThreadState::kParked, state_);
+  state_ = ThreadState::kRunning;
+}
+
+bool ThreadLocalHeap::IsParked() {
+  v8::base::MutexGuard guard(&state_mutex_);
+  return state_ == ThreadState::kParked;
+}
+
+void ThreadLocalHeap::RequestSafepoint() {
+  safepoint_requested_.store(true, std::memory_order_relaxed);
+}
+
+void ThreadLocalHeap::EnterSafepoint() {
+  heap_.safepoint().EnterFromThread(this);
+}
+
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,79 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CPPGC_THREAD_LOCAL_HEAP_H_
+#define V8_HEAP_CPPGC_THREAD_LOCAL_HEAP_H_
+
+#include <atomic>
+
+#include "include/cppgc/thread-local-heap.h"
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/heap/cppgc/object-allocator.h"
+
+namespace cppgc {
+namespace internal {
+
+class Heap;
+
+// Allocation state of a thread other than the one owning the heap. A
+// ThreadLocalHeap is either
+//   Running:   The thread may allocate and access the heap, and invokes
+//              Safepoint() regularly to give garbage collections the chance to
+//              run.
+//   Parked:    The thread does not access the heap, so garbage collections do
+//              not wait for it.
+//   Safepoint: The thread is stopped for a garbage collection.
+class V8_EXPORT_PRIVATE ThreadLocalHeap final : public cppgc::ThreadLocalHeap {
+ public:
+  static ThreadLocalHeap* From(cppgc::ThreadLocalHeap* heap) {
+    return static_cast<ThreadLocalHeap*>(heap);
+  }
+
+  explicit ThreadLocalHeap(Heap& heap);
+  ~ThreadLocalHeap() final;
+
+  ThreadLocalHeap(const ThreadLocalHeap&) = delete;
+  ThreadLocalHeap& operator=(const ThreadLocalHeap&) = delete;
+
+  Heap& heap() { return heap_; }
+
+  ObjectAllocator& object_allocator() { return object_allocator_; }
+
+  void Safepoint() {
+    if (V8_UNLIKELY(safepoint_requested_.load(std::memory_order_relaxed))) {
+      safepoint_requested_.store(false, std::memory_order_relaxed);
+      EnterSafepoint();
+    }
+  }
+
+  void Park();
+  void Unpark();
+  bool IsParked();
+
+ private:
+  enum class ThreadState : uint8_t { kRunning, kParked, kSafepoint };
+
+  // Invoked by the thread owning the heap.
+  void RequestSafepoint();
+
+  void EnterSafepoint();
+
+  Heap& heap_;
+  ObjectAllocator object_allocator_;
+
+  v8::base::Mutex state_mutex_;
+  v8::base::ConditionVariable state_change_;
+  ThreadState state_ = ThreadState::kRunning;
+
+  std::atomic<bool> safepoint_requested_{false};
+
+  friend class GlobalSafepoint;
+};
+
+}  // namespace internal
+}  // namespace cppgc
+
+#endif  // V8_HEAP_CPPGC_THREAD_LOCAL_HEAP_H_
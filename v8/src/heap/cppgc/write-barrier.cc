@@ -71,7 +71,18 @@ void WriteBarrier::GenerationalBarrierSlow(CagedHeapLocalData* local_data,
                                            const AgeTable& age_table,
                                            const void* slot,
                                            uintptr_t value_offset) {
-  if (age_table[value_offset] == AgeTable::Age::kOld) return;
+  const AgeTable::Age value_age = age_table[value_offset];
+  if (value_age == AgeTable::Age::kOld) return;
+  if (value_age == AgeTable::Age::kUnknown) {
+    // The region of the value holds young and old objects. Old objects have
+    // their mark bit set.
+    const uintptr_t value_address =
+        reinterpret_cast<uintptr_t>(local_data) + value_offset;
+    const void* value = reinterpret_cast<const void*>(value_address);
+    const auto& header =
+        BasePage::FromPayload(value)->ObjectHeaderFromInnerAddress(value);
+    if (!header.IsYoung()) return;
+  }
   // Record slot.
   local_data->heap_base->remembered_slots().insert(const_cast<void*>(slot));
 }
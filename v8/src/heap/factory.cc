@@ -426,10 +426,12 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_shared_function_info(*shared);
   vector->set_maybe_optimized_code(
       HeapObjectReference::ClearedValue(isolate()));
+  vector->set_baseline_code(*undefined_value(), SKIP_WRITE_BARRIER);
   vector->set_length(length);
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
   vector->InitializeOptimizationState();
+  vector->clear_padding();
   vector->set_closure_feedback_cell_array(*closure_feedback_cell_array);
 
   // TODO(leszeks): Initialize based on the feedback metadata.
@@ -126,7 +126,10 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
       young_object_size(0),
       survived_young_object_size(0),
       incremental_marking_bytes(0),
-      incremental_marking_duration(0.0) {
+      incremental_marking_duration(0.0),
+      scavenge_tasks(0),
+      old_to_new_pages(0),
+      scavenge_task_imbalance(0.0) {
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
@@ -203,6 +206,7 @@ void GCTracer::ResetForTesting() {
   recorded_embedder_generation_allocations_.Reset();
   recorded_context_disposal_times_.Reset();
   recorded_survival_ratios_.Reset();
+  recorded_old_to_new_pages_.Reset();
   start_counter_ = 0;
   average_mutator_duration_ = 0;
   average_mark_compact_duration_ = 0;
@@ -481,6 +485,24 @@ void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
 
+void GCTracer::AddScavengeTaskWork(int tasks, size_t old_to_new_pages,
+                                   size_t total_bytes, size_t max_task_bytes) {
+  DCHECK_EQ(Event::SCAVENGER, current_.type);
+  DCHECK_LT(0, tasks);
+  DCHECK_LE(max_task_bytes, total_bytes);
+  current_.scavenge_tasks = tasks;
+  current_.old_to_new_pages = old_to_new_pages;
+  recorded_old_to_new_pages_.Push(static_cast<double>(old_to_new_pages));
+  current_.scavenge_task_imbalance =
+      total_bytes == 0
+          ? 1.0
+          : static_cast<double>(max_task_bytes) * tasks / total_bytes;
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                       "V8.GCScavengerTaskImbalance", TRACE_EVENT_SCOPE_THREAD,
+                       "tasks", tasks, "imbalance",
+                       current_.scavenge_task_imbalance);
+}
+
 void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
   if (bytes > 0) {
     incremental_marking_bytes_ += bytes;
@@ -552,6 +574,13 @@ void GCTracer::PrintNVP() const {
   size_t allocated_since_last_gc =
       current_.start_object_size - previous_.end_object_size;
 
+  MemoryAllocator* memory_allocator = heap_->memory_allocator();
+  const size_t huge_page_backed_size = memory_allocator->HugePageBackedSize();
+  const double huge_page_coverage =
+      memory_allocator->Size() == 0
+          ? 0
+          : 100.0 * huge_page_backed_size / memory_allocator->Size();
+
   double incremental_walltime_duration = 0;
 
   if (current_.type == Event::INCREMENTAL_MARK_COMPACTOR) {
@@ -591,6 +620,9 @@ void GCTracer::PrintNVP() const {
           "incremental.steps_count=%d "
           "incremental.steps_took=%.1f "
           "scavenge_throughput=%.f "
+          "scavenge_tasks=%d "
+          "scavenge_task_imbalance=%.2f "
+          "old_to_new_pages=%zu "
           "total_size_before=%zu "
           "total_size_after=%zu "
           "holes_size_before=%zu "
@@ -607,6 +639,8 @@ void GCTracer::PrintNVP() const {
           "semi_space_copy_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "unmapper_chunks=%d "
+          "huge_page_backed=%zu "
+          "huge_page_coverage=%.1f%% "
           "context_disposal_rate=%.1f\n",
           duration, spent_in_mutator, current_.TypeName(true),
           current_.reduce_memory, current_.scopes[Scope::STOP_THE_WORLD],
@@ -636,10 +670,11 @@ void GCTracer::PrintNVP() const {
           current_.incremental_marking_scopes[GCTracer::Scope::MC_INCREMENTAL]
               .steps,
           current_.scopes[Scope::MC_INCREMENTAL],
-          ScavengeSpeedInBytesPerMillisecond(), current_.start_object_size,
-          current_.end_object_size, current_.start_holes_size,
-          current_.end_holes_size, allocated_since_last_gc,
-          heap_->promoted_objects_size(),
+          ScavengeSpeedInBytesPerMillisecond(), current_.scavenge_tasks,
+          current_.scavenge_task_imbalance, current_.old_to_new_pages,
+          current_.start_object_size, current_.end_object_size,
+          current_.start_holes_size, current_.end_holes_size,
+          allocated_since_last_gc, heap_->promoted_objects_size(),
           heap_->semi_space_copied_object_size(),
           heap_->nodes_died_in_new_space_, heap_->nodes_copied_in_new_space_,
           heap_->nodes_promoted_, heap_->promotion_ratio_,
@@ -647,6 +682,7 @@ void GCTracer::PrintNVP() const {
           heap_->semi_space_copied_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->unmapper()->NumberOfChunks(),
+          huge_page_backed_size, huge_page_coverage,
           ContextDisposalRateInMilliseconds());
       break;
     case Event::MINOR_MARK_COMPACTOR:
@@ -805,6 +841,8 @@ void GCTracer::PrintNVP() const {
           "semi_space_copy_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "unmapper_chunks=%d "
+          "huge_page_backed=%zu "
+          "huge_page_coverage=%.1f%% "
           "context_disposal_rate=%.1f "
           "compaction_speed=%.f\n",
           duration, spent_in_mutator, current_.TypeName(true),
@@ -901,6 +939,7 @@ void GCTracer::PrintNVP() const {
           heap_->semi_space_copied_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->unmapper()->NumberOfChunks(),
+          huge_page_backed_size, huge_page_coverage,
           ContextDisposalRateInMilliseconds(),
           CompactionSpeedInBytesPerMillisecond());
       break;
@@ -1140,6 +1179,13 @@ double GCTracer::AverageSurvivalRatio() const {
   return sum / recorded_survival_ratios_.Count();
 }
 
+double GCTracer::AverageOldToNewPages() const {
+  if (recorded_old_to_new_pages_.Count() == 0) return 0.0;
+  double sum = recorded_old_to_new_pages_.Sum(
+      [](double a, double b) { return a + b; }, 0.0);
+  return sum / recorded_old_to_new_pages_.Count();
+}
+
 bool GCTracer::SurvivalEventsRecorded() const {
   return recorded_survival_ratios_.Count() > 0;
 }
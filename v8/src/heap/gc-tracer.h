@@ -196,6 +196,16 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Duration of incremental marking steps for INCREMENTAL_MARK_COMPACTOR.
     double incremental_marking_duration;
 
+    // Number of parallel tasks and of pages with old-to-new slots for
+    // SCAVENGER.
+    int scavenge_tasks;
+    size_t old_to_new_pages;
+
+    // Bytes scavenged by the busiest task relative to the average of all
+    // tasks for SCAVENGER: 1 if the work was spread evenly, the number of
+    // tasks if a single task did all of it.
+    double scavenge_task_imbalance;
+
     // Amounts of time spent in different scopes during GC.
     double scopes[Scope::NUMBER_OF_SCOPES];
 
@@ -244,6 +254,11 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddSurvivalRatio(double survival_ratio);
 
+  // Log how the work of a parallel scavenge was spread across its tasks,
+  // given the bytes copied or promoted by all tasks and by the busiest one.
+  void AddScavengeTaskWork(int tasks, size_t old_to_new_pages,
+                           size_t total_bytes, size_t max_task_bytes);
+
   // Log an incremental marking step.
   void AddIncrementalMarkingStep(double duration, size_t bytes);
 
@@ -328,6 +343,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Returns true if at least one survival event was recorded.
   bool SurvivalEventsRecorded() const;
 
+  // Computes the average number of pages with old-to-new slots that recent
+  // scavenges processed. Returns 0 if no scavenges have been recorded.
+  double AverageOldToNewPages() const;
+
   // Discard all recorded survival events.
   void ResetSurvivalEvents();
 
@@ -382,6 +401,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, ScavengeTaskWork);
 
   struct BackgroundCounter {
     double total_duration_ms;
@@ -497,6 +517,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::RingBuffer<BytesAndDuration> recorded_embedder_generation_allocations_;
   base::RingBuffer<double> recorded_context_disposal_times_;
   base::RingBuffer<double> recorded_survival_ratios_;
+  base::RingBuffer<double> recorded_old_to_new_pages_;
 
   base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[BackgroundScope::NUMBER_OF_SCOPES];
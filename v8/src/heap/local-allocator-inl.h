@@ -84,13 +84,20 @@ AllocationResult EvacuationAllocator::AllocateInLAB(
 bool EvacuationAllocator::NewLocalAllocationBuffer() {
   if (lab_allocation_will_fail_) return false;
   AllocationResult result =
-      new_space_->AllocateRawSynchronized(kLabSize, kWordAligned);
+      new_space_->AllocateRawSynchronized(lab_size_, kWordAligned);
+  while (FLAG_adaptive_scavenge_lab_size && result.IsRetry() &&
+         lab_size_ > kMinLabSize) {
+    // A smaller LAB may still fit at the end of new space.
+    lab_size_ = Max(lab_size_ / 2, kMinLabSize);
+    result = new_space_->AllocateRawSynchronized(lab_size_, kWordAligned);
+  }
   if (result.IsRetry()) {
     lab_allocation_will_fail_ = true;
     return false;
   }
   LocalAllocationBuffer saved_lab = std::move(new_space_lab_);
-  new_space_lab_ = LocalAllocationBuffer::FromResult(heap_, result, kLabSize);
+  new_space_lab_ = LocalAllocationBuffer::FromResult(heap_, result, lab_size_);
+  lab_size_ = Min(2 * lab_size_, max_lab_size_);
   DCHECK(new_space_lab_.IsValid());
   if (!new_space_lab_.TryMerge(&saved_lab)) {
     saved_lab.CloseAndMakeIterable();
@@ -19,14 +19,26 @@ namespace internal {
 class EvacuationAllocator {
  public:
   static const int kLabSize = 32 * KB;
+  static const int kMinLabSize = 16 * KB;
+  static const int kMaxLabSize = 64 * KB;
   static const int kMaxLabObjectSize = 8 * KB;
 
-  explicit EvacuationAllocator(Heap* heap, LocalSpaceKind local_space_kind)
+  // New space LABs start at {lab_size} and double every time they are
+  // refilled, up to {max_lab_size}. With --adaptive-scavenge-lab-size, they
+  // shrink again when new space runs out of room for them.
+  EvacuationAllocator(Heap* heap, LocalSpaceKind local_space_kind,
+                      int lab_size = kLabSize, int max_lab_size = kLabSize)
       : heap_(heap),
         new_space_(heap->new_space()),
         compaction_spaces_(heap, local_space_kind),
         new_space_lab_(LocalAllocationBuffer::InvalidBuffer()),
-        lab_allocation_will_fail_(false) {}
+        lab_size_(lab_size),
+        max_lab_size_(max_lab_size),
+        lab_allocation_will_fail_(false) {
+    DCHECK_LE(kMinLabSize, lab_size_);
+    DCHECK_LE(lab_size_, max_lab_size_);
+    DCHECK_LE(max_lab_size_, kMaxLabSize);
+  }
 
   // Needs to be called from the main thread to finalize this
   // EvacuationAllocator.
@@ -59,6 +71,8 @@ class EvacuationAllocator {
   NewSpace* const new_space_;
   CompactionSpaceCollection compaction_spaces_;
   LocalAllocationBuffer new_space_lab_;
+  int lab_size_;
+  const int max_lab_size_;
   bool lab_allocation_will_fail_;
 };
 
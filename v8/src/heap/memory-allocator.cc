@@ -44,6 +44,11 @@ void CodeRangeAddressHint::NotifyFreedCodeRange(Address code_range_start,
 // MemoryAllocator
 //
 
+// static
+constexpr size_t MemoryAllocator::kHugePageSize;
+// static
+constexpr size_t MemoryAllocator::kHugePageRegionSize;
+
 MemoryAllocator::MemoryAllocator(Isolate* isolate, size_t capacity,
                                  size_t code_range_size)
     : isolate_(isolate),
@@ -119,6 +124,18 @@ void MemoryAllocator::InitializeCodePageAllocator(
                 MemoryChunk::kPageSize);
   DCHECK(IsAligned(aligned_base, kMinExpectedOSPageSize));
 
+  if (FLAG_huge_pages) {
+    // The bounded allocator below packs code pages into the code range, so
+    // neighboring pages share huge pages.
+    Address huge_page_start = RoundUp(aligned_base, kHugePageSize);
+    Address huge_page_end = RoundDown(aligned_base + size, kHugePageSize);
+    if (huge_page_start < huge_page_end) {
+      code_range_huge_pages_ = page_allocator->AdviseHugePages(
+          reinterpret_cast<void*>(huge_page_start),
+          huge_page_end - huge_page_start);
+    }
+  }
+
   LOG(isolate_,
       NewEvent("CodeRange", reinterpret_cast<void*>(reservation.address()),
                requested));
@@ -139,6 +156,9 @@ void MemoryAllocator::TearDown() {
   // DCHECK_EQ(0, size_executable_);
   capacity_ = 0;
 
+  DCHECK_EQ(huge_page_backed_size_, 0u);
+  huge_page_regions_.clear();
+
   if (last_chunk_.IsReserved()) {
     last_chunk_.Free();
   }
@@ -150,6 +170,7 @@ void MemoryAllocator::TearDown() {
     code_range_ = base::AddressRegion();
     code_page_allocator_instance_.reset();
   }
+  code_range_huge_pages_ = false;
   code_page_allocator_ = nullptr;
   data_page_allocator_ = nullptr;
 }
@@ -356,6 +377,95 @@ Address MemoryAllocator::AllocateAlignedMemory(
   return base;
 }
 
+bool MemoryAllocator::ShouldUseHugePageRegion(BaseSpace* owner,
+                                              size_t chunk_size,
+                                              Executability executable) const {
+  // Only regular pages are packed. Large pages are released as a whole and
+  // would leave holes that pages of other sizes cannot fill.
+  return FLAG_huge_pages && executable == NOT_EXECUTABLE && owner != nullptr &&
+         owner->identity() == OLD_SPACE &&
+         chunk_size == static_cast<size_t>(MemoryChunk::kPageSize);
+}
+
+std::unique_ptr<MemoryAllocator::HugePageRegion>
+MemoryAllocator::ReserveHugePageRegion() {
+  // Over-reserve instead of passing kHugePageSize as alignment, because
+  // bounded page allocators (e.g. with pointer compression) cannot align to
+  // more than their allocation granularity.
+  void* hint = AlignedAddress(isolate_->heap()->GetRandomMmapAddr(),
+                              kHugePageSize);
+  VirtualMemory reservation(data_page_allocator_,
+                            kHugePageRegionSize + kHugePageSize, hint);
+  if (!reservation.IsReserved()) return nullptr;
+  Address start = RoundUp(reservation.address(), kHugePageSize);
+  DCHECK_LE(start + kHugePageRegionSize, reservation.end());
+  if (!data_page_allocator_->AdviseHugePages(reinterpret_cast<void*>(start),
+                                             kHugePageRegionSize)) {
+    huge_pages_supported_ = false;
+    return nullptr;
+  }
+  std::unique_ptr<HugePageRegion> region = std::make_unique<HugePageRegion>();
+  region->reservation = std::move(reservation);
+  region->allocator = std::make_unique<base::BoundedPageAllocator>(
+      data_page_allocator_, start, kHugePageRegionSize,
+      static_cast<size_t>(MemoryChunk::kAlignment));
+  return region;
+}
+
+Address MemoryAllocator::AllocateHugePageBackedMemory(
+    size_t chunk_size, size_t commit_size, VirtualMemory* controller) {
+  DCHECK_LE(commit_size, chunk_size);
+  base::MutexGuard guard(&huge_page_regions_mutex_);
+  if (!huge_pages_supported_) return kNullAddress;
+  v8::PageAllocator* region_allocator = nullptr;
+  void* address = nullptr;
+  // Prefer the oldest regions so that the newer ones drain when the heap
+  // shrinks.
+  for (auto& region : huge_page_regions_) {
+    region_allocator = region->allocator.get();
+    address = region_allocator->AllocatePages(nullptr, chunk_size,
+                                              MemoryChunk::kAlignment,
+                                              PageAllocator::kNoAccess);
+    if (address != nullptr) break;
+  }
+  if (address == nullptr) {
+    std::unique_ptr<HugePageRegion> region = ReserveHugePageRegion();
+    if (!region) return kNullAddress;
+    region_allocator = region->allocator.get();
+    address = region_allocator->AllocatePages(nullptr, chunk_size,
+                                              MemoryChunk::kAlignment,
+                                              PageAllocator::kNoAccess);
+    DCHECK_NOT_NULL(address);
+    huge_page_regions_.push_back(std::move(region));
+  }
+
+  VirtualMemory reservation(region_allocator,
+                            reinterpret_cast<Address>(address), chunk_size);
+  Address base = reservation.address();
+  if (!reservation.SetPermissions(base, commit_size,
+                                  PageAllocator::kReadWrite)) {
+    reservation.Free();
+    return kNullAddress;
+  }
+  UpdateAllocatedSpaceLimits(base, base + commit_size);
+  size_ += reservation.size();
+  huge_page_backed_size_ += reservation.size();
+  *controller = std::move(reservation);
+  return base;
+}
+
+bool MemoryAllocator::IsInHugePageRegion(Address address) {
+  base::MutexGuard guard(&huge_page_regions_mutex_);
+  for (auto& region : huge_page_regions_) {
+    base::BoundedPageAllocator* allocator = region->allocator.get();
+    if (address >= allocator->begin() &&
+        address < allocator->begin() + allocator->size()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 V8_EXPORT_PRIVATE BasicMemoryChunk* MemoryAllocator::AllocateBasicChunk(
     size_t reserve_area_size, size_t commit_area_size, Executability executable,
     BaseSpace* owner) {
@@ -432,9 +542,15 @@ V8_EXPORT_PRIVATE BasicMemoryChunk* MemoryAllocator::AllocateBasicChunk(
     size_t commit_size = ::RoundUp(
         MemoryChunkLayout::ObjectStartOffsetInDataPage() + commit_area_size,
         GetCommitPageSize());
-    base =
-        AllocateAlignedMemory(chunk_size, commit_size, MemoryChunk::kAlignment,
-                              executable, address_hint, &reservation);
+    if (ShouldUseHugePageRegion(owner, chunk_size, executable)) {
+      base = AllocateHugePageBackedMemory(chunk_size, commit_size,
+                                          &reservation);
+    }
+    if (base == kNullAddress) {
+      base = AllocateAlignedMemory(chunk_size, commit_size,
+                                   MemoryChunk::kAlignment, executable,
+                                   address_hint, &reservation);
+    }
 
     if (base == kNullAddress) return nullptr;
 
@@ -516,6 +632,9 @@ void MemoryAllocator::PartialFreeMemory(BasicMemoryChunk* chunk,
   const size_t released_bytes = reservation->Release(start_free);
   DCHECK_GE(size_, released_bytes);
   size_ -= released_bytes;
+  if (IsInHugePageRegion(chunk->address())) {
+    huge_page_backed_size_ -= released_bytes;
+  }
 }
 
 void MemoryAllocator::UnregisterSharedMemory(BasicMemoryChunk* chunk) {
@@ -535,6 +654,10 @@ void MemoryAllocator::UnregisterMemory(BasicMemoryChunk* chunk,
   DCHECK_GE(size_, static_cast<size_t>(size));
 
   size_ -= size;
+  if (huge_page_backed_size_ > 0 && IsInHugePageRegion(chunk->address())) {
+    DCHECK_GE(huge_page_backed_size_, size);
+    huge_page_backed_size_ -= size;
+  }
   if (executable == EXECUTABLE) {
     DCHECK_GE(size_executable_, size);
     size_executable_ -= size;
@@ -204,6 +204,13 @@ class MemoryAllocator {
   // Returns allocated executable spaces in bytes.
   size_t SizeExecutable() const { return size_executable_; }
 
+  // Returns allocated bytes that were placed in memory advised to be backed by
+  // huge pages, see --huge-pages.
+  size_t HugePageBackedSize() const {
+    return huge_page_backed_size_ +
+           (code_range_huge_pages_ ? size_executable_.load() : 0);
+  }
+
   // Returns the maximum available bytes of heaps.
   size_t Available() const {
     const size_t size = Size();
@@ -263,6 +270,12 @@ class MemoryAllocator {
   // a given zap value.
   void ZapBlock(Address start, size_t size, uintptr_t zap_value);
 
+  // Size and alignment of the huge pages requested by --huge-pages.
+  static constexpr size_t kHugePageSize = 2 * MB;
+  // Size of the regions that regular old space pages are packed into when
+  // --huge-pages is enabled.
+  static constexpr size_t kHugePageRegionSize = 8 * kHugePageSize;
+
   V8_WARN_UNUSED_RESULT bool CommitExecutableMemory(VirtualMemory* vm,
                                                     Address start,
                                                     size_t commit_size,
@@ -306,9 +319,34 @@ class MemoryAllocator {
   void RegisterReadOnlyMemory(ReadOnlyPage* page);
 
  private:
+  // A kHugePageSize-aligned region of kHugePageRegionSize bytes that is
+  // advised to be backed by huge pages. Pages are carved out of it by
+  // |allocator|, so that neighboring pages share huge pages.
+  struct HugePageRegion {
+    VirtualMemory reservation;
+    std::unique_ptr<base::BoundedPageAllocator> allocator;
+  };
+
   void InitializeCodePageAllocator(v8::PageAllocator* page_allocator,
                                    size_t requested);
 
+  // Returns whether a chunk of |chunk_size| bytes for |owner| should be placed
+  // in a huge page region.
+  bool ShouldUseHugePageRegion(BaseSpace* owner, size_t chunk_size,
+                               Executability executable) const;
+
+  // Like AllocateAlignedMemory but reserves |chunk_size| bytes in a huge page
+  // region, reserving a new region if all existing ones are full. Returns
+  // kNullAddress on failure.
+  Address AllocateHugePageBackedMemory(size_t chunk_size, size_t commit_size,
+                                       VirtualMemory* controller);
+
+  // Reserves a new huge page region. Returns nullptr if the memory could not
+  // be reserved or huge pages are not supported by the OS.
+  std::unique_ptr<HugePageRegion> ReserveHugePageRegion();
+
+  bool IsInHugePageRegion(Address address);
+
   // PreFreeMemory logically frees the object, i.e., it unregisters the
   // memory, logs a delete event and adds the chunk to remembered unmapped
   // pages.
@@ -413,6 +451,18 @@ class MemoryAllocator {
   VirtualMemory last_chunk_;
   Unmapper unmapper_;
 
+  // Regions that regular old space pages are allocated in when --huge-pages
+  // is enabled. Regions are kept until tear down and reused as pages are
+  // freed.
+  std::vector<std::unique_ptr<HugePageRegion>> huge_page_regions_;
+  base::Mutex huge_page_regions_mutex_;
+  // Cleared when the OS rejected the huge page advice.
+  bool huge_pages_supported_ = true;
+  // Allocated bytes in |huge_page_regions_|.
+  std::atomic<size_t> huge_page_backed_size_{0};
+  // Whether the code range was advised to be backed by huge pages.
+  bool code_range_huge_pages_ = false;
+
   // Data structure to remember allocated executable memory chunks.
   std::unordered_set<MemoryChunk*> executable_memory_;
   base::Mutex executable_memory_mutex_;
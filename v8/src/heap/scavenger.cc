@@ -293,10 +293,14 @@ void ScavengerCollector::CollectGarbage() {
     });
 
     const bool is_logging = isolate_->LogObjectRelocation();
+    const int lab_size = InitialLabSize(num_scavenge_tasks);
+    const int max_lab_size = FLAG_adaptive_scavenge_lab_size
+                                 ? EvacuationAllocator::kMaxLabSize
+                                 : EvacuationAllocator::kLabSize;
     for (int i = 0; i < num_scavenge_tasks; ++i) {
-      scavengers.emplace_back(
-          new Scavenger(this, heap_, is_logging, &empty_chunks, &copied_list,
-                        &promotion_list, &ephemeron_table_list, i));
+      scavengers.emplace_back(new Scavenger(
+          this, heap_, is_logging, &empty_chunks, &copied_list, &promotion_list,
+          &ephemeron_table_list, i, lab_size, max_lab_size));
     }
 
     std::vector<std::pair<ParallelWorkItem, MemoryChunk*>> memory_chunks;
@@ -304,6 +308,7 @@ void ScavengerCollector::CollectGarbage() {
         heap_, [&memory_chunks](MemoryChunk* chunk) {
           memory_chunks.emplace_back(ParallelWorkItem{}, chunk);
         });
+    const size_t old_to_new_pages = memory_chunks.size();
 
     RootScavengeVisitor root_scavenge_visitor(scavengers[kMainThreadId].get());
 
@@ -374,10 +379,19 @@ void ScavengerCollector::CollectGarbage() {
 
       DCHECK(surviving_new_large_objects_.empty());
 
+      size_t total_bytes = 0;
+      size_t max_task_bytes = 0;
       for (auto& scavenger : scavengers) {
+        size_t task_bytes =
+            scavenger->bytes_copied() + scavenger->bytes_promoted();
+        total_bytes += task_bytes;
+        max_task_bytes = Max(max_task_bytes, task_bytes);
         scavenger->Finalize();
       }
       scavengers.clear();
+      heap_->tracer()->AddScavengeTaskWork(num_scavenge_tasks,
+                                           old_to_new_pages, total_bytes,
+                                           max_task_bytes);
 
       HandleSurvivingNewLargeObjects();
     }
@@ -497,10 +511,29 @@ void ScavengerCollector::MergeSurvivingNewLargeObjects(
   }
 }
 
+size_t ScavengerCollector::EstimatedSurvivingBytes() {
+  // Survival ratios are percentages of the young generation size.
+  return static_cast<size_t>(heap_->new_space()->Size() *
+                             heap_->tracer()->AverageSurvivalRatio() / 100);
+}
+
 int ScavengerCollector::NumberOfScavengeTasks() {
   if (!FLAG_parallel_scavenge) return 1;
-  const int num_scavenge_tasks =
-      static_cast<int>(heap_->new_space()->TotalCapacity()) / MB + 1;
+  GCTracer* tracer = heap_->tracer();
+  int num_scavenge_tasks;
+  if (FLAG_adaptive_scavenge_tasks && tracer->SurvivalEventsRecorded()) {
+    // Size the job by the work recent scavenges had: copying or promoting
+    // the surviving objects, and processing the old-to-new slots. Tiny
+    // scavenges then do not pay for starting tasks that find nothing to do.
+    num_scavenge_tasks =
+        static_cast<int>(EstimatedSurvivingBytes() / kSurvivingBytesPerTask +
+                         tracer->AverageOldToNewPages() /
+                             kOldToNewPagesPerTask) +
+        1;
+  } else {
+    num_scavenge_tasks =
+        static_cast<int>(heap_->new_space()->TotalCapacity()) / MB + 1;
+  }
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
   int tasks =
       Max(1, Min(Min(num_scavenge_tasks, kMaxScavengerTasks), num_cores));
@@ -512,10 +545,26 @@ int ScavengerCollector::NumberOfScavengeTasks() {
   return tasks;
 }
 
+int ScavengerCollector::InitialLabSize(int num_scavenge_tasks) {
+  if (!FLAG_adaptive_scavenge_lab_size ||
+      !heap_->tracer()->SurvivalEventsRecorded()) {
+    return EvacuationAllocator::kLabSize;
+  }
+  // Tasks that are expected to copy little start with small LABs, so that
+  // less of to-space is left unused at the end of their last LAB. Busy
+  // tasks grow their LABs as they refill them.
+  size_t bytes_per_task = EstimatedSurvivingBytes() / num_scavenge_tasks;
+  return static_cast<int>(
+      Max(Min(bytes_per_task / 4,
+              static_cast<size_t>(EvacuationAllocator::kLabSize)),
+          static_cast<size_t>(EvacuationAllocator::kMinLabSize)));
+}
+
 Scavenger::Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
                      Worklist<MemoryChunk*, 64>* empty_chunks,
                      CopiedList* copied_list, PromotionList* promotion_list,
-                     EphemeronTableList* ephemeron_table_list, int task_id)
+                     EphemeronTableList* ephemeron_table_list, int task_id,
+                     int lab_size, int max_lab_size)
     : collector_(collector),
       heap_(heap),
       empty_chunks_(empty_chunks, task_id),
@@ -525,7 +574,8 @@ Scavenger::Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
       local_pretenuring_feedback_(kInitialLocalPretenuringFeedbackCapacity),
       copied_size_(0),
       promoted_size_(0),
-      allocator_(heap, LocalSpaceKind::kCompactionSpaceForScavenge),
+      allocator_(heap, LocalSpaceKind::kCompactionSpaceForScavenge, lab_size,
+                 max_lab_size),
       is_logging_(is_logging),
       is_incremental_marking_(heap->incremental_marking()->IsMarking()),
       is_compacting_(heap->incremental_marking()->IsCompacting()) {}
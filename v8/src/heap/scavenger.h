@@ -100,7 +100,8 @@ class Scavenger {
   Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
             Worklist<MemoryChunk*, 64>* empty_chunks, CopiedList* copied_list,
             PromotionList* promotion_list,
-            EphemeronTableList* ephemeron_table_list, int task_id);
+            EphemeronTableList* ephemeron_table_list, int task_id,
+            int lab_size, int max_lab_size);
 
   // Entry point for scavenging an old generation page. For scavenging single
   // objects see RootScavengingVisitor and ScavengeVisitor below.
@@ -256,6 +257,10 @@ class ScavengerCollector {
   static const int kMaxScavengerTasks = 8;
   static const int kMainThreadId = 0;
 
+  // Amounts of work that justify one more scavenger task.
+  static const size_t kSurvivingBytesPerTask = 256 * KB;
+  static const int kOldToNewPagesPerTask = 16;
+
   explicit ScavengerCollector(Heap* heap);
 
   void CollectGarbage();
@@ -291,7 +296,11 @@ class ScavengerCollector {
   void MergeSurvivingNewLargeObjects(
       const SurvivingNewLargeObjectsMap& objects);
 
+  // Estimates the size of the young objects that will survive this
+  // scavenge from the survival rate of recent GCs.
+  size_t EstimatedSurvivingBytes();
   int NumberOfScavengeTasks();
+  int InitialLabSize(int num_scavenge_tasks);
 
   void ProcessWeakReferences(EphemeronTableList* ephemeron_table_list);
   void ClearYoungEphemerons(EphemeronTableList* ephemeron_table_list);
@@ -25,6 +25,7 @@
 #include "src/profiler/heap-profiler.h"
 #include "src/snapshot/snapshot.h"
 #include "src/tracing/tracing-category-observer.h"
+#include "src/utils/simd-dispatch.h"
 #include "src/wasm/wasm-engine.h"
 
 namespace v8 {
@@ -113,6 +114,7 @@ void V8::InitializeOncePerProcessImpl() {
   Simulator::InitializeOncePerProcess();
 #endif
   CpuFeatures::Probe(false);
+  SimdDispatch::InitializeOncePerProcess();
   ElementsAccessor::InitializeOncePerProcess();
   Bootstrapper::InitializeOncePerProcess();
   CallDescriptors::InitializeOncePerProcess();
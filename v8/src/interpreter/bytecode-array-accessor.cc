@@ -112,7 +112,10 @@ Bytecode BytecodeArrayAccessor::current_bytecode() const {
       bytecode_array()->get(bytecode_offset_ + current_prefix_offset());
   Bytecode current_bytecode = Bytecodes::FromByte(current_byte);
   DCHECK(!Bytecodes::IsPrefixScalingBytecode(current_bytecode));
-  return current_bytecode;
+  // A superinstruction only differs from the bytecode it was fused from in how
+  // the interpreter dispatches it, so report that bytecode instead. The
+  // bytecode it was fused with follows as usual.
+  return Bytecodes::GetUnfusedBytecode(current_bytecode);
 }
 
 int BytecodeArrayAccessor::current_bytecode_size() const {
@@ -33,6 +33,7 @@ BytecodeArrayWriter::BytecodeArrayWriter(
       last_bytecode_offset_(0),
       last_bytecode_had_source_info_(false),
       elide_noneffectful_bytecodes_(FLAG_ignition_elide_noneffectful_bytecodes),
+      fuse_superinstructions_(FLAG_ignition_superinstructions),
       exit_seen_in_block_(false) {
   bytecodes_.reserve(512);  // Derived via experimentation.
 }
@@ -111,6 +112,7 @@ void BytecodeArrayWriter::Write(BytecodeNode* node) {
 
   if (exit_seen_in_block_) return;  // Don't emit dead code.
   UpdateExitSeenInBlock(node->bytecode());
+  MaybeFuseWithLastBytecode(node);
   MaybeElideLastBytecode(node->bytecode(), node->source_info().is_valid());
 
   UpdateSourcePositionTable(node);
@@ -122,6 +124,7 @@ void BytecodeArrayWriter::WriteJump(BytecodeNode* node, BytecodeLabel* label) {
 
   if (exit_seen_in_block_) return;  // Don't emit dead code.
   UpdateExitSeenInBlock(node->bytecode());
+  MaybeFuseWithLastBytecode(node);
   MaybeElideLastBytecode(node->bytecode(), node->source_info().is_valid());
 
   UpdateSourcePositionTable(node);
@@ -245,14 +248,35 @@ void BytecodeArrayWriter::UpdateExitSeenInBlock(Bytecode bytecode) {
   }
 }
 
+void BytecodeArrayWriter::MaybeFuseWithLastBytecode(
+    const BytecodeNode* const node) {
+  if (!fuse_superinstructions_) return;
+
+  // If the last bytecode and the next one form a superinstruction, patch the
+  // last bytecode into it. The next bytecode is emitted as usual, so its
+  // offset stays valid for source positions, the deoptimizer and exception
+  // handlers. Superinstructions have no scaled variants, so neither bytecode
+  // may need a scaling prefix. A forward jump may still turn out to need one,
+  // or a constant pool operand, once its label is bound; the superinstruction
+  // then simply dispatches to it.
+  if (node->operand_scale() != OperandScale::kSingle) return;
+  Bytecode superinstruction =
+      Bytecodes::GetSuperinstruction(last_bytecode_, node->bytecode());
+  if (superinstruction == Bytecode::kIllegal) return;
+  uint8_t& last_byte = bytecodes()->at(last_bytecode_offset_);
+  if (last_byte != Bytecodes::ToByte(last_bytecode_)) return;
+  last_byte = Bytecodes::ToByte(superinstruction);
+}
+
 void BytecodeArrayWriter::MaybeElideLastBytecode(Bytecode next_bytecode,
                                                  bool has_source_info) {
-  if (!elide_noneffectful_bytecodes_) return;
+  if (!elide_noneffectful_bytecodes_ && !fuse_superinstructions_) return;
 
   // If the last bytecode loaded the accumulator without any external effect,
   // and the next bytecode clobbers this load without reading the accumulator,
   // then the previous bytecode can be elided as it has no effect.
-  if (Bytecodes::IsAccumulatorLoadWithoutEffects(last_bytecode_) &&
+  if (elide_noneffectful_bytecodes_ &&
+      Bytecodes::IsAccumulatorLoadWithoutEffects(last_bytecode_) &&
       Bytecodes::GetAccumulatorUse(next_bytecode) == AccumulatorUse::kWrite &&
       (!last_bytecode_had_source_info_ || !has_source_info)) {
     DCHECK_GT(bytecodes()->size(), last_bytecode_offset_);
@@ -102,6 +102,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
 
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
+  void MaybeFuseWithLastBytecode(const BytecodeNode* const node);
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
   void InvalidateLastBytecode();
 
@@ -124,6 +125,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   size_t last_bytecode_offset_;
   bool last_bytecode_had_source_info_;
   bool elide_noneffectful_bytecodes_;
+  bool fuse_superinstructions_;
 
   bool exit_seen_in_block_;
 
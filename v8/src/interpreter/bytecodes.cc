@@ -169,6 +169,43 @@ Bytecode Bytecodes::GetJumpWithoutToBoolean(Bytecode bytecode) {
   UNREACHABLE();
 }
 
+// static
+Bytecode Bytecodes::GetUnfusedBytecode(Bytecode bytecode) {
+  switch (bytecode) {
+#define CASE(Name, First, Second) \
+  case Bytecode::k##Name:         \
+    return Bytecode::k##First;
+    SUPERINSTRUCTION_LIST(CASE)
+#undef CASE
+    default:
+      return bytecode;
+  }
+}
+
+// static
+Bytecode Bytecodes::GetFusedSuccessor(Bytecode bytecode) {
+  switch (bytecode) {
+#define CASE(Name, First, Second) \
+  case Bytecode::k##Name:         \
+    return Bytecode::k##Second;
+    SUPERINSTRUCTION_LIST(CASE)
+#undef CASE
+    default:
+      break;
+  }
+  UNREACHABLE();
+}
+
+// static
+Bytecode Bytecodes::GetSuperinstruction(Bytecode first, Bytecode second) {
+#define CASE(Name, First, Second)                                   \
+  if (first == Bytecode::k##First && second == Bytecode::k##Second) \
+    return Bytecode::k##Name;
+  SUPERINSTRUCTION_LIST(CASE)
+#undef CASE
+  return Bytecode::kIllegal;
+}
+
 // static
 bool Bytecodes::IsDebugBreak(Bytecode bytecode) {
   switch (bytecode) {
@@ -326,8 +363,10 @@ bool Bytecodes::IsUnsignedOperandType(OperandType operand_type) {
 // static
 bool Bytecodes::BytecodeHasHandler(Bytecode bytecode,
                                    OperandScale operand_scale) {
+  // Superinstructions are only fused from bytecodes without a scaling prefix.
   return operand_scale == OperandScale::kSingle ||
-         Bytecodes::IsBytecodeWithScalableOperands(bytecode);
+         (Bytecodes::IsBytecodeWithScalableOperands(bytecode) &&
+          !Bytecodes::IsSuperinstruction(bytecode));
 }
 
 std::ostream& operator<<(std::ostream& os, const Bytecode& bytecode) {
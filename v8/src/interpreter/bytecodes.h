@@ -368,6 +368,18 @@ namespace interpreter {
   /* Execution Abort (internal error) */                                       \
   V(Abort, AccumulatorUse::kNone, OperandType::kIdx)                           \
                                                                                \
+  /* Superinstructions, see SUPERINSTRUCTION_LIST */                           \
+  V(LdarAdd, AccumulatorUse::kWrite, OperandType::kReg)                        \
+  V(LdarSub, AccumulatorUse::kWrite, OperandType::kReg)                        \
+  V(TestEqualStrictJumpIfFalse, AccumulatorUse::kReadWrite, OperandType::kReg, \
+    OperandType::kIdx)                                                         \
+  V(TestLessThanJumpIfFalse, AccumulatorUse::kReadWrite, OperandType::kReg,    \
+    OperandType::kIdx)                                                         \
+  V(TestLessThanOrEqualJumpIfFalse, AccumulatorUse::kReadWrite,                \
+    OperandType::kReg, OperandType::kIdx)                                      \
+  V(TestGreaterThanJumpIfFalse, AccumulatorUse::kReadWrite, OperandType::kReg, \
+    OperandType::kIdx)                                                         \
+                                                                               \
   /* Illegal bytecode  */                                                      \
   V(Illegal, AccumulatorUse::kNone)
 
@@ -460,6 +472,19 @@ namespace interpreter {
   V(Return)                     \
   V(SuspendGenerator)
 
+// List of superinstructions. A superinstruction replaces the first bytecode of
+// a frequently dispatched pair and has the same operands. The second bytecode
+// stays in the bytecode array; the superinstruction's handler executes it in
+// place if it still finds it there, and dispatches to it otherwise.
+// Format is V(<superinstruction>, <first bytecode>, <second bytecode>).
+#define SUPERINSTRUCTION_LIST(V)                                       \
+  V(LdarAdd, Ldar, Add)                                                \
+  V(LdarSub, Ldar, Sub)                                                \
+  V(TestEqualStrictJumpIfFalse, TestEqualStrict, JumpIfFalse)          \
+  V(TestLessThanJumpIfFalse, TestLessThan, JumpIfFalse)                \
+  V(TestLessThanOrEqualJumpIfFalse, TestLessThanOrEqual, JumpIfFalse)  \
+  V(TestGreaterThanJumpIfFalse, TestGreaterThan, JumpIfFalse)
+
 // Enumeration of interpreter bytecodes.
 enum class Bytecode : uint8_t {
 #define DECLARE_BYTECODE(Name, ...) k##Name,
@@ -719,6 +744,13 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
 #undef OR_BYTECODE
   }
 
+  // Returns true if the bytecode is a superinstruction.
+  static constexpr bool IsSuperinstruction(Bytecode bytecode) {
+#define OR_BYTECODE(NAME, ...) || bytecode == Bytecode::k##NAME
+    return false SUPERINSTRUCTION_LIST(OR_BYTECODE);
+#undef OR_BYTECODE
+  }
+
   // Returns the number of operands expected by |bytecode|.
   static int NumberOfOperands(Bytecode bytecode) {
     DCHECK_LE(bytecode, Bytecode::kLast);
@@ -802,6 +834,18 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // Returns the equivalent jump bytecode without the accumulator coercion.
   static Bytecode GetJumpWithoutToBoolean(Bytecode bytecode);
 
+  // Returns the bytecode that |bytecode| was fused from if it is a
+  // superinstruction, and |bytecode| itself otherwise.
+  static Bytecode GetUnfusedBytecode(Bytecode bytecode);
+
+  // Returns the bytecode that the superinstruction |bytecode| expects to
+  // follow it.
+  static Bytecode GetFusedSuccessor(Bytecode bytecode);
+
+  // Returns the superinstruction for |first| followed by |second|, or
+  // Bytecode::kIllegal if the pair is not fused.
+  static Bytecode GetSuperinstruction(Bytecode first, Bytecode second);
+
   // Returns true if there is a call in the most-frequently executed path
   // through the bytecode's handler.
   static bool MakesCallAlongCriticalPath(Bytecode bytecode);
@@ -896,8 +940,8 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
 
   // Returns true if a handler is generated for a bytecode at a given
   // operand scale. All bytecodes have handlers at OperandScale::kSingle,
-  // but only bytecodes with scalable operands have handlers with larger
-  // OperandScale values.
+  // but only bytecodes with scalable operands that are not superinstructions
+  // have handlers with larger OperandScale values.
   static bool BytecodeHasHandler(Bytecode bytecode, OperandScale operand_scale);
 
   // Return the operand scale required to hold a signed operand with |value|.
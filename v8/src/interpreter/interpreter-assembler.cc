@@ -1177,6 +1177,43 @@ void InterpreterAssembler::InlineStar() {
   accumulator_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::DispatchToFusedBytecode(
+    const std::function<void()>& generate_fused) {
+  DCHECK(Bytecodes::IsSuperinstruction(bytecode_));
+  DCHECK_EQ(operand_scale_, OperandScale::kSingle);
+  Comment("========= DispatchToFusedBytecode");
+  Bytecode fused_bytecode = Bytecodes::GetFusedSuccessor(bytecode_);
+  TNode<IntPtrT> target_offset = Advance();
+  TNode<WordT> target_bytecode = LoadBytecode(target_offset);
+
+  // The fused bytecode may since have been replaced by a debug break, or by a
+  // constant pool variant when patching a jump.
+  Label do_inline(this), do_dispatch(this);
+  TNode<BoolT> is_fused =
+      Word32Equal(TruncateWordToInt32(target_bytecode),
+                  Int32Constant(static_cast<int>(fused_bytecode)));
+  Branch(is_fused, &do_inline, &do_dispatch);
+
+  BIND(&do_dispatch);
+  DispatchToBytecode(target_bytecode, target_offset);
+
+  BIND(&do_inline);
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  bytecode_ = fused_bytecode;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  generate_fused();
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
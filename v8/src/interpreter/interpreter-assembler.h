@@ -223,6 +223,12 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // Dispatch to the bytecode.
   void Dispatch();
 
+  // Dispatch from a superinstruction to the bytecode that follows it. If that
+  // is still the bytecode it was fused with, |generate_fused| is called to
+  // build code for that bytecode at the next offset instead, which has to end
+  // in a dispatch of its own.
+  void DispatchToFusedBytecode(const std::function<void()>& generate_fused);
+
   // Dispatch bytecode as wide operand variant.
   void DispatchWide(OperandScale operand_scale);
 
@@ -1597,6 +1597,23 @@ class InterpreterCompareOpAssembler : public InterpreterAssembler {
       : InterpreterAssembler(state, bytecode, operand_scale) {}
 
   void CompareOpWithFeedback(Operation compare_op) {
+    SetAccumulator(CompareWithFeedback(compare_op));
+    Dispatch();
+  }
+
+  // Like CompareOpWithFeedback, for superinstructions that fuse the compare
+  // with a following JumpIfFalse.
+  void CompareOpWithFeedbackAndJumpIfFalse(Operation compare_op) {
+    SetAccumulator(CompareWithFeedback(compare_op));
+    DispatchToFusedBytecode([this] {
+      TNode<Object> accumulator = GetAccumulator();
+      TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
+      JumpIfTaggedEqual(accumulator, FalseConstant(), relative_jump);
+    });
+  }
+
+ private:
+  TNode<Oddball> CompareWithFeedback(Operation compare_op) {
     TNode<Object> lhs = LoadRegisterAtOperandIndex(0);
     TNode<Object> rhs = GetAccumulator();
     TNode<Context> context = GetContext();
@@ -1625,8 +1642,7 @@ class InterpreterCompareOpAssembler : public InterpreterAssembler {
     TNode<HeapObject> maybe_feedback_vector = LoadFeedbackVector();
     UpdateFeedback(var_type_feedback.value(), maybe_feedback_vector,
                    slot_index);
-    SetAccumulator(result);
-    Dispatch();
+    return result;
   }
 };
 
@@ -3081,6 +3097,57 @@ IGNITION_HANDLER(ResumeGenerator, InterpreterAssembler) {
   Dispatch();
 }
 
+// LdarAdd <src>
+//
+// Superinstruction for Ldar <src> followed by Add.
+IGNITION_HANDLER(LdarAdd, InterpreterBinaryOpAssembler) {
+  TNode<Object> value = LoadRegisterAtOperandIndex(0);
+  SetAccumulator(value);
+  DispatchToFusedBytecode([this] {
+    BinaryOpWithFeedback(&BinaryOpAssembler::Generate_AddWithFeedback);
+  });
+}
+
+// LdarSub <src>
+//
+// Superinstruction for Ldar <src> followed by Sub.
+IGNITION_HANDLER(LdarSub, InterpreterBinaryOpAssembler) {
+  TNode<Object> value = LoadRegisterAtOperandIndex(0);
+  SetAccumulator(value);
+  DispatchToFusedBytecode([this] {
+    BinaryOpWithFeedback(&BinaryOpAssembler::Generate_SubtractWithFeedback);
+  });
+}
+
+// TestEqualStrictJumpIfFalse <src>
+//
+// Superinstruction for TestEqualStrict <src> followed by JumpIfFalse.
+IGNITION_HANDLER(TestEqualStrictJumpIfFalse, InterpreterCompareOpAssembler) {
+  CompareOpWithFeedbackAndJumpIfFalse(Operation::kStrictEqual);
+}
+
+// TestLessThanJumpIfFalse <src>
+//
+// Superinstruction for TestLessThan <src> followed by JumpIfFalse.
+IGNITION_HANDLER(TestLessThanJumpIfFalse, InterpreterCompareOpAssembler) {
+  CompareOpWithFeedbackAndJumpIfFalse(Operation::kLessThan);
+}
+
+// TestLessThanOrEqualJumpIfFalse <src>
+//
+// Superinstruction for TestLessThanOrEqual <src> followed by JumpIfFalse.
+IGNITION_HANDLER(TestLessThanOrEqualJumpIfFalse,
+                 InterpreterCompareOpAssembler) {
+  CompareOpWithFeedbackAndJumpIfFalse(Operation::kLessThanOrEqual);
+}
+
+// TestGreaterThanJumpIfFalse <src>
+//
+// Superinstruction for TestGreaterThan <src> followed by JumpIfFalse.
+IGNITION_HANDLER(TestGreaterThanJumpIfFalse, InterpreterCompareOpAssembler) {
+  CompareOpWithFeedbackAndJumpIfFalse(Operation::kGreaterThan);
+}
+
 #undef IGNITION_HANDLER
 
 }  // namespace
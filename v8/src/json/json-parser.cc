@@ -6,6 +6,7 @@
 
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
+#include "src/json/json-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/field-type.h"
@@ -65,12 +66,7 @@ enum class EscapeKind : uint8_t {
 };
 
 using EscapeKindField = base::BitField8<EscapeKind, 0, 3>;
-using MayTerminateStringField = EscapeKindField::Next<bool, 1>;
-using NumberPartField = MayTerminateStringField::Next<bool, 1>;
-
-constexpr bool MayTerminateJsonString(uint8_t flags) {
-  return MayTerminateStringField::decode(flags);
-}
+using NumberPartField = EscapeKindField::Next<bool, 1>;
 
 constexpr EscapeKind GetEscapeKind(uint8_t flags) {
   return EscapeKindField::decode(flags);
@@ -92,10 +88,6 @@ constexpr uint8_t GetJsonScanFlags(uint8_t c) {
           : c == '\\' ? EscapeKindField::encode(EscapeKind::kSelf)
           : c == '/' ? EscapeKindField::encode(EscapeKind::kSelf)
           : EscapeKindField::encode(EscapeKind::kIllegal)) |
-         (c < 0x20 ? MayTerminateStringField::encode(true)
-          : c == '"' ? MayTerminateStringField::encode(true)
-          : c == '\\' ? MayTerminateStringField::encode(true)
-          : MayTerminateStringField::encode(false)) |
          NumberPartField::encode(c == '.' ||
                                  c == 'e' ||
                                  c == 'E' ||
@@ -317,16 +309,18 @@ MaybeHandle<Object> InternalizeJsonProperty(Handle<JSObject> holder,
 
 template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
-  next_ = JsonToken::EOS;
-
-  cursor_ = std::find_if(cursor_, end_, [this](Char c) {
-    JsonToken current = V8_LIKELY(c <= unibrow::Latin1::kMaxChar)
-                            ? one_char_json_tokens[c]
-                            : JsonToken::ILLEGAL;
-    bool result = current != JsonToken::WHITESPACE;
-    if (result) next_ = current;
-    return result;
-  });
+  // Tokens are usually not preceded by whitespace, and if they are, it's
+  // often by the indentation of pretty-printed JSON.
+  if (cursor_ != end_ && JsonSimd::IsWhitespace(*cursor_)) {
+    cursor_ = JsonSimd::SkipWhitespace(cursor_ + 1, end_);
+  }
+  if (V8_UNLIKELY(cursor_ == end_)) {
+    next_ = JsonToken::EOS;
+    return;
+  }
+  Char c = *cursor_;
+  next_ = V8_LIKELY(c <= unibrow::Latin1::kMaxChar) ? one_char_json_tokens[c]
+                                                    : JsonToken::ILLEGAL;
 }
 
 template <typename Char>
@@ -1127,13 +1121,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   uc32 bits = 0;
 
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
-      }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+    cursor_ = JsonSimd::FindStringTerminator(cursor_, end_, &bits);
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowHeapAllocation allow_before_exception;
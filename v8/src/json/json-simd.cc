@@ -0,0 +1,240 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-simd.h"
+
+#include "src/base/bits.h"
+#include "src/utils/simd-dispatch.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr bool MayTerminateString(uc32 c) {
+  return c == '"' || c == '\\' || c < 0x20;
+}
+
+template <typename Char>
+const Char* FindStringTerminatorScalar(const Char* cursor, const Char* end,
+                                       uc32* bits) {
+  for (; cursor != end; ++cursor) {
+    Char c = *cursor;
+    if (MayTerminateString(c)) break;
+    if (sizeof(Char) == 2) *bits |= c;
+  }
+  return cursor;
+}
+
+template <typename Char>
+const Char* SkipWhitespaceScalar(const Char* cursor, const Char* end) {
+  while (cursor != end && JsonSimd::IsWhitespace(*cursor)) ++cursor;
+  return cursor;
+}
+
+#if V8_HOST_ARCH_X64
+
+// The helpers below return a mask with bit i set if byte i of the vector
+// belongs to a matching character. Two-byte characters set two bits.
+
+template <typename Char>
+int StringTerminatorMask(__m128i x) {
+  if (sizeof(Char) == 1) {
+    __m128i quote = _mm_cmpeq_epi8(x, _mm_set1_epi8('"'));
+    __m128i backslash = _mm_cmpeq_epi8(x, _mm_set1_epi8('\\'));
+    // x < 0x20 iff the saturating difference x - 0x1F is zero.
+    __m128i control = _mm_cmpeq_epi8(_mm_subs_epu8(x, _mm_set1_epi8(0x1F)),
+                                     _mm_setzero_si128());
+    return _mm_movemask_epi8(
+        _mm_or_si128(_mm_or_si128(quote, backslash), control));
+  }
+  __m128i quote = _mm_cmpeq_epi16(x, _mm_set1_epi16('"'));
+  __m128i backslash = _mm_cmpeq_epi16(x, _mm_set1_epi16('\\'));
+  __m128i control = _mm_cmpeq_epi16(_mm_subs_epu16(x, _mm_set1_epi16(0x1F)),
+                                    _mm_setzero_si128());
+  return _mm_movemask_epi8(
+      _mm_or_si128(_mm_or_si128(quote, backslash), control));
+}
+
+template <typename Char>
+int NonWhitespaceMask(__m128i x) {
+  __m128i whitespace;
+  if (sizeof(Char) == 1) {
+    whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')),
+                     _mm_cmpeq_epi8(x, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('\r')),
+                     _mm_cmpeq_epi8(x, _mm_set1_epi8('\n'))));
+  } else {
+    whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(x, _mm_set1_epi16(' ')),
+                     _mm_cmpeq_epi16(x, _mm_set1_epi16('\t'))),
+        _mm_or_si128(_mm_cmpeq_epi16(x, _mm_set1_epi16('\r')),
+                     _mm_cmpeq_epi16(x, _mm_set1_epi16('\n'))));
+  }
+  return ~_mm_movemask_epi8(whitespace) & 0xFFFF;
+}
+
+// Or's together the 16-bit lanes of {x}.
+uc32 OrLanes16(__m128i x) {
+  x = _mm_or_si128(x, _mm_srli_si128(x, 8));
+  x = _mm_or_si128(x, _mm_srli_si128(x, 4));
+  x = _mm_or_si128(x, _mm_srli_si128(x, 2));
+  return static_cast<uc32>(_mm_cvtsi128_si32(x)) & 0xFFFF;
+}
+
+template <typename Char>
+const Char* FindStringTerminatorSSE2(const Char* cursor, const Char* end,
+                                     uc32* bits) {
+  constexpr int kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  __m128i seen = _mm_setzero_si128();
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    int mask = StringTerminatorMask<Char>(x);
+    if (mask != 0) {
+      end = cursor + base::bits::CountTrailingZeros(mask) / sizeof(Char);
+      break;
+    }
+    if (sizeof(Char) == 2) seen = _mm_or_si128(seen, x);
+  }
+  if (sizeof(Char) == 2) *bits |= OrLanes16(seen);
+  return FindStringTerminatorScalar(cursor, end, bits);
+}
+
+template <typename Char>
+const Char* SkipWhitespaceSSE2(const Char* cursor, const Char* end) {
+  constexpr int kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    int mask = NonWhitespaceMask<Char>(x);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(mask) / sizeof(Char);
+    }
+  }
+  return SkipWhitespaceScalar(cursor, end);
+}
+
+#endif  // V8_HOST_ARCH_X64
+
+#if V8_SIMD_DISPATCH
+
+template <typename Char>
+V8_TARGET_AVX2 uint32_t StringTerminatorMaskAVX2(__m256i x) {
+  __m256i quote, backslash, control;
+  if (sizeof(Char) == 1) {
+    quote = _mm256_cmpeq_epi8(x, _mm256_set1_epi8('"'));
+    backslash = _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\\'));
+    control = _mm256_cmpeq_epi8(_mm256_subs_epu8(x, _mm256_set1_epi8(0x1F)),
+                                _mm256_setzero_si256());
+  } else {
+    quote = _mm256_cmpeq_epi16(x, _mm256_set1_epi16('"'));
+    backslash = _mm256_cmpeq_epi16(x, _mm256_set1_epi16('\\'));
+    control =
+        _mm256_cmpeq_epi16(_mm256_subs_epu16(x, _mm256_set1_epi16(0x1F)),
+                           _mm256_setzero_si256());
+  }
+  return static_cast<uint32_t>(_mm256_movemask_epi8(
+      _mm256_or_si256(_mm256_or_si256(quote, backslash), control)));
+}
+
+template <typename Char>
+V8_TARGET_AVX2 uint32_t NonWhitespaceMaskAVX2(__m256i x) {
+  __m256i whitespace;
+  if (sizeof(Char) == 1) {
+    whitespace = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')),
+                        _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\r')),
+                        _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\n'))));
+  } else {
+    whitespace = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi16(x, _mm256_set1_epi16(' ')),
+                        _mm256_cmpeq_epi16(x, _mm256_set1_epi16('\t'))),
+        _mm256_or_si256(_mm256_cmpeq_epi16(x, _mm256_set1_epi16('\r')),
+                        _mm256_cmpeq_epi16(x, _mm256_set1_epi16('\n'))));
+  }
+  return ~static_cast<uint32_t>(_mm256_movemask_epi8(whitespace));
+}
+
+template <typename Char>
+V8_TARGET_AVX2 const Char* FindStringTerminatorAVX2(const Char* cursor,
+                                                    const Char* end,
+                                                    uc32* bits) {
+  constexpr int kCharsPerVector = sizeof(__m256i) / sizeof(Char);
+  __m256i seen = _mm256_setzero_si256();
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cursor));
+    uint32_t mask = StringTerminatorMaskAVX2<Char>(x);
+    if (mask != 0) {
+      end = cursor + base::bits::CountTrailingZeros(mask) / sizeof(Char);
+      break;
+    }
+    if (sizeof(Char) == 2) seen = _mm256_or_si256(seen, x);
+  }
+  if (sizeof(Char) == 2) {
+    *bits |= OrLanes16(_mm_or_si128(_mm256_castsi256_si128(seen),
+                                    _mm256_extracti128_si256(seen, 1)));
+  }
+  return FindStringTerminatorScalar(cursor, end, bits);
+}
+
+template <typename Char>
+V8_TARGET_AVX2 const Char* SkipWhitespaceAVX2(const Char* cursor,
+                                              const Char* end) {
+  constexpr int kCharsPerVector = sizeof(__m256i) / sizeof(Char);
+  for (; end - cursor >= kCharsPerVector; cursor += kCharsPerVector) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cursor));
+    uint32_t mask = NonWhitespaceMaskAVX2<Char>(x);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(mask) / sizeof(Char);
+    }
+  }
+  return SkipWhitespaceScalar(cursor, end);
+}
+
+#endif  // V8_SIMD_DISPATCH
+
+}  // namespace
+
+// static
+template <typename Char>
+const Char* JsonSimd::FindStringTerminator(const Char* start, const Char* end,
+                                           uc32* bits) {
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) {
+    return FindStringTerminatorAVX2(start, end, bits);
+  }
+#endif
+#if V8_HOST_ARCH_X64
+  return FindStringTerminatorSSE2(start, end, bits);
+#else
+  return FindStringTerminatorScalar(start, end, bits);
+#endif
+}
+
+// static
+template <typename Char>
+const Char* JsonSimd::SkipWhitespace(const Char* start, const Char* end) {
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) return SkipWhitespaceAVX2(start, end);
+#endif
+#if V8_HOST_ARCH_X64
+  return SkipWhitespaceSSE2(start, end);
+#else
+  return SkipWhitespaceScalar(start, end);
+#endif
+}
+
+template const uint8_t* JsonSimd::FindStringTerminator(const uint8_t*,
+                                                       const uint8_t*, uc32*);
+template const uint16_t* JsonSimd::FindStringTerminator(const uint16_t*,
+                                                        const uint16_t*,
+                                                        uc32*);
+template const uint8_t* JsonSimd::SkipWhitespace(const uint8_t*,
+                                                 const uint8_t*);
+template const uint16_t* JsonSimd::SkipWhitespace(const uint16_t*,
+                                                  const uint16_t*);
+
+}  // namespace internal
+}  // namespace v8
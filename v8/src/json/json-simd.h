@@ -0,0 +1,40 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_SIMD_H_
+#define V8_JSON_JSON_SIMD_H_
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized versions of the hot scanning loops of JsonParser. On x64 they
+// process 16 (SSE2) or 32 (AVX2, if the CPU and OS support it) bytes at a
+// time; elsewhere they fall back to scalar loops. Both return a pointer into
+// [start, end], which is {end} if no matching character was found.
+class V8_EXPORT_PRIVATE JsonSimd : public AllStatic {
+ public:
+  // Returns the first character that may terminate a JSON string, i.e. a
+  // quote, a backslash or a control character. All characters before it
+  // are or'ed into {*bits}, so that callers can tell whether the string
+  // fits into one byte per character.
+  template <typename Char>
+  static const Char* FindStringTerminator(const Char* start, const Char* end,
+                                          uc32* bits);
+
+  // Returns the first character that is not JSON whitespace, i.e. not one
+  // of space, tab, carriage-return and newline.
+  template <typename Char>
+  static const Char* SkipWhitespace(const Char* start, const Char* end);
+
+  static constexpr bool IsWhitespace(uc32 c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  }
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_SIMD_H_
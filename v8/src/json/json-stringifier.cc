@@ -4,6 +4,10 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "include/v8-profiler.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
@@ -14,6 +18,7 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -21,7 +26,10 @@ namespace internal {
 
 class JsonStringifier {
  public:
-  explicit JsonStringifier(Isolate* isolate);
+  // With a {sink}, the result is passed to it in parts, see
+  // IncrementalStringBuilder::Sink.
+  explicit JsonStringifier(Isolate* isolate,
+                           IncrementalStringBuilder::Sink* sink = nullptr);
 
   ~JsonStringifier() { DeleteArray(gap_); }
 
@@ -143,6 +151,106 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+namespace {
+
+// Encodes the parts of the result as UTF-8 and writes them to an
+// OutputStream, in chunks of the size the stream asks for.
+class OutputStreamSink final : public IncrementalStringBuilder::Sink {
+ public:
+  OutputStreamSink(Isolate* isolate, v8::OutputStream* stream)
+      : isolate_(isolate),
+        stream_(stream),
+        chunk_(std::max(stream->GetChunkSize(),
+                        static_cast<int>(unibrow::Utf8::kMaxEncodedSize))) {}
+
+  bool Write(Handle<String> part) override {
+    part = String::Flatten(isolate_, part);
+    DisallowHeapAllocation no_gc;
+    String::FlatContent content = part->GetFlatContent(no_gc);
+    return content.IsOneByte() ? WriteChars(content.ToOneByteVector())
+                               : WriteChars(content.ToUC16Vector());
+  }
+
+  // Writes out the last chunk and ends the stream.
+  bool Finish() {
+    if (pending_lead_ != unibrow::Utf16::kNoPreviousCharacter) {
+      // The stringifier escapes lone surrogates in strings, but not in gaps.
+      if (!WriteCodePoint(pending_lead_)) return false;
+      pending_lead_ = unibrow::Utf16::kNoPreviousCharacter;
+    }
+    if (!Flush()) return false;
+    stream_->EndOfStream();
+    return true;
+  }
+
+ private:
+  template <typename Char>
+  bool WriteChars(Vector<const Char> chars) {
+    for (Char c : chars) {
+      // Surrogate pairs may be split across parts, so a lead surrogate is
+      // only written once the next character is known.
+      if (pending_lead_ != unibrow::Utf16::kNoPreviousCharacter) {
+        uc32 code_point = pending_lead_;
+        pending_lead_ = unibrow::Utf16::kNoPreviousCharacter;
+        if (unibrow::Utf16::IsTrailSurrogate(c)) {
+          if (!WriteCodePoint(
+                  unibrow::Utf16::CombineSurrogatePair(code_point, c))) {
+            return false;
+          }
+          continue;
+        }
+        if (!WriteCodePoint(code_point)) return false;
+      }
+      if (sizeof(Char) == 2 && unibrow::Utf16::IsLeadSurrogate(c)) {
+        pending_lead_ = c;
+        continue;
+      }
+      if (!WriteCodePoint(c)) return false;
+    }
+    return true;
+  }
+
+  bool WriteCodePoint(uc32 c) {
+    if (chunk_.size() - used_ < unibrow::Utf8::kMaxEncodedSize && !Flush()) {
+      return false;
+    }
+    used_ += unibrow::Utf8::Encode(chunk_.data() + used_, c,
+                                   unibrow::Utf16::kNoPreviousCharacter);
+    return true;
+  }
+
+  bool Flush() {
+    if (used_ == 0) return true;
+    int size = static_cast<int>(used_);
+    used_ = 0;
+    return stream_->WriteAsciiChunk(chunk_.data(), size) ==
+           v8::OutputStream::kContinue;
+  }
+
+  Isolate* isolate_;
+  v8::OutputStream* stream_;
+  std::vector<char> chunk_;
+  size_t used_ = 0;
+  int pending_lead_ = unibrow::Utf16::kNoPreviousCharacter;
+};
+
+}  // namespace
+
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> replacer, Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  OutputStreamSink sink(isolate, stream);
+  JsonStringifier stringifier(isolate, &sink);
+  Handle<Object> result;
+  if (!stringifier.Stringify(object, replacer, gap).ToHandle(&result)) {
+    // Without an exception, the stream aborted.
+    if (isolate->has_pending_exception()) return Nothing<bool>();
+    return Just(false);
+  }
+  if (result->IsUndefined(isolate)) return Just(false);
+  return Just(sink.Finish());
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -211,13 +319,15 @@ const char* const JsonStringifier::JsonEscapeTable =
     "\xF8\0      \xF9\0      \xFA\0      \xFB\0      "
     "\xFC\0      \xFD\0      \xFE\0      \xFF\0      ";
 
-JsonStringifier::JsonStringifier(Isolate* isolate)
+JsonStringifier::JsonStringifier(Isolate* isolate,
+                                 IncrementalStringBuilder::Sink* sink)
     : isolate_(isolate),
       builder_(isolate),
       gap_(nullptr),
       indent_(0),
       stack_() {
   tojson_string_ = factory()->toJSON_string();
+  if (sink != nullptr) builder_.set_sink(sink);
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -521,6 +631,8 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
       isolate_->stack_guard()->HandleInterrupts().IsException(isolate_)) {
     return EXCEPTION;
   }
+  // There is no point in serializing the rest if no one is listening.
+  if (V8_UNLIKELY(builder_.SinkStopped())) return EXCEPTION;
   if (object->IsJSReceiver() || object->IsBigInt()) {
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
         isolate_, object, ApplyToJsonFunction(object, key), EXCEPTION);
@@ -8,12 +8,22 @@
 #include "src/objects/objects.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Like JsonStringify, but writes the result to {stream} in UTF-8 chunks
+// instead of creating a string. Returns Nothing if an exception was thrown,
+// and false if {object} has no JSON representation or the stream aborted.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToStream(
+    Isolate* isolate, Handle<Object> object, Handle<Object> replacer,
+    Handle<Object> gap, v8::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
@@ -0,0 +1,297 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/libplatform/v8-code-cache.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "src/base/logging.h"
+#include "src/base/platform/platform.h"
+
+#if V8_OS_WIN
+#include <direct.h>
+#include <sys/utime.h>
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <utime.h>
+#endif
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+constexpr uint32_t kMagicNumber = 0xC0DECAC5;
+constexpr char kEntrySuffix[] = ".v8cc";
+constexpr size_t kEntrySuffixLength = sizeof(kEntrySuffix) - 1;
+
+// Starts every entry file. It is followed by the script source, which is
+// compared on lookup since the hash in the file name may collide, and then by
+// the cached data. The source is padded so that the data stays
+// pointer-aligned in the mapping, which the code deserializer prefers.
+struct EntryHeader {
+  uint32_t magic_number;
+  uint32_t version_tag;
+  uint64_t source_hash;
+  uint64_t source_length;
+  uint32_t data_length;
+  uint32_t reserved;
+};
+static_assert(sizeof(EntryHeader) % 8 == 0, "EntryHeader must be aligned");
+
+size_t PaddedSourceLength(size_t source_length) {
+  return (source_length + 7) & ~size_t{7};
+}
+
+size_t DataOffset(size_t source_length) {
+  return sizeof(EntryHeader) + PaddedSourceLength(source_length);
+}
+
+// 64-bit FNV-1a. Stable across processes and platforms, unlike base::hash.
+uint64_t HashSource(const char* source, size_t length) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(source[i]);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+class MappedEntry final : public CodeCacheDirectory::Entry {
+ public:
+  MappedEntry(base::OS::MemoryMappedFile* file, size_t data_offset)
+      : file_(file), data_offset_(data_offset) {}
+
+  const uint8_t* data() const override {
+    return static_cast<const uint8_t*>(file_->memory()) + data_offset_;
+  }
+  int length() const override {
+    return static_cast<int>(file_->size() - data_offset_);
+  }
+
+ private:
+  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+  const size_t data_offset_;
+};
+
+struct EntryFileInfo {
+  std::string path;
+  size_t size;
+  int64_t last_used;
+};
+
+bool EndsWithEntrySuffix(const char* name) {
+  size_t length = strlen(name);
+  return length > kEntrySuffixLength &&
+         strcmp(name + length - kEntrySuffixLength, kEntrySuffix) == 0;
+}
+
+// |mtime| is in nanoseconds where the platform provides that resolution, so
+// that entries used within the same second are still ordered.
+bool GetFileInfo(const std::string& path, size_t* size, int64_t* mtime) {
+#if V8_OS_WIN
+  struct _stat64 info;
+  if (_stat64(path.c_str(), &info) != 0) return false;
+#else
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0) return false;
+#endif
+  *size = static_cast<size_t>(info.st_size);
+  *mtime = static_cast<int64_t>(info.st_mtime) * 1000000000;
+#if V8_OS_LINUX
+  *mtime += info.st_mtim.tv_nsec;
+#endif
+  return true;
+}
+
+void TouchFile(const std::string& path) {
+#if V8_OS_WIN
+  _utime(path.c_str(), nullptr);
+#else
+  utime(path.c_str(), nullptr);
+#endif
+}
+
+bool MakeDirectory(const std::string& path) {
+#if V8_OS_WIN
+  return _mkdir(path.c_str()) == 0 || errno == EEXIST;
+#else
+  return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+std::vector<EntryFileInfo> ListEntries(const std::string& directory) {
+  std::vector<EntryFileInfo> entries;
+  auto add_entry = [&](const char* name) {
+    if (!EndsWithEntrySuffix(name)) return;
+    EntryFileInfo entry;
+    entry.path = directory + base::OS::DirectorySeparator() + name;
+    if (GetFileInfo(entry.path, &entry.size, &entry.last_used)) {
+      entries.push_back(std::move(entry));
+    }
+  };
+#if V8_OS_WIN
+  WIN32_FIND_DATAA find_data;
+  std::string pattern = directory + "\\*";
+  HANDLE handle = FindFirstFileA(pattern.c_str(), &find_data);
+  if (handle == INVALID_HANDLE_VALUE) return entries;
+  do {
+    add_entry(find_data.cFileName);
+  } while (FindNextFileA(handle, &find_data));
+  FindClose(handle);
+#else
+  DIR* dir = opendir(directory.c_str());
+  if (dir == nullptr) return entries;
+  while (struct dirent* dirent = readdir(dir)) {
+    add_entry(dirent->d_name);
+  }
+  closedir(dir);
+#endif
+  return entries;
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<CodeCacheDirectory> CodeCacheDirectory::Open(
+    const char* path, size_t max_size_in_bytes, uint32_t version_tag) {
+  if (!MakeDirectory(path)) return nullptr;
+  std::unique_ptr<CodeCacheDirectory> cache(
+      new CodeCacheDirectory(path, max_size_in_bytes, version_tag));
+  cache->Trim();
+  return cache;
+}
+
+CodeCacheDirectory::CodeCacheDirectory(const char* path,
+                                       size_t max_size_in_bytes,
+                                       uint32_t version_tag)
+    : path_(path),
+      max_size_in_bytes_(max_size_in_bytes),
+      version_tag_(version_tag) {}
+
+CodeCacheDirectory::~CodeCacheDirectory() = default;
+
+std::string CodeCacheDirectory::EntryPath(const char* source,
+                                          size_t source_length) const {
+  uint64_t source_hash = HashSource(source, source_length);
+  char name[64];
+  base::OS::SNPrintF(name, sizeof(name), "%016llx-%08x%s",
+                     static_cast<unsigned long long>(  // NOLINT(runtime/int)
+                         source_hash),
+                     version_tag_, kEntrySuffix);
+  return path_ + base::OS::DirectorySeparator() + name;
+}
+
+std::unique_ptr<CodeCacheDirectory::Entry> CodeCacheDirectory::Lookup(
+    const char* source, size_t source_length) {
+  uint64_t source_hash = HashSource(source, source_length);
+  std::string entry_path = EntryPath(source, source_length);
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          entry_path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  size_t data_offset = DataOffset(source_length);
+  if (!file || file->size() < data_offset) return nullptr;
+
+  EntryHeader header;
+  memcpy(&header, file->memory(), sizeof(header));
+  const char* entry_source =
+      static_cast<const char*>(file->memory()) + sizeof(EntryHeader);
+  if (header.magic_number != kMagicNumber ||
+      header.version_tag != version_tag_ ||
+      header.source_length != source_length ||
+      header.source_hash != source_hash ||
+      header.data_length != file->size() - data_offset ||
+      memcmp(entry_source, source, source_length) != 0) {
+    return nullptr;
+  }
+
+  TouchFile(entry_path);
+  return std::make_unique<MappedEntry>(file.release(), data_offset);
+}
+
+bool CodeCacheDirectory::Store(const char* source, size_t source_length,
+                               const uint8_t* data, int length) {
+  DCHECK_LE(0, length);
+  EntryHeader header;
+  header.magic_number = kMagicNumber;
+  header.version_tag = version_tag_;
+  header.source_hash = HashSource(source, source_length);
+  header.source_length = source_length;
+  header.data_length = static_cast<uint32_t>(length);
+  header.reserved = 0;
+
+  // Write to a temporary file first and rename it into place, so that
+  // concurrent readers never see a partially written entry.
+  char temp_name[64];
+  base::OS::SNPrintF(temp_name, sizeof(temp_name), "tmp-%d-%d",
+                     base::OS::GetCurrentProcessId(), next_temp_file_id_++);
+  std::string temp_path = path_ + base::OS::DirectorySeparator() + temp_name;
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (file == nullptr) return false;
+  const char padding[8] = {0};
+  size_t padding_length = PaddedSourceLength(source_length) - source_length;
+  bool ok =
+      fwrite(&header, sizeof(header), 1, file) == 1 &&
+      fwrite(source, 1, source_length, file) == source_length &&
+      fwrite(padding, 1, padding_length, file) == padding_length &&
+      fwrite(data, 1, length, file) == static_cast<size_t>(length);
+  ok = fclose(file) == 0 && ok;
+
+  std::string entry_path = EntryPath(source, source_length);
+#if V8_OS_WIN
+  // rename() does not replace existing files on Windows.
+  if (ok) base::OS::Remove(entry_path.c_str());
+#endif
+  if (!ok || std::rename(temp_path.c_str(), entry_path.c_str()) != 0) {
+    base::OS::Remove(temp_path.c_str());
+    return false;
+  }
+
+  size_in_bytes_ += DataOffset(source_length) + length;
+  if (size_in_bytes_ > max_size_in_bytes_) TrimExcept(entry_path);
+  return true;
+}
+
+void CodeCacheDirectory::Remove(const char* source, size_t source_length) {
+  std::string entry_path = EntryPath(source, source_length);
+  size_t size;
+  int64_t mtime;
+  if (GetFileInfo(entry_path, &size, &mtime) &&
+      base::OS::Remove(entry_path.c_str())) {
+    size_in_bytes_ -= std::min(size, size_in_bytes_);
+  }
+}
+
+void CodeCacheDirectory::Trim() { TrimExcept(std::string()); }
+
+void CodeCacheDirectory::TrimExcept(const std::string& keep_path) {
+  std::vector<EntryFileInfo> entries = ListEntries(path_);
+  size_in_bytes_ = 0;
+  for (const EntryFileInfo& entry : entries) size_in_bytes_ += entry.size;
+  if (size_in_bytes_ <= max_size_in_bytes_) return;
+
+  std::sort(entries.begin(), entries.end(),
+            [](const EntryFileInfo& a, const EntryFileInfo& b) {
+              return a.last_used < b.last_used;
+            });
+  for (const EntryFileInfo& entry : entries) {
+    if (size_in_bytes_ <= max_size_in_bytes_) break;
+    if (entry.path == keep_path) continue;
+    // Another process may have evicted the entry already.
+    base::OS::Remove(entry.path.c_str());
+    size_in_bytes_ -= entry.size;
+  }
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -35,12 +35,14 @@ void PrintStackTrace() {
 std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
-    std::unique_ptr<v8::TracingController> tracing_controller) {
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    WorkerThreadsTaskScheduling worker_threads_task_scheduling) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   auto platform = std::make_unique<DefaultPlatform>(
-      thread_pool_size, idle_task_support, std::move(tracing_controller));
+      thread_pool_size, idle_task_support, std::move(tracing_controller),
+      worker_threads_task_scheduling);
   platform->EnsureBackgroundTaskRunnerInitialized();
   return platform;
 }
@@ -89,9 +91,11 @@ int GetActualThreadPoolSize(int thread_pool_size) {
 
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
-    std::unique_ptr<v8::TracingController> tracing_controller)
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    WorkerThreadsTaskScheduling worker_threads_task_scheduling)
     : thread_pool_size_(GetActualThreadPoolSize(thread_pool_size)),
       idle_task_support_(idle_task_support),
+      worker_threads_task_scheduling_(worker_threads_task_scheduling),
       tracing_controller_(std::move(tracing_controller)),
       page_allocator_(std::make_unique<v8::base::PageAllocator>()) {
   if (!tracing_controller_) {
@@ -125,9 +129,10 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
   if (!worker_threads_task_runner_) {
     worker_threads_task_runner_ =
         std::make_shared<DefaultWorkerThreadsTaskRunner>(
-            thread_pool_size_, time_function_for_testing_
-                                   ? time_function_for_testing_
-                                   : DefaultTimeFunction);
+            thread_pool_size_,
+            time_function_for_testing_ ? time_function_for_testing_
+                                       : DefaultTimeFunction,
+            worker_threads_task_scheduling_);
   }
 }
 
@@ -200,6 +205,20 @@ void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   worker_threads_task_runner_->PostTask(std::move(task));
 }
 
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(
+      std::move(task), TaskPriority::kUserBlocking);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(std::move(task),
+                                                    TaskPriority::kBestEffort);
+}
+
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                 double delay_in_seconds) {
   EnsureBackgroundTaskRunnerInitialized();
@@ -10,10 +10,16 @@ namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size, TimeFunction time_function)
+    uint32_t thread_pool_size, TimeFunction time_function,
+    WorkerThreadsTaskScheduling scheduling)
     : queue_(time_function), time_function_(time_function) {
+  if (scheduling == WorkerThreadsTaskScheduling::kWorkStealing) {
+    work_stealing_queue_ = std::make_unique<WorkStealingTaskQueue>(
+        static_cast<int>(thread_pool_size), time_function);
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(
+        std::make_unique<WorkerThread>(this, static_cast<int>(i)));
   }
 }
 
@@ -27,11 +33,22 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
   base::MutexGuard guard(&lock_);
   terminated_ = true;
   queue_.Terminate();
+  if (work_stealing_queue_) work_stealing_queue_->Terminate();
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+  PostTaskWithPriority(std::move(task), TaskPriority::kUserVisible);
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTaskWithPriority(
+    std::unique_ptr<Task> task, TaskPriority priority) {
+  if (work_stealing_queue_) {
+    // The work-stealing queue drops tasks once it is terminated.
+    work_stealing_queue_->Append(std::move(task), priority);
+    return;
+  }
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
   queue_.Append(std::move(task));
@@ -39,6 +56,10 @@ void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
+  if (work_stealing_queue_) {
+    work_stealing_queue_->AppendDelayed(std::move(task), delay_in_seconds);
+    return;
+  }
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
   queue_.AppendDelayed(std::move(task), delay_in_seconds);
@@ -55,21 +76,23 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(int worker_id) {
+  if (work_stealing_queue_) return work_stealing_queue_->GetNext(worker_id);
   return queue_.GetNext();
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
+    DefaultWorkerThreadsTaskRunner* runner, int worker_id)
     : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
+      runner_(runner),
+      worker_id_(worker_id) {
   CHECK(Start());
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<Task> task = runner_->GetNext()) {
+  while (std::unique_ptr<Task> task = runner_->GetNext(worker_id_)) {
     task->Run();
   }
 }
@@ -9,10 +9,12 @@
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/libplatform/delayed-task-queue.h"
+#include "src/libplatform/work-stealing-task-queue.h"
 
 namespace v8 {
 namespace platform {
@@ -22,8 +24,10 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  public:
   using TimeFunction = double (*)();
 
-  DefaultWorkerThreadsTaskRunner(uint32_t thread_pool_size,
-                                 TimeFunction time_function);
+  DefaultWorkerThreadsTaskRunner(
+      uint32_t thread_pool_size, TimeFunction time_function,
+      WorkerThreadsTaskScheduling scheduling =
+          WorkerThreadsTaskScheduling::kSharedQueue);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
@@ -41,10 +45,14 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   bool IdleTasksEnabled() override;
 
+  // Posts |task| with the given |priority|. The priority is only taken into
+  // account with WorkerThreadsTaskScheduling::kWorkStealing.
+  void PostTaskWithPriority(std::unique_ptr<Task> task, TaskPriority priority);
+
  private:
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, int worker_id);
     ~WorkerThread() override;
 
     // This thread attempts to get tasks in a loop from |runner_| and run them.
@@ -52,17 +60,21 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    const int worker_id_;
 
     DISALLOW_COPY_AND_ASSIGN(WorkerThread);
   };
 
   // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
   // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  std::unique_ptr<Task> GetNext(int worker_id);
 
   bool terminated_ = false;
   base::Mutex lock_;
   DelayedTaskQueue queue_;
+  // Replaces |queue_| (and makes |lock_| unnecessary for posting) when work
+  // stealing is enabled.
+  std::unique_ptr<WorkStealingTaskQueue> work_stealing_queue_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   TimeFunction time_function_;
 };
@@ -0,0 +1,187 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/work-stealing-task-queue.h"
+
+#include "src/base/logging.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+// The queue and worker index of the current thread, if it is a worker thread
+// of some WorkStealingTaskQueue. Used to keep tasks posted from a worker on
+// that worker's deques.
+thread_local WorkStealingTaskQueue* current_queue = nullptr;
+thread_local int current_worker_id = -1;
+}  // namespace
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(int num_workers,
+                                             TimeFunction time_function)
+    : time_function_(time_function) {
+  DCHECK_LT(0, num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::make_unique<WorkerDeques>());
+    for (auto& size : workers_.back()->sizes) size.store(0);
+  }
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() {
+  DCHECK(terminated_.load());
+  if (current_queue == this) current_queue = nullptr;
+}
+
+double WorkStealingTaskQueue::MonotonicallyIncreasingTime() {
+  return time_function_();
+}
+
+void WorkStealingTaskQueue::Append(std::unique_ptr<Task> task,
+                                   TaskPriority priority) {
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  int worker_id;
+  if (current_queue == this) {
+    worker_id = current_worker_id;
+  } else {
+    worker_id = static_cast<int>(
+        next_worker_.fetch_add(1, std::memory_order_relaxed) %
+        workers_.size());
+  }
+  Push(worker_id, std::move(task), priority);
+}
+
+void WorkStealingTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
+                                          double delay_in_seconds) {
+  DCHECK_GE(delay_in_seconds, 0.0);
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
+  {
+    base::MutexGuard guard(&delayed_lock_);
+    delayed_task_queue_.emplace(deadline, std::move(task));
+    has_delayed_tasks_.store(true);
+    delayed_tasks_epoch_.fetch_add(1);
+  }
+  // Wake up all idle workers, since they might be waiting for a later
+  // deadline or without a deadline at all.
+  base::MutexGuard guard(&idle_lock_);
+  idle_condition_var_.NotifyAll();
+}
+
+void WorkStealingTaskQueue::Push(int worker_id, std::unique_ptr<Task> task,
+                                 TaskPriority priority) {
+  WorkerDeques* worker = workers_[worker_id].get();
+  int index = static_cast<int>(priority);
+  {
+    base::MutexGuard guard(&worker->lock);
+    worker->tasks[index].push_back(std::move(task));
+    worker->sizes[index].store(worker->tasks[index].size(),
+                               std::memory_order_relaxed);
+    pending_tasks_.fetch_add(1);
+  }
+  WakeUpIdleWorker();
+}
+
+void WorkStealingTaskQueue::WakeUpIdleWorker() {
+  // Pairs with the increment of |idle_workers_| in GetNext(): either the
+  // worker observes the new pending task, or we observe the idle worker.
+  if (idle_workers_.load() == 0) return;
+  base::MutexGuard guard(&idle_lock_);
+  idle_condition_var_.NotifyOne();
+}
+
+std::unique_ptr<Task> WorkStealingTaskQueue::TryPop(int worker_id,
+                                                    int priority) {
+  WorkerDeques* worker = workers_[worker_id].get();
+  if (worker->sizes[priority].load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+  base::MutexGuard guard(&worker->lock);
+  auto& tasks = worker->tasks[priority];
+  if (tasks.empty()) return nullptr;
+  std::unique_ptr<Task> result = std::move(tasks.front());
+  tasks.pop_front();
+  worker->sizes[priority].store(tasks.size(), std::memory_order_relaxed);
+  pending_tasks_.fetch_sub(1);
+  return result;
+}
+
+std::unique_ptr<Task> WorkStealingTaskQueue::TryGetTask(int worker_id) {
+  const int num_workers = static_cast<int>(workers_.size());
+  for (int priority = kNumPriorities - 1; priority >= 0; --priority) {
+    if (std::unique_ptr<Task> task = TryPop(worker_id, priority)) return task;
+    for (int i = 1; i < num_workers; ++i) {
+      int victim = (worker_id + i) % num_workers;
+      if (std::unique_ptr<Task> task = TryPop(victim, priority)) return task;
+    }
+  }
+  return nullptr;
+}
+
+double WorkStealingTaskQueue::FlushDelayedTasks(int worker_id) {
+  base::MutexGuard guard(&delayed_lock_);
+  double now = MonotonicallyIncreasingTime();
+  while (!delayed_task_queue_.empty()) {
+    auto it = delayed_task_queue_.begin();
+    if (it->first > now) break;
+    Push(worker_id, std::move(it->second), TaskPriority::kUserVisible);
+    delayed_task_queue_.erase(it);
+  }
+  has_delayed_tasks_.store(!delayed_task_queue_.empty());
+  if (delayed_task_queue_.empty()) return -1;
+  return delayed_task_queue_.begin()->first;
+}
+
+std::unique_ptr<Task> WorkStealingTaskQueue::GetNext(int worker_id) {
+  DCHECK_LE(0, worker_id);
+  DCHECK_LT(worker_id, num_workers());
+  current_queue = this;
+  current_worker_id = worker_id;
+  for (;;) {
+    if (terminated_.load()) {
+      current_queue = nullptr;
+      return nullptr;
+    }
+
+    size_t delayed_tasks_epoch = delayed_tasks_epoch_.load();
+    double next_deadline = -1;
+    if (has_delayed_tasks_.load()) {
+      next_deadline = FlushDelayedTasks(worker_id);
+    }
+
+    if (std::unique_ptr<Task> task = TryGetTask(worker_id)) return task;
+
+    base::MutexGuard guard(&idle_lock_);
+    idle_workers_.fetch_add(1);
+    // Re-check for tasks that were posted after we last looked. A changed
+    // epoch means a delayed task was added that |next_deadline| misses.
+    if (pending_tasks_.load() == 0 && !terminated_.load() &&
+        delayed_tasks_epoch_.load() == delayed_tasks_epoch) {
+      if (next_deadline >= 0) {
+        // Wait for the next delayed task or a newly posted task.
+        double wait_in_seconds = next_deadline - MonotonicallyIncreasingTime();
+        if (wait_in_seconds > 0) {
+          base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
+              base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
+          // Like DelayedTaskQueue, this waits for real time rather than
+          // |time_function_| time.
+          bool notified = idle_condition_var_.WaitFor(&idle_lock_, wait_delta);
+          USE(notified);
+        }
+      } else {
+        idle_condition_var_.Wait(&idle_lock_);
+      }
+    }
+    idle_workers_.fetch_sub(1);
+  }
+}
+
+void WorkStealingTaskQueue::Terminate() {
+  base::MutexGuard guard(&idle_lock_);
+  DCHECK(!terminated_.load());
+  terminated_.store(true);
+  idle_condition_var_.NotifyAll();
+}
+
+}  // namespace platform
+}  // namespace v8
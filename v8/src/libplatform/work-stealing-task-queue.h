@@ -0,0 +1,106 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+#define V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace platform {
+
+// WorkStealingTaskQueue provides queueing for immediate and delayed tasks for
+// a fixed number of worker threads. Every worker owns one deque per
+// TaskPriority, guarded by its own lock. Tasks posted from a worker thread go
+// to that worker's deques, other tasks are distributed round-robin. A worker
+// looking for work drains the highest non-empty priority first, taking from
+// its own deque before stealing from the other workers'. Unlike
+// DelayedTaskQueue, no ordering between tasks is guaranteed.
+class V8_PLATFORM_EXPORT WorkStealingTaskQueue {
+ public:
+  using TimeFunction = double (*)();
+
+  WorkStealingTaskQueue(int num_workers, TimeFunction time_function);
+  ~WorkStealingTaskQueue();
+
+  double MonotonicallyIncreasingTime();
+
+  // Appends an immediate task with the given |priority|. The queue takes
+  // ownership of |task|. Tasks appended after Terminate() are dropped.
+  // Thread-safe.
+  void Append(std::unique_ptr<Task> task, TaskPriority priority);
+
+  // Appends a delayed task. Once its deadline has passed the task is handed
+  // to a worker with TaskPriority::kUserVisible. Thread-safe.
+  void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
+
+  // Returns the next task for the worker |worker_id|, which must be in
+  // [0, num_workers). Blocks if no task is available. Returns nullptr if the
+  // queue is terminated. Must only be called from the thread backing
+  // |worker_id|.
+  std::unique_ptr<Task> GetNext(int worker_id);
+
+  // Terminate the queue. All workers blocked in GetNext() return nullptr.
+  void Terminate();
+
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  static constexpr int kNumPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
+  struct WorkerDeques {
+    base::Mutex lock;
+    std::deque<std::unique_ptr<Task>> tasks[kNumPriorities];
+    // Mirrors tasks[i].size() so that thieves can skip empty deques without
+    // taking |lock|.
+    std::atomic<size_t> sizes[kNumPriorities];
+  };
+
+  void Push(int worker_id, std::unique_ptr<Task> task, TaskPriority priority);
+  std::unique_ptr<Task> TryPop(int worker_id, int priority);
+  std::unique_ptr<Task> TryGetTask(int worker_id);
+  // Moves delayed tasks that have hit their deadline to |worker_id|'s deques
+  // and returns the time of the next pending deadline, or a negative value if
+  // there is none.
+  double FlushDelayedTasks(int worker_id);
+  void WakeUpIdleWorker();
+
+  std::vector<std::unique_ptr<WorkerDeques>> workers_;
+  std::atomic<size_t> next_worker_{0};
+
+  // Number of tasks in all deques. Used together with |idle_workers_| to
+  // avoid lost wake-ups without taking |idle_lock_| on every post.
+  std::atomic<size_t> pending_tasks_{0};
+  std::atomic<int> idle_workers_{0};
+  std::atomic<bool> terminated_{false};
+  base::Mutex idle_lock_;
+  base::ConditionVariable idle_condition_var_;
+
+  std::atomic<bool> has_delayed_tasks_{false};
+  // Incremented whenever a delayed task is added, so that idle workers notice
+  // deadlines that are earlier than the one they are about to wait for.
+  std::atomic<size_t> delayed_tasks_epoch_{0};
+  base::Mutex delayed_lock_;
+  std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
+
+  TimeFunction time_function_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingTaskQueue);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
@@ -74,6 +74,9 @@ namespace internal {
   /* percent of freed code size per module, collected on GC */                 \
   HR(wasm_module_freed_code_size_percent, V8.WasmModuleCodeSizePercentFreed,   \
      0, 100, 32)                                                               \
+  /* percent of functions tiered up by dynamic tiering, collected on GC */     \
+  HR(wasm_module_tiered_up_functions_percent,                                  \
+     V8.WasmModuleTieredUpFunctionsPercent, 0, 100, 32)                        \
   /* number of code GCs triggered per native module, collected on code GC */   \
   HR(wasm_module_num_triggered_code_gcs,                                       \
      V8.WasmModuleNumberOfCodeGCsTriggered, 1, 128, 20)                        \
@@ -167,6 +170,10 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  HT(turbofan_optimize_queue_latency, V8.TurboFanOptimizeQueueLatency,         \
+     10000000, MICROSECOND)                                                    \
+  HT(turbofan_optimize_install_latency, V8.TurboFanOptimizeInstallLatency,     \
+     10000000, MICROSECOND)                                                    \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
@@ -318,6 +325,8 @@ namespace internal {
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)            \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                             \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions) \
+  SC(wasm_tiering_budget_exhausted, V8.WasmTieringBudgetExhausted)   \
+  SC(wasm_dynamic_tier_up_units, V8.WasmDynamicTierUpUnits)          \
   SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)        \
   SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)
 
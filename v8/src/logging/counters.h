@@ -753,6 +753,7 @@ class RuntimeCallTimer final {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToStream)                                \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
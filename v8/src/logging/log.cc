@@ -82,6 +82,8 @@ static const char* ComputeMarker(SharedFunctionInfo shared, AbstractCode code) {
   switch (code.kind()) {
     case CodeKind::INTERPRETED_FUNCTION:
       return shared.optimization_disabled() ? "" : "~";
+    case CodeKind::BASELINE:
+      return "^";
     case CodeKind::TURBOFAN:
     case CodeKind::NATIVE_CONTEXT_INDEPENDENT:
     case CodeKind::TURBOPROP:
@@ -2170,6 +2172,10 @@ void ExistingCodeLogger::LogCodeObject(Object object) {
       return;  // We log this later using LogCompiledFunctions.
     case CodeKind::BYTECODE_HANDLER:
       return;  // We log it later by walking the dispatch table.
+    case CodeKind::BASELINE:
+      description = "A baseline function";
+      tag = CodeEventListener::FUNCTION_TAG;
+      break;
     case CodeKind::FOR_TESTING:
       description = "STUB code";
       tag = CodeEventListener::STUB_TAG;
@@ -0,0 +1,725 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/numbers/bigint-arithmetic.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+#include "src/execution/isolate.h"
+#include "src/execution/stack-guard.h"
+#include "src/objects/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+using digit_t = BigIntArithmetic::digit_t;
+using Digits = std::vector<digit_t>;
+
+namespace {
+
+const int kDigitBits = BigIntArithmetic::kDigitBits;
+
+void Normalize(Digits* x) {
+  while (!x->empty() && x->back() == 0) x->pop_back();
+}
+
+Digits FromVector(Vector<const digit_t> x) {
+  Digits result(x.begin(), x.end());
+  Normalize(&result);
+  return result;
+}
+
+void ToVector(Vector<digit_t> z, const Digits& x) {
+  CHECK_LE(x.size(), z.size());
+  std::copy(x.begin(), x.end(), z.begin());
+  std::fill(z.begin() + x.size(), z.end(), 0);
+}
+
+int Compare(const Digits& a, const Digits& b) {
+  if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+  for (size_t i = a.size(); i-- > 0;) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+// Digits [from, to) of {x}, normalized.
+Digits Slice(const Digits& x, size_t from, size_t to) {
+  from = std::min(from, x.size());
+  to = std::min(to, x.size());
+  Digits result(x.begin() + from, x.begin() + to);
+  Normalize(&result);
+  return result;
+}
+
+// z += x * beta^shift, where beta is the digit base.
+void AddShifted(Digits* z, const Digits& x, size_t shift) {
+  if (x.empty()) return;
+  if (z->size() < x.size() + shift) z->resize(x.size() + shift, 0);
+  digit_t carry = 0;
+  size_t i = 0;
+  for (; i < x.size(); i++) {
+    digit_t new_carry = 0;
+    digit_t sum = BigIntArithmetic::digit_add((*z)[shift + i], x[i],
+                                              &new_carry);
+    (*z)[shift + i] = BigIntArithmetic::digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  for (i += shift; carry != 0; i++) {
+    if (i == z->size()) z->push_back(0);
+    digit_t new_carry = 0;
+    (*z)[i] = BigIntArithmetic::digit_add((*z)[i], carry, &new_carry);
+    carry = new_carry;
+  }
+}
+
+Digits Add(const Digits& a, const Digits& b) {
+  Digits result = a;
+  AddShifted(&result, b, 0);
+  return result;
+}
+
+// z -= x * beta^shift. Requires z >= x * beta^shift.
+void SubShifted(Digits* z, const Digits& x, size_t shift) {
+  digit_t borrow = 0;
+  size_t i = 0;
+  for (; i < x.size(); i++) {
+    DCHECK_LT(shift + i, z->size());
+    digit_t new_borrow = 0;
+    digit_t difference = BigIntArithmetic::digit_sub((*z)[shift + i], x[i],
+                                                     &new_borrow);
+    (*z)[shift + i] =
+        BigIntArithmetic::digit_sub(difference, borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  for (i += shift; borrow != 0; i++) {
+    DCHECK_LT(i, z->size());
+    digit_t new_borrow = 0;
+    (*z)[i] = BigIntArithmetic::digit_sub((*z)[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  Normalize(z);
+}
+
+// Requires a >= b.
+Digits Sub(const Digits& a, const Digits& b) {
+  Digits result = a;
+  SubShifted(&result, b, 0);
+  return result;
+}
+
+Digits ShiftLeftBits(const Digits& x, int shift) {
+  DCHECK(0 <= shift && shift < kDigitBits);
+  if (shift == 0 || x.empty()) return x;
+  Digits result(x.size() + 1);
+  digit_t carry = 0;
+  for (size_t i = 0; i < x.size(); i++) {
+    result[i] = (x[i] << shift) | carry;
+    carry = x[i] >> (kDigitBits - shift);
+  }
+  result[x.size()] = carry;
+  Normalize(&result);
+  return result;
+}
+
+Digits ShiftRightBits(const Digits& x, int shift) {
+  DCHECK(0 <= shift && shift < kDigitBits);
+  if (shift == 0 || x.empty()) return x;
+  Digits result(x.size());
+  for (size_t i = 0; i < x.size(); i++) {
+    result[i] = x[i] >> shift;
+    if (i + 1 < x.size()) result[i] |= x[i + 1] << (kDigitBits - shift);
+  }
+  Normalize(&result);
+  return result;
+}
+
+// Divides {x} in place by a single digit and returns the remainder.
+digit_t DivideSingle(Digits* x, digit_t divisor) {
+  DCHECK_NE(divisor, 0);
+  digit_t remainder = 0;
+  for (size_t i = x->size(); i-- > 0;) {
+    (*x)[i] =
+        BigIntArithmetic::digit_div(remainder, (*x)[i], divisor, &remainder);
+  }
+  Normalize(x);
+  return remainder;
+}
+
+// Multiplies {x} in place by a single digit and adds {summand}.
+void MultiplyAddSingle(Digits* x, digit_t factor, digit_t summand) {
+  digit_t carry = summand;
+  for (size_t i = 0; i < x->size(); i++) {
+    digit_t high = 0;
+    digit_t low = BigIntArithmetic::digit_mul((*x)[i], factor, &high);
+    (*x)[i] = BigIntArithmetic::digit_add(low, carry, &high);
+    carry = high;
+  }
+  if (carry != 0) x->push_back(carry);
+  Normalize(x);
+}
+
+// Returns whether (factor1 * factor2) > (high << kDigitBits) + low.
+bool ProductGreaterThan(digit_t factor1, digit_t factor2, digit_t high,
+                        digit_t low) {
+  digit_t result_high;
+  digit_t result_low = BigIntArithmetic::digit_mul(factor1, factor2,
+                                                   &result_high);
+  return result_high > high || (result_high == high && result_low > low);
+}
+
+}  // namespace
+
+void BigIntArithmetic::AddWorkEstimate(uintptr_t estimate) {
+  work_estimate_ += estimate;
+  if (work_estimate_ < 5000000) return;
+  work_estimate_ = 0;
+  if (isolate_ == nullptr || interrupted_) return;
+  StackLimitCheck interrupt_check(isolate_);
+  if (interrupt_check.InterruptRequested() &&
+      isolate_->stack_guard()->HandleInterrupts().IsException(isolate_)) {
+    interrupted_ = true;
+  }
+}
+
+// Multiplication.
+
+bool BigIntArithmetic::Multiply(Vector<digit_t> Z, Vector<const digit_t> X,
+                                Vector<const digit_t> Y) {
+  Digits z;
+  MultiplyImpl(&z, FromVector(X), FromVector(Y));
+  if (interrupted()) return false;
+  ToVector(Z, z);
+  return true;
+}
+
+void BigIntArithmetic::MultiplyImpl(Digits* z, const Digits& x,
+                                    const Digits& y) {
+  if (x.size() < y.size()) return MultiplyImpl(z, y, x);
+  z->clear();
+  if (y.empty() || interrupted()) return;
+  const size_t n = y.size();
+  if (n < static_cast<size_t>(kKaratsubaThreshold)) {
+    return MultiplySchoolbook(z, x, y);
+  }
+  if (x.size() >= 2 * n) {
+    // Split the larger factor into chunks the size of the smaller one, so
+    // that the recursive multiplications are balanced.
+    for (size_t i = 0; i < x.size(); i += n) {
+      Digits product;
+      MultiplyImpl(&product, Slice(x, i, i + n), y);
+      AddShifted(z, product, i);
+    }
+    Normalize(z);
+    return;
+  }
+  if (n < static_cast<size_t>(kToomThreshold)) {
+    return MultiplyKaratsuba(z, x, y);
+  }
+  MultiplyToom3(z, x, y);
+}
+
+void BigIntArithmetic::MultiplySchoolbook(Digits* z, const Digits& x,
+                                          const Digits& y) {
+  z->assign(x.size() + y.size(), 0);
+  for (size_t i = 0; i < y.size(); i++) {
+    digit_t multiplier = y[i];
+    if (multiplier == 0) continue;
+    digit_t carry = 0;
+    for (size_t j = 0; j < x.size(); j++) {
+      digit_t high = 0;
+      digit_t low = digit_mul(x[j], multiplier, &high);
+      low = digit_add(low, carry, &high);
+      (*z)[i + j] = digit_add((*z)[i + j], low, &high);
+      carry = high;
+    }
+    (*z)[i + x.size()] = carry;
+  }
+  Normalize(z);
+  AddWorkEstimate(x.size() * y.size());
+}
+
+// (x1 * beta^m + x0) * (y1 * beta^m + y0) =
+//     x1*y1 * beta^2m + ((x0 + x1)(y0 + y1) - x0*y0 - x1*y1) * beta^m + x0*y0
+void BigIntArithmetic::MultiplyKaratsuba(Digits* z, const Digits& x,
+                                         const Digits& y) {
+  const size_t m = (x.size() + 1) / 2;
+  Digits x0 = Slice(x, 0, m), x1 = Slice(x, m, x.size());
+  Digits y0 = Slice(y, 0, m), y1 = Slice(y, m, y.size());
+  Digits z0, z1, z2;
+  MultiplyImpl(&z0, x0, y0);
+  MultiplyImpl(&z2, x1, y1);
+  MultiplyImpl(&z1, Add(x0, x1), Add(y0, y1));
+  if (interrupted()) return;
+  SubShifted(&z1, z0, 0);
+  SubShifted(&z1, z2, 0);
+  *z = z0;
+  AddShifted(z, z1, m);
+  AddShifted(z, z2, 2 * m);
+  Normalize(z);
+}
+
+namespace {
+
+// A signed number, for the intermediate values of Toom-Cook multiplication.
+struct Signed {
+  Digits magnitude;
+  bool negative = false;
+};
+
+Signed SignedAdd(const Signed& a, const Signed& b) {
+  Signed result;
+  if (a.negative == b.negative) {
+    result.magnitude = Add(a.magnitude, b.magnitude);
+    result.negative = a.negative;
+  } else if (Compare(a.magnitude, b.magnitude) >= 0) {
+    result.magnitude = Sub(a.magnitude, b.magnitude);
+    result.negative = a.negative;
+  } else {
+    result.magnitude = Sub(b.magnitude, a.magnitude);
+    result.negative = b.negative;
+  }
+  if (result.magnitude.empty()) result.negative = false;
+  return result;
+}
+
+Signed SignedSub(const Signed& a, const Signed& b) {
+  Signed negated_b = b;
+  negated_b.negative = !b.negative && !b.magnitude.empty();
+  return SignedAdd(a, negated_b);
+}
+
+// Divides by a small number that is known to divide {a}.
+Signed SignedDivideExact(const Signed& a, digit_t divisor) {
+  Signed result = a;
+  digit_t remainder = DivideSingle(&result.magnitude, divisor);
+  DCHECK_EQ(remainder, 0);
+  USE(remainder);
+  if (result.magnitude.empty()) result.negative = false;
+  return result;
+}
+
+Signed SignedShiftLeft(const Signed& a, int shift) {
+  Signed result;
+  result.magnitude = ShiftLeftBits(a.magnitude, shift);
+  result.negative = a.negative;
+  return result;
+}
+
+Signed MakeSigned(Digits magnitude) {
+  Signed result;
+  result.magnitude = std::move(magnitude);
+  return result;
+}
+
+}  // namespace
+
+// Toom-Cook 3-way multiplication, with the evaluation points 0, 1, -1, -2
+// and infinity and the interpolation sequence by Bodrato and Zanoni,
+// "What about Toom-Cook matrices optimality?" (2006).
+void BigIntArithmetic::MultiplyToom3(Digits* z, const Digits& x,
+                                     const Digits& y) {
+  const size_t k = (x.size() + 2) / 3;
+  Signed x0 = MakeSigned(Slice(x, 0, k));
+  Signed x1 = MakeSigned(Slice(x, k, 2 * k));
+  Signed x2 = MakeSigned(Slice(x, 2 * k, x.size()));
+  Signed y0 = MakeSigned(Slice(y, 0, k));
+  Signed y1 = MakeSigned(Slice(y, k, 2 * k));
+  Signed y2 = MakeSigned(Slice(y, 2 * k, y.size()));
+
+  // Evaluation.
+  Signed p = SignedAdd(x0, x2);
+  Signed x_at_1 = SignedAdd(p, x1);
+  Signed x_at_m1 = SignedSub(p, x1);
+  Signed x_at_m2 =
+      SignedSub(SignedShiftLeft(SignedAdd(x_at_m1, x2), 1), x0);
+  Signed q = SignedAdd(y0, y2);
+  Signed y_at_1 = SignedAdd(q, y1);
+  Signed y_at_m1 = SignedSub(q, y1);
+  Signed y_at_m2 =
+      SignedSub(SignedShiftLeft(SignedAdd(y_at_m1, y2), 1), y0);
+
+  // Pointwise multiplication.
+  auto multiply = [this](Signed* product, const Signed& a, const Signed& b) {
+    MultiplyImpl(&product->magnitude, a.magnitude, b.magnitude);
+    product->negative =
+        !product->magnitude.empty() && a.negative != b.negative;
+  };
+  Signed r0, r1, r_m1, r_m2, r_inf;
+  multiply(&r0, x0, y0);
+  multiply(&r1, x_at_1, y_at_1);
+  multiply(&r_m1, x_at_m1, y_at_m1);
+  multiply(&r_m2, x_at_m2, y_at_m2);
+  multiply(&r_inf, x2, y2);
+  if (interrupted()) return;
+
+  // Interpolation.
+  Signed r3 = SignedDivideExact(SignedSub(r_m2, r1), 3);
+  r1 = SignedDivideExact(SignedSub(r1, r_m1), 2);
+  Signed r2 = SignedSub(r_m1, r0);
+  r3 = SignedAdd(SignedDivideExact(SignedSub(r2, r3), 2),
+                 SignedShiftLeft(r_inf, 1));
+  r2 = SignedSub(SignedAdd(r2, r1), r_inf);
+  r1 = SignedSub(r1, r3);
+
+  // Recomposition. All coefficients are non-negative now.
+  DCHECK(!r1.negative && !r2.negative && !r3.negative);
+  *z = r0.magnitude;
+  AddShifted(z, r1.magnitude, k);
+  AddShifted(z, r2.magnitude, 2 * k);
+  AddShifted(z, r3.magnitude, 3 * k);
+  AddShifted(z, r_inf.magnitude, 4 * k);
+  Normalize(z);
+}
+
+// Division.
+
+bool BigIntArithmetic::Divide(Vector<digit_t> Q, Vector<digit_t> R,
+                              Vector<const digit_t> A,
+                              Vector<const digit_t> B) {
+  Digits q, r;
+  Digits b = FromVector(B);
+  CHECK(!b.empty());
+  DivideImpl(&q, &r, FromVector(A), b);
+  if (interrupted()) return false;
+  if (!Q.empty()) ToVector(Q, q);
+  if (!R.empty()) ToVector(R, r);
+  return true;
+}
+
+void BigIntArithmetic::DivideImpl(Digits* q, Digits* r, const Digits& a,
+                                  const Digits& b) {
+  const size_t threshold = kBurnikelThreshold;
+  if (b.size() >= threshold && a.size() >= b.size() + threshold) {
+    DivideBurnikel(q, r, a, b);
+  } else {
+    DivideSchoolbook(q, r, a, b);
+  }
+}
+
+// See Knuth, Volume 2, section 4.3.1, Algorithm D.
+void BigIntArithmetic::DivideSchoolbook(Digits* q, Digits* r, const Digits& a,
+                                        const Digits& b) {
+  DCHECK(!b.empty());
+  if (Compare(a, b) < 0) {
+    q->clear();
+    *r = a;
+    return;
+  }
+  if (b.size() == 1) {
+    *q = a;
+    digit_t remainder = DivideSingle(q, b[0]);
+    r->clear();
+    if (remainder != 0) r->push_back(remainder);
+    return;
+  }
+  const size_t n = b.size();
+  const size_t m = a.size() - n;
+  // D1. Normalize so that the divisor's most significant bit is set.
+  const int shift = base::bits::CountLeadingZeros(b.back());
+  Digits v = ShiftLeftBits(b, shift);
+  DCHECK_EQ(v.size(), n);
+  Digits u = ShiftLeftBits(a, shift);
+  u.resize(a.size() + 1, 0);
+  q->assign(m + 1, 0);
+
+  const digit_t vn1 = v[n - 1];
+  const digit_t vn2 = v[n - 2];
+  for (size_t j = m + 1; j-- > 0;) {
+    // D3. Estimate the quotient digit.
+    digit_t qhat = std::numeric_limits<digit_t>::max();
+    const digit_t ujn = u[j + n];
+    if (ujn != vn1) {
+      digit_t rhat = 0;
+      qhat = digit_div(ujn, u[j + n - 1], vn1, &rhat);
+      while (ProductGreaterThan(qhat, vn2, rhat, u[j + n - 2])) {
+        qhat--;
+        digit_t prev_rhat = rhat;
+        rhat += vn1;
+        // v[n-1] >= 0, so this tests for overflow.
+        if (rhat < prev_rhat) break;
+      }
+    }
+    // D4. Multiply and subtract.
+    digit_t carry = 0;
+    digit_t borrow = 0;
+    for (size_t i = 0; i < n; i++) {
+      digit_t high = 0;
+      digit_t low = digit_mul(qhat, v[i], &high);
+      low = digit_add(low, carry, &high);
+      carry = high;
+      digit_t new_borrow = 0;
+      digit_t difference = digit_sub(u[j + i], low, &new_borrow);
+      u[j + i] = digit_sub(difference, borrow, &new_borrow);
+      borrow = new_borrow;
+    }
+    digit_t new_borrow = 0;
+    digit_t top = digit_sub(u[j + n], carry, &new_borrow);
+    u[j + n] = digit_sub(top, borrow, &new_borrow);
+    // D5/D6. If the result was negative, the quotient digit was one too
+    // large; add the divisor back.
+    if (new_borrow != 0) {
+      qhat--;
+      digit_t add_carry = 0;
+      for (size_t i = 0; i < n; i++) {
+        digit_t new_carry = 0;
+        digit_t sum = digit_add(u[j + i], v[i], &new_carry);
+        u[j + i] = digit_add(sum, add_carry, &new_carry);
+        add_carry = new_carry;
+      }
+      u[j + n] += add_carry;
+    }
+    (*q)[j] = qhat;
+  }
+  Normalize(q);
+  u.resize(n);
+  Normalize(&u);
+  *r = ShiftRightBits(u, shift);
+  AddWorkEstimate((m + 1) * n);
+}
+
+// Burnikel and Ziegler, "Fast Recursive Division" (1998), Algorithm 2.
+void BigIntArithmetic::DivideBurnikel(Digits* q, Digits* r, const Digits& a,
+                                      const Digits& b) {
+  const int s = static_cast<int>(b.size());
+  // Choose the block size n = j * 2^k >= s with j < kBurnikelThreshold, so
+  // that D2n1n can halve n k times before falling back to schoolbook.
+  int m = 1;
+  while (m * kBurnikelThreshold <= s) m *= 2;
+  const int j = (s + m - 1) / m;
+  const int n = j * m;
+  // Normalize: shift so that B has exactly n digits and its top bit set.
+  const int sigma_digits = n - s;
+  const int sigma_bits = base::bits::CountLeadingZeros(b.back());
+  Digits b_normalized(sigma_digits, 0);
+  Digits shifted_b = ShiftLeftBits(b, sigma_bits);
+  b_normalized.insert(b_normalized.end(), shifted_b.begin(), shifted_b.end());
+  DCHECK_EQ(b_normalized.size(), static_cast<size_t>(n));
+  Digits a_normalized(sigma_digits, 0);
+  Digits shifted_a = ShiftLeftBits(a, sigma_bits);
+  a_normalized.insert(a_normalized.end(), shifted_a.begin(), shifted_a.end());
+
+  // Split A into t blocks of n digits, such that the most significant block
+  // has its top bit clear and is hence smaller than B.
+  const size_t a_bits =
+      a_normalized.size() * kDigitBits -
+      base::bits::CountLeadingZeros(a_normalized.back());
+  const size_t block_bits = static_cast<size_t>(n) * kDigitBits;
+  const int t = std::max(static_cast<int>(a_bits / block_bits) + 1, 2);
+
+  // Z = [A_{t-1} A_{t-2}].
+  Digits z = Slice(a_normalized, (t - 2) * n, t * n);
+  q->clear();
+  for (int i = t - 2; i >= 0; i--) {
+    Digits q_i, r_i;
+    D2n1n(&q_i, &r_i, z, b_normalized, n);
+    if (interrupted()) return;
+    AddShifted(q, q_i, i * n);
+    if (i > 0) {
+      // Z = [R A_{i-1}].
+      z = Slice(a_normalized, (i - 1) * n, i * n);
+      AddShifted(&z, r_i, n);
+    } else {
+      z = std::move(r_i);
+    }
+  }
+  Normalize(q);
+  // Undo the normalization of the remainder.
+  *r = ShiftRightBits(Slice(z, sigma_digits, z.size()), sigma_bits);
+}
+
+// Algorithm 1: Divides the 2n-digit {a} by the n-digit {b}, which has its
+// top bit set, where a < b * beta^n.
+void BigIntArithmetic::D2n1n(Digits* q, Digits* r, const Digits& a,
+                             const Digits& b, int n) {
+  if (n % 2 != 0 || n < kBurnikelThreshold) {
+    return DivideSchoolbook(q, r, a, b);
+  }
+  const int half = n / 2;
+  // [A1 A2 A3 A4] / [B1 B2], in two steps of [A1 A2 A3] / B and
+  // [R1 R2 A4] / B.
+  Digits q1, r1, q2;
+  D3n2n(&q1, &r1, Slice(a, 2 * half, 4 * half), Slice(a, half, 2 * half), b,
+        half);
+  if (interrupted()) return;
+  D3n2n(&q2, r, r1, Slice(a, 0, half), b, half);
+  *q = q2;
+  AddShifted(q, q1, half);
+  Normalize(q);
+}
+
+// Algorithm 2: Divides [A1 A2 A3] by the 2n-digit [B1 B2], where {a12} is
+// [A1 A2] and every A_i and B_i has n digits, and [A1 A2] < [B1 B2].
+void BigIntArithmetic::D3n2n(Digits* q, Digits* r, const Digits& a12,
+                             const Digits& a3, const Digits& b, int n) {
+  Digits a1 = Slice(a12, n, 2 * n);
+  Digits b1 = Slice(b, n, 2 * n);
+  Digits b2 = Slice(b, 0, n);
+  Digits r1;
+  if (Compare(a1, b1) < 0) {
+    D2n1n(q, &r1, a12, b1, n);
+    if (interrupted()) return;
+  } else {
+    // Q = beta^n - 1, R1 = [A1 A2] - [B1 0] + [0 B1].
+    q->assign(n, std::numeric_limits<digit_t>::max());
+    r1 = Add(a12, b1);
+    SubShifted(&r1, b1, n);
+  }
+  Digits d;
+  MultiplyImpl(&d, *q, b2);
+  // R = [R1 A3] - D, corrected until it is non-negative.
+  Digits r_hat = a3;
+  AddShifted(&r_hat, r1, n);
+  Normalize(&r_hat);
+  Digits one(1, 1);
+  while (Compare(r_hat, d) < 0) {
+    SubShifted(q, one, 0);
+    AddShifted(&r_hat, b, 0);
+  }
+  SubShifted(&r_hat, d, 0);
+  *r = std::move(r_hat);
+}
+
+// Conversion to and from strings.
+
+namespace {
+
+const char kConversionChars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// Writes exactly {width} characters ending at {end}, zero-padded on the
+// left, by repeatedly dividing {x} by {chunk_divisor} == radix^chunk_chars.
+void ToStringSchoolbook(char* end, int width, Digits x, int radix,
+                        int chunk_chars, digit_t chunk_divisor) {
+  char* const start = end - width;
+  while (!x.empty()) {
+    digit_t chunk = DivideSingle(&x, chunk_divisor);
+    for (int i = 0; i < chunk_chars && end > start; i++) {
+      *--end = kConversionChars[chunk % radix];
+      chunk /= radix;
+    }
+    DCHECK_EQ(chunk, 0);
+  }
+  while (end > start) *--end = '0';
+}
+
+}  // namespace
+
+bool BigIntArithmetic::ToString(std::vector<char>* out,
+                                Vector<const digit_t> X, int radix) {
+  DCHECK(2 <= radix && radix <= 36);
+  Digits x = FromVector(X);
+  DCHECK(!x.empty());
+  // The largest power of {radix} that fits into a digit.
+  int chunk_chars = 0;
+  digit_t chunk_divisor = 1;
+  while (chunk_divisor <= std::numeric_limits<digit_t>::max() / radix) {
+    chunk_divisor *= radix;
+    chunk_chars++;
+  }
+  // powers[i] == chunk_divisor^(2^(i+1)), up to the first one that exceeds
+  // {x}. The string of any number below powers[i] is at most
+  // chunk_chars * 2^(i+1) characters long.
+  std::vector<Digits> powers;
+  Digits power;
+  MultiplyImpl(&power, Digits(1, chunk_divisor), Digits(1, chunk_divisor));
+  powers.push_back(power);
+  while (Compare(powers.back(), x) <= 0) {
+    MultiplyImpl(&power, powers.back(), powers.back());
+    if (interrupted()) return false;
+    powers.push_back(power);
+  }
+  const int level = static_cast<int>(powers.size()) - 1;
+  const int width = chunk_chars << (level + 1);
+  std::vector<char> buffer(width);
+  ToStringImpl(buffer.data() + width, width, x, powers, level - 1, radix,
+               chunk_chars, chunk_divisor);
+  if (interrupted()) return false;
+  // Remove leading zeroes.
+  auto first = std::find_if(buffer.begin(), buffer.end(),
+                            [](char c) { return c != '0'; });
+  DCHECK(first != buffer.end());
+  out->insert(out->end(), first, buffer.end());
+  return true;
+}
+
+// Writes exactly {width} characters for {x} < powers[level + 1] ending at
+// {end}, by splitting {x} into quotient and remainder of powers[level].
+void BigIntArithmetic::ToStringImpl(char* end, int width, const Digits& x,
+                                    const std::vector<Digits>& powers,
+                                    int level, int radix, int chunk_chars,
+                                    digit_t chunk_divisor) {
+  if (interrupted()) return;
+  if (level < 0 || x.size() < static_cast<size_t>(kToStringThreshold)) {
+    ToStringSchoolbook(end, width, x, radix, chunk_chars, chunk_divisor);
+    AddWorkEstimate(x.size() * x.size());
+    return;
+  }
+  Digits q, r;
+  DivideImpl(&q, &r, x, powers[level]);
+  const int low_width = chunk_chars << (level + 1);
+  DCHECK_LT(low_width, width);
+  ToStringImpl(end, low_width, r, powers, level - 1, radix, chunk_chars,
+               chunk_divisor);
+  ToStringImpl(end - low_width, width - low_width, q, powers, level - 1, radix,
+               chunk_chars, chunk_divisor);
+}
+
+bool BigIntArithmetic::FromParts(Vector<digit_t> Z,
+                                 Vector<const digit_t> multipliers,
+                                 Vector<const digit_t> parts) {
+  DCHECK_EQ(multipliers.size(), parts.size());
+  Digits value, multiplier;
+  if (parts.size() < static_cast<size_t>(kFromStringThreshold)) {
+    for (size_t i = 0; i < parts.size(); i++) {
+      MultiplyAddSingle(&value, multipliers[i], parts[i]);
+    }
+  } else {
+    FromPartsImpl(&value, &multiplier, multipliers, parts);
+    if (interrupted()) return false;
+  }
+  ToVector(Z, value);
+  return true;
+}
+
+// Computes the value of the given parts, and the product of their
+// multipliers, which is what the value of any parts that follow must be
+// shifted by.
+void BigIntArithmetic::FromPartsImpl(Digits* value, Digits* multiplier,
+                                     Vector<const digit_t> multipliers,
+                                     Vector<const digit_t> parts) {
+  if (parts.size() == 1) {
+    value->clear();
+    if (parts[0] != 0) value->push_back(parts[0]);
+    multiplier->assign(1, multipliers[0]);
+    return;
+  }
+  const size_t half = parts.size() / 2;
+  Digits high_value, high_multiplier, low_value, low_multiplier;
+  FromPartsImpl(&high_value, &high_multiplier, multipliers.SubVector(0, half),
+                parts.SubVector(0, half));
+  FromPartsImpl(&low_value, &low_multiplier,
+                multipliers.SubVector(half, parts.size()),
+                parts.SubVector(half, parts.size()));
+  MultiplyImpl(value, high_value, low_multiplier);
+  AddShifted(value, low_value, 0);
+  Normalize(value);
+  MultiplyImpl(multiplier, high_multiplier, low_multiplier);
+}
+
+// static
+digit_t BigIntArithmetic::digit_pow(digit_t base, digit_t exponent) {
+  digit_t result = 1ull;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result *= base;
+    }
+    exponent >>= 1;
+    base *= base;
+  }
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
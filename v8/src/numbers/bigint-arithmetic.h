@@ -0,0 +1,272 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_NUMBERS_BIGINT_ARITHMETIC_H_
+#define V8_NUMBERS_BIGINT_ARITHMETIC_H_
+
+#include <vector>
+
+#include "src/base/bits.h"
+#include "src/common/globals.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+#if V8_TARGET_ARCH_32_BIT
+#define HAVE_TWODIGIT_T 1
+using twodigit_t = uint64_t;
+#elif defined(__SIZEOF_INT128__)
+// Both Clang and GCC support this on x64.
+#define HAVE_TWODIGIT_T 1
+using twodigit_t = __uint128_t;
+#endif
+
+// Arithmetic on the magnitudes of arbitrary-precision integers, stored as
+// little-endian vectors of digits like the digits of a BigInt. Operands are
+// off-heap, so that long-running operations can check for interrupts (which
+// might move heap objects) in between.
+//
+// Large operands use asymptotically faster algorithms than the schoolbook
+// ones in MutableBigInt: Karatsuba and Toom-Cook 3-way multiplication,
+// Burnikel-Ziegler division, and divide-and-conquer radix conversion.
+class V8_EXPORT_PRIVATE BigIntArithmetic {
+ public:
+  using digit_t = uintptr_t;
+
+  static const int kDigitBits = sizeof(digit_t) * kBitsPerByte;
+  static const int kHalfDigitBits = kDigitBits / 2;
+  static const digit_t kHalfDigitMask = (digit_t{1} << kHalfDigitBits) - 1;
+
+  // Operand sizes (in digits) above which the faster algorithms pay off.
+  // Tuned on x64; the digit count of an operand is its bit length / 64.
+  static const int kKaratsubaThreshold = 34;
+  static const int kToomThreshold = 193;
+  static const int kBurnikelThreshold = 57;
+  static const int kToStringThreshold = 43;
+  // Minimum number of parts (each one or two digits) for FromParts to
+  // combine them pairwise instead of one by one.
+  static const int kFromStringThreshold = 50;
+
+  // Without an isolate, long-running operations are not interruptible.
+  explicit BigIntArithmetic(Isolate* isolate = nullptr) : isolate_(isolate) {}
+
+  // All operations below return false if they were interrupted by a
+  // termination request, in which case their outputs are undefined.
+
+  // Z := X * Y. {Z} must have room for at least X.length() + Y.length()
+  // digits; excess digits are zeroed.
+  bool Multiply(Vector<digit_t> Z, Vector<const digit_t> X,
+                Vector<const digit_t> Y);
+
+  // Q := A / B, R := A % B, for B != 0. Either output can be empty if the
+  // caller does not need it; otherwise {Q} must have room for
+  // A.length() - B.length() + 1 digits and {R} for B.length() digits.
+  // Excess digits are zeroed.
+  bool Divide(Vector<digit_t> Q, Vector<digit_t> R, Vector<const digit_t> A,
+              Vector<const digit_t> B);
+
+  // Appends the digits of X in the given radix, most significant first and
+  // without a sign, to {out}. X must be non-zero.
+  bool ToString(std::vector<char>* out, Vector<const digit_t> X, int radix);
+
+  // Sets Z to the value obtained by starting at zero and, for every i,
+  // multiplying by {multipliers[i]} and adding {parts[i]}. This is how
+  // StringToBigIntHelper accumulates the chunks of a parsed string. {Z} must
+  // be large enough for the result; excess digits are zeroed.
+  bool FromParts(Vector<digit_t> Z, Vector<const digit_t> multipliers,
+                 Vector<const digit_t> parts);
+
+  // Digit arithmetic helpers.
+
+  // {carry} must point to an initialized digit_t and will either be
+  // incremented by one or left alone.
+  static inline digit_t digit_add(digit_t a, digit_t b, digit_t* carry) {
+#if HAVE_TWODIGIT_T
+    twodigit_t result = static_cast<twodigit_t>(a) + static_cast<twodigit_t>(b);
+    *carry += result >> kDigitBits;
+    return static_cast<digit_t>(result);
+#else
+    digit_t result = a + b;
+    if (result < a) *carry += 1;
+    return result;
+#endif
+  }
+
+  // {borrow} must point to an initialized digit_t and will either be
+  // incremented by one or left alone.
+  static inline digit_t digit_sub(digit_t a, digit_t b, digit_t* borrow) {
+#if HAVE_TWODIGIT_T
+    twodigit_t result = static_cast<twodigit_t>(a) - static_cast<twodigit_t>(b);
+    *borrow += (result >> kDigitBits) & 1;
+    return static_cast<digit_t>(result);
+#else
+    digit_t result = a - b;
+    if (result > a) *borrow += 1;
+    return static_cast<digit_t>(result);
+#endif
+  }
+
+  // Returns the low half of the result. High half is in {high}.
+  static inline digit_t digit_mul(digit_t a, digit_t b, digit_t* high);
+
+  // Returns the quotient.
+  // quotient = (high << kDigitBits + low - remainder) / divisor
+  static inline digit_t digit_div(digit_t high, digit_t low,
+                                  digit_t divisor, digit_t* remainder);
+
+  // Raises {base} to the power of {exponent}. Does not check for overflow.
+  static digit_t digit_pow(digit_t base, digit_t exponent);
+
+ private:
+  // Counts work done by the schoolbook base cases and checks for interrupts
+  // every now and then (roughly every 10-20 of milliseconds -- rarely enough
+  // not to create noticeable overhead, frequently enough not to appear
+  // frozen).
+  void AddWorkEstimate(uintptr_t estimate);
+  bool interrupted() const { return interrupted_; }
+
+  // Implementations on normalized digit vectors (no leading zero digits).
+  using Digits = std::vector<digit_t>;
+
+  void MultiplyImpl(Digits* z, const Digits& x, const Digits& y);
+  void MultiplySchoolbook(Digits* z, const Digits& x, const Digits& y);
+  void MultiplyKaratsuba(Digits* z, const Digits& x, const Digits& y);
+  void MultiplyToom3(Digits* z, const Digits& x, const Digits& y);
+
+  void DivideImpl(Digits* q, Digits* r, const Digits& a, const Digits& b);
+  void DivideSchoolbook(Digits* q, Digits* r, const Digits& a,
+                        const Digits& b);
+  void DivideBurnikel(Digits* q, Digits* r, const Digits& a, const Digits& b);
+  void D2n1n(Digits* q, Digits* r, const Digits& a, const Digits& b, int n);
+  void D3n2n(Digits* q, Digits* r, const Digits& a12, const Digits& a3,
+             const Digits& b, int n);
+
+  void ToStringImpl(char* end, int width, const Digits& x,
+                    const std::vector<Digits>& powers, int level, int radix,
+                    int chunk_chars, digit_t chunk_divisor);
+  void FromPartsImpl(Digits* value, Digits* multiplier,
+                     Vector<const digit_t> multipliers,
+                     Vector<const digit_t> parts);
+
+  Isolate* isolate_;
+  uintptr_t work_estimate_ = 0;
+  bool interrupted_ = false;
+};
+
+// static
+inline BigIntArithmetic::digit_t BigIntArithmetic::digit_mul(digit_t a,
+                                                             digit_t b,
+                                                             digit_t* high) {
+#if HAVE_TWODIGIT_T
+  twodigit_t result = static_cast<twodigit_t>(a) * static_cast<twodigit_t>(b);
+  *high = result >> kDigitBits;
+  return static_cast<digit_t>(result);
+#else
+  // Multiply in half-pointer-sized chunks.
+  // For inputs [AH AL]*[BH BL], the result is:
+  //
+  //            [AL*BL]  // r_low
+  //    +    [AL*BH]     // r_mid1
+  //    +    [AH*BL]     // r_mid2
+  //    + [AH*BH]        // r_high
+  //    = [R4 R3 R2 R1]  // high = [R4 R3], low = [R2 R1]
+  //
+  // Where of course we must be careful with carries between the columns.
+  digit_t a_low = a & kHalfDigitMask;
+  digit_t a_high = a >> kHalfDigitBits;
+  digit_t b_low = b & kHalfDigitMask;
+  digit_t b_high = b >> kHalfDigitBits;
+
+  digit_t r_low = a_low * b_low;
+  digit_t r_mid1 = a_low * b_high;
+  digit_t r_mid2 = a_high * b_low;
+  digit_t r_high = a_high * b_high;
+
+  digit_t carry = 0;
+  digit_t low = digit_add(r_low, r_mid1 << kHalfDigitBits, &carry);
+  low = digit_add(low, r_mid2 << kHalfDigitBits, &carry);
+  *high =
+      (r_mid1 >> kHalfDigitBits) + (r_mid2 >> kHalfDigitBits) + r_high + carry;
+  return low;
+#endif
+}
+
+// static
+inline BigIntArithmetic::digit_t BigIntArithmetic::digit_div(
+    digit_t high, digit_t low, digit_t divisor, digit_t* remainder) {
+  DCHECK(high < divisor);
+#if V8_TARGET_ARCH_X64 && (__GNUC__ || __clang__)
+  digit_t quotient;
+  digit_t rem;
+  __asm__("divq  %[divisor]"
+          // Outputs: {quotient} will be in rax, {rem} in rdx.
+          : "=a"(quotient), "=d"(rem)
+          // Inputs: put {high} into rdx, {low} into rax, and {divisor} into
+          // any register or stack slot.
+          : "d"(high), "a"(low), [divisor] "rm"(divisor));
+  *remainder = rem;
+  return quotient;
+#elif V8_TARGET_ARCH_IA32 && (__GNUC__ || __clang__)
+  digit_t quotient;
+  digit_t rem;
+  __asm__("divl  %[divisor]"
+          // Outputs: {quotient} will be in eax, {rem} in edx.
+          : "=a"(quotient), "=d"(rem)
+          // Inputs: put {high} into edx, {low} into eax, and {divisor} into
+          // any register or stack slot.
+          : "d"(high), "a"(low), [divisor] "rm"(divisor));
+  *remainder = rem;
+  return quotient;
+#else
+  static const digit_t kHalfDigitBase = 1ull << kHalfDigitBits;
+  // Adapted from Warren, Hacker's Delight, p. 152.
+  int s = base::bits::CountLeadingZeros(divisor);
+  DCHECK_NE(s, kDigitBits);  // {divisor} is not 0.
+  divisor <<= s;
+
+  digit_t vn1 = divisor >> kHalfDigitBits;
+  digit_t vn0 = divisor & kHalfDigitMask;
+  // {s} can be 0. {low >> kDigitBits} would be undefined behavior, so
+  // we mask the shift amount with {kShiftMask}, and the result with
+  // {s_zero_mask} which is 0 if s == 0 and all 1-bits otherwise.
+  STATIC_ASSERT(sizeof(intptr_t) == sizeof(digit_t));
+  const int kShiftMask = kDigitBits - 1;
+  digit_t s_zero_mask =
+      static_cast<digit_t>(static_cast<intptr_t>(-s) >> (kDigitBits - 1));
+  digit_t un32 =
+      (high << s) | ((low >> ((kDigitBits - s) & kShiftMask)) & s_zero_mask);
+  digit_t un10 = low << s;
+  digit_t un1 = un10 >> kHalfDigitBits;
+  digit_t un0 = un10 & kHalfDigitMask;
+  digit_t q1 = un32 / vn1;
+  digit_t rhat = un32 - q1 * vn1;
+
+  while (q1 >= kHalfDigitBase || q1 * vn0 > rhat * kHalfDigitBase + un1) {
+    q1--;
+    rhat += vn1;
+    if (rhat >= kHalfDigitBase) break;
+  }
+
+  digit_t un21 = un32 * kHalfDigitBase + un1 - q1 * divisor;
+  digit_t q0 = un21 / vn1;
+  rhat = un21 - q0 * vn1;
+
+  while (q0 >= kHalfDigitBase || q0 * vn0 > rhat * kHalfDigitBase + un0) {
+    q0--;
+    rhat += vn1;
+    if (rhat >= kHalfDigitBase) break;
+  }
+
+  *remainder = (un21 * kHalfDigitBase + un0 - q0 * divisor) >> s;
+  return q1 * kHalfDigitBase + q0;
+#endif
+}
+
+#undef HAVE_TWODIGIT_T
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_NUMBERS_BIGINT_ARITHMETIC_H_
@@ -8,10 +8,12 @@
 #include <stdarg.h>
 
 #include <cmath>
+#include <vector>
 
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/heap/factory.h"
+#include "src/numbers/bigint-arithmetic.h"
 #include "src/numbers/dtoa.h"
 #include "src/numbers/strtod.h"
 #include "src/objects/bigint.h"
@@ -899,6 +901,11 @@ class StringToBigIntHelper : public StringToIntHelper<LocalIsolate> {
       case State::kZero:
         return BigInt::Zero(this->isolate(), allocation_type());
       case State::kDone:
+        if (collect_parts_ && !BigInt::InplaceMultiplyAddParts(
+                                  this->isolate(), result_,
+                                  VectorOf(multipliers_), VectorOf(parts_))) {
+          return MaybeHandle<BigInt>();
+        }
         return BigInt::Finalize<Isolate>(result_, this->negative());
       case State::kEmpty:
       case State::kRunning:
@@ -920,9 +927,18 @@ class StringToBigIntHelper : public StringToIntHelper<LocalIsolate> {
     if (!maybe.ToHandle(&result_)) {
       this->set_state(State::kError);
     }
+    // For long inputs, collect the parts and combine them at the end with
+    // a divide-and-conquer algorithm, which is subquadratic. Every part
+    // holds at most 8 decimal characters.
+    collect_parts_ = charcount / 8 >= BigIntArithmetic::kFromStringThreshold;
   }
 
   void ResultMultiplyAdd(uint32_t multiplier, uint32_t part) override {
+    if (collect_parts_) {
+      multipliers_.push_back(multiplier);
+      parts_.push_back(part);
+      return;
+    }
     BigInt::InplaceMultiplyAdd(*result_, static_cast<uintptr_t>(multiplier),
                                static_cast<uintptr_t>(part));
   }
@@ -939,6 +955,9 @@ class StringToBigIntHelper : public StringToIntHelper<LocalIsolate> {
  private:
   Handle<FreshlyAllocatedBigInt> result_;
   Behavior behavior_;
+  bool collect_parts_ = false;
+  std::vector<uintptr_t> multipliers_;
+  std::vector<uintptr_t> parts_;
 };
 
 template <typename LocalIsolate>
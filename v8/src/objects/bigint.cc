@@ -22,6 +22,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/numbers/bigint-arithmetic.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/double.h"
 #include "src/objects/heap-number-inl.h"
@@ -157,6 +158,12 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
                                Handle<MutableBigInt>* remainder);
   static bool ProductGreaterThan(digit_t factor1, digit_t factor2, digit_t high,
                                  digit_t low);
+
+  // Helpers for handing large operands to BigIntArithmetic, which works on
+  // off-heap copies of the digits.
+  static std::vector<digit_t> CopyDigits(Handle<BigIntBase> x);
+  static void SetDigits(Handle<MutableBigInt> result,
+                        const std::vector<digit_t>& digits);
   digit_t InplaceAdd(Handle<BigIntBase> summand, int start_index);
   digit_t InplaceSub(Handle<BigIntBase> subtrahend, int start_index);
   void InplaceRightShift(int shift);
@@ -196,13 +203,24 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
   // representation.
   static uint64_t GetRawBits(BigIntBase x, bool* lossless);
 
-  // Digit arithmetic helpers.
-  static inline digit_t digit_add(digit_t a, digit_t b, digit_t* carry);
-  static inline digit_t digit_sub(digit_t a, digit_t b, digit_t* borrow);
-  static inline digit_t digit_mul(digit_t a, digit_t b, digit_t* high);
+  // Digit arithmetic helpers, shared with BigIntArithmetic.
+  STATIC_ASSERT((std::is_same<digit_t, BigIntArithmetic::digit_t>::value));
+  static inline digit_t digit_add(digit_t a, digit_t b, digit_t* carry) {
+    return BigIntArithmetic::digit_add(a, b, carry);
+  }
+  static inline digit_t digit_sub(digit_t a, digit_t b, digit_t* borrow) {
+    return BigIntArithmetic::digit_sub(a, b, borrow);
+  }
+  static inline digit_t digit_mul(digit_t a, digit_t b, digit_t* high) {
+    return BigIntArithmetic::digit_mul(a, b, high);
+  }
   static inline digit_t digit_div(digit_t high, digit_t low, digit_t divisor,
-                                  digit_t* remainder);
-  static digit_t digit_pow(digit_t base, digit_t exponent);
+                                  digit_t* remainder) {
+    return BigIntArithmetic::digit_div(high, low, divisor, remainder);
+  }
+  static digit_t digit_pow(digit_t base, digit_t exponent) {
+    return BigIntArithmetic::digit_pow(base, exponent);
+  }
   static inline bool digit_ismax(digit_t x) {
     return static_cast<digit_t>(~x) == 0;
   }
@@ -525,6 +543,20 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
   if (!MutableBigInt::New(isolate, result_length).ToHandle(&result)) {
     return MaybeHandle<BigInt>();
   }
+  if (std::min(x->length(), y->length()) >=
+      BigIntArithmetic::kKaratsubaThreshold) {
+    std::vector<digit_t> x_digits = MutableBigInt::CopyDigits(x);
+    std::vector<digit_t> y_digits = MutableBigInt::CopyDigits(y);
+    std::vector<digit_t> result_digits(result_length);
+    if (!BigIntArithmetic(isolate).Multiply(VectorOf(result_digits),
+                                            VectorOf(x_digits),
+                                            VectorOf(y_digits))) {
+      return MaybeHandle<BigInt>();
+    }
+    MutableBigInt::SetDigits(result, result_digits);
+    result->set_sign(x->sign() != y->sign());
+    return MutableBigInt::MakeImmutable(result);
+  }
   result->InitializeDigits(result_length);
   uintptr_t work_estimate = 0;
   for (int i = 0; i < x->length(); i++) {
@@ -1538,6 +1570,36 @@ void BigInt::InplaceMultiplyAdd(FreshlyAllocatedBigInt x, uintptr_t factor,
                                      bigint);
 }
 
+namespace {
+
+// Only the main thread handles interrupts during long-running operations.
+Isolate* InterruptIsolate(Isolate* isolate) { return isolate; }
+Isolate* InterruptIsolate(LocalIsolate* isolate) { return nullptr; }
+
+}  // namespace
+
+template <typename LocalIsolate>
+bool BigInt::InplaceMultiplyAddParts(LocalIsolate* isolate,
+                                     Handle<FreshlyAllocatedBigInt> x,
+                                     Vector<const uintptr_t> multipliers,
+                                     Vector<const uintptr_t> parts) {
+  STATIC_ASSERT(sizeof(uintptr_t) == sizeof(digit_t));
+  std::vector<digit_t> digits(x->length());
+  if (!BigIntArithmetic(InterruptIsolate(isolate))
+           .FromParts(VectorOf(digits), multipliers, parts)) {
+    return false;
+  }
+  MutableBigInt::SetDigits(Handle<MutableBigInt>::cast(x), digits);
+  return true;
+}
+
+template bool BigInt::InplaceMultiplyAddParts<Isolate>(
+    Isolate*, Handle<FreshlyAllocatedBigInt>, Vector<const uintptr_t>,
+    Vector<const uintptr_t>);
+template bool BigInt::InplaceMultiplyAddParts<LocalIsolate>(
+    LocalIsolate*, Handle<FreshlyAllocatedBigInt>, Vector<const uintptr_t>,
+    Vector<const uintptr_t>);
+
 // Divides {x} by {divisor}, returning the result in {quotient} and {remainder}.
 // Mathematically, the contract is:
 // quotient = (x - remainder) / divisor, with 0 <= remainder < divisor.
@@ -1568,6 +1630,18 @@ void MutableBigInt::AbsoluteDivSmall(Isolate* isolate, Handle<BigIntBase> x,
   }
 }
 
+std::vector<BigInt::digit_t> MutableBigInt::CopyDigits(Handle<BigIntBase> x) {
+  std::vector<digit_t> digits(x->length());
+  for (int i = 0; i < x->length(); i++) digits[i] = x->digit(i);
+  return digits;
+}
+
+void MutableBigInt::SetDigits(Handle<MutableBigInt> result,
+                              const std::vector<digit_t>& digits) {
+  DCHECK_EQ(result->length(), static_cast<int>(digits.size()));
+  for (int i = 0; i < result->length(); i++) result->set_digit(i, digits[i]);
+}
+
 // Divides {dividend} by {divisor}, returning the result in {quotient} and
 // {remainder}. Mathematically, the contract is:
 // quotient = (dividend - remainder) / divisor, with 0 <= remainder < divisor.
@@ -1588,6 +1662,28 @@ bool MutableBigInt::AbsoluteDivLarge(Isolate* isolate,
   int n = divisor->length();
   int m = dividend->length() - n;
 
+  // For large operands, Burnikel-Ziegler division is faster.
+  if (n >= BigIntArithmetic::kBurnikelThreshold &&
+      m >= BigIntArithmetic::kBurnikelThreshold) {
+    std::vector<digit_t> a = CopyDigits(dividend);
+    std::vector<digit_t> b = CopyDigits(divisor);
+    std::vector<digit_t> q(quotient != nullptr ? m + 1 : 0);
+    std::vector<digit_t> r(remainder != nullptr ? n : 0);
+    if (!BigIntArithmetic(isolate).Divide(VectorOf(q), VectorOf(r),
+                                          VectorOf(a), VectorOf(b))) {
+      return false;
+    }
+    if (quotient != nullptr) {
+      *quotient = New(isolate, m + 1).ToHandleChecked();
+      SetDigits(*quotient, q);
+    }
+    if (remainder != nullptr) {
+      *remainder = New(isolate, n).ToHandleChecked();
+      SetDigits(*remainder, r);
+    }
+    return true;
+  }
+
   // The quotient to be computed.
   Handle<MutableBigInt> q;
   if (quotient != nullptr) q = New(isolate, m + 1).ToHandleChecked();
@@ -2163,6 +2259,24 @@ MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
       return MaybeHandle<String>();
     }
   }
+  if (length >= BigIntArithmetic::kToStringThreshold) {
+    // Divide-and-conquer conversion, which produces the exact length.
+    std::vector<digit_t> digits = CopyDigits(x);
+    std::vector<char> chars;
+    if (sign) chars.push_back('-');
+    if (!BigIntArithmetic(isolate).ToString(&chars, VectorOf(digits), radix)) {
+      return MaybeHandle<String>();
+    }
+    DCHECK_LE(chars.size(), chars_required);
+    Handle<SeqOneByteString> result =
+        isolate->factory()
+            ->NewRawOneByteString(static_cast<int>(chars.size()))
+            .ToHandleChecked();
+    DisallowHeapAllocation no_gc;
+    CopyChars(result->GetChars(no_gc), chars.data(), chars.size());
+    return result;
+  }
+
   Handle<SeqOneByteString> result =
       isolate->factory()
           ->NewRawOneByteString(static_cast<int>(chars_required))
@@ -2558,171 +2672,6 @@ uint64_t BigInt::AsUint64(bool* lossless) {
   return result;
 }
 
-// Digit arithmetic helpers.
-
-#if V8_TARGET_ARCH_32_BIT
-#define HAVE_TWODIGIT_T 1
-using twodigit_t = uint64_t;
-#elif defined(__SIZEOF_INT128__)
-// Both Clang and GCC support this on x64.
-#define HAVE_TWODIGIT_T 1
-using twodigit_t = __uint128_t;
-#endif
-
-// {carry} must point to an initialized digit_t and will either be incremented
-// by one or left alone.
-inline BigInt::digit_t MutableBigInt::digit_add(digit_t a, digit_t b,
-                                                digit_t* carry) {
-#if HAVE_TWODIGIT_T
-  twodigit_t result = static_cast<twodigit_t>(a) + static_cast<twodigit_t>(b);
-  *carry += result >> kDigitBits;
-  return static_cast<digit_t>(result);
-#else
-  digit_t result = a + b;
-  if (result < a) *carry += 1;
-  return result;
-#endif
-}
-
-// {borrow} must point to an initialized digit_t and will either be incremented
-// by one or left alone.
-inline BigInt::digit_t MutableBigInt::digit_sub(digit_t a, digit_t b,
-                                                digit_t* borrow) {
-#if HAVE_TWODIGIT_T
-  twodigit_t result = static_cast<twodigit_t>(a) - static_cast<twodigit_t>(b);
-  *borrow += (result >> kDigitBits) & 1;
-  return static_cast<digit_t>(result);
-#else
-  digit_t result = a - b;
-  if (result > a) *borrow += 1;
-  return static_cast<digit_t>(result);
-#endif
-}
-
-// Returns the low half of the result. High half is in {high}.
-inline BigInt::digit_t MutableBigInt::digit_mul(digit_t a, digit_t b,
-                                                digit_t* high) {
-#if HAVE_TWODIGIT_T
-  twodigit_t result = static_cast<twodigit_t>(a) * static_cast<twodigit_t>(b);
-  *high = result >> kDigitBits;
-  return static_cast<digit_t>(result);
-#else
-  // Multiply in half-pointer-sized chunks.
-  // For inputs [AH AL]*[BH BL], the result is:
-  //
-  //            [AL*BL]  // r_low
-  //    +    [AL*BH]     // r_mid1
-  //    +    [AH*BL]     // r_mid2
-  //    + [AH*BH]        // r_high
-  //    = [R4 R3 R2 R1]  // high = [R4 R3], low = [R2 R1]
-  //
-  // Where of course we must be careful with carries between the columns.
-  digit_t a_low = a & kHalfDigitMask;
-  digit_t a_high = a >> kHalfDigitBits;
-  digit_t b_low = b & kHalfDigitMask;
-  digit_t b_high = b >> kHalfDigitBits;
-
-  digit_t r_low = a_low * b_low;
-  digit_t r_mid1 = a_low * b_high;
-  digit_t r_mid2 = a_high * b_low;
-  digit_t r_high = a_high * b_high;
-
-  digit_t carry = 0;
-  digit_t low = digit_add(r_low, r_mid1 << kHalfDigitBits, &carry);
-  low = digit_add(low, r_mid2 << kHalfDigitBits, &carry);
-  *high =
-      (r_mid1 >> kHalfDigitBits) + (r_mid2 >> kHalfDigitBits) + r_high + carry;
-  return low;
-#endif
-}
-
-// Returns the quotient.
-// quotient = (high << kDigitBits + low - remainder) / divisor
-BigInt::digit_t MutableBigInt::digit_div(digit_t high, digit_t low,
-                                         digit_t divisor, digit_t* remainder) {
-  DCHECK(high < divisor);
-#if V8_TARGET_ARCH_X64 && (__GNUC__ || __clang__)
-  digit_t quotient;
-  digit_t rem;
-  __asm__("divq  %[divisor]"
-          // Outputs: {quotient} will be in rax, {rem} in rdx.
-          : "=a"(quotient), "=d"(rem)
-          // Inputs: put {high} into rdx, {low} into rax, and {divisor} into
-          // any register or stack slot.
-          : "d"(high), "a"(low), [divisor] "rm"(divisor));
-  *remainder = rem;
-  return quotient;
-#elif V8_TARGET_ARCH_IA32 && (__GNUC__ || __clang__)
-  digit_t quotient;
-  digit_t rem;
-  __asm__("divl  %[divisor]"
-          // Outputs: {quotient} will be in eax, {rem} in edx.
-          : "=a"(quotient), "=d"(rem)
-          // Inputs: put {high} into edx, {low} into eax, and {divisor} into
-          // any register or stack slot.
-          : "d"(high), "a"(low), [divisor] "rm"(divisor));
-  *remainder = rem;
-  return quotient;
-#else
-  static const digit_t kHalfDigitBase = 1ull << kHalfDigitBits;
-  // Adapted from Warren, Hacker's Delight, p. 152.
-  int s = base::bits::CountLeadingZeros(divisor);
-  DCHECK_NE(s, kDigitBits);  // {divisor} is not 0.
-  divisor <<= s;
-
-  digit_t vn1 = divisor >> kHalfDigitBits;
-  digit_t vn0 = divisor & kHalfDigitMask;
-  // {s} can be 0. {low >> kDigitBits} would be undefined behavior, so
-  // we mask the shift amount with {kShiftMask}, and the result with
-  // {s_zero_mask} which is 0 if s == 0 and all 1-bits otherwise.
-  STATIC_ASSERT(sizeof(intptr_t) == sizeof(digit_t));
-  const int kShiftMask = kDigitBits - 1;
-  digit_t s_zero_mask =
-      static_cast<digit_t>(static_cast<intptr_t>(-s) >> (kDigitBits - 1));
-  digit_t un32 =
-      (high << s) | ((low >> ((kDigitBits - s) & kShiftMask)) & s_zero_mask);
-  digit_t un10 = low << s;
-  digit_t un1 = un10 >> kHalfDigitBits;
-  digit_t un0 = un10 & kHalfDigitMask;
-  digit_t q1 = un32 / vn1;
-  digit_t rhat = un32 - q1 * vn1;
-
-  while (q1 >= kHalfDigitBase || q1 * vn0 > rhat * kHalfDigitBase + un1) {
-    q1--;
-    rhat += vn1;
-    if (rhat >= kHalfDigitBase) break;
-  }
-
-  digit_t un21 = un32 * kHalfDigitBase + un1 - q1 * divisor;
-  digit_t q0 = un21 / vn1;
-  rhat = un21 - q0 * vn1;
-
-  while (q0 >= kHalfDigitBase || q0 * vn0 > rhat * kHalfDigitBase + un0) {
-    q0--;
-    rhat += vn1;
-    if (rhat >= kHalfDigitBase) break;
-  }
-
-  *remainder = (un21 * kHalfDigitBase + un0 - q0 * divisor) >> s;
-  return q1 * kHalfDigitBase + q0;
-#endif
-}
-
-// Raises {base} to the power of {exponent}. Does not check for overflow.
-BigInt::digit_t MutableBigInt::digit_pow(digit_t base, digit_t exponent) {
-  digit_t result = 1ull;
-  while (exponent > 0) {
-    if (exponent & 1) {
-      result *= base;
-    }
-    exponent >>= 1;
-    base *= base;
-  }
-  return result;
-}
-
-#undef HAVE_TWODIGIT_T
-
 void MutableBigInt::set_64_bits(uint64_t bits) {
   STATIC_ASSERT(kDigitBits == 64 || kDigitBits == 32);
   if (kDigitBits == 64) {
@@ -257,6 +257,14 @@ class BigInt : public BigIntBase {
       AllocationType allocation);
   static void InplaceMultiplyAdd(FreshlyAllocatedBigInt x, uintptr_t factor,
                                  uintptr_t summand);
+  // Sets {x} to the result of InplaceMultiplyAdd with every pair of
+  // {multipliers} and {parts}, starting from zero, using a subquadratic
+  // algorithm. Returns false if interrupted.
+  template <typename LocalIsolate>
+  static bool InplaceMultiplyAddParts(LocalIsolate* isolate,
+                                      Handle<FreshlyAllocatedBigInt> x,
+                                      Vector<const uintptr_t> multipliers,
+                                      Vector<const uintptr_t> parts);
   template <typename LocalIsolate>
   static Handle<BigInt> Finalize(Handle<FreshlyAllocatedBigInt> x, bool sign);
 
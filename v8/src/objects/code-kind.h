@@ -13,7 +13,8 @@ namespace internal {
 
 // The order of INTERPRETED_FUNCTION to TURBOFAN is important. We use it to
 // check the relative ordering of the tiers when fetching / installing optimized
-// code.
+// code. BASELINE code is not installed on functions, it is entered from the
+// interpreter entry trampoline and runs in an interpreter frame.
 #define CODE_KIND_LIST(V)       \
   V(BYTECODE_HANDLER)           \
   V(FOR_TESTING)                \
@@ -26,6 +27,7 @@ namespace internal {
   V(JS_TO_JS_FUNCTION)          \
   V(C_WASM_ENTRY)               \
   V(INTERPRETED_FUNCTION)       \
+  V(BASELINE)                   \
   V(NATIVE_CONTEXT_INDEPENDENT) \
   V(TURBOPROP)                  \
   V(TURBOFAN)
@@ -51,6 +53,10 @@ inline constexpr bool CodeKindIsInterpretedJSFunction(CodeKind kind) {
   return kind == CodeKind::INTERPRETED_FUNCTION;
 }
 
+inline constexpr bool CodeKindIsBaselinedJSFunction(CodeKind kind) {
+  return kind == CodeKind::BASELINE;
+}
+
 inline constexpr bool CodeKindIsNativeContextIndependentJSFunction(
     CodeKind kind) {
   return kind == CodeKind::NATIVE_CONTEXT_INDEPENDENT;
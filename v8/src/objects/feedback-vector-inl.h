@@ -139,6 +139,17 @@ bool FeedbackVector::has_optimized_code() const {
   return !optimized_code().is_null();
 }
 
+bool FeedbackVector::has_baseline_code() const {
+  return baseline_code().IsCode();
+}
+
+void FeedbackVector::clear_padding() {
+  if (FIELD_SIZE(kOptionalPaddingOffset) == 0) return;
+  DCHECK_EQ(4, FIELD_SIZE(kOptionalPaddingOffset));
+  memset(reinterpret_cast<void*>(address() + kOptionalPaddingOffset), 0,
+         FIELD_SIZE(kOptionalPaddingOffset));
+}
+
 bool FeedbackVector::has_optimization_marker() const {
   return optimization_marker() != OptimizationMarker::kLogFirstExecution &&
          optimization_marker() != OptimizationMarker::kNone;
@@ -182,6 +182,7 @@ class NexusConfig;
 //  - invocation count
 //  - runtime profiler ticks
 //  - optimized code cell (weak cell or Smi marker)
+//  - baseline code (or undefined)
 // followed by an array of feedback slots, of length determined by the feedback
 // metadata.
 class FeedbackVector
@@ -214,6 +215,8 @@ class FeedbackVector
 
   inline Code optimized_code() const;
   inline bool has_optimized_code() const;
+  inline bool has_baseline_code() const;
+  inline void clear_padding();
   inline bool has_optimization_marker() const;
   inline OptimizationMarker optimization_marker() const;
   inline OptimizationTier optimization_tier() const;
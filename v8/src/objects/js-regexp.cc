@@ -226,7 +226,7 @@ Handle<JSRegExp> JSRegExp::Copy(Handle<JSRegExp> regexp) {
 }
 
 Object JSRegExp::Code(bool is_latin1) const {
-  DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
+  DCHECK(TypeSupportsCaptures(TypeTag()));
   return DataAt(code_index(is_latin1));
 }
 
@@ -240,9 +240,15 @@ bool JSRegExp::ShouldProduceBytecode() {
          (FLAG_regexp_tier_up && !MarkedForTierUp());
 }
 
-// Only irregexps are subject to tier-up.
+// Irregexps are subject to tier-up, and so are experimental regexps that can
+// be compiled to native code.  For the latter, the tier-up ticks are only
+// initialized if that is the case.
 bool JSRegExp::CanTierUp() {
-  return FLAG_regexp_tier_up && TypeTag() == JSRegExp::IRREGEXP;
+  if (!FLAG_regexp_tier_up) return false;
+  if (TypeTag() == JSRegExp::IRREGEXP) return true;
+  return TypeTag() == JSRegExp::EXPERIMENTAL &&
+         DataAt(kIrregexpTicksUntilTierUpIndex) !=
+             Smi::FromInt(JSRegExp::kUninitializedValue);
 }
 
 // An irregexp is considered to be marked for tier up if the tier-up ticks
@@ -266,8 +272,7 @@ void JSRegExp::ResetLastTierUpTick() {
 }
 
 void JSRegExp::TierUpTick() {
-  DCHECK(FLAG_regexp_tier_up);
-  DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
+  DCHECK(CanTierUp());
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
   if (tier_up_ticks == 0) {
     return;
@@ -277,8 +282,7 @@ void JSRegExp::TierUpTick() {
 }
 
 void JSRegExp::MarkTierUpForNextExec() {
-  DCHECK(FLAG_regexp_tier_up);
-  DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
+  DCHECK(CanTierUp());
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
                                Smi::zero());
 }
@@ -81,5 +81,22 @@ void LiteralBuffer::AddTwoByteChar(uc32 code_unit) {
   }
 }
 
+void LiteralBuffer::AddChars(Vector<const uint16_t> code_units,
+                             bool is_one_byte) {
+  if (code_units.empty()) return;
+  if (this->is_one_byte() && !is_one_byte) ConvertToTwoByte();
+  int size = code_units.length() * (this->is_one_byte() ? kOneByteSize
+                                                         : kUC16Size);
+  while (position_ + size > backing_store_.length()) ExpandBuffer();
+  if (this->is_one_byte()) {
+    CopyChars(&backing_store_[position_], code_units.begin(),
+              code_units.length());
+  } else {
+    CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]),
+              code_units.begin(), code_units.length());
+  }
+  position_ += size;
+}
+
 }  // namespace internal
 }  // namespace v8
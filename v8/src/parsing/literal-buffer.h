@@ -34,6 +34,10 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of UTF-16 code units at once. {is_one_byte} says whether all
+  // of them are Latin-1 characters.
+  void AddChars(Vector<const uint16_t> code_units, bool is_one_byte);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(Vector<const char> keyword) const {
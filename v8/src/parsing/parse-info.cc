@@ -223,6 +223,22 @@ std::unique_ptr<ParseInfo> ParseInfo::ForToplevelFunction(
   return result;
 }
 
+// static
+std::unique_ptr<ParseInfo> ParseInfo::ForEagerInnerFunctions(
+    const ParseInfo* outer_parse_info, UnoptimizedCompileState* compile_state,
+    uintptr_t stack_limit) {
+  std::unique_ptr<ParseInfo> result(
+      new ParseInfo(outer_parse_info->flags(), compile_state));
+
+  // The bytecode generator only looks up the source ranges recorded by the
+  // parser, so share them with the outer parse info.
+  result->set_source_range_map(outer_parse_info->source_range_map());
+  result->set_language_mode(outer_parse_info->language_mode());
+  result->SetPerThreadState(stack_limit, nullptr);
+
+  return result;
+}
+
 ParseInfo::~ParseInfo() = default;
 
 DeclarationScope* ParseInfo::scope() const { return literal()->scope(); }
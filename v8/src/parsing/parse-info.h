@@ -213,6 +213,13 @@ class V8_EXPORT_PRIVATE ParseInfo {
       UnoptimizedCompileState* compile_state, const FunctionLiteral* literal,
       const AstRawString* function_name);
 
+  // Creates a new parse info for executing the compilation jobs of the eager
+  // inner functions of |outer_parse_info|'s AST on another thread, with
+  // |stack_limit| as the stack limit of that thread.
+  static std::unique_ptr<ParseInfo> ForEagerInnerFunctions(
+      const ParseInfo* outer_parse_info,
+      UnoptimizedCompileState* compile_state, uintptr_t stack_limit);
+
   ~ParseInfo();
 
   template <typename LocalIsolate>
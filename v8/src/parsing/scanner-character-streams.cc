@@ -14,6 +14,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/unicode-inl.h"
+#include "src/strings/utf8-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -602,15 +603,21 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
       *(output_cursor++) = unibrow::Utf16::LeadSurrogate(t);
       *(output_cursor++) = unibrow::Utf16::TrailSurrogate(t);
     }
-    // Fast path for ascii sequences.
+    // Fast path for well-formed sequences, which leaves the DFA with the
+    // ill-formed ones and those split across chunks. No sequence decodes to
+    // more UTF-16 code units than it has bytes, so the output fits into the
+    // buffer if the input does.
     size_t remaining = end - cursor;
     size_t max_buffer = max_buffer_end - output_cursor;
-    int max_length = static_cast<int>(Min(remaining, max_buffer));
+    size_t max_length = Min(remaining, max_buffer);
     DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
-    int ascii_length = NonAsciiStart(cursor, max_length);
-    CopyChars(output_cursor, cursor, ascii_length);
-    cursor += ascii_length;
-    output_cursor += ascii_length;
+    size_t valid_length = Utf8Simd::ValidPrefixLength(cursor, max_length);
+    if (valid_length == 0) {
+      // Without a valid prefix, e.g. with --no-utf8-simd, still copy ASCII.
+      valid_length = Utf8Simd::AsciiPrefixLength(cursor, max_length);
+    }
+    output_cursor = Utf8Simd::Decode(cursor, valid_length, output_cursor);
+    cursor += valid_length;
   }
 
   current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
@@ -5,7 +5,9 @@
 #ifndef V8_PARSING_SCANNER_INL_H_
 #define V8_PARSING_SCANNER_INL_H_
 
+#include "src/flags/flags.h"
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -256,6 +258,10 @@ inline bool CharCanBeKeyword(uc32 c) {
          CanBeKeyword(character_scan_flags[c]);
 }
 
+inline bool IsAsciiWhiteSpaceOrLineTerminator(uc32 c) {
+  return c == ' ' || base::IsInRange(c, '\t', '\r');
+}
+
 V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
   DCHECK(IsIdentifierStart(c0_));
   bool escaped = false;
@@ -273,25 +279,58 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
+      if (FLAG_scanner_simd) {
+        // Add the ASCII identifier parts a block at a time.
+        AdvanceBlockwise([this](const uint16_t* start, const uint16_t* end) {
+          const uint16_t* run_end =
+              ScannerSimd::SkipAsciiIdentifierParts(start, end);
+          next().literal_chars.AddChars(
+              Vector<const uint16_t>(start, run_end - start), true);
+          return run_end;
+        });
+
+        if (V8_UNLIKELY(static_cast<uint32_t>(c0_) > kMaxAscii)) {
+          // A non-ascii character, as opposed to the end of input, means we
+          // need to drop through to the slow path.
+          if (c0_ != kEndOfInput) {
+            scan_flags |=
+                static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+          }
+        } else {
+          DCHECK(TerminatesLiteral(character_scan_flags[c0_]));
+          scan_flags |= character_scan_flags[c0_];
         }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
+
+        // Only identifiers as short as the keywords can be keywords.
+        Vector<const uint8_t> chars = next().literal_chars.one_byte_literal();
+        if (chars.length() > MAX_WORD_LENGTH) {
+          scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
         } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
+          for (int i = 1; i < chars.length(); i++) {
+            scan_flags |= character_scan_flags[chars[i]];
+          }
         }
-      });
+      } else {
+        AdvanceUntil([this, &scan_flags](uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            // A non-ascii character means we need to drop through to the slow
+            // path.
+            // TODO(leszeks): This would be most efficient as a goto to the
+            // slow path, check codegen and maybe use a bool instead.
+            scan_flags |=
+                static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+            return true;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          scan_flags |= char_flags;
+          if (TerminatesLiteral(char_flags)) {
+            return true;
+          } else {
+            AddLiteralChar(static_cast<char>(c0));
+            return false;
+          }
+        });
+      }
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::IDENTIFIER;
@@ -328,7 +367,18 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
-    Advance();
+    if (V8_LIKELY(!FLAG_scanner_simd ||
+                  !IsAsciiWhiteSpaceOrLineTerminator(Peek()))) {
+      Advance();
+      continue;
+    }
+    // Skip runs of ASCII whitespace, e.g. indentation, a block at a time.
+    bool line_terminator = false;
+    AdvanceBlockwise(
+        [&line_terminator](const uint16_t* start, const uint16_t* end) {
+          return ScannerSimd::SkipAsciiWhiteSpace(start, end, &line_terminator);
+        });
+    if (line_terminator) next().after_line_terminator = true;
   }
 
   // Return whether or not we skipped any characters.
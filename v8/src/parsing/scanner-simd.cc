@@ -0,0 +1,302 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/scanner-simd.h"
+
+#include "src/base/bits.h"
+#include "src/base/bounds.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/utils/simd-dispatch.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+inline bool IsAsciiWhiteSpace(uint16_t c) {
+  return c == ' ' || base::IsInRange(c, '\t', '\r');
+}
+
+inline bool IsLineTerminator(uint16_t c) {
+  return IsLineFeed(c) || IsCarriageReturn(c);
+}
+
+inline bool IsStringTerminator(uint16_t c) {
+  return c == '"' || c == '\'' || c == '\\' || IsLineTerminator(c);
+}
+
+const uint16_t* SkipAsciiIdentifierPartsScalar(const uint16_t* start,
+                                               const uint16_t* end) {
+  const uint16_t* p = start;
+  while (p < end && IsAsciiIdentifier(*p)) p++;
+  return p;
+}
+
+const uint16_t* SkipAsciiWhiteSpaceScalar(const uint16_t* start,
+                                          const uint16_t* end,
+                                          bool* line_terminator) {
+  const uint16_t* p = start;
+  while (p < end && IsAsciiWhiteSpace(*p)) {
+    if (IsLineTerminator(*p)) *line_terminator = true;
+    p++;
+  }
+  return p;
+}
+
+const uint16_t* FindStringTerminatorScalar(const uint16_t* start,
+                                           const uint16_t* end,
+                                           uint16_t* bits) {
+  const uint16_t* p = start;
+  uint16_t or_bits = 0;
+  while (p < end && !IsStringTerminator(*p)) or_bits |= *p++;
+  *bits |= or_bits;
+  return p;
+}
+
+#if V8_HOST_ARCH_X64
+
+// The movemask instructions yield two bits per 16-bit lane.
+inline size_t LaneIndex(uint32_t mask) {
+  return base::bits::CountTrailingZeros(mask) / sizeof(uint16_t);
+}
+
+// Returns the bits of {mask} below its lowest set bit.
+inline uint32_t BitsBelowLowest(uint32_t mask) {
+  return (mask & (~mask + 1)) - 1;
+}
+
+constexpr size_t kLanes128 = sizeof(__m128i) / sizeof(uint16_t);
+
+inline __m128i Load128(const uint16_t* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+// The comparisons are signed, so code units from 0x8000 up never match any
+// of the ranges below.
+inline __m128i InRange128(__m128i c, uint16_t lower, uint16_t upper) {
+  return _mm_and_si128(_mm_cmpgt_epi16(c, _mm_set1_epi16(lower - 1)),
+                       _mm_cmplt_epi16(c, _mm_set1_epi16(upper + 1)));
+}
+
+inline __m128i Equals128(__m128i c, uint16_t value) {
+  return _mm_cmpeq_epi16(c, _mm_set1_epi16(value));
+}
+
+inline __m128i IsAsciiIdentifierPart128(__m128i c) {
+  __m128i lower = _mm_or_si128(c, _mm_set1_epi16(0x20));
+  __m128i letter_or_digit =
+      _mm_or_si128(InRange128(lower, 'a', 'z'), InRange128(c, '0', '9'));
+  return _mm_or_si128(letter_or_digit,
+                      _mm_or_si128(Equals128(c, '_'), Equals128(c, '$')));
+}
+
+inline __m128i IsAsciiWhiteSpace128(__m128i c) {
+  return _mm_or_si128(Equals128(c, ' '), InRange128(c, '\t', '\r'));
+}
+
+inline __m128i IsLineTerminator128(__m128i c) {
+  return _mm_or_si128(Equals128(c, '\n'), Equals128(c, '\r'));
+}
+
+inline __m128i IsStringTerminator128(__m128i c) {
+  __m128i quote = _mm_or_si128(Equals128(c, '"'), Equals128(c, '\''));
+  return _mm_or_si128(_mm_or_si128(quote, Equals128(c, '\\')),
+                      IsLineTerminator128(c));
+}
+
+inline uint32_t MoveMask128(__m128i v) {
+  return static_cast<uint32_t>(_mm_movemask_epi8(v));
+}
+
+inline uint16_t OrLanes128(__m128i v) {
+  v = _mm_or_si128(v, _mm_srli_si128(v, 8));
+  v = _mm_or_si128(v, _mm_srli_si128(v, 4));
+  v = _mm_or_si128(v, _mm_srli_si128(v, 2));
+  return static_cast<uint16_t>(_mm_cvtsi128_si32(v));
+}
+
+const uint16_t* SkipAsciiIdentifierPartsSSE2(const uint16_t* start,
+                                             const uint16_t* end) {
+  const uint16_t* p = start;
+  for (; static_cast<size_t>(end - p) >= kLanes128; p += kLanes128) {
+    uint32_t mask = MoveMask128(IsAsciiIdentifierPart128(Load128(p))) ^ 0xFFFF;
+    if (mask != 0) return p + LaneIndex(mask);
+  }
+  return SkipAsciiIdentifierPartsScalar(p, end);
+}
+
+const uint16_t* SkipAsciiWhiteSpaceSSE2(const uint16_t* start,
+                                        const uint16_t* end,
+                                        bool* line_terminator) {
+  const uint16_t* p = start;
+  for (; static_cast<size_t>(end - p) >= kLanes128; p += kLanes128) {
+    __m128i c = Load128(p);
+    uint32_t mask = MoveMask128(IsAsciiWhiteSpace128(c)) ^ 0xFFFF;
+    uint32_t line_terminators = MoveMask128(IsLineTerminator128(c));
+    if (mask != 0) {
+      if (line_terminators & BitsBelowLowest(mask)) *line_terminator = true;
+      return p + LaneIndex(mask);
+    }
+    if (line_terminators != 0) *line_terminator = true;
+  }
+  return SkipAsciiWhiteSpaceScalar(p, end, line_terminator);
+}
+
+const uint16_t* FindStringTerminatorSSE2(const uint16_t* start,
+                                         const uint16_t* end,
+                                         uint16_t* bits) {
+  const uint16_t* p = start;
+  __m128i or_bits = _mm_setzero_si128();
+  for (; static_cast<size_t>(end - p) >= kLanes128; p += kLanes128) {
+    __m128i c = Load128(p);
+    if (MoveMask128(IsStringTerminator128(c)) != 0) break;
+    or_bits = _mm_or_si128(or_bits, c);
+  }
+  *bits |= OrLanes128(or_bits);
+  // The terminator, if any, is in the next block.
+  return FindStringTerminatorScalar(p, end, bits);
+}
+
+#endif  // V8_HOST_ARCH_X64
+
+#if V8_SIMD_DISPATCH
+
+constexpr size_t kLanes256 = sizeof(__m256i) / sizeof(uint16_t);
+
+V8_TARGET_AVX2 inline __m256i Load256(const uint16_t* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+V8_TARGET_AVX2 inline __m256i InRange256(__m256i c, uint16_t lower,
+                                         uint16_t upper) {
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi16(c, _mm256_set1_epi16(lower - 1)),
+      _mm256_cmpgt_epi16(_mm256_set1_epi16(upper + 1), c));
+}
+
+V8_TARGET_AVX2 inline __m256i Equals256(__m256i c, uint16_t value) {
+  return _mm256_cmpeq_epi16(c, _mm256_set1_epi16(value));
+}
+
+V8_TARGET_AVX2 inline __m256i IsAsciiIdentifierPart256(__m256i c) {
+  __m256i lower = _mm256_or_si256(c, _mm256_set1_epi16(0x20));
+  __m256i letter_or_digit =
+      _mm256_or_si256(InRange256(lower, 'a', 'z'), InRange256(c, '0', '9'));
+  return _mm256_or_si256(
+      letter_or_digit, _mm256_or_si256(Equals256(c, '_'), Equals256(c, '$')));
+}
+
+V8_TARGET_AVX2 inline __m256i IsAsciiWhiteSpace256(__m256i c) {
+  return _mm256_or_si256(Equals256(c, ' '), InRange256(c, '\t', '\r'));
+}
+
+V8_TARGET_AVX2 inline __m256i IsLineTerminator256(__m256i c) {
+  return _mm256_or_si256(Equals256(c, '\n'), Equals256(c, '\r'));
+}
+
+V8_TARGET_AVX2 inline __m256i IsStringTerminator256(__m256i c) {
+  __m256i quote = _mm256_or_si256(Equals256(c, '"'), Equals256(c, '\''));
+  return _mm256_or_si256(_mm256_or_si256(quote, Equals256(c, '\\')),
+                         IsLineTerminator256(c));
+}
+
+V8_TARGET_AVX2 inline uint32_t MoveMask256(__m256i v) {
+  return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+}
+
+V8_TARGET_AVX2 const uint16_t* SkipAsciiIdentifierPartsAVX2(
+    const uint16_t* start, const uint16_t* end) {
+  const uint16_t* p = start;
+  for (; static_cast<size_t>(end - p) >= kLanes256; p += kLanes256) {
+    uint32_t mask = ~MoveMask256(IsAsciiIdentifierPart256(Load256(p)));
+    if (mask != 0) return p + LaneIndex(mask);
+  }
+  return SkipAsciiIdentifierPartsSSE2(p, end);
+}
+
+V8_TARGET_AVX2 const uint16_t* SkipAsciiWhiteSpaceAVX2(const uint16_t* start,
+                                                       const uint16_t* end,
+                                                       bool* line_terminator) {
+  const uint16_t* p = start;
+  for (; static_cast<size_t>(end - p) >= kLanes256; p += kLanes256) {
+    __m256i c = Load256(p);
+    uint32_t mask = ~MoveMask256(IsAsciiWhiteSpace256(c));
+    uint32_t line_terminators = MoveMask256(IsLineTerminator256(c));
+    if (mask != 0) {
+      if (line_terminators & BitsBelowLowest(mask)) *line_terminator = true;
+      return p + LaneIndex(mask);
+    }
+    if (line_terminators != 0) *line_terminator = true;
+  }
+  return SkipAsciiWhiteSpaceSSE2(p, end, line_terminator);
+}
+
+V8_TARGET_AVX2 const uint16_t* FindStringTerminatorAVX2(const uint16_t* start,
+                                                        const uint16_t* end,
+                                                        uint16_t* bits) {
+  const uint16_t* p = start;
+  __m256i or_bits = _mm256_setzero_si256();
+  for (; static_cast<size_t>(end - p) >= kLanes256; p += kLanes256) {
+    __m256i c = Load256(p);
+    if (MoveMask256(IsStringTerminator256(c)) != 0) break;
+    or_bits = _mm256_or_si256(or_bits, c);
+  }
+  *bits |= OrLanes128(_mm_or_si128(_mm256_castsi256_si128(or_bits),
+                                   _mm256_extracti128_si256(or_bits, 1)));
+  return FindStringTerminatorSSE2(p, end, bits);
+}
+
+#endif  // V8_SIMD_DISPATCH
+
+}  // namespace
+
+// static
+const uint16_t* ScannerSimd::SkipAsciiIdentifierParts(const uint16_t* start,
+                                                      const uint16_t* end) {
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) {
+    return SkipAsciiIdentifierPartsAVX2(start, end);
+  }
+#endif
+#if V8_HOST_ARCH_X64
+  return SkipAsciiIdentifierPartsSSE2(start, end);
+#else
+  return SkipAsciiIdentifierPartsScalar(start, end);
+#endif
+}
+
+// static
+const uint16_t* ScannerSimd::SkipAsciiWhiteSpace(const uint16_t* start,
+                                                 const uint16_t* end,
+                                                 bool* line_terminator) {
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) {
+    return SkipAsciiWhiteSpaceAVX2(start, end, line_terminator);
+  }
+#endif
+#if V8_HOST_ARCH_X64
+  return SkipAsciiWhiteSpaceSSE2(start, end, line_terminator);
+#else
+  return SkipAsciiWhiteSpaceScalar(start, end, line_terminator);
+#endif
+}
+
+// static
+const uint16_t* ScannerSimd::FindStringTerminator(const uint16_t* start,
+                                                  const uint16_t* end,
+                                                  uint16_t* bits) {
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) {
+    return FindStringTerminatorAVX2(start, end, bits);
+  }
+#endif
+#if V8_HOST_ARCH_X64
+  return FindStringTerminatorSSE2(start, end, bits);
+#else
+  return FindStringTerminatorScalar(start, end, bits);
+#endif
+}
+
+}  // namespace internal
+}  // namespace v8
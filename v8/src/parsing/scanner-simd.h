@@ -0,0 +1,47 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized searches over the buffered UTF-16 chunk of a
+// Utf16CharacterStream, used by the Scanner to consume runs of identifier
+// characters, whitespace and string literal characters at once. On x64 these
+// look at 8 (SSE2) or 16 (AVX2) code units at a time, as selected by
+// SimdDispatch; elsewhere they are scalar loops. Only used with
+// --scanner-simd.
+//
+// Only ASCII identifier characters and whitespace are handled here; the
+// Scanner takes care of the rest.
+class V8_EXPORT_PRIVATE ScannerSimd : public AllStatic {
+ public:
+  // Returns the first code unit in [start, end) that is not an ASCII
+  // identifier part, i.e. not a letter, a digit, '_' or '$', or {end}.
+  static const uint16_t* SkipAsciiIdentifierParts(const uint16_t* start,
+                                                  const uint16_t* end);
+
+  // Returns the first code unit in [start, end) that is not ASCII whitespace
+  // or a line terminator, or {end}. Sets {*line_terminator} if any of the
+  // skipped code units is '\n' or '\r'.
+  static const uint16_t* SkipAsciiWhiteSpace(const uint16_t* start,
+                                             const uint16_t* end,
+                                             bool* line_terminator);
+
+  // Returns the first code unit in [start, end) that may end the body of a
+  // string literal, i.e. a quote, a backslash, '\n' or '\r', or {end}. The
+  // code units before it are OR-ed into {*bits}.
+  static const uint16_t* FindStringTerminator(const uint16_t* start,
+                                              const uint16_t* end,
+                                              uint16_t* bits);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
@@ -459,19 +459,31 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
+    if (FLAG_scanner_simd) {
+      AdvanceBlockwise([this](const uint16_t* start, const uint16_t* end) {
+        uint16_t bits = 0;
+        const uint16_t* run_end =
+            ScannerSimd::FindStringTerminator(start, end, &bits);
+        next().literal_chars.AddChars(
+            Vector<const uint16_t>(start, run_end - start),
+            bits <= unibrow::Latin1::kMaxChar);
+        return run_end;
+      });
+    } else {
+      AdvanceUntil([this](uc32 c0) {
+        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+          if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+            return true;
+          }
+          AddLiteralChar(c0);
+          return false;
         }
+        uint8_t char_flags = character_scan_flags[c0];
+        if (MayTerminateString(char_flags)) return true;
         AddLiteralChar(c0);
         return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+      });
+    }
 
     while (c0_ == '\\') {
       Advance();
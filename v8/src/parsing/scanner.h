@@ -93,6 +93,29 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but {scan} looks at a whole block of buffered code
+  // units at once: it is called with the range of code units after the
+  // cursor, and returns the first one that ends the run, or the end of the
+  // range to continue with the next block.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceBlockwise(FunctionType scan) {
+    while (true) {
+      const uint16_t* run_end = scan(buffer_cursor_, buffer_end_);
+      DCHECK(buffer_cursor_ <= run_end && run_end <= buffer_end_);
+
+      if (run_end == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked()) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = run_end + 1;
+        return static_cast<uc32>(*run_end);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -529,6 +552,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType>
+  V8_INLINE void AdvanceBlockwise(FunctionType scan) {
+    c0_ = source_->AdvanceBlockwise(scan);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
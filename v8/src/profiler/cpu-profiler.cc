@@ -393,6 +393,7 @@ CpuProfile* CpuProfiler::GetProfile(int index) {
 
 void CpuProfiler::DeleteAllProfiles() {
   if (is_profiling_) StopProcessor();
+  profiles_->StopContinuousProfiling();
   ResetProfiles();
 }
 
@@ -594,6 +595,25 @@ CpuProfile* CpuProfiler::StopProfiling(String title) {
   return StopProfiling(profiles_->GetName(title));
 }
 
+bool CpuProfiler::StartContinuousProfiling(
+    CpuProfileWindowSink* sink, ContinuousCpuProfilingOptions options) {
+  if (!profiles_->StartContinuousProfiling(code_observer_.code_map(), sink,
+                                           options)) {
+    return false;
+  }
+  TRACE_EVENT0("v8", "CpuProfiler::StartContinuousProfiling");
+  AdjustSamplingInterval();
+  StartProcessorIfNotStarted();
+  return true;
+}
+
+void CpuProfiler::StopContinuousProfiling() {
+  if (!profiles_->has_continuous_profile()) return;
+  if (profiles_->IsOnlyContinuousProfile()) StopProcessor();
+  profiles_->StopContinuousProfiling();
+  AdjustSamplingInterval();
+}
+
 void CpuProfiler::StopProcessorIfLastProfile(const char* title) {
   if (!profiles_->IsLastProfile(title)) return;
   StopProcessor();
@@ -321,6 +321,9 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String title);
+  bool StartContinuousProfiling(CpuProfileWindowSink* sink,
+                                ContinuousCpuProfilingOptions options);
+  void StopContinuousProfiling();
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
   void DeleteAllProfiles();
@@ -336,6 +339,7 @@ class V8_EXPORT_PRIVATE CpuProfiler {
     return profiler_listener_.get();
   }
   CodeMap* code_map_for_test() { return code_observer_.code_map(); }
+  CpuProfilesCollection* profiles_for_test() const { return profiles_.get(); }
 
  private:
   void StartProcessorIfNotStarted();
@@ -128,6 +128,14 @@ v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
   }
 }
 
+v8::AllocationProfileDelta* HeapProfiler::GetAllocationProfileDelta() {
+  if (sampling_heap_profiler_.get()) {
+    return sampling_heap_profiler_->GetAllocationProfileDelta();
+  } else {
+    return nullptr;
+  }
+}
+
 
 void HeapProfiler::StartHeapObjectsTracking(bool track_allocations) {
   ids_->UpdateHeapObjectsMap();
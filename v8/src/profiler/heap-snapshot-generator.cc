@@ -4,16 +4,22 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
 #include "src/handles/global-handles.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -1287,6 +1293,11 @@ void V8HeapExplorer::ExtractFeedbackVectorReferences(
     SetWeakReference(entry, "optimized code", code_heap_object,
                      FeedbackVector::kMaybeOptimizedCodeOffset);
   }
+  if (feedback_vector.has_baseline_code()) {
+    SetInternalReference(entry, "baseline_code",
+                         feedback_vector.baseline_code(),
+                         FeedbackVector::kBaselineCodeOffset);
+  }
 }
 
 void V8HeapExplorer::ExtractDescriptorArrayReferences(HeapEntry* entry,
@@ -2191,16 +2202,20 @@ class OutputStreamWriter {
     AddSubstring(s, static_cast<int>(len));
   }
   void AddSubstring(const char* s, int n) {
-    if (n <= 0) return;
     DCHECK_LE(n, strlen(s));
-    const char* s_end = s + n;
-    while (s < s_end) {
-      int s_chunk_size =
-          Min(chunk_size_ - chunk_pos_, static_cast<int>(s_end - s));
-      DCHECK_GT(s_chunk_size, 0);
-      MemCopy(chunk_.begin() + chunk_pos_, s, s_chunk_size);
-      s += s_chunk_size;
-      chunk_pos_ += s_chunk_size;
+    AddBytes(reinterpret_cast<const uint8_t*>(s), n);
+  }
+  // Unlike the other methods, also accepts '\0' and non-ASCII bytes.
+  void AddBytes(const uint8_t* bytes, int n) {
+    if (n <= 0) return;
+    const uint8_t* bytes_end = bytes + n;
+    while (bytes < bytes_end) {
+      int bytes_chunk_size =
+          Min(chunk_size_ - chunk_pos_, static_cast<int>(bytes_end - bytes));
+      DCHECK_GT(bytes_chunk_size, 0);
+      MemCopy(chunk_.begin() + chunk_pos_, bytes, bytes_chunk_size);
+      bytes += bytes_chunk_size;
+      chunk_pos_ += bytes_chunk_size;
       MaybeWriteChunk();
     }
   }
@@ -2758,5 +2773,297 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+
+const uint32_t HeapSnapshotBinarySerializer::kVersion = 1;
+const size_t HeapSnapshotBinarySerializer::kChunkSize = 16 * KB;
+
+namespace {
+
+constexpr char kBinarySnapshotMagic[] = {'V', '8', 'H', 'S'};
+
+// Appends |value| as an unsigned LEB128 varint.
+void WriteVarint(uint64_t value, std::vector<uint8_t>* buffer) {
+  while (value >= 0x80) {
+    buffer->push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  buffer->push_back(static_cast<uint8_t>(value));
+}
+
+// 0-based position is converted to 1-based, as in the JSON format.
+uint32_t EncodePosition(int position) {
+  if (position == -1) return 0;
+  DCHECK_GE(position, 0);
+  return static_cast<uint32_t>(position + 1);
+}
+
+}  // namespace
+
+// Encodes chunks on worker threads while the main thread writes them out in
+// order. The main thread encodes chunks itself while the next chunk to be
+// written is not ready, so progress does not depend on worker threads being
+// available. At most kMaxChunksInFlight chunks are buffered at a time.
+class HeapSnapshotBinarySerializer::EncodingJob final : public JobTask {
+ public:
+  explicit EncodingJob(const HeapSnapshotBinarySerializer* serializer)
+      : serializer_(serializer),
+        buffers_(serializer->chunk_count()),
+        ready_(serializer->chunk_count(), false) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield() && TryEncodeNextChunk()) {
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next = next_chunk_.load(std::memory_order_relaxed);
+    const size_t limit = Limit();
+    return worker_count + (next < limit ? limit - next : 0);
+  }
+
+  // Called on the main thread.
+  Buffer TakeChunk(size_t chunk) {
+    while (true) {
+      {
+        base::MutexGuard guard(&mutex_);
+        if (ready_[chunk]) break;
+      }
+      if (!TryEncodeNextChunk()) break;
+    }
+    base::MutexGuard guard(&mutex_);
+    while (!ready_[chunk]) chunk_ready_.Wait(&mutex_);
+    return std::move(buffers_[chunk]);
+  }
+
+  // Called on the main thread once |chunk| was written to the stream.
+  void ReleaseChunk(size_t chunk) {
+    DCHECK_EQ(written_chunks_.load(std::memory_order_relaxed), chunk);
+    written_chunks_.store(chunk + 1, std::memory_order_relaxed);
+  }
+
+ private:
+  static const size_t kMaxChunksInFlight = 32;
+
+  size_t Limit() const {
+    return std::min(
+        buffers_.size(),
+        written_chunks_.load(std::memory_order_relaxed) + kMaxChunksInFlight);
+  }
+
+  bool TryEncodeNextChunk() {
+    size_t chunk = next_chunk_.load(std::memory_order_relaxed);
+    do {
+      if (chunk >= Limit()) return false;
+    } while (!next_chunk_.compare_exchange_weak(chunk, chunk + 1,
+                                                std::memory_order_relaxed));
+    Buffer buffer;
+    serializer_->EncodeChunk(chunk, &buffer);
+    base::MutexGuard guard(&mutex_);
+    buffers_[chunk] = std::move(buffer);
+    ready_[chunk] = true;
+    chunk_ready_.NotifyAll();
+    return true;
+  }
+
+  const HeapSnapshotBinarySerializer* const serializer_;
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<size_t> written_chunks_{0};
+  base::Mutex mutex_;
+  base::ConditionVariable chunk_ready_;
+  // Guarded by |mutex_|.
+  std::vector<Buffer> buffers_;
+  std::vector<bool> ready_;
+};
+
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  if (AllocationTracker* allocation_tracker =
+          snapshot_->profiler()->allocation_tracker()) {
+    allocation_tracker->PrepareForSerialization();
+  }
+  DCHECK_EQ(0, snapshot_->root()->index());
+  node_chunks_ = (snapshot_->entries().size() + kChunkSize - 1) / kChunkSize;
+  edge_chunks_ = (snapshot_->children().size() + kChunkSize - 1) / kChunkSize;
+  CollectStrings();
+
+  DCHECK_NULL(writer_);
+  OutputStreamWriter writer(stream);
+  writer_ = &writer;
+  SerializeHeader();
+  SerializeChunks();
+  SerializeTraceFunctionInfos();
+  SerializeTraceTree();
+  SerializeSamples();
+  SerializeLocations();
+  SerializeStrings();
+  Flush();
+  writer.Finalize();
+  writer_ = nullptr;
+}
+
+uint32_t HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  auto result =
+      string_ids_.emplace(s, static_cast<uint32_t>(strings_.size() + 1));
+  if (result.second) strings_.push_back(s);
+  return result.first->second;
+}
+
+void HeapSnapshotBinarySerializer::CollectStrings() {
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    GetStringId(entry.name());
+  }
+  for (const HeapGraphEdge* edge : snapshot_->children()) {
+    if (edge->type() != HeapGraphEdge::kElement &&
+        edge->type() != HeapGraphEdge::kHidden) {
+      GetStringId(edge->name());
+    }
+  }
+}
+
+void HeapSnapshotBinarySerializer::EncodeChunk(size_t chunk,
+                                               Buffer* buffer) const {
+  if (chunk < node_chunks_) {
+    const std::deque<HeapEntry>& entries = snapshot_->entries();
+    const size_t end = std::min(entries.size(), (chunk + 1) * kChunkSize);
+    for (size_t i = chunk * kChunkSize; i < end; ++i) {
+      const HeapEntry& entry = entries[i];
+      WriteVarint(entry.type(), buffer);
+      WriteVarint(string_ids_.at(entry.name()), buffer);
+      WriteVarint(entry.id(), buffer);
+      WriteVarint(entry.self_size(), buffer);
+      WriteVarint(entry.children_count(), buffer);
+      WriteVarint(entry.trace_node_id(), buffer);
+      WriteVarint(entry.detachedness(), buffer);
+    }
+    return;
+  }
+  const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  chunk -= node_chunks_;
+  const size_t end = std::min(edges.size(), (chunk + 1) * kChunkSize);
+  for (size_t i = chunk * kChunkSize; i < end; ++i) {
+    const HeapGraphEdge* edge = edges[i];
+    WriteVarint(edge->type(), buffer);
+    if (edge->type() == HeapGraphEdge::kElement ||
+        edge->type() == HeapGraphEdge::kHidden) {
+      WriteVarint(static_cast<uint32_t>(edge->index()), buffer);
+    } else {
+      WriteVarint(string_ids_.at(edge->name()), buffer);
+    }
+    WriteVarint(edge->to()->index(), buffer);
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeChunks() {
+  Flush();
+  if (!FLAG_heap_snapshot_parallel_serialization || chunk_count() <= 1) {
+    for (size_t chunk = 0; chunk < chunk_count(); ++chunk) {
+      if (writer_->aborted()) return;
+      EncodeChunk(chunk, &buffer_);
+      Flush();
+    }
+    return;
+  }
+
+  auto job = std::make_unique<EncodingJob>(this);
+  EncodingJob* encoding_job = job.get();
+  std::unique_ptr<JobHandle> handle = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::move(job));
+  for (size_t chunk = 0; chunk < chunk_count(); ++chunk) {
+    if (writer_->aborted()) break;
+    buffer_ = encoding_job->TakeChunk(chunk);
+    Flush();
+    encoding_job->ReleaseChunk(chunk);
+    handle->NotifyConcurrencyIncrease();
+  }
+  handle->Cancel();
+}
+
+void HeapSnapshotBinarySerializer::SerializeHeader() {
+  for (char c : kBinarySnapshotMagic) buffer_.push_back(c);
+  WriteVarint(kVersion, &buffer_);
+  WriteVarint(snapshot_->entries().size(), &buffer_);
+  WriteVarint(snapshot_->children().size(), &buffer_);
+  AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
+  WriteVarint(tracker ? tracker->function_info_list().size() : 0, &buffer_);
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceFunctionInfos() {
+  AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
+  if (!tracker) return;
+  for (AllocationTracker::FunctionInfo* info : tracker->function_info_list()) {
+    WriteVarint(info->function_id, &buffer_);
+    WriteVarint(GetStringId(info->name), &buffer_);
+    WriteVarint(GetStringId(info->script_name), &buffer_);
+    WriteVarint(static_cast<uint32_t>(info->script_id), &buffer_);
+    WriteVarint(EncodePosition(info->line), &buffer_);
+    WriteVarint(EncodePosition(info->column), &buffer_);
+  }
+  Flush();
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceTree() {
+  AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
+  WriteVarint(tracker ? 1 : 0, &buffer_);
+  if (tracker) SerializeTraceNode(tracker->trace_tree()->root());
+  Flush();
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceNode(
+    AllocationTraceNode* node) {
+  WriteVarint(node->id(), &buffer_);
+  WriteVarint(node->function_info_index(), &buffer_);
+  WriteVarint(node->allocation_count(), &buffer_);
+  WriteVarint(node->allocation_size(), &buffer_);
+  WriteVarint(node->children().size(), &buffer_);
+  for (AllocationTraceNode* child : node->children()) {
+    SerializeTraceNode(child);
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeSamples() {
+  const std::vector<HeapObjectsMap::TimeInterval>& samples =
+      snapshot_->profiler()->heap_object_map()->samples();
+  WriteVarint(samples.size(), &buffer_);
+  for (const HeapObjectsMap::TimeInterval& sample : samples) {
+    base::TimeDelta time_delta = sample.timestamp - samples[0].timestamp;
+    WriteVarint(time_delta.InMicroseconds(), &buffer_);
+    WriteVarint(sample.last_assigned_id(), &buffer_);
+  }
+  Flush();
+}
+
+void HeapSnapshotBinarySerializer::SerializeLocations() {
+  const std::vector<SourceLocation>& locations = snapshot_->locations();
+  WriteVarint(locations.size(), &buffer_);
+  for (const SourceLocation& location : locations) {
+    WriteVarint(location.entry_index, &buffer_);
+    WriteVarint(static_cast<uint32_t>(location.scriptId), &buffer_);
+    WriteVarint(static_cast<uint32_t>(location.line), &buffer_);
+    WriteVarint(static_cast<uint32_t>(location.col), &buffer_);
+  }
+  Flush();
+}
+
+void HeapSnapshotBinarySerializer::SerializeStrings() {
+  // The first string is the "<dummy>" placeholder of the JSON format.
+  WriteVarint(strings_.size() + 1, &buffer_);
+  static const char kDummy[] = "<dummy>";
+  WriteVarint(strlen(kDummy), &buffer_);
+  buffer_.insert(buffer_.end(), kDummy, kDummy + strlen(kDummy));
+  for (const char* s : strings_) {
+    const size_t length = strlen(s);
+    WriteVarint(length, &buffer_);
+    buffer_.insert(buffer_.end(), s, s + length);
+    if (buffer_.size() >= kChunkSize) Flush();
+  }
+  Flush();
+}
+
+void HeapSnapshotBinarySerializer::Flush() {
+  if (!writer_->aborted()) {
+    writer_->AddBytes(buffer_.data(), static_cast<int>(buffer_.size()));
+  }
+  buffer_.clear();
+}
+
 }  // namespace internal
 }  // namespace v8
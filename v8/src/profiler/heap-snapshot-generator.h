@@ -595,6 +595,55 @@ class HeapSnapshotJSONSerializer {
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshotJSONSerializer);
 };
 
+// Writes a snapshot in the compact binary format described near
+// v8::HeapSnapshot::Serialize. Nodes and edges are encoded in chunks, which
+// are encoded on worker threads with --heap-snapshot-parallel-serialization
+// and written to the stream in order as soon as they are ready.
+class HeapSnapshotBinarySerializer {
+ public:
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot) {}
+  void Serialize(v8::OutputStream* stream);
+
+  static const uint32_t kVersion;
+  // Number of nodes or edges encoded together.
+  static const size_t kChunkSize;
+
+ private:
+  class EncodingJob;
+  using Buffer = std::vector<uint8_t>;
+
+  uint32_t GetStringId(const char* s);
+  void CollectStrings();
+  size_t chunk_count() const { return node_chunks_ + edge_chunks_; }
+  // Encodes nodes or edges. Can be called concurrently once CollectStrings()
+  // assigned ids to all node and edge names.
+  void EncodeChunk(size_t chunk, Buffer* buffer) const;
+  void SerializeChunks();
+  void SerializeHeader();
+  void SerializeTraceFunctionInfos();
+  void SerializeTraceTree();
+  void SerializeTraceNode(AllocationTraceNode* node);
+  void SerializeSamples();
+  void SerializeLocations();
+  void SerializeStrings();
+  void Flush();
+
+  HeapSnapshot* snapshot_;
+  // Names are interned by pointer, so that ids can be looked up concurrently
+  // without hashing their contents. Equal names may therefore appear more
+  // than once in the string table.
+  std::unordered_map<const char*, uint32_t> string_ids_;
+  std::vector<const char*> strings_;
+  size_t node_chunks_ = 0;
+  size_t edge_chunks_ = 0;
+  // Holds the encoding of the sections written on the main thread.
+  Buffer buffer_;
+  OutputStreamWriter* writer_ = nullptr;
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotBinarySerializer);
+};
+
 
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,265 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/pprof-serializer.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "src/profiler/profile-generator.h"
+#include "third_party/zlib/google/compression_utils_portable.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Field numbers of the profile.proto messages.
+enum ProfileField {
+  kProfileSampleType = 1,
+  kProfileSample = 2,
+  kProfileLocation = 4,
+  kProfileFunction = 5,
+  kProfileStringTable = 6,
+  kProfileTimeNanos = 9,
+  kProfileDurationNanos = 10,
+  kProfilePeriodType = 11,
+  kProfilePeriod = 12,
+};
+enum ValueTypeField { kValueTypeType = 1, kValueTypeUnit = 2 };
+enum SampleField { kSampleLocationId = 1, kSampleValue = 2 };
+enum LocationField { kLocationId = 1, kLocationLine = 4 };
+enum LineField { kLineFunctionId = 1, kLineLine = 2 };
+enum FunctionField {
+  kFunctionId = 1,
+  kFunctionName = 2,
+  kFunctionFilename = 4,
+  kFunctionStartLine = 5,
+};
+
+// Appends protocol buffer fields to a byte vector.
+class ProtoWriter {
+ public:
+  void WriteVarintField(int field, uint64_t value) {
+    WriteTag(field, kVarint);
+    WriteVarint(value);
+  }
+
+  void WriteBytesField(int field, const uint8_t* data, size_t size) {
+    WriteTag(field, kLengthDelimited);
+    WriteVarint(size);
+    buffer_.insert(buffer_.end(), data, data + size);
+  }
+
+  void WriteStringField(int field, const std::string& value) {
+    WriteBytesField(field, reinterpret_cast<const uint8_t*>(value.data()),
+                    value.size());
+  }
+
+  void WriteMessageField(int field, const ProtoWriter& message) {
+    WriteBytesField(field, message.buffer_.data(), message.buffer_.size());
+  }
+
+  void WritePackedField(int field, const std::vector<uint64_t>& values) {
+    ProtoWriter packed;
+    for (uint64_t value : values) packed.WriteVarint(value);
+    WriteMessageField(field, packed);
+  }
+
+  std::vector<uint8_t>& buffer() { return buffer_; }
+
+ private:
+  enum WireType { kVarint = 0, kLengthDelimited = 2 };
+
+  void WriteTag(int field, WireType type) {
+    WriteVarint(static_cast<uint64_t>(field) << 3 | type);
+  }
+
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+      buffer_.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    buffer_.push_back(static_cast<uint8_t>(value));
+  }
+
+  std::vector<uint8_t> buffer_;
+};
+
+class ProfileBuilder {
+ public:
+  explicit ProfileBuilder(int64_t period_nanos) : period_nanos_(period_nanos) {
+    // The first entry of the string table has to be the empty string.
+    Intern("");
+  }
+
+  void AddSamples(const ProfileTree* tree) {
+    const ProfileNode* root = tree->root();
+    std::vector<const ProfileNode*> pending_nodes = {root};
+    while (!pending_nodes.empty()) {
+      const ProfileNode* node = pending_nodes.back();
+      pending_nodes.pop_back();
+      for (const ProfileNode* child : *node->children()) {
+        pending_nodes.push_back(child);
+      }
+      if (node != root && node->self_ticks() != 0) AddSamples(root, node);
+    }
+  }
+
+  void Finish(ProtoWriter* profile, int64_t time_nanos,
+              int64_t duration_nanos) {
+    ProtoWriter ticks_type;
+    ticks_type.WriteVarintField(kValueTypeType, Intern("samples"));
+    ticks_type.WriteVarintField(kValueTypeUnit, Intern("count"));
+    ProtoWriter time_type;
+    time_type.WriteVarintField(kValueTypeType, Intern("cpu"));
+    time_type.WriteVarintField(kValueTypeUnit, Intern("nanoseconds"));
+
+    profile->WriteMessageField(kProfileSampleType, ticks_type);
+    profile->WriteMessageField(kProfileSampleType, time_type);
+    for (const ProtoWriter& sample : samples_) {
+      profile->WriteMessageField(kProfileSample, sample);
+    }
+    for (const ProtoWriter& location : locations_) {
+      profile->WriteMessageField(kProfileLocation, location);
+    }
+    for (const ProtoWriter& function : functions_) {
+      profile->WriteMessageField(kProfileFunction, function);
+    }
+    for (const std::string& string : strings_) {
+      profile->WriteStringField(kProfileStringTable, string);
+    }
+    profile->WriteVarintField(kProfileTimeNanos, time_nanos);
+    profile->WriteVarintField(kProfileDurationNanos, duration_nanos);
+    profile->WriteMessageField(kProfilePeriodType, time_type);
+    profile->WriteVarintField(kProfilePeriod, period_nanos_);
+  }
+
+ private:
+  // Adds the self ticks of |node|, split by the lines they were taken at.
+  void AddSamples(const ProfileNode* root, const ProfileNode* node) {
+    // Locations are ordered leaf first. A node records the line its parent
+    // called it from, which is where the parent's location points to.
+    std::vector<uint64_t> location_ids = {0};
+    for (const ProfileNode* child = node; child->parent() != root;
+         child = child->parent()) {
+      location_ids.push_back(
+          LocationId(child->parent()->entry(), child->line_number()));
+    }
+
+    unsigned remaining_ticks = node->self_ticks();
+    std::vector<v8::CpuProfileNode::LineTick> line_ticks(
+        node->GetHitLineCount());
+    if (!line_ticks.empty()) {
+      node->GetLineTicks(line_ticks.data(),
+                         static_cast<unsigned>(line_ticks.size()));
+    }
+    for (const v8::CpuProfileNode::LineTick& line_tick : line_ticks) {
+      unsigned ticks = std::min(line_tick.hit_count, remaining_ticks);
+      if (ticks == 0) continue;
+      location_ids[0] = LocationId(node->entry(), line_tick.line);
+      AddSample(location_ids, ticks);
+      remaining_ticks -= ticks;
+    }
+    if (remaining_ticks != 0) {
+      location_ids[0] = LocationId(node->entry(),
+                                   v8::CpuProfileNode::kNoLineNumberInfo);
+      AddSample(location_ids, remaining_ticks);
+    }
+  }
+
+  void AddSample(const std::vector<uint64_t>& location_ids, unsigned ticks) {
+    samples_.emplace_back();
+    ProtoWriter& sample = samples_.back();
+    sample.WritePackedField(kSampleLocationId, location_ids);
+    sample.WritePackedField(kSampleValue,
+                            {ticks, ticks * static_cast<uint64_t>(
+                                                period_nanos_)});
+  }
+
+  uint64_t LocationId(CodeEntry* entry, int line) {
+    auto result = location_ids_.emplace(std::make_pair(entry, line),
+                                        locations_.size() + 1);
+    if (!result.second) return result.first->second;
+
+    ProtoWriter line_message;
+    line_message.WriteVarintField(kLineFunctionId, FunctionId(entry));
+    if (line > 0) line_message.WriteVarintField(kLineLine, line);
+    locations_.emplace_back();
+    ProtoWriter& location = locations_.back();
+    location.WriteVarintField(kLocationId, result.first->second);
+    location.WriteMessageField(kLocationLine, line_message);
+    return result.first->second;
+  }
+
+  uint64_t FunctionId(CodeEntry* entry) {
+    auto result = function_ids_.emplace(entry, functions_.size() + 1);
+    if (!result.second) return result.first->second;
+
+    functions_.emplace_back();
+    ProtoWriter& function = functions_.back();
+    function.WriteVarintField(kFunctionId, result.first->second);
+    function.WriteVarintField(
+        kFunctionName,
+        Intern(*entry->name() ? entry->name() : "(anonymous function)"));
+    if (*entry->resource_name()) {
+      function.WriteVarintField(kFunctionFilename,
+                                Intern(entry->resource_name()));
+    }
+    if (entry->line_number() > 0) {
+      function.WriteVarintField(kFunctionStartLine, entry->line_number());
+    }
+    return result.first->second;
+  }
+
+  uint64_t Intern(const std::string& string) {
+    auto result = string_ids_.emplace(string, strings_.size());
+    if (result.second) strings_.push_back(string);
+    return result.first->second;
+  }
+
+  const int64_t period_nanos_;
+  std::vector<ProtoWriter> samples_;
+  std::vector<ProtoWriter> locations_;
+  std::vector<ProtoWriter> functions_;
+  std::vector<std::string> strings_;
+  std::map<std::pair<CodeEntry*, int>, uint64_t> location_ids_;
+  std::unordered_map<CodeEntry*, uint64_t> function_ids_;
+  std::unordered_map<std::string, uint64_t> string_ids_;
+};
+
+// Size of the gzip header and trailer added to the deflate stream.
+constexpr size_t kGzipOverhead = 18;
+
+}  // namespace
+
+// static
+std::vector<uint8_t> PprofSerializer::Serialize(const ProfileTree* tree,
+                                                int64_t time_nanos,
+                                                int64_t duration_nanos,
+                                                int64_t period_nanos) {
+  ProfileBuilder builder(period_nanos);
+  builder.AddSamples(tree);
+  ProtoWriter profile;
+  builder.Finish(&profile, time_nanos, duration_nanos);
+
+  const std::vector<uint8_t>& message = profile.buffer();
+  uLongf compressed_size = static_cast<uLongf>(
+      compressBound(static_cast<uLong>(message.size())) + kGzipOverhead);
+  std::vector<uint8_t> compressed(compressed_size);
+  if (zlib_internal::CompressHelper(
+          zlib_internal::GZIP, compressed.data(), &compressed_size,
+          message.data(), static_cast<uLong>(message.size()),
+          Z_DEFAULT_COMPRESSION, nullptr, nullptr) != Z_OK) {
+    return {};
+  }
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,38 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_PPROF_SERIALIZER_H_
+#define V8_PROFILER_PPROF_SERIALIZER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+class ProfileTree;
+
+// Encodes the self ticks of a ProfileTree as a profile.proto message of pprof
+// (https://github.com/google/pprof/blob/master/proto/profile.proto). Each
+// sample has two values, the number of ticks and the CPU time they account
+// for. The tree is expected to record caller line numbers, see
+// v8::CpuProfilingMode::kCallerLineNumbers.
+class V8_EXPORT_PRIVATE PprofSerializer {
+ public:
+  // Returns the gzip-compressed message, which is the format pprof reads, or
+  // an empty vector if compression failed.
+  static std::vector<uint8_t> Serialize(const ProfileTree* tree,
+                                        int64_t time_nanos,
+                                        int64_t duration_nanos,
+                                        int64_t period_nanos);
+
+  DISALLOW_IMPLICIT_CONSTRUCTORS(PprofSerializer);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_PPROF_SERIALIZER_H_
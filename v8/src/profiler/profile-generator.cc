@@ -9,6 +9,7 @@
 #include "src/codegen/source-position.h"
 #include "src/objects/shared-function-info-inl.h"
 #include "src/profiler/cpu-profiler.h"
+#include "src/profiler/pprof-serializer.h"
 #include "src/profiler/profile-generator-inl.h"
 #include "src/profiler/profiler-stats.h"
 #include "src/tracing/trace-event.h"
@@ -660,6 +661,12 @@ void CodeMap::Clear() {
   code_entries_.clear();
   code_map_.clear();
   free_list_head_ = kNoFreeSlot;
+  retired_entries_.clear();
+}
+
+void CodeMap::ReleaseRetiredEntries() {
+  for (unsigned index : retired_entries_) DeleteCodeEntry(index);
+  retired_entries_.clear();
 }
 
 void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
@@ -678,6 +685,8 @@ void CodeMap::ClearCodesInRange(Address start, Address end) {
   for (; right != code_map_.end() && right->first < end; ++right) {
     if (!entry(right->second.index)->used()) {
       DeleteCodeEntry(right->second.index);
+    } else {
+      retired_entries_.push_back(right->second.index);
     }
   }
   code_map_.erase(left, right);
@@ -730,6 +739,104 @@ void CodeMap::Print() {
   }
 }
 
+ContinuousCpuProfile::ContinuousCpuProfile(
+    Isolate* isolate, CodeMap* code_map, CpuProfileWindowSink* sink,
+    ContinuousCpuProfilingOptions options)
+    : isolate_(isolate), code_map_(code_map), sink_(sink), options_(options) {
+  DCHECK_LT(0, options_.window_duration_ms());
+  StartWindow(base::TimeTicks::HighResolutionNow());
+}
+
+void ContinuousCpuProfile::StartWindow(base::TimeTicks start_time) {
+  tree_.reset(new ProfileTree(isolate_));
+  node_count_ = 0;
+  truncated_samples_ = 0;
+  window_start_ = start_time;
+  window_start_nanos_ = (base::Time::Now() - base::Time::UnixEpoch())
+                            .InNanoseconds();
+}
+
+bool ContinuousCpuProfile::CheckSubsample(
+    base::TimeDelta source_sampling_interval) {
+  DCHECK_GE(source_sampling_interval, base::TimeDelta());
+  source_sampling_interval_ = source_sampling_interval;
+  if (source_sampling_interval.IsZero()) return true;
+
+  next_sample_delta_ -= source_sampling_interval;
+  if (next_sample_delta_ <= base::TimeDelta()) {
+    next_sample_delta_ =
+        base::TimeDelta::FromMicroseconds(options_.sampling_interval_us());
+    return true;
+  }
+  return false;
+}
+
+void ContinuousCpuProfile::AddPath(base::TimeTicks timestamp,
+                                   const ProfileStackTrace& path, int src_line,
+                                   base::TimeDelta sampling_interval,
+                                   bool may_release_code_entries) {
+  if (!timestamp.IsNull() &&
+      timestamp - window_start_ >= base::TimeDelta::FromMilliseconds(
+                                       options_.window_duration_ms())) {
+    FinishWindow(timestamp, may_release_code_entries);
+  }
+  if (!CheckSubsample(sampling_interval)) return;
+
+  unsigned truncated_samples = truncated_samples_;
+  ProfileNode* node = AddBoundedPath(path);
+  node->IncrementSelfTicks();
+  // The line belongs to the top frame, unless the path was cut off.
+  if (truncated_samples == truncated_samples_) {
+    node->IncrementLineTicks(src_line);
+  }
+}
+
+ProfileNode* ContinuousCpuProfile::AddBoundedPath(
+    const ProfileStackTrace& path) {
+  // Like ProfileTree::AddPathFromEnd() with caller line numbers, but stops
+  // at the deepest existing node once the tree is full.
+  ProfileNode* node = tree_->root();
+  int parent_line_number = v8::CpuProfileNode::kNoLineNumberInfo;
+  for (auto it = path.rbegin(); it != path.rend(); ++it) {
+    if (it->code_entry == nullptr) continue;
+    ProfileNode* child = node->FindChild(it->code_entry, parent_line_number);
+    if (child == nullptr) {
+      if (node_count_ >= options_.max_nodes()) {
+        ++truncated_samples_;
+        break;
+      }
+      child = node->FindOrAddChild(it->code_entry, parent_line_number);
+      ++node_count_;
+    }
+    node = child;
+    parent_line_number = it->line_number;
+  }
+  return node;
+}
+
+void ContinuousCpuProfile::FinishWindow(base::TimeTicks end_time,
+                                        bool may_release_code_entries) {
+  // Report the period the profile was actually sampled at, i.e. the target
+  // interval rounded up to a multiple of the profiler's interval.
+  int64_t period_us = options_.sampling_interval_us();
+  int64_t source_period_us = source_sampling_interval_.InMicroseconds();
+  if (source_period_us > 0) {
+    period_us = std::max<int64_t>(
+                    (period_us + source_period_us - 1) / source_period_us, 1) *
+                source_period_us;
+  }
+  std::vector<uint8_t> data = PprofSerializer::Serialize(
+      tree_.get(), window_start_nanos_,
+      (end_time - window_start_).InNanoseconds(),
+      period_us * base::TimeConstants::kNanosecondsPerMicrosecond);
+  if (!data.empty()) sink_->WriteProfileWindow(data.data(), data.size());
+
+  // The tree was the last reference to code entries retired during the
+  // window, unless other profiles are running.
+  StartWindow(end_time);
+  if (may_release_code_entries) code_map_->ReleaseRetiredEntries();
+}
+
 CpuProfilesCollection::CpuProfilesCollection(Isolate* isolate)
     : profiler_(nullptr), current_profiles_semaphore_(1) {}
 
@@ -780,13 +887,15 @@ CpuProfile* CpuProfilesCollection::StopProfiling(const char* title) {
 bool CpuProfilesCollection::IsLastProfile(const char* title) {
   // Called from VM thread, and only it can mutate the list,
   // so no locking is needed here.
-  if (current_profiles_.size() != 1) return false;
+  if (current_profiles_.size() != 1 || continuous_profile_) return false;
   return title[0] == '\0' || strcmp(current_profiles_[0]->title(), title) == 0;
 }
 
 
 void CpuProfilesCollection::RemoveProfile(CpuProfile* profile) {
-  // Called from VM thread for a completed profile.
+  // Called from VM thread for a completed profile. The continuous profile
+  // checks for finished profiles on the profile generator thread.
+  current_profiles_semaphore_.Wait();
   auto pos =
       std::find_if(finished_profiles_.begin(), finished_profiles_.end(),
                    [&](const std::unique_ptr<CpuProfile>& finished_profile) {
@@ -794,6 +903,36 @@ void CpuProfilesCollection::RemoveProfile(CpuProfile* profile) {
                    });
   DCHECK(pos != finished_profiles_.end());
   finished_profiles_.erase(pos);
+  current_profiles_semaphore_.Signal();
+}
+
+bool CpuProfilesCollection::StartContinuousProfiling(
+    CodeMap* code_map, CpuProfileWindowSink* sink,
+    ContinuousCpuProfilingOptions options) {
+  DCHECK(profiler_);
+  current_profiles_semaphore_.Wait();
+  bool started = !continuous_profile_;
+  if (started) {
+    continuous_profile_.reset(new ContinuousCpuProfile(
+        profiler_->isolate(), code_map, sink, options));
+  }
+  current_profiles_semaphore_.Signal();
+  return started;
+}
+
+void CpuProfilesCollection::StopContinuousProfiling() {
+  current_profiles_semaphore_.Wait();
+  std::unique_ptr<ContinuousCpuProfile> profile =
+      std::move(continuous_profile_);
+  bool may_release_code_entries =
+      current_profiles_.empty() && finished_profiles_.empty();
+  current_profiles_semaphore_.Signal();
+  if (!profile) return;
+  // Once detached, the profile no longer receives samples, so its last window
+  // can be finished on this thread. Code entries are only released if the
+  // profile generator thread is not running anymore.
+  profile->FinishWindow(base::TimeTicks::HighResolutionNow(),
+                        may_release_code_entries && !profiler_->processor());
 }
 
 namespace {
@@ -802,6 +941,16 @@ int64_t GreatestCommonDivisor(int64_t a, int64_t b) {
   return b ? GreatestCommonDivisor(b, a % b) : a;
 }
 
+// Snaps a profile's requested sampling interval to the next multiple of the
+// base sampling interval.
+int64_t SnapSamplingInterval(int64_t interval_us,
+                             int64_t base_sampling_interval_us) {
+  return std::max<int64_t>((interval_us + base_sampling_interval_us - 1) /
+                               base_sampling_interval_us,
+                           1) *
+         base_sampling_interval_us;
+}
+
 }  // namespace
 
 base::TimeDelta CpuProfilesCollection::GetCommonSamplingInterval() const {
@@ -813,14 +962,13 @@ base::TimeDelta CpuProfilesCollection::GetCommonSamplingInterval() const {
 
   int64_t interval_us = 0;
   for (const auto& profile : current_profiles_) {
-    // Snap the profile's requested sampling interval to the next multiple of
-    // the base sampling interval.
-    int64_t profile_interval_us =
-        std::max<int64_t>(
-            (profile->sampling_interval_us() + base_sampling_interval_us - 1) /
-                base_sampling_interval_us,
-            1) *
-        base_sampling_interval_us;
+    int64_t profile_interval_us = SnapSamplingInterval(
+        profile->sampling_interval_us(), base_sampling_interval_us);
+    interval_us = GreatestCommonDivisor(interval_us, profile_interval_us);
+  }
+  if (continuous_profile_) {
+    int64_t profile_interval_us = SnapSamplingInterval(
+        continuous_profile_->sampling_interval_us(), base_sampling_interval_us);
     interval_us = GreatestCommonDivisor(interval_us, profile_interval_us);
   }
   return base::TimeDelta::FromMicroseconds(interval_us);
@@ -837,6 +985,11 @@ void CpuProfilesCollection::AddPathToCurrentProfiles(
     profile->AddPath(timestamp, path, src_line, update_stats,
                      sampling_interval);
   }
+  if (continuous_profile_ && update_stats) {
+    continuous_profile_->AddPath(
+        timestamp, path, src_line, sampling_interval,
+        current_profiles_.empty() && finished_profiles_.empty());
+  }
   current_profiles_semaphore_.Signal();
 }
 
@@ -412,6 +412,11 @@ class V8_EXPORT_PRIVATE CodeMap {
   CodeEntry* FindEntry(Address addr, Address* out_instruction_start = nullptr);
   void Print();
 
+  // Deletes the entries of code that went away while profiles referred to
+  // them. Only safe once no profile tree holds these entries anymore.
+  void ReleaseRetiredEntries();
+  size_t retired_entries_count() const { return retired_entries_.size(); }
+
   void Clear();
 
  private:
@@ -437,10 +442,68 @@ class V8_EXPORT_PRIVATE CodeMap {
   std::deque<CodeEntrySlotInfo> code_entries_;
   std::map<Address, CodeEntryMapInfo> code_map_;
   unsigned free_list_head_ = kNoFreeSlot;
+  // Slots of used entries that are no longer mapped to any code.
+  std::vector<unsigned> retired_entries_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeMap);
 };
 
+// A profile that is not meant to be stopped before it is looked at. Samples
+// are aggregated in a call tree covering a fixed window of time. When the
+// window is over, it is encoded in the pprof format, passed to a
+// CpuProfileWindowSink and dropped, so memory use is bounded by the number of
+// nodes a window may have.
+class V8_EXPORT_PRIVATE ContinuousCpuProfile {
+ public:
+  ContinuousCpuProfile(Isolate* isolate, CodeMap* code_map,
+                       CpuProfileWindowSink* sink,
+                       ContinuousCpuProfilingOptions options);
+
+  // Checks whether or not the given TickSample should be (sub)sampled, given
+  // the sampling interval of the profiler that recorded it (in microseconds).
+  bool CheckSubsample(base::TimeDelta sampling_interval);
+  // Adds the call path to the current window, after finishing the current
+  // window if |timestamp| is past its end. Retired code entries are released
+  // along with a window only if |may_release_code_entries| is set, i.e. if no
+  // other profile may refer to them.
+  void AddPath(base::TimeTicks timestamp, const ProfileStackTrace& path,
+               int src_line, base::TimeDelta sampling_interval,
+               bool may_release_code_entries);
+  // Encodes the current window, passes it to the sink and starts a new window
+  // at |end_time|.
+  void FinishWindow(base::TimeTicks end_time, bool may_release_code_entries);
+
+  int64_t sampling_interval_us() const {
+    return options_.sampling_interval_us();
+  }
+  const ProfileTree* window_tree() const { return tree_.get(); }
+  // Number of nodes in the tree of the current window, excluding the root.
+  unsigned window_node_count() const { return node_count_; }
+  // Number of samples of the current window that were attributed to a caller
+  // because the tree of the window was full.
+  unsigned window_truncated_samples() const { return truncated_samples_; }
+
+ private:
+  void StartWindow(base::TimeTicks start_time);
+  ProfileNode* AddBoundedPath(const ProfileStackTrace& path);
+
+  Isolate* const isolate_;
+  CodeMap* const code_map_;
+  CpuProfileWindowSink* const sink_;
+  const ContinuousCpuProfilingOptions options_;
+  std::unique_ptr<ProfileTree> tree_;
+  unsigned node_count_ = 0;
+  unsigned truncated_samples_ = 0;
+  base::TimeTicks window_start_;
+  // Wall clock time of the window start, in nanoseconds since the epoch.
+  int64_t window_start_nanos_ = 0;
+  // Sampling interval of the profiler when the last sample arrived.
+  base::TimeDelta source_sampling_interval_;
+  base::TimeDelta next_sample_delta_;
+
+  DISALLOW_COPY_AND_ASSIGN(ContinuousCpuProfile);
+};
+
 class V8_EXPORT_PRIVATE CpuProfilesCollection {
  public:
   explicit CpuProfilesCollection(Isolate* isolate);
@@ -457,6 +520,20 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   bool IsLastProfile(const char* title);
   void RemoveProfile(CpuProfile* profile);
 
+  // Returns false if a continuous profile is already running.
+  bool StartContinuousProfiling(CodeMap* code_map, CpuProfileWindowSink* sink,
+                                ContinuousCpuProfilingOptions options);
+  // Passes the last window of the continuous profile, if any, to its sink.
+  void StopContinuousProfiling();
+  bool has_continuous_profile() const { return !!continuous_profile_; }
+  // Whether the continuous profile is the only one that needs samples.
+  bool IsOnlyContinuousProfile() const {
+    return continuous_profile_ && current_profiles_.empty();
+  }
+  ContinuousCpuProfile* continuous_profile_for_test() const {
+    return continuous_profile_.get();
+  }
+
   // Finds a common sampling interval dividing each CpuProfile's interval,
   // rounded up to the nearest multiple of the CpuProfiler's sampling interval.
   // Returns 0 if no profiles are attached.
@@ -478,6 +555,7 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
 
   // Accessed by VM thread and profile generator thread.
   std::vector<std::unique_ptr<CpuProfile>> current_profiles_;
+  std::unique_ptr<ContinuousCpuProfile> continuous_profile_;
   base::Semaphore current_profiles_semaphore_;
 
   DISALLOW_COPY_AND_ASSIGN(CpuProfilesCollection);
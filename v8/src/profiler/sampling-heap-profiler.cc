@@ -64,9 +64,13 @@ SamplingHeapProfiler::SamplingHeapProfiler(
   CHECK_GT(rate_, 0u);
   heap_->AddAllocationObserversToAllSpaces(&allocation_observer_,
                                            &allocation_observer_);
+  heap_->AddGCEpilogueCallback(
+      OnGCEpilogue,
+      static_cast<v8::GCType>(kGCTypeScavenge | kGCTypeMarkSweepCompact), this);
 }
 
 SamplingHeapProfiler::~SamplingHeapProfiler() {
+  heap_->RemoveGCEpilogueCallback(OnGCEpilogue, this);
   heap_->RemoveAllocationObserversFromAllSpaces(&allocation_observer_,
                                                 &allocation_observer_);
 }
@@ -85,8 +89,10 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
+  auto sample = std::make_unique<Sample>(
+      size, node, loc, this, next_sample_id(),
+      Heap::InYoungGeneration(heap_object), heap_->gc_count(),
+      heap_->MonotonicallyIncreasingTimeInMs());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
   samples_.emplace(sample.get(), std::move(sample));
@@ -109,10 +115,37 @@ void SamplingHeapProfiler::OnWeakCallback(
       node = parent;
     }
   }
+  if (sample->reported) {
+    sample->profiler->freed_sample_ids_.push_back(sample->sample_id);
+  }
   sample->profiler->samples_.erase(sample);
   // sample is deleted because its unique ptr was erased from samples_.
 }
 
+// static
+void SamplingHeapProfiler::OnGCEpilogue(v8::Isolate* isolate,
+                                        v8::GCType type,
+                                        v8::GCCallbackFlags flags,
+                                        void* data) {
+  SamplingHeapProfiler* profiler = static_cast<SamplingHeapProfiler*>(data);
+  const int gc_count = profiler->heap_->gc_count();
+  for (const auto& it : profiler->samples_) {
+    Sample* sample = it.second.get();
+    // Skip objects allocated by epilogue callbacks of this collection.
+    if (sample->gc_count >= gc_count) continue;
+    if (type == kGCTypeMarkSweepCompact) {
+      sample->mark_compacts_survived++;
+    } else {
+      sample->scavenges_survived++;
+    }
+    if (sample->allocated_young && !sample->promoted) {
+      HandleScope scope(profiler->isolate_);
+      Handle<Object> object = Utils::OpenHandle(*sample->global.Get(isolate));
+      sample->promoted = !Heap::InYoungGeneration(*object);
+    }
+  }
+}
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
     AllocationNode* parent, const char* name, int script_id,
     int start_position) {
@@ -207,12 +240,19 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   return node;
 }
 
-v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
-    AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
+std::map<int, Handle<Script>> SamplingHeapProfiler::BuildScriptMap() {
+  std::map<int, Handle<Script>> scripts;
+  Script::Iterator iterator(isolate_);
+  for (Script script = iterator.Next(); !script.is_null();
+       script = iterator.Next()) {
+    scripts[script.id()] = handle(script, isolate_);
+  }
+  return scripts;
+}
+
+v8::AllocationProfile::Node SamplingHeapProfiler::DescribeAllocationNode(
+    SamplingHeapProfiler::AllocationNode* node,
     const std::map<int, Handle<Script>>& scripts) {
-  // By pinning the node we make sure its children won't get disposed if
-  // a GC kicks in during the tree retrieval.
-  node->pinned_ = true;
   Local<v8::String> script_name =
       ToApiHandle<v8::String>(isolate_->factory()->InternalizeUtf8String(""));
   int line = v8::AllocationProfile::kNoLineNumberInfo;
@@ -239,11 +279,20 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
     allocations.push_back(ScaleSample(alloc.first, alloc.second));
   }
 
-  profile->nodes_.push_back(v8::AllocationProfile::Node{
+  return v8::AllocationProfile::Node{
       ToApiHandle<v8::String>(
           isolate_->factory()->InternalizeUtf8String(node->name_)),
       script_name, node->script_id_, node->script_position_, line, column,
-      node->id_, std::vector<v8::AllocationProfile::Node*>(), allocations});
+      node->id_, std::vector<v8::AllocationProfile::Node*>(), allocations};
+}
+
+v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
+    AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
+    const std::map<int, Handle<Script>>& scripts) {
+  // By pinning the node we make sure its children won't get disposed if
+  // a GC kicks in during the tree retrieval.
+  node->pinned_ = true;
+  profile->nodes_.push_back(DescribeAllocationNode(node, scripts));
   v8::AllocationProfile::Node* current = &profile->nodes_.back();
   // The |children_| map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
@@ -264,14 +313,7 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   }
   // To resolve positions to line/column numbers, we will need to look up
   // scripts. Build a map to allow fast mapping from script id to script.
-  std::map<int, Handle<Script>> scripts;
-  {
-    Script::Iterator iterator(isolate_);
-    for (Script script = iterator.Next(); !script.is_null();
-         script = iterator.Next()) {
-      scripts[script.id()] = handle(script, isolate_);
-    }
-  }
+  std::map<int, Handle<Script>> scripts = BuildScriptMap();
   auto profile = new v8::internal::AllocationProfile();
   TranslateAllocationNode(profile, &profile_root_, scripts);
   profile->samples_ = BuildSamples();
@@ -279,15 +321,65 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   return profile;
 }
 
+void SamplingHeapProfiler::AddNewNodes(
+    AllocationProfileDelta* delta, SamplingHeapProfiler::AllocationNode* node,
+    const std::map<int, Handle<Script>>& scripts) {
+  node->pinned_ = true;
+  if (!node->reported_) {
+    v8::AllocationProfile::Node description =
+        DescribeAllocationNode(node, scripts);
+    description.allocations.clear();
+    delta->new_nodes_.push_back(v8::AllocationProfileDelta::NewNode{
+        node->parent_ ? node->parent_->id_ : 0, std::move(description)});
+    node->reported_ = true;
+  }
+  // Children may be added while iterating, see TranslateAllocationNode.
+  for (const auto& it : node->children_) {
+    AddNewNodes(delta, it.second.get(), scripts);
+  }
+  node->pinned_ = false;
+}
+
+v8::AllocationProfileDelta* SamplingHeapProfiler::GetAllocationProfileDelta() {
+  if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
+    isolate_->heap()->CollectAllGarbage(
+        Heap::kNoGCFlags, GarbageCollectionReason::kSamplingProfiler);
+  }
+  auto delta = new v8::internal::AllocationProfileDelta();
+  // Describing nodes may allocate and thereby take new samples. Nodes are
+  // reported first, so that every reported sample refers to a known node.
+  AddNewNodes(delta, &profile_root_, BuildScriptMap());
+
+  const double now_ms = heap_->MonotonicallyIncreasingTimeInMs();
+  for (const auto& it : samples_) {
+    Sample* sample = it.second.get();
+    if (sample->reported || !sample->owner->reported_) continue;
+    delta->allocated_samples_.push_back(BuildSample(sample, now_ms));
+    sample->reported = true;
+  }
+  delta->freed_sample_ids_.swap(freed_sample_ids_);
+  return delta;
+}
+
+v8::AllocationProfile::Sample SamplingHeapProfiler::BuildSample(
+    const Sample* sample, double now_ms) const {
+  return v8::AllocationProfile::Sample{sample->owner->id_,
+                                       sample->size,
+                                       ScaleSample(sample->size, 1).count,
+                                       sample->sample_id,
+                                       sample->scavenges_survived,
+                                       sample->mark_compacts_survived,
+                                       sample->promoted,
+                                       now_ms - sample->allocation_time_ms};
+}
+
 const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
+  const double now_ms = heap_->MonotonicallyIncreasingTimeInMs();
   std::vector<v8::AllocationProfile::Sample> samples;
   samples.reserve(samples_.size());
   for (const auto& it : samples_) {
-    const Sample* sample = it.second.get();
-    samples.emplace_back(v8::AllocationProfile::Sample{
-        sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+    samples.emplace_back(BuildSample(it.second.get(), now_ms));
   }
   return samples;
 }
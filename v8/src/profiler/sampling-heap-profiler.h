@@ -43,6 +43,31 @@ class AllocationProfile : public v8::AllocationProfile {
   DISALLOW_COPY_AND_ASSIGN(AllocationProfile);
 };
 
+class AllocationProfileDelta : public v8::AllocationProfileDelta {
+ public:
+  AllocationProfileDelta() = default;
+
+  const std::vector<NewNode>& GetNewNodes() override { return new_nodes_; }
+
+  const std::vector<v8::AllocationProfile::Sample>& GetAllocatedSamples()
+      override {
+    return allocated_samples_;
+  }
+
+  const std::vector<uint64_t>& GetFreedSampleIds() override {
+    return freed_sample_ids_;
+  }
+
+ private:
+  std::vector<NewNode> new_nodes_;
+  std::vector<v8::AllocationProfile::Sample> allocated_samples_;
+  std::vector<uint64_t> freed_sample_ids_;
+
+  friend class SamplingHeapProfiler;
+
+  DISALLOW_COPY_AND_ASSIGN(AllocationProfileDelta);
+};
+
 class SamplingHeapProfiler {
  public:
   class AllocationNode {
@@ -93,6 +118,8 @@ class SamplingHeapProfiler {
     const char* const name_;
     uint32_t id_;
     bool pinned_ = false;
+    // Whether the node was passed to a delta report.
+    bool reported_ = false;
 
     friend class SamplingHeapProfiler;
 
@@ -101,17 +128,30 @@ class SamplingHeapProfiler {
 
   struct Sample {
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
+           SamplingHeapProfiler* profiler_, uint64_t sample_id,
+           bool allocated_young_, int gc_count_, double allocation_time_ms_)
         : size(size_),
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          allocated_young(allocated_young_),
+          gc_count(gc_count_),
+          allocation_time_ms(allocation_time_ms_) {}
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    const bool allocated_young;
+    // Value of Heap::gc_count() when the object was allocated.
+    const int gc_count;
+    const double allocation_time_ms;
+    unsigned int scavenges_survived = 0;
+    unsigned int mark_compacts_survived = 0;
+    bool promoted = false;
+    // Whether the sample was passed to a delta report.
+    bool reported = false;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -122,6 +162,7 @@ class SamplingHeapProfiler {
   ~SamplingHeapProfiler();
 
   v8::AllocationProfile* GetAllocationProfile();
+  v8::AllocationProfileDelta* GetAllocationProfileDelta();
   StringsStorage* names() const { return names_; }
 
  private:
@@ -160,24 +201,40 @@ class SamplingHeapProfiler {
   void SampleObject(Address soon_object, size_t size);
 
   const std::vector<v8::AllocationProfile::Sample> BuildSamples() const;
+  v8::AllocationProfile::Sample BuildSample(const Sample* sample,
+                                            double now_ms) const;
 
   AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
                                      int script_id, int start_position);
   static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
+  // Updates the survival statistics of the samples that are still live after
+  // a garbage collection. Dead samples were removed by OnWeakCallback before.
+  static void OnGCEpilogue(v8::Isolate* isolate, v8::GCType type,
+                           v8::GCCallbackFlags flags, void* data);
 
   uint32_t next_node_id() { return ++last_node_id_; }
   uint64_t next_sample_id() { return ++last_sample_id_; }
 
   // Methods that construct v8::AllocationProfile.
 
+  // Maps all currently loaded scripts by their script id.
+  std::map<int, Handle<Script>> BuildScriptMap();
+  // Describes the provided AllocationNode *node* without its children. Line
+  // numbers, column numbers, and script names are resolved using *scripts*.
+  v8::AllocationProfile::Node DescribeAllocationNode(
+      SamplingHeapProfiler::AllocationNode* node,
+      const std::map<int, Handle<Script>>& scripts);
   // Translates the provided AllocationNode *node* returning an equivalent
   // AllocationProfile::Node. The newly created AllocationProfile::Node is added
-  // to the provided AllocationProfile *profile*. Line numbers, column numbers,
-  // and script names are resolved using *scripts* which maps all currently
-  // loaded scripts keyed by their script id.
+  // to the provided AllocationProfile *profile*.
   v8::AllocationProfile::Node* TranslateAllocationNode(
       AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
       const std::map<int, Handle<Script>>& scripts);
+  // Adds the nodes of the subtree of *node* that were not reported yet to
+  // *delta*.
+  void AddNewNodes(AllocationProfileDelta* delta,
+                   SamplingHeapProfiler::AllocationNode* node,
+                   const std::map<int, Handle<Script>>& scripts);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count) const;
   AllocationNode* AddStack();
@@ -190,6 +247,8 @@ class SamplingHeapProfiler {
   StringsStorage* const names_;
   AllocationNode profile_root_;
   std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Ids of reported samples that died since the last delta report.
+  std::vector<uint64_t> freed_sample_ids_;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
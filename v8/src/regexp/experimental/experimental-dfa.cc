@@ -0,0 +1,419 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-dfa.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "src/base/functional.h"
+#include "src/regexp/regexp.h"
+#include "src/strings/char-predicates-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The characters that assertions distinguish, as the boundaries of ranges.
+constexpr uc16 kContextBoundaries[] = {
+    // Line terminators.
+    '\n', '\n' + 1, '\r', '\r' + 1, 0x2028, 0x2029 + 1,
+    // Word characters.
+    '0', '9' + 1, 'A', 'Z' + 1, '_', '_' + 1, 'a', 'z' + 1};
+
+// The cache is flushed at most once per this many characters per state,
+// otherwise the dfa gives up.  Below that, building states costs more than
+// running the nfa would.
+constexpr int kMinCharactersPerState = 10;
+
+constexpr int kCharactersBetweenInterruptChecks = 1024;
+
+}  // namespace
+
+ExperimentalDfa::ExperimentalDfa(Vector<const RegExpInstruction> bytecode,
+                                 Direction direction,
+                                 AccountingAllocator* allocator,
+                                 size_t cache_size)
+    : bytecode_(bytecode.begin(), bytecode.end()),
+      direction_(direction),
+      begin_pc_(-1),
+      accept_pc_(-1),
+      visited_(bytecode.size(), 0),
+      allocator_(allocator),
+      cache_size_(cache_size),
+      zone_(new Zone(allocator, ZONE_NAME)) {
+  const int length = static_cast<int>(bytecode_.size());
+  std::vector<int> predecessor_counts(length + 1, 0);
+  for (int pc = 0; pc < length; ++pc) {
+    const RegExpInstruction& inst = bytecode_[pc];
+    switch (inst.opcode) {
+      case RegExpInstruction::CONSUME_RANGE: {
+        RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+        class_starts_.push_back(range.min);
+        if (range.max < 0xFFFF) class_starts_.push_back(range.max + 1);
+        break;
+      }
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+        if (inst.payload.register_index == 0) begin_pc_ = pc;
+        ++predecessor_counts[pc + 1];
+        break;
+      case RegExpInstruction::ACCEPT:
+        accept_pc_ = pc;
+        break;
+      case RegExpInstruction::FORK:
+        ++predecessor_counts[inst.payload.pc];
+        ++predecessor_counts[pc + 1];
+        break;
+      case RegExpInstruction::JMP:
+        ++predecessor_counts[inst.payload.pc];
+        break;
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::CLEAR_REGISTER:
+        ++predecessor_counts[pc + 1];
+        break;
+    }
+  }
+  DCHECK_GE(begin_pc_, 0);
+  DCHECK_GE(accept_pc_, 0);
+
+  if (direction_ == kBackward) {
+    predecessor_offsets_.resize(length + 1);
+    int offset = 0;
+    for (int pc = 0; pc < length; ++pc) {
+      predecessor_offsets_[pc] = offset;
+      offset += predecessor_counts[pc];
+    }
+    predecessor_offsets_[length] = offset;
+    predecessors_.resize(offset);
+    std::vector<int> fill(predecessor_offsets_.begin(),
+                          predecessor_offsets_.end());
+    auto add_edge = [&](int from, int to) { predecessors_[fill[to]++] = from; };
+    for (int pc = 0; pc < length; ++pc) {
+      const RegExpInstruction& inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+        case RegExpInstruction::ACCEPT:
+          break;
+        case RegExpInstruction::FORK:
+          add_edge(pc, inst.payload.pc);
+          add_edge(pc, pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          add_edge(pc, inst.payload.pc);
+          break;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          add_edge(pc, pc + 1);
+          break;
+      }
+    }
+  }
+
+  class_starts_.insert(class_starts_.end(), std::begin(kContextBoundaries),
+                       std::end(kContextBoundaries));
+  std::sort(class_starts_.begin(), class_starts_.end());
+  class_starts_.erase(std::unique(class_starts_.begin(), class_starts_.end()),
+                      class_starts_.end());
+  if (!class_starts_.empty() && class_starts_.front() == 0) {
+    class_starts_.erase(class_starts_.begin());
+  }
+  character_class_count_ = static_cast<int>(class_starts_.size()) + 1;
+  for (int c = 0; c < kCharacterClassTableSize; ++c) {
+    character_class_table_[c] = CharacterClassOfSlow(c);
+  }
+}
+
+size_t ExperimentalDfa::StateHash::operator()(const State* state) const {
+  return base::hash_combine(
+      base::hash_range(state->pcs, state->pcs + state->pc_count),
+      state->context, state->matched);
+}
+
+bool ExperimentalDfa::StateEqual::operator()(const State* a,
+                                             const State* b) const {
+  return a->pc_count == b->pc_count && a->context == b->context &&
+         a->matched == b->matched &&
+         std::equal(a->pcs, a->pcs + a->pc_count, b->pcs);
+}
+
+// static
+ExperimentalDfa::ContextClass ExperimentalDfa::ContextClassOf(uc16 c) {
+  if (unibrow::IsLineTerminator(c)) return kLineTerminator;
+  if (IsRegExpWord(c)) return kWordCharacter;
+  return kOtherCharacter;
+}
+
+int ExperimentalDfa::CharacterClassOfSlow(uc16 c) const {
+  return static_cast<int>(
+      std::upper_bound(class_starts_.begin(), class_starts_.end(), c) -
+      class_starts_.begin());
+}
+
+bool ExperimentalDfa::SatisfiesAssertion(int pc, ContextClass before,
+                                         ContextClass after) const {
+  switch (bytecode_[pc].payload.assertion_type) {
+    case RegExpAssertion::START_OF_INPUT:
+      return before == kInputBoundary;
+    case RegExpAssertion::END_OF_INPUT:
+      return after == kInputBoundary;
+    case RegExpAssertion::START_OF_LINE:
+      return before == kInputBoundary || before == kLineTerminator;
+    case RegExpAssertion::END_OF_LINE:
+      return after == kInputBoundary || after == kLineTerminator;
+    case RegExpAssertion::BOUNDARY:
+      return (before == kWordCharacter) != (after == kWordCharacter);
+    case RegExpAssertion::NON_BOUNDARY:
+      return (before == kWordCharacter) == (after == kWordCharacter);
+  }
+}
+
+bool ExperimentalDfa::ComputeClosure(const State* state, ContextClass before,
+                                     ContextClass after) {
+  closure_.clear();
+  worklist_.clear();
+  ++visited_generation_;
+  return direction_ == kForward
+             ? ComputeForwardClosure(state, before, after)
+             : ComputeBackwardClosure(state, before, after);
+}
+
+bool ExperimentalDfa::ComputeForwardClosure(const State* state,
+                                            ContextClass before,
+                                            ContextClass after) {
+  // This follows `NfaInterpreter::RunActiveThread` exactly, so that the
+  // threads end up in the same order: Each thread runs until it blocks, then
+  // the threads it forked run, most recent first, and only then the next
+  // thread of `state`.
+  for (int i = 0; i < state->pc_count; ++i) {
+    worklist_.push_back(state->pcs[i]);
+    while (!worklist_.empty()) {
+      int pc = worklist_.back();
+      worklist_.pop_back();
+      bool running = true;
+      while (running && visited_[pc] != visited_generation_) {
+        visited_[pc] = visited_generation_;
+        const RegExpInstruction& inst = bytecode_[pc];
+        switch (inst.opcode) {
+          case RegExpInstruction::CONSUME_RANGE:
+            closure_.push_back(pc);
+            running = false;
+            break;
+          case RegExpInstruction::ASSERTION:
+            running = SatisfiesAssertion(pc, before, after);
+            ++pc;
+            break;
+          case RegExpInstruction::FORK:
+            worklist_.push_back(inst.payload.pc);
+            ++pc;
+            break;
+          case RegExpInstruction::JMP:
+            pc = inst.payload.pc;
+            break;
+          case RegExpInstruction::ACCEPT:
+            // Threads with lower priority can only produce worse matches.
+            return true;
+          case RegExpInstruction::SET_REGISTER_TO_CP:
+          case RegExpInstruction::CLEAR_REGISTER:
+            ++pc;
+            break;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+bool ExperimentalDfa::ComputeBackwardClosure(const State* state,
+                                             ContextClass before,
+                                             ContextClass after) {
+  for (int i = 0; i < state->pc_count; ++i) {
+    int pc = state->pcs[i];
+    visited_[pc] = visited_generation_;
+    closure_.push_back(pc);
+    worklist_.push_back(pc);
+  }
+  bool matched = false;
+  while (!worklist_.empty()) {
+    int pc = worklist_.back();
+    worklist_.pop_back();
+    if (pc == begin_pc_) matched = true;
+    for (int i = predecessor_offsets_[pc]; i < predecessor_offsets_[pc + 1];
+         ++i) {
+      int predecessor = predecessors_[i];
+      if (visited_[predecessor] == visited_generation_) continue;
+      if (bytecode_[predecessor].opcode == RegExpInstruction::ASSERTION &&
+          !SatisfiesAssertion(predecessor, before, after)) {
+        continue;
+      }
+      visited_[predecessor] = visited_generation_;
+      closure_.push_back(predecessor);
+      worklist_.push_back(predecessor);
+    }
+  }
+  return matched;
+}
+
+ExperimentalDfa::State* ExperimentalDfa::ComputeNext(State* state, uc16 c,
+                                                     int position) {
+  const ContextClass context = ContextClassOf(c);
+  bool matched;
+  int count = 0;
+  if (direction_ == kForward) {
+    matched = ComputeClosure(state, state->context, context);
+    for (int pc : closure_) {
+      RegExpInstruction::Uc16Range range = bytecode_[pc].payload.consume_range;
+      if (c >= range.min && c <= range.max) closure_[count++] = pc + 1;
+    }
+  } else {
+    matched = ComputeClosure(state, context, state->context);
+    for (int pc : closure_) {
+      if (pc == 0) continue;
+      const RegExpInstruction& inst = bytecode_[pc - 1];
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (c >= range.min && c <= range.max) closure_[count++] = pc - 1;
+    }
+    std::sort(closure_.begin(), closure_.begin() + count);
+  }
+
+  State* next = Lookup(closure_.data(), count, context, matched);
+  if (next == nullptr) {
+    if (static_cast<size_t>(std::abs(position - reset_position_)) <
+        kMinCharactersPerState * states_.size()) {
+      return nullptr;
+    }
+    // Start over from the new state.  `state` is gone now, so the transition
+    // isn't recorded.
+    FlushCache();
+    reset_position_ = position;
+    return Lookup(closure_.data(), count, context, matched);
+  }
+  state->next[CharacterClassOf(c)] = next;
+  return next;
+}
+
+bool ExperimentalDfa::MatchesAtEnd(State* state, ContextClass beyond) {
+  int8_t& result = state->matches_at_end[beyond];
+  if (result < 0) {
+    result = direction_ == kForward
+                 ? ComputeClosure(state, state->context, beyond)
+                 : ComputeClosure(state, beyond, state->context);
+  }
+  return result != 0;
+}
+
+ExperimentalDfa::State* ExperimentalDfa::Lookup(const int* pcs, int pc_count,
+                                                ContextClass context,
+                                                bool matched) {
+  State key;
+  key.pcs = const_cast<int*>(pcs);
+  key.pc_count = pc_count;
+  key.context = context;
+  key.matched = matched;
+  auto it = states_.find(&key);
+  if (it != states_.end()) return *it;
+
+  const size_t size = sizeof(State) + pc_count * sizeof(int) +
+                      character_class_count_ * sizeof(State*);
+  if (zone_->allocation_size() + size > cache_size_) return nullptr;
+  State* state = zone_->New<State>(key);
+  state->pcs = zone_->NewArray<int>(pc_count);
+  std::copy(pcs, pcs + pc_count, state->pcs);
+  state->next = zone_->NewArray<State*>(character_class_count_);
+  std::fill(state->next, state->next + character_class_count_, nullptr);
+  std::fill(std::begin(state->matches_at_end), std::end(state->matches_at_end),
+            -1);
+  states_.insert(state);
+  return state;
+}
+
+void ExperimentalDfa::FlushCache() {
+  states_.clear();
+  zone_.reset(new Zone(allocator_, ZONE_NAME));
+}
+
+template <class Character>
+int ExperimentalDfa::Scan(Vector<const Character> input, int from, int to,
+                          const InterruptHandler<Character>& handle_interrupts,
+                          int* match) {
+  if (direction_ == kForward) {
+    DCHECK_LE(from, to);
+    return ScanImpl<Character, kForward>(input, from, to, handle_interrupts,
+                                         match);
+  }
+  DCHECK_GE(from, to);
+  return ScanImpl<Character, kBackward>(input, from, to, handle_interrupts,
+                                        match);
+}
+
+template <class Character, ExperimentalDfa::Direction direction>
+int ExperimentalDfa::ScanImpl(
+    Vector<const Character> input, int from, int to,
+    const InterruptHandler<Character>& handle_interrupts, int* match) {
+  constexpr bool kForwardScan = direction == kForward;
+  constexpr int kStep = kForwardScan ? 1 : -1;
+  auto context_before = [&](int position) {
+    return position == 0 ? kInputBoundary
+                         : ContextClassOf(input[position - 1]);
+  };
+  auto context_after = [&](int position) {
+    return position == input.length() ? kInputBoundary
+                                      : ContextClassOf(input[position]);
+  };
+
+  *match = kNoMatch;
+  reset_position_ = from;
+  const int start_pc = kForwardScan ? 0 : accept_pc_;
+  const ContextClass start_context =
+      kForwardScan ? context_before(from) : context_after(from);
+  State* state = Lookup(&start_pc, 1, start_context, false);
+  if (state == nullptr) {
+    FlushCache();
+    state = Lookup(&start_pc, 1, start_context, false);
+    if (state == nullptr) {
+      *match = kCacheExhausted;
+      return RegExp::kInternalRegExpSuccess;
+    }
+  }
+
+  int position = from;
+  int ticks_until_interrupt_check = kCharactersBetweenInterruptChecks;
+  while (position != to) {
+    if (--ticks_until_interrupt_check == 0) {
+      ticks_until_interrupt_check = kCharactersBetweenInterruptChecks;
+      int err_code = handle_interrupts(&input);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+    }
+
+    const uc16 c = kForwardScan ? input[position] : input[position - 1];
+    State* next = state->next[CharacterClassOf(c)];
+    if (next == nullptr) {
+      next = ComputeNext(state, c, position);
+      if (next == nullptr) {
+        *match = kCacheExhausted;
+        return RegExp::kInternalRegExpSuccess;
+      }
+    }
+    state = next;
+    if (state->matched) *match = position;
+    position += kStep;
+    if (state->pc_count == 0) return RegExp::kInternalRegExpSuccess;
+  }
+  const ContextClass end_context =
+      kForwardScan ? context_after(to) : context_before(to);
+  if (MatchesAtEnd(state, end_context)) *match = to;
+  return RegExp::kInternalRegExpSuccess;
+}
+
+template int ExperimentalDfa::Scan(
+    Vector<const uint8_t> input, int from, int to,
+    const InterruptHandler<uint8_t>& handle_interrupts, int* match);
+template int ExperimentalDfa::Scan(
+    Vector<const uc16> input, int from, int to,
+    const InterruptHandler<uc16>& handle_interrupts, int* match);
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,192 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+
+#include <functional>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/utils/vector.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+// A deterministic finite automaton (dfa) for experimental regexp bytecode
+// that is built lazily during matching, in the style of re2's DFA class.
+// Background: https://swtch.com/~rsc/regexp/regexp3.html
+//
+// A dfa state stands for the set of nfa threads that `NfaInterpreter` would
+// have at some input position, minus their registers.  Transitions are
+// computed on first use and then cached, so that each input character costs
+// a table lookup instead of a step of every thread.  Since threads lose their
+// registers, the dfa can only compute the boundaries of a match:
+// - Running forward from the start of the search, it finds where the match
+//   that `NfaInterpreter` would report ends.  States keep the threads in
+//   priority order and drop lower-priority threads after an ACCEPT, just like
+//   the interpreter, so this is the end of the highest-priority match and
+//   not just of some match.
+// - Running backward from that end, it finds where the match begins, namely
+//   at the smallest position from which the program can reach the end.
+//   Order doesn't matter here, so backward states are sets of pcs.
+// Assertions depend on the characters around the current position.  States
+// therefore record the class (see `ContextClass`) of the character behind
+// them, and transitions look at the class of the character ahead.
+//
+// The states live in a zone with a fixed budget.  Once the budget is spent,
+// the cache is flushed and rebuilt from the current state.  If that happens
+// too often relative to the amount of input processed, the dfa gives up, and
+// callers should fall back to the nfa.
+class ExperimentalDfa {
+ public:
+  enum Direction { kForward, kBackward };
+
+  // Results of `Scan` besides match positions.
+  static constexpr int kNoMatch = -1;
+  static constexpr int kCacheExhausted = -2;
+
+  // Used to handle interrupts during long scans.  Returns
+  // RegExp::kInternalRegExpSuccess if the scan can continue, or an error code
+  // otherwise, and updates the input in case the string was moved.
+  template <class Character>
+  using InterruptHandler = std::function<int(Vector<const Character>*)>;
+
+  ExperimentalDfa(Vector<const RegExpInstruction> bytecode,
+                  Direction direction, AccountingAllocator* allocator,
+                  size_t cache_size);
+  ExperimentalDfa(const ExperimentalDfa&) = delete;
+  ExperimentalDfa& operator=(const ExperimentalDfa&) = delete;
+
+  // Whether matches found by the forward dfa begin at the start of the scan,
+  // i.e. the program is sticky or anchored at the start of the input.
+  bool IsAnchored() const { return begin_pc_ == 0; }
+
+  // Scans `input` from `from` towards `to`, which must not be smaller than
+  // `from` for forward scans and not larger for backward scans.  Sets `match`
+  // to the end (forward) or the beginning (backward) of the match, or to
+  // kNoMatch or kCacheExhausted.  Backward scans must start at the end of a
+  // match.  Returns RegExp::kInternalRegExpSuccess or the error code of
+  // `handle_interrupts`.
+  template <class Character>
+  int Scan(Vector<const Character> input, int from, int to,
+           const InterruptHandler<Character>& handle_interrupts, int* match);
+
+ private:
+  // The information about a character that assertions need.
+  enum ContextClass : uint8_t {
+    kInputBoundary,
+    kLineTerminator,
+    kWordCharacter,
+    kOtherCharacter,
+    kContextClassCount
+  };
+
+  struct State {
+    // Forward: the pcs at which threads continue, highest priority first.
+    // Backward: the sorted pcs from which the end can be reached.
+    int* pcs;
+    int pc_count;
+    // The class of the character before (forward) or after (backward) the
+    // position of this state.
+    ContextClass context;
+    // Whether the transition into this state found a match at the previous
+    // position.
+    bool matched;
+    // The successor for each character class, or nullptr if not yet known.
+    State** next;
+    // Whether there is a match at this position if the input ends here,
+    // indexed by the class of the character beyond the end of the scan:
+    // 0 or 1, or -1 if not yet known.
+    int8_t matches_at_end[kContextClassCount];
+  };
+
+  struct StateHash {
+    size_t operator()(const State* state) const;
+  };
+  struct StateEqual {
+    bool operator()(const State* a, const State* b) const;
+  };
+
+  template <class Character, Direction direction>
+  int ScanImpl(Vector<const Character> input, int from, int to,
+               const InterruptHandler<Character>& handle_interrupts,
+               int* match);
+
+  static ContextClass ContextClassOf(uc16 c);
+  int CharacterClassOf(uc16 c) const {
+    if (c < kCharacterClassTableSize) return character_class_table_[c];
+    return CharacterClassOfSlow(c);
+  }
+  int CharacterClassOfSlow(uc16 c) const;
+
+  // Computes the threads at the current position, which lies between
+  // characters of classes `before` and `after`, starting from the threads in
+  // `state`.  Writes the pcs of threads that consume a character to
+  // `closure_`, and returns whether a thread reached the end of the program
+  // (ACCEPT forward, the begin pc backward).
+  bool ComputeClosure(const State* state, ContextClass before,
+                      ContextClass after);
+  bool ComputeForwardClosure(const State* state, ContextClass before,
+                             ContextClass after);
+  bool ComputeBackwardClosure(const State* state, ContextClass before,
+                              ContextClass after);
+  bool SatisfiesAssertion(int pc, ContextClass before,
+                          ContextClass after) const;
+
+  // Computes and caches the successor of `state` on `c`.  Returns nullptr if
+  // the cache had to be flushed too often.  `position` is only used to
+  // decide that.  Invalidates all states other than the result if the cache
+  // is flushed.
+  State* ComputeNext(State* state, uc16 c, int position);
+  bool MatchesAtEnd(State* state, ContextClass beyond);
+
+  // Returns the cached state with the given contents, creating it if needed.
+  // Returns nullptr if the cache is full.
+  State* Lookup(const int* pcs, int pc_count, ContextClass context,
+                bool matched);
+  void FlushCache();
+
+  static constexpr int kCharacterClassTableSize = 256;
+
+  // The program, copied so that the dfa is independent of the gc.
+  std::vector<RegExpInstruction> bytecode_;
+  const Direction direction_;
+  // The pc that starts the match, i.e. the one that sets register 0.
+  int begin_pc_;
+  int accept_pc_;
+
+  // The program's epsilon transitions reversed, for backward closures.  The
+  // predecessors of pc are predecessors_[predecessor_offsets_[pc]] up to
+  // predecessors_[predecessor_offsets_[pc + 1]].
+  std::vector<int> predecessor_offsets_;
+  std::vector<int> predecessors_;
+
+  // Characters are grouped into classes that no instruction distinguishes.
+  // Class i consists of the characters in [class_starts_[i - 1],
+  // class_starts_[i]), where class_starts_[-1] is 0.
+  std::vector<int> class_starts_;
+  uint16_t character_class_table_[kCharacterClassTableSize];
+  int character_class_count_;
+
+  // Scratch space for closures.
+  std::vector<int> closure_;
+  std::vector<int> worklist_;
+  std::vector<int> visited_;
+  int visited_generation_ = 0;
+
+  AccountingAllocator* const allocator_;
+  const size_t cache_size_;
+  std::unique_ptr<Zone> zone_;
+  std::unordered_set<State*, StateHash, StateEqual> states_;
+  int reset_position_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
@@ -7,6 +7,7 @@
 #include "src/base/optional.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -19,6 +20,10 @@ namespace {
 
 constexpr int kUndefinedRegisterValue = -1;
 
+// Below this many characters, building dfa states is about as expensive as
+// running the nfa.
+constexpr int kMinInputLengthForDfa = 64;
+
 template <class Character>
 bool SatisfiesAssertion(RegExpAssertion::AssertionType type,
                         Vector<const Character> context, int position) {
@@ -132,6 +137,11 @@ class NfaInterpreter {
   // the search continues with the threads with higher priority.  If no threads
   // with high priority are left, we return the match that was produced by the
   // ACCEPTing thread with highest priority.
+  //
+  // With --experimental-regexp-engine-dfa, the interpreter first finds the
+  // boundaries of the next match with an `ExperimentalDfa`. The nfa then only
+  // has to run over the match to compute its captures, and not at all if
+  // there are no captures.
  public:
   NfaInterpreter(Isolate* isolate, RegExp::CallOrigin call_origin,
                  ByteArray bytecode, int register_count_per_match, String input,
@@ -156,6 +166,13 @@ class NfaInterpreter {
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+
+    if (FLAG_experimental_regexp_engine_dfa &&
+        input_.length() - input_index_ >= kMinInputLengthForDfa) {
+      forward_dfa_.emplace(bytecode_, ExperimentalDfa::kForward,
+                           zone->allocator(),
+                           FLAG_experimental_regexp_engine_dfa_cache_size * KB);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -168,7 +185,8 @@ class NfaInterpreter {
 
     int match_num = 0;
     while (match_num != max_match_num) {
-      int err_code = FindNextMatch();
+      int err_code =
+          forward_dfa_.has_value() ? FindNextMatchWithDfa() : FindNextMatch();
       if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
 
       if (!FoundMatch()) break;
@@ -320,10 +338,7 @@ class NfaInterpreter {
     }
     active_threads_.DropAndClear();
 
-    if (best_match_registers_.has_value()) {
-      FreeRegisterArray(best_match_registers_->begin());
-      best_match_registers_ = base::nullopt;
-    }
+    ClearBestMatch();
 
     // All threads start at bytecode 0.
     active_threads_.Add(
@@ -361,6 +376,66 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Like `FindNextMatch`, but finds the boundaries of the match with the dfa
+  // first.  Switches to the nfa for good if the dfa's cache is exhausted.
+  int FindNextMatchWithDfa() {
+    const ExperimentalDfa::InterruptHandler<Character> handle_interrupts =
+        [this](Vector<const Character>* input) {
+          int err_code = HandleInterrupts();
+          *input = input_;
+          return err_code;
+        };
+
+    int match_end;
+    int err_code = forward_dfa_->Scan(input_, input_index_, input_.length(),
+                                      handle_interrupts, &match_end);
+    if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+    if (match_end == ExperimentalDfa::kCacheExhausted) {
+      forward_dfa_.reset();
+      return FindNextMatch();
+    }
+    if (match_end == ExperimentalDfa::kNoMatch) {
+      ClearBestMatch();
+      return RegExp::kInternalRegExpSuccess;
+    }
+
+    int match_begin = input_index_;
+    if (!forward_dfa_->IsAnchored()) {
+      if (!backward_dfa_.has_value()) {
+        backward_dfa_.emplace(
+            bytecode_, ExperimentalDfa::kBackward, zone_->allocator(),
+            FLAG_experimental_regexp_engine_dfa_cache_size * KB);
+      }
+      err_code = backward_dfa_->Scan(input_, match_end, input_index_,
+                                     handle_interrupts, &match_begin);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (match_begin == ExperimentalDfa::kCacheExhausted) {
+        forward_dfa_.reset();
+        return FindNextMatch();
+      }
+    }
+    DCHECK_GE(match_begin, input_index_);
+    DCHECK_LE(match_begin, match_end);
+
+    if (register_count_per_match_ == 2) {
+      ClearBestMatch();
+      int* registers = NewRegisterArrayUninitialized();
+      registers[0] = match_begin;
+      registers[1] = match_end;
+      best_match_registers_ = Vector<int>(registers, 2);
+      return RegExp::kInternalRegExpSuccess;
+    }
+
+    // No thread starting before `match_begin` can match, so the nfa finds
+    // the same match when starting there.
+    SetInputIndex(match_begin);
+    err_code = FindNextMatch();
+    DCHECK_IMPLIES(err_code == RegExp::kInternalRegExpSuccess,
+                   FoundMatch() && (*best_match_registers_)[0] == match_begin &&
+                       (*best_match_registers_)[1] == match_end);
+    return err_code;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -459,6 +534,13 @@ class NfaInterpreter {
 
   bool FoundMatch() const { return best_match_registers_.has_value(); }
 
+  void ClearBestMatch() {
+    if (best_match_registers_.has_value()) {
+      FreeRegisterArray(best_match_registers_->begin());
+      best_match_registers_ = base::nullopt;
+    }
+  }
+
   Vector<int> GetRegisterArray(InterpreterThread t) {
     return Vector<int>(t.register_array_begin, register_count_per_match_);
   }
@@ -548,6 +630,10 @@ class NfaInterpreter {
   // `register_array_allocator_`.
   base::Optional<Vector<int>> best_match_registers_;
 
+  // The dfas that find the end and the beginning of matches, if enabled.
+  base::Optional<ExperimentalDfa> forward_dfa_;
+  base::Optional<ExperimentalDfa> backward_dfa_;
+
   Zone* zone_;
 };
 
@@ -0,0 +1,29 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-jit.h"
+
+namespace v8 {
+namespace internal {
+
+// The code generators live in the architecture-specific directories.
+#if !V8_TARGET_ARCH_X64
+
+bool ExperimentalRegExpJit::CanCompile(Vector<const RegExpInstruction> bytecode,
+                                       int register_count_per_match) {
+  return false;
+}
+
+Handle<Code> ExperimentalRegExpJit::Compile(Isolate* isolate,
+                                            Handle<ByteArray> bytecode,
+                                            int register_count_per_match,
+                                            bool is_one_byte,
+                                            Handle<String> source) {
+  UNREACHABLE();
+}
+
+#endif  // !V8_TARGET_ARCH_X64
+
+}  // namespace internal
+}  // namespace v8
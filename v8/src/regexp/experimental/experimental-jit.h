@@ -0,0 +1,49 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_JIT_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_JIT_H_
+
+#include "src/handles/handles.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class Code;
+class String;
+
+// Compiles experimental regexp bytecode to native code that runs the same
+// breadth-first simulation as `NfaInterpreter`, without the dfa.  The
+// generated code has the signature of native irregexp code (see
+// `NativeRegExpMacroAssembler::Execute`), so it can be installed in the code
+// fields of the regexp and is called directly from JavaScript.  Currently only
+// implemented on x64.
+//
+// Instead of lists of threads with heap-allocated register arrays, the code
+// keeps one register array per CONSUME_RANGE instruction and input parity in
+// its stack frame: at most one thread can block at each such instruction per
+// input position.  Blocked threads are represented by the address of a stub
+// that checks the next character and resumes the thread, and the code of each
+// instruction copies registers with unrolled moves.
+class ExperimentalRegExpJit final : public AllStatic {
+ public:
+  // Whether `bytecode` can be compiled to native code on this platform.
+  // Programs whose frame would be too large are left to the interpreter.
+  static bool CanCompile(Vector<const RegExpInstruction> bytecode,
+                         int register_count_per_match);
+
+  // Compiles the bytecode for one-byte or two-byte subjects.  `source` is only
+  // used for logging.
+  static Handle<Code> Compile(Isolate* isolate, Handle<ByteArray> bytecode,
+                              int register_count_per_match, bool is_one_byte,
+                              Handle<String> source);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_JIT_H_
@@ -7,6 +7,8 @@
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental-compiler.h"
 #include "src/regexp/experimental/experimental-interpreter.h"
+#include "src/regexp/experimental/experimental-jit.h"
+#include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/utils/ostreams.h"
 
@@ -55,6 +57,14 @@ Handle<ByteArray> VectorToByteArray(Isolate* isolate, Vector<T> data) {
   return byte_array;
 }
 
+Vector<RegExpInstruction> AsInstructionSequence(ByteArray raw_bytes) {
+  RegExpInstruction* inst_begin =
+      reinterpret_cast<RegExpInstruction*>(raw_bytes.GetDataStartAddress());
+  int inst_num = raw_bytes.length() / sizeof(RegExpInstruction);
+  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes.length());
+  return Vector<RegExpInstruction>(inst_begin, inst_num);
+}
+
 namespace {
 
 struct CompilationResult {
@@ -127,18 +137,61 @@ bool ExperimentalRegExp::Compile(Isolate* isolate, Handle<JSRegExp> re) {
 
   re->SetCaptureNameMap(compilation_result->capture_name_map);
 
+  // Regexps that can be compiled to native code tier up like irregexps.
+  // Their tier-up ticks are left uninitialized otherwise.
+  bool can_compile_native;
+  {
+    DisallowHeapAllocation no_gc;
+    can_compile_native =
+        FLAG_experimental_regexp_engine_jit &&
+        ExperimentalRegExpJit::CanCompile(
+            AsInstructionSequence(*compilation_result->bytecode),
+            JSRegExp::RegistersForCaptureCount(re->CaptureCount()));
+  }
+  if (can_compile_native) {
+    re->SetDataAt(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                  Smi::FromInt(FLAG_regexp_tier_up_ticks));
+  }
+
   return true;
 }
 
-Vector<RegExpInstruction> AsInstructionSequence(ByteArray raw_bytes) {
-  RegExpInstruction* inst_begin =
-      reinterpret_cast<RegExpInstruction*>(raw_bytes.GetDataStartAddress());
-  int inst_num = raw_bytes.length() / sizeof(RegExpInstruction);
-  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes.length());
-  return Vector<RegExpInstruction>(inst_begin, inst_num);
+namespace {
+
+bool CanCompileNative(JSRegExp regexp) {
+  return regexp.DataAt(JSRegExp::kIrregexpTicksUntilTierUpIndex) !=
+         Smi::FromInt(JSRegExp::kUninitializedValue);
 }
 
-namespace {
+// Native code is compiled once the regexp is marked for tier-up, or right
+// away if tier-up is disabled.
+bool ShouldCompileNative(JSRegExp regexp) {
+  if (!CanCompileNative(regexp)) return false;
+  return !FLAG_regexp_tier_up || regexp.MarkedForTierUp();
+}
+
+// Until then, the code fields hold the trampoline to the interpreter.
+bool HasNativeCode(JSRegExp regexp, bool is_one_byte) {
+  return Code::cast(regexp.Code(is_one_byte)).kind() == CodeKind::REGEXP;
+}
+
+void CompileNative(Isolate* isolate, Handle<JSRegExp> regexp,
+                   bool is_one_byte) {
+  if (FLAG_trace_experimental_regexp_engine || FLAG_trace_regexp_tier_up) {
+    StdoutStream{} << "Compiling experimental regexp " << regexp->Pattern()
+                   << " to native code for "
+                   << (is_one_byte ? "one-byte" : "two-byte") << " subjects"
+                   << std::endl;
+  }
+  Handle<ByteArray> bytecode(
+      ByteArray::cast(regexp->DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex)),
+      isolate);
+  Handle<Code> code = ExperimentalRegExpJit::Compile(
+      isolate, bytecode,
+      JSRegExp::RegistersForCaptureCount(regexp->CaptureCount()), is_one_byte,
+      handle(regexp->Pattern(), isolate));
+  regexp->SetDataAt(JSRegExp::code_index(is_one_byte), *code);
+}
 
 int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
                     ByteArray bytecode, String subject, int capture_count,
@@ -181,6 +234,8 @@ int32_t ExperimentalRegExp::ExecRaw(Isolate* isolate,
   ByteArray bytecode =
       ByteArray::cast(regexp.DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex));
 
+  if (regexp.CanTierUp()) regexp.TierUpTick();
+
   return ExecRawImpl(isolate, call_origin, bytecode, subject,
                      regexp.CaptureCount(), output_registers,
                      output_register_count, subject_index);
@@ -205,10 +260,42 @@ int32_t ExperimentalRegExp::MatchForCallFromJs(
 
   JSRegExp regexp_obj = JSRegExp::cast(Object(regexp));
 
+  if (ShouldCompileNative(regexp_obj)) {
+    // Returning RETRY will re-enter through runtime, where the regexp is
+    // compiled to native code.
+    return RegExp::kInternalRegExpRetry;
+  }
+
   return ExecRaw(isolate, RegExp::kFromJs, regexp_obj, subject_string,
                  output_registers, output_register_count, start_position);
 }
 
+int32_t ExperimentalRegExp::ExecRawFromRuntime(Isolate* isolate,
+                                               Handle<JSRegExp> regexp,
+                                               Handle<String> subject,
+                                               int32_t* output_registers,
+                                               int32_t output_register_count,
+                                               int32_t subject_index) {
+  DCHECK(subject->IsFlat());
+  bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
+  if (!HasNativeCode(*regexp, is_one_byte) && ShouldCompileNative(*regexp)) {
+    CompileNative(isolate, regexp, is_one_byte);
+  }
+
+  if (HasNativeCode(*regexp, is_one_byte)) {
+    int32_t result = NativeRegExpMacroAssembler::Match(
+        regexp, subject, output_registers, output_register_count,
+        subject_index, isolate);
+    // Native code returns RETRY when it hits the stack limit, and leaves
+    // interrupts and stack overflows to the interpreter.
+    if (result != RegExp::kInternalRegExpRetry) return result;
+  }
+
+  DisallowHeapAllocation no_gc;
+  return ExecRaw(isolate, RegExp::kFromRuntime, *regexp, *subject,
+                 output_registers, output_register_count, subject_index);
+}
+
 MaybeHandle<Object> ExperimentalRegExp::Exec(
     Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
     int subject_index, Handle<RegExpMatchInfo> last_match_info) {
@@ -239,9 +326,15 @@ MaybeHandle<Object> ExperimentalRegExp::Exec(
     output_registers_release.reset(output_registers);
   }
 
+  // As for irregexps, tier up eagerly for long subjects.
+  if (regexp->CanTierUp() &&
+      subject->length() >= JSRegExp::kTierUpForSubjectLengthValue) {
+    regexp->MarkTierUpForNextExec();
+  }
+
   int num_matches =
-      ExecRaw(isolate, RegExp::kFromRuntime, *regexp, *subject,
-              output_registers, output_register_count, subject_index);
+      ExecRawFromRuntime(isolate, regexp, subject, output_registers,
+                         output_register_count, subject_index);
 
   if (num_matches > 0) {
     DCHECK_EQ(num_matches, 1);
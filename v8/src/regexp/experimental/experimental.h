@@ -43,6 +43,14 @@ class ExperimentalRegExp final : public AllStatic {
                          JSRegExp regexp, String subject,
                          int32_t* output_registers,
                          int32_t output_register_count, int32_t subject_index);
+  // Like `ExecRaw` from the runtime, but runs native code for the encoding of
+  // `subject` if there is any, and compiles it first if the regexp is due for
+  // tier-up.
+  static int32_t ExecRawFromRuntime(Isolate* isolate, Handle<JSRegExp> regexp,
+                                    Handle<String> subject,
+                                    int32_t* output_registers,
+                                    int32_t output_register_count,
+                                    int32_t subject_index);
 
   // Compile and execute a regexp with the experimental engine, regardless of
   // its type tag.  The regexp itself is not changed (apart from lastIndex).
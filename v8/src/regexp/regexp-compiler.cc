@@ -8,6 +8,7 @@
 #include "src/execution/isolate.h"
 #include "src/objects/objects-inl.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
+#include "src/regexp/regexp-prefilter.h"
 #ifdef V8_INTL_SUPPORT
 #include "src/regexp/special-case.h"
 #endif  // V8_INTL_SUPPORT
@@ -253,6 +254,8 @@ RegExpCompiler::RegExpCompiler(Isolate* isolate, Zone* zone, int capture_count,
       read_backward_(false),
       current_expansion_factor_(1),
       frequency_collator_(),
+      unanchored_loop_(nullptr),
+      prefilter_(nullptr),
       isolate_(isolate),
       zone_(zone) {
   accept_ = zone->New<EndNode>(EndNode::ACCEPT, zone);
@@ -3148,14 +3151,23 @@ int ChoiceNode::EmitOptimizedUnanchoredSearch(RegExpCompiler* compiler,
   // and step forwards 3 if the character is not one of abc.  Abc need
   // not be atoms, they can be any reasonably limited character class or
   // small alternation.
+  //
+  // If this is the loop prepended to the whole regexp and all matches start
+  // with one of a set of literals, the macro assembler may search for them
+  // directly instead.
   BoyerMooreLookahead* bm = bm_info(false);
   if (bm == nullptr) {
     eats_at_least = Min(kMaxLookaheadForBoyerMoore, EatsAtLeast(false));
-    if (eats_at_least >= 1) {
-      bm = zone()->New<BoyerMooreLookahead>(eats_at_least, compiler, zone());
-      GuardedAlternative alt0 = alternatives_->at(0);
-      alt0.node()->FillInBMInfo(isolate, 0, kRecursionBudget, bm, false);
-    }
+  }
+  if (this == compiler->unanchored_loop() &&
+      compiler->prefilter() != nullptr &&
+      macro_assembler->AdvanceToPrefilterCandidate(compiler->prefilter())) {
+    return eats_at_least;
+  }
+  if (bm == nullptr && eats_at_least >= 1) {
+    bm = zone()->New<BoyerMooreLookahead>(eats_at_least, compiler, zone());
+    GuardedAlternative alt0 = alternatives_->at(0);
+    alt0.node()->FillInBMInfo(isolate, 0, kRecursionBudget, bm, false);
   }
   if (bm != nullptr) {
     bm->EmitSkipInstructions(macro_assembler);
@@ -3832,6 +3844,14 @@ RegExpNode* RegExpCompiler::OptionallyStepBackToLeadSurrogate(
 RegExpNode* RegExpCompiler::PreprocessRegExp(RegExpCompileData* data,
                                              JSRegExp::Flags flags,
                                              bool is_one_byte) {
+  // Collect the literals before the tree is rewritten by ToNode.
+  RegExpPrefilter* prefilter = nullptr;
+  if (FLAG_regexp_prefilter && !data->tree->IsAnchoredAtStart() &&
+      !IsSticky(flags)) {
+    prefilter =
+        RegExpPrefilter::Create(data->tree, flags, is_one_byte, zone());
+  }
+
   // Wrap the body of the regexp in capture #0.
   RegExpNode* captured_body =
       RegExpCapture::ToNode(data->tree, 0, this, accept());
@@ -3844,6 +3864,8 @@ RegExpNode* RegExpCompiler::PreprocessRegExp(RegExpCompileData* data,
         0, RegExpTree::kInfinity, false,
         zone()->New<RegExpCharacterClass>('*', default_flags), this,
         captured_body, data->contains_anchor);
+    unanchored_loop_ = loop_node;
+    prefilter_ = prefilter;
 
     if (data->contains_anchor) {
       // Unroll loop once, to take care of the case that might start
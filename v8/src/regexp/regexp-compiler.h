@@ -15,6 +15,7 @@ namespace internal {
 
 class DynamicBitSet;
 class Isolate;
+class RegExpPrefilter;
 
 namespace regexp_compiler_constants {
 
@@ -573,6 +574,11 @@ class RegExpCompiler {
   Isolate* isolate() const { return isolate_; }
   Zone* zone() const { return zone_; }
 
+  // The loop that PreprocessRegExp prepends to unanchored regexps, and the
+  // literals that matches start with, if any.
+  RegExpNode* unanchored_loop() const { return unanchored_loop_; }
+  RegExpPrefilter* prefilter() const { return prefilter_; }
+
   static const int kNoRegister = -1;
 
  private:
@@ -590,6 +596,8 @@ class RegExpCompiler {
   bool read_backward_;
   int current_expansion_factor_;
   FrequencyCollator frequency_collator_;
+  RegExpNode* unanchored_loop_;
+  RegExpPrefilter* prefilter_;
   Isolate* isolate_;
   Zone* zone_;
 };
@@ -6,6 +6,7 @@
 
 #include "src/ast/ast.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-prefilter.h"
 
 namespace v8 {
 namespace internal {
@@ -381,6 +382,15 @@ bool RegExpMacroAssemblerTracer::CheckSpecialCharacterClass(
 }
 
 
+bool RegExpMacroAssemblerTracer::AdvanceToPrefilterCandidate(
+    RegExpPrefilter* prefilter) {
+  bool supported = assembler_->AdvanceToPrefilterCandidate(prefilter);
+  PrintF(" AdvanceToPrefilterCandidate(literals=%d): %s;\n",
+         prefilter->literal_count(), supported ? "true" : "false");
+  return supported;
+}
+
+
 void RegExpMacroAssemblerTracer::IfRegisterLT(int register_index,
                                               int comparand, Label* if_lt) {
   PrintF(" IfRegisterLT(register=%d, number=%d, label[%08x]);\n",
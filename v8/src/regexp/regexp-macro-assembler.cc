@@ -134,6 +134,11 @@ bool RegExpMacroAssembler::CheckSpecialCharacterClass(uc16 type,
   return false;
 }
 
+bool RegExpMacroAssembler::AdvanceToPrefilterCandidate(
+    RegExpPrefilter* prefilter) {
+  return false;
+}
+
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
                                                        Zone* zone)
     : RegExpMacroAssembler(isolate, zone) {}
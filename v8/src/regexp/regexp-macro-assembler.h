@@ -19,6 +19,8 @@ static const uc32 kTrailSurrogateEnd = 0xdfff;
 static const uc32 kNonBmpStart = 0x10000;
 static const uc32 kNonBmpEnd = 0x10ffff;
 
+class RegExpPrefilter;
+
 struct DisjunctDecisionRow {
   RegExpCharacterClass cc;
   Label* on_match;
@@ -123,6 +125,11 @@ class RegExpMacroAssembler {
   // not have custom support.
   // May clobber the current loaded character.
   virtual bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match);
+  // Advances the current position to the next position at which one of the
+  // literals of the prefilter starts, or to the end of the input if there is
+  // none. Returns false, without emitting code, if this is not supported.
+  // May clobber the current loaded character.
+  virtual bool AdvanceToPrefilterCandidate(RegExpPrefilter* prefilter);
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
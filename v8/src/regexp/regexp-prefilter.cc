@@ -0,0 +1,525 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-prefilter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/base/bits.h"
+#include "src/base/memory.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/regexp/regexp-compiler.h"
+#include "src/utils/simd-dispatch.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const int kMaxKeyLength = RegExpPrefilter::kMaxKeyLength;
+
+// Larger sets are rarely selective, and their tables get large.
+const size_t kMaxLiteralCount = 4096;
+// Boyer-Moore lookahead already does well on two alternatives.
+const size_t kMinLiteralCount = 3;
+// Character classes like [Ee] expand to one literal per character.
+const int kMaxClassSize = 4;
+const int kMaxDepth = 32;
+
+// Teddy assigns the literals to 8 buckets and checks the nibbles of up to 3
+// characters per position. With more literals, most positions pass.
+const int kMaxTeddyLength = 3;
+const int kMaxTeddyLiteralCount = 64;
+const int kTeddyBucketCount = 8;
+
+// The hashed bitset has about 16 bits per literal.
+const uint32_t kMinFilterBits = 512;
+const uint32_t kMaxFilterBits = 1 << 16;
+const int kFilterBitsPerLiteral = 16;
+
+// Strings that every match of a subexpression starts with one of. If
+// `exact`, every match is one of the strings.
+struct Prefixes {
+  explicit Prefixes(Zone* zone) : strings(zone) {}
+  ZoneVector<Vector<const uc16>> strings;
+  bool exact = true;
+};
+
+class PrefixCollector {
+ public:
+  explicit PrefixCollector(Zone* zone) : zone_(zone) {}
+
+  // Returns false if a match of `tree` may start with any character, or if
+  // there are too many prefixes.
+  bool Collect(RegExpTree* tree, int depth, Prefixes* result);
+
+ private:
+  // Appends the prefixes of `tree`, which follows the exact prefixes in
+  // `prefixes` in a sequence. Returns false if the rest of the sequence
+  // cannot add to the prefixes.
+  bool Append(RegExpTree* tree, int depth, Prefixes* prefixes);
+
+  void AddEmpty(Prefixes* result, bool exact) {
+    result->strings.push_back(Vector<const uc16>());
+    result->exact = exact;
+  }
+
+  Zone* zone_;
+};
+
+bool PrefixCollector::Collect(RegExpTree* tree, int depth, Prefixes* result) {
+  DCHECK(result->strings.empty());
+  if (depth > kMaxDepth) return false;
+
+  if (tree->IsAtom()) {
+    RegExpAtom* atom = tree->AsAtom();
+    if (atom->ignore_case()) return false;
+    int length = std::min(atom->length(), kMaxKeyLength);
+    result->strings.push_back(atom->data().SubVector(0, length));
+    result->exact = length == atom->length();
+    return true;
+  }
+
+  if (tree->IsCharacterClass()) {
+    RegExpCharacterClass* char_class = tree->AsCharacterClass();
+    if (char_class->is_negated() || IgnoreCase(char_class->flags())) {
+      return false;
+    }
+    ZoneList<CharacterRange>* ranges = char_class->ranges(zone_);
+    int size = 0;
+    for (int i = 0; i < ranges->length(); i++) {
+      CharacterRange range = ranges->at(i);
+      if (range.to() > String::kMaxUtf16CodeUnit) return false;
+      size += range.to() - range.from() + 1;
+      if (size > kMaxClassSize) return false;
+    }
+    for (int i = 0; i < ranges->length(); i++) {
+      CharacterRange range = ranges->at(i);
+      for (uc32 c = range.from(); c <= range.to(); c++) {
+        uc16* string = zone_->NewArray<uc16>(1);
+        string[0] = static_cast<uc16>(c);
+        result->strings.push_back(Vector<const uc16>(string, 1));
+      }
+    }
+    result->exact = true;
+    return true;
+  }
+
+  if (tree->IsText()) {
+    AddEmpty(result, true);
+    ZoneList<TextElement>* elements = tree->AsText()->elements();
+    for (int i = 0; i < elements->length(); i++) {
+      if (!Append(elements->at(i).tree(), depth + 1, result)) break;
+    }
+    return true;
+  }
+
+  if (tree->IsAlternative()) {
+    AddEmpty(result, true);
+    ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    for (int i = 0; i < nodes->length(); i++) {
+      if (!Append(nodes->at(i), depth + 1, result)) break;
+    }
+    return true;
+  }
+
+  if (tree->IsDisjunction()) {
+    ZoneList<RegExpTree*>* alternatives = tree->AsDisjunction()->alternatives();
+    result->exact = true;
+    for (int i = 0; i < alternatives->length(); i++) {
+      Prefixes alternative(zone_);
+      if (!Collect(alternatives->at(i), depth + 1, &alternative)) return false;
+      if (result->strings.size() + alternative.strings.size() >
+          kMaxLiteralCount) {
+        return false;
+      }
+      result->strings.insert(result->strings.end(),
+                             alternative.strings.begin(),
+                             alternative.strings.end());
+      result->exact &= alternative.exact;
+    }
+    return true;
+  }
+
+  if (tree->IsCapture()) {
+    return Collect(tree->AsCapture()->body(), depth + 1, result);
+  }
+
+  if (tree->IsGroup()) {
+    return Collect(tree->AsGroup()->body(), depth + 1, result);
+  }
+
+  if (tree->IsQuantifier()) {
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() == 0) {
+      AddEmpty(result, false);
+      return true;
+    }
+    if (!Collect(quantifier->body(), depth + 1, result)) return false;
+    if (quantifier->max() != 1) result->exact = false;
+    return true;
+  }
+
+  // Assertions and lookarounds don't consume any characters.
+  if (tree->IsAssertion() || tree->IsLookaround() || tree->IsEmpty()) {
+    AddEmpty(result, true);
+    return true;
+  }
+
+  // Back references may match anything.
+  DCHECK(tree->IsBackReference());
+  return false;
+}
+
+bool PrefixCollector::Append(RegExpTree* tree, int depth,
+                             Prefixes* prefixes) {
+  DCHECK(prefixes->exact);
+  bool all_complete = std::all_of(
+      prefixes->strings.begin(), prefixes->strings.end(),
+      [](Vector<const uc16> string) {
+        return string.length() == kMaxKeyLength;
+      });
+  Prefixes next(zone_);
+  if (all_complete || !Collect(tree, depth, &next) ||
+      prefixes->strings.size() * next.strings.size() > kMaxLiteralCount) {
+    prefixes->exact = false;
+    return false;
+  }
+
+  bool truncated = false;
+  ZoneVector<Vector<const uc16>> product(zone_);
+  product.reserve(prefixes->strings.size() * next.strings.size());
+  for (Vector<const uc16> head : prefixes->strings) {
+    for (Vector<const uc16> tail : next.strings) {
+      int length = std::min(head.length() + tail.length(),
+                            kMaxKeyLength);
+      if (length == head.length() || tail.length() == 0) {
+        truncated |= tail.length() != 0;
+        product.push_back(head);
+        continue;
+      }
+      truncated |= length < head.length() + tail.length();
+      uc16* string = zone_->NewArray<uc16>(length);
+      std::copy(head.begin(), head.end(), string);
+      std::copy(tail.begin(), tail.begin() + (length - head.length()),
+                string + head.length());
+      product.push_back(Vector<const uc16>(string, length));
+    }
+  }
+  prefixes->strings = std::move(product);
+  prefixes->exact = next.exact && !truncated;
+  return prefixes->exact;
+}
+
+bool LiteralLess(Vector<const uc16> a, Vector<const uc16> b) {
+  return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+
+// The first key_length characters of a literal or subject position, in the
+// byte order of the subject, so that keys of the subject can be read with a
+// single load.
+uint64_t KeyOf(Vector<const uc16> literal, int char_size) {
+  uint64_t key = 0;
+  for (int i = 0; i < literal.length(); i++) {
+    key |= static_cast<uint64_t>(literal[i]) << (kBitsPerByte * char_size * i);
+  }
+  return key;
+}
+
+template <typename Char>
+uint64_t LoadKey(const Char* position, int key_length) {
+  uint64_t key = 0;
+  for (int i = 0; i < key_length; i++) {
+    key |= static_cast<uint64_t>(position[i])
+           << (kBitsPerByte * sizeof(Char) * i);
+  }
+  return key;
+}
+
+uint32_t HashKey(uint64_t key, uint32_t shift) {
+  return static_cast<uint32_t>((key * uint64_t{0x9E3779B97F4A7C15}) >> shift);
+}
+
+// Teddy compares bytes; two-byte characters saturate when packed to bytes,
+// so their fingerprints may match more characters than the literals.
+uint8_t TeddyByte(uc16 c) {
+  if (c <= 0xFF) return static_cast<uint8_t>(c);
+  return c < 0x8000 ? 0xFF : 0x00;
+}
+
+// The table starts with the header, followed by the filter bitset and the
+// sorted keys of the literals.
+struct TableHeader {
+  uint32_t char_size;
+  uint32_t key_length;
+  uint32_t key_count;
+  // The filter has 1 << (64 - filter_shift) bits.
+  uint32_t filter_shift;
+  // Zero if the search doesn't use Teddy.
+  uint32_t teddy_length;
+  uint32_t padding;
+  // Buckets of the literals by the low and high nibble of each of the first
+  // teddy_length characters.
+  uint8_t teddy_masks[kMaxTeddyLength][2][16];
+};
+
+class Table {
+ public:
+  explicit Table(Address data)
+      : header_(reinterpret_cast<const TableHeader*>(data)),
+        filter_(reinterpret_cast<const uint8_t*>(data + sizeof(TableHeader))),
+        keys_(data + sizeof(TableHeader) + FilterBytes(*header_)),
+        key_count_(header_->key_count),
+        filter_shift_(header_->filter_shift) {
+    int key_bits = header_->key_length * header_->char_size * kBitsPerByte;
+    key_mask_ = key_bits == 64 ? ~uint64_t{0} : (uint64_t{1} << key_bits) - 1;
+  }
+
+  static int FilterBytes(const TableHeader& header) {
+    return static_cast<int>((uint64_t{1} << (64 - header.filter_shift)) /
+                            kBitsPerByte);
+  }
+
+  const TableHeader& header() const { return *header_; }
+
+  // Whether one of the literals starts at `position`. The fast version reads
+  // 8 bytes.
+  template <typename Char>
+  bool Matches(const Char* position) const {
+    return Matches(LoadKey(position, header_->key_length));
+  }
+  template <typename Char>
+  bool MatchesFast(const Char* position) const {
+    return Matches(base::ReadUnalignedValue<uint64_t>(
+                       reinterpret_cast<Address>(position)) &
+                   key_mask_);
+  }
+
+  bool Matches(uint64_t key) const {
+    uint32_t bit = HashKey(key, filter_shift_);
+    if ((filter_[bit / kBitsPerByte] & (1 << (bit % kBitsPerByte))) == 0) {
+      return false;
+    }
+    int low = 0;
+    int high = key_count_;
+    while (low < high) {
+      int middle = low + (high - low) / 2;
+      uint64_t middle_key = base::ReadUnalignedValue<uint64_t>(
+          keys_ + middle * sizeof(uint64_t));
+      if (middle_key == key) return true;
+      if (middle_key < key) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return false;
+  }
+
+ private:
+  const TableHeader* header_;
+  const uint8_t* filter_;
+  Address keys_;
+  int key_count_;
+  uint32_t filter_shift_;
+  uint64_t key_mask_;
+};
+
+std::vector<uint8_t> BuildTable(
+    const ZoneVector<Vector<const uc16>>& literals, bool is_one_byte,
+    int key_length) {
+  int key_count = static_cast<int>(literals.size());
+  uint32_t filter_bits = std::min(
+      kMaxFilterBits,
+      base::bits::RoundUpToPowerOfTwo32(std::max<uint32_t>(
+          kMinFilterBits, kFilterBitsPerLiteral * key_count)));
+
+  TableHeader header = {};
+  header.char_size = is_one_byte ? kOneByteSize : kUC16Size;
+  header.key_length = key_length;
+  header.key_count = key_count;
+  header.filter_shift = 64 - base::bits::WhichPowerOfTwo(filter_bits);
+  if (key_count <= kMaxTeddyLiteralCount) {
+    header.teddy_length = std::min(key_length, kMaxTeddyLength);
+    // The literals are sorted, so literals with common prefixes share
+    // buckets.
+    for (int i = 0; i < key_count; i++) {
+      int bucket = i * kTeddyBucketCount / key_count;
+      for (uint32_t j = 0; j < header.teddy_length; j++) {
+        uint8_t byte = TeddyByte(literals[i][j]);
+        header.teddy_masks[j][0][byte & 0x0F] |= 1 << bucket;
+        header.teddy_masks[j][1][byte >> 4] |= 1 << bucket;
+      }
+    }
+  }
+
+  size_t filter_offset = sizeof(TableHeader);
+  size_t keys_offset = filter_offset + filter_bits / kBitsPerByte;
+  std::vector<uint8_t> data(keys_offset + key_count * sizeof(uint64_t));
+  std::vector<uint64_t> keys;
+  keys.reserve(key_count);
+  for (Vector<const uc16> literal : literals) {
+    uint64_t key = KeyOf(literal, header.char_size);
+    uint32_t bit = HashKey(key, header.filter_shift);
+    data[filter_offset + bit / kBitsPerByte] |= 1 << (bit % kBitsPerByte);
+    keys.push_back(key);
+  }
+  std::sort(keys.begin(), keys.end());
+  memcpy(data.data(), &header, sizeof(header));
+  memcpy(data.data() + keys_offset, keys.data(),
+         key_count * sizeof(uint64_t));
+  return data;
+}
+
+#if V8_SIMD_DISPATCH
+
+V8_TARGET_SSSE3 __m128i LoadMask(const uint8_t* mask) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+}
+
+// Loads the (saturated) bytes of 16 characters.
+V8_TARGET_SSSE3 __m128i LoadBytes(const uint8_t* chars) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+}
+
+V8_TARGET_SSSE3 __m128i LoadBytes(const uint16_t* chars) {
+  __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+  __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 8));
+  return _mm_packus_epi16(low, high);
+}
+
+// Checks 16 positions at a time while all of the characters of their
+// fingerprints are in the subject, and returns the first match, `end` if
+// there is none before `limit`, or the first position left to check.
+template <typename Char>
+V8_TARGET_SSSE3 const Char* TeddySearch(const Table& table,
+                                        const Char* position,
+                                        const Char* limit, const Char* end) {
+  const TableHeader& header = table.header();
+  const int length = header.teddy_length;
+  DCHECK_LE(1, length);
+  DCHECK_LE(length, kMaxTeddyLength);
+  __m128i low_masks[kMaxTeddyLength];
+  __m128i high_masks[kMaxTeddyLength];
+  for (int i = 0; i < length; i++) {
+    low_masks[i] = LoadMask(header.teddy_masks[i][0]);
+    high_masks[i] = LoadMask(header.teddy_masks[i][1]);
+  }
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  const __m128i zero = _mm_setzero_si128();
+
+  while (end - position >= 16 + length - 1) {
+    __m128i buckets = _mm_set1_epi8(-1);
+    for (int i = 0; i < length; i++) {
+      __m128i bytes = LoadBytes(position + i);
+      __m128i low = _mm_and_si128(bytes, nibble);
+      __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+      buckets = _mm_and_si128(
+          buckets, _mm_and_si128(_mm_shuffle_epi8(low_masks[i], low),
+                                 _mm_shuffle_epi8(high_masks[i], high)));
+    }
+    uint32_t candidates =
+        ~_mm_movemask_epi8(_mm_cmpeq_epi8(buckets, zero)) & 0xFFFF;
+    while (candidates != 0) {
+      const Char* candidate =
+          position + base::bits::CountTrailingZeros(candidates);
+      if (candidate >= limit) return end;
+      if (table.Matches(candidate)) return candidate;
+      candidates &= candidates - 1;
+    }
+    position += 16;
+  }
+  return position;
+}
+
+#endif  // V8_SIMD_DISPATCH
+
+template <typename Char>
+const Char* Search(const Table& table, const Char* position, const Char* end) {
+  // Positions past the limit are too close to the end for a literal.
+  if (end - position < static_cast<int>(table.header().key_length)) {
+    return end;
+  }
+  const Char* limit = end - table.header().key_length + 1;
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_ssse3() && table.header().teddy_length > 0) {
+    position = TeddySearch(table, position, limit, end);
+  }
+#endif
+  constexpr int kFastKeyChars = sizeof(uint64_t) / sizeof(Char);
+  if (end - position >= kFastKeyChars) {
+    const Char* fast_limit = std::min(limit, end - kFastKeyChars + 1);
+    for (; position < fast_limit; position++) {
+      if (table.MatchesFast(position)) return position;
+    }
+  }
+  for (; position < limit; position++) {
+    if (table.Matches(position)) return position;
+  }
+  return end;
+}
+
+}  // namespace
+
+// static
+RegExpPrefilter* RegExpPrefilter::Create(RegExpTree* tree,
+                                         JSRegExp::Flags flags,
+                                         bool is_one_byte, Zone* zone) {
+  if (IgnoreCase(flags)) return nullptr;
+  Prefixes prefixes(zone);
+  if (!PrefixCollector(zone).Collect(tree, 0, &prefixes)) return nullptr;
+
+  // One-byte subjects cannot contain literals with two-byte characters.
+  ZoneVector<Vector<const uc16>> literals(zone);
+  int key_length = kMaxKeyLength;
+  for (Vector<const uc16> literal : prefixes.strings) {
+    if (is_one_byte &&
+        std::any_of(literal.begin(), literal.end(),
+                    [](uc16 c) { return c > String::kMaxOneByteCharCode; })) {
+      continue;
+    }
+    key_length = std::min(key_length, literal.length());
+    literals.push_back(literal);
+  }
+  // Literals of single characters are better left to Boyer-Moore lookahead.
+  if (key_length < 2) return nullptr;
+
+  for (Vector<const uc16>& literal : literals) {
+    literal = literal.SubVector(0, key_length);
+  }
+  std::sort(literals.begin(), literals.end(), LiteralLess);
+  literals.erase(std::unique(literals.begin(), literals.end()),
+                 literals.end());
+  if (literals.size() < kMinLiteralCount) return nullptr;
+  return zone->New<RegExpPrefilter>(&literals, is_one_byte, key_length);
+}
+
+Handle<ByteArray> RegExpPrefilter::ToByteArray(Isolate* isolate) const {
+  std::vector<uint8_t> data = BuildTable(literals_, is_one_byte_, key_length_);
+  Handle<ByteArray> table = isolate->factory()->NewByteArray(
+      static_cast<int>(data.size()), AllocationType::kOld);
+  table->copy_in(0, data.data(), static_cast<int>(data.size()));
+  return table;
+}
+
+// static
+Address RegExpPrefilter::FindCandidate(Address table_data, Address current,
+                                       Address end) {
+  Table table(table_data);
+  if (table.header().char_size == kOneByteSize) {
+    return reinterpret_cast<Address>(
+        Search(table, reinterpret_cast<const uint8_t*>(current),
+               reinterpret_cast<const uint8_t*>(end)));
+  }
+  return reinterpret_cast<Address>(
+      Search(table, reinterpret_cast<const uint16_t*>(current),
+             reinterpret_cast<const uint16_t*>(end)));
+}
+
+}  // namespace internal
+}  // namespace v8
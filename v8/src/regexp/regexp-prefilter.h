@@ -0,0 +1,70 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_PREFILTER_H_
+#define V8_REGEXP_REGEXP_PREFILTER_H_
+
+#include "src/handles/handles.h"
+#include "src/objects/js-regexp.h"
+#include "src/utils/vector.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class RegExpTree;
+
+// A set of literals such that every match of a regexp starts with one of
+// them, e.g. {"erro", "fata", "pani"} for /(error|fatal|panic): .*/. Native
+// code of unanchored regexps calls FindCandidate to skip to the next position
+// at which one of the literals starts, instead of trying the regexp at every
+// position or skipping by Boyer-Moore lookahead, which is of little use once
+// the alternatives cover most characters.
+//
+// Literals are cut to their first kMaxKeyLength characters. The search
+// compares a fingerprint of the first characters of 16 positions at a time
+// with those of the literals (Teddy, as in Hyperscan) if there are few
+// literals and the CPU has SSSE3, and otherwise tests positions against a
+// hashed bitset of the literals. Candidates are then looked up in the sorted
+// literals, so the regexp only runs where one of the literals starts.
+class RegExpPrefilter final : public ZoneObject {
+ public:
+  static const int kMaxKeyLength = 4;
+
+  // Returns nullptr if the regexp has no suitable set of literals. Sets of
+  // few literals or of single characters are left to Boyer-Moore lookahead.
+  static RegExpPrefilter* Create(RegExpTree* tree, JSRegExp::Flags flags,
+                                 bool is_one_byte, Zone* zone);
+
+  int literal_count() const { return static_cast<int>(literals_.size()); }
+
+  // Returns the table that generated code passes to FindCandidate.
+  Handle<ByteArray> ToByteArray(Isolate* isolate) const;
+
+  // Called from generated code with the data of the table, the address of
+  // the current position and the end of the subject. Returns the address of
+  // the first position at or after `current` at which one of the literals
+  // starts, or `end` if there is none. Doesn't allocate.
+  static Address FindCandidate(Address table, Address current, Address end);
+
+ private:
+  RegExpPrefilter(ZoneVector<Vector<const uc16>>* literals, bool is_one_byte,
+                  int key_length)
+      : literals_(*literals),
+        is_one_byte_(is_one_byte),
+        key_length_(key_length) {}
+
+  // Sorted and without duplicates, all of length key_length_.
+  const ZoneVector<Vector<const uc16>> literals_;
+  const bool is_one_byte_;
+  const int key_length_;
+
+  friend Zone;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_PREFILTER_H_
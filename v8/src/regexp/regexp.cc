@@ -1058,10 +1058,9 @@ int32_t* RegExpGlobalCache::FetchNext() {
         break;
       case JSRegExp::EXPERIMENTAL: {
         DCHECK(ExperimentalRegExp::IsCompiled(regexp_, isolate_));
-        DisallowHeapAllocation no_gc;
-        num_matches_ = ExperimentalRegExp::ExecRaw(
-            isolate_, RegExp::kFromRuntime, *regexp_, *subject_,
-            register_array_, register_array_size_, last_end_index);
+        num_matches_ = ExperimentalRegExp::ExecRawFromRuntime(
+            isolate_, regexp_, subject_, register_array_, register_array_size_,
+            last_end_index);
         break;
       }
       case JSRegExp::IRREGEXP: {
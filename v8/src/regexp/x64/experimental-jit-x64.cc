@@ -0,0 +1,724 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if V8_TARGET_ARCH_X64
+
+#include "src/codegen/macro-assembler.h"
+#include "src/heap/factory.h"
+#include "src/logging/log.h"
+#include "src/objects/objects-inl.h"
+#include "src/regexp/experimental/experimental-jit.h"
+#include "src/regexp/regexp-macro-assembler.h"
+
+namespace v8 {
+namespace internal {
+
+/*
+ * The generated code uses the following register assignment convention
+ * - rbx : Address of the first character of the subject string.
+ * - r15 : Length of the subject string.
+ * - r14 : Current input position, as character index.
+ * - r11 : The character at the previous position, i.e. the one that blocked
+ *         threads consume in the current step.
+ * - r12 : Generation counter, incremented at every position and every new
+ *         search.  Used to mark instructions as visited.
+ * - r13 : Register array of the running thread.
+ * - rdi : Base of the register arrays of threads blocked in this step.
+ * - rsi : End of the list of threads blocked in this step.
+ * - r9  : Base of the register arrays of threads blocked in the last step.
+ * - r8  : Next thread to be resumed from the list of the last step.
+ * - rdx : End of that list.
+ * - rsp : Top of the stack of forked threads that still have to run.
+ * - rbp : Frame pointer.  Used to access arguments and local variables.
+ * - rax, rcx, r10 : Scratch registers.
+ *
+ * Each instruction of the program has its own block of code.  The block of a
+ * thread that cannot continue jumps to `thread_done_`, which pops the next
+ * forked thread or resumes the next blocked thread.  Both are represented by
+ * code addresses: forked threads by a stub that loads the FORK's register
+ * array and jumps to the forked pc, blocked threads by a stub that checks the
+ * CONSUME_RANGE for the current character, loads the register array and jumps
+ * to the next pc.  Threads are resumed in the same order as in the
+ * interpreter, which yields the same match.
+ *
+ * The stack frame of the generated code looks like this
+ *
+ *       - return address
+ * rbp-> - old rbp
+ *       - callee-save registers
+ *       - locals, see `FrameLayout`
+ *       - pushed addresses of forked threads
+ *
+ * The code is called with the arguments of native irregexp code (see
+ * `NativeRegExpMacroAssembler::Execute`), and returns the number of matches.
+ * If the stack limit is hit, it returns RETRY and leaves the handling of
+ * interrupts to the interpreter.
+ */
+
+namespace {
+
+constexpr Register kInputBase = rbx;
+constexpr Register kInputLength = r15;
+constexpr Register kPosition = r14;
+constexpr Register kCurrentCharacter = r11;
+constexpr Register kGeneration = r12;
+constexpr Register kThreadRegisters = r13;
+constexpr Register kNewSlots = rdi;
+constexpr Register kNewListEnd = rsi;
+constexpr Register kOldSlots = r9;
+constexpr Register kOldListNext = r8;
+constexpr Register kOldListEnd = rdx;
+
+#ifdef V8_TARGET_OS_WIN
+constexpr int kCalleeSaveRegisterCount = 7;
+// Offsets of the stack arguments from rbp.  The first four arguments are
+// passed in rcx, rdx, r8 and r9.
+constexpr int kRegisterOutput = 6 * kSystemPointerSize;
+constexpr int kNumOutputRegisters = 7 * kSystemPointerSize;
+#else
+constexpr int kCalleeSaveRegisterCount = 5;
+#endif
+constexpr int kCalleeSaveSize = kCalleeSaveRegisterCount * kSystemPointerSize;
+
+// Frames are limited to this many bytes; larger programs are interpreted.
+constexpr int kMaxFrameSize = 64 * KB;
+// Check for interrupts whenever the generation counter is a multiple of this.
+constexpr int kInterruptCheckInterval = 1024;
+// Register arrays of up to this many registers are copied by unrolled moves.
+constexpr int kMaxUnrolledRegisterCount = 16;
+
+// Offsets of the locals from the bottom of the locals area.
+class FrameLayout {
+ public:
+  FrameLayout(Vector<const RegExpInstruction> bytecode, int register_count)
+      : visited_slot_(bytecode.length(), -1),
+        consume_slot_(bytecode.length(), -1),
+        fork_slot_(bytecode.length(), -1) {
+    const int register_array_size = register_count * kInt32Size;
+    // Only the targets of jumps can be reached twice at the same position,
+    // all other instructions have a unique predecessor.
+    int join_count = 0;
+    int consume_count = 0;
+    for (int pc = 0; pc < bytecode.length(); ++pc) {
+      const RegExpInstruction& inst = bytecode[pc];
+      if (inst.opcode == RegExpInstruction::JMP ||
+          inst.opcode == RegExpInstruction::FORK) {
+        int target = inst.payload.pc;
+        if (visited_slot_[target] == -1) {
+          visited_slot_[target] = join_count++ * kSystemPointerSize;
+        }
+      }
+      if (inst.opcode == RegExpInstruction::CONSUME_RANGE) {
+        consume_slot_[pc] = consume_count++ * register_array_size;
+      }
+      if (inst.opcode == RegExpInstruction::FORK) {
+        fork_slot_[pc] = fork_count_++ * register_array_size;
+      }
+    }
+
+    int offset = kFixedLocalsSize;
+    visited_ = offset;
+    for (int& slot : visited_slot_) {
+      if (slot != -1) slot += offset;
+    }
+    offset += join_count * kSystemPointerSize;
+    lists_ = offset;
+    list_size_ = consume_count * kSystemPointerSize;
+    offset += 2 * list_size_;
+    slots_ = offset;
+    slots_size_ = consume_count * register_array_size;
+    offset += 2 * slots_size_;
+    for (int& slot : fork_slot_) {
+      if (slot != -1) slot += offset;
+    }
+    offset += fork_count_ * register_array_size;
+    start_registers_ = offset;
+    offset += register_array_size;
+    best_registers_ = offset;
+    offset += register_array_size;
+    visited_count_ = join_count;
+    size_ = offset;
+    STATIC_ASSERT(kFixedLocalsSize % kSystemPointerSize == 0);
+    DCHECK_EQ(0, register_array_size % kSystemPointerSize);
+  }
+
+  // Fixed locals.
+  static constexpr int kOutput = 0;
+  static constexpr int kOutputRegistersLeft = kOutput + kSystemPointerSize;
+  static constexpr int kMatchCount = kOutputRegistersLeft + kSystemPointerSize;
+  static constexpr int kHasMatch = kMatchCount + kSystemPointerSize;
+  // The start of the list of threads blocked in this step.
+  static constexpr int kNewList = kHasMatch + kSystemPointerSize;
+  static constexpr int kFixedLocalsSize = kNewList + kSystemPointerSize;
+
+  // The visited mark of an instruction, or -1 if it doesn't need one.
+  int visited_slot(int pc) const { return visited_slot_[pc]; }
+  int visited() const { return visited_; }
+  int visited_count() const { return visited_count_; }
+  // Relative to the register arrays of this or the last step.
+  int consume_slot(int pc) const { return consume_slot_[pc]; }
+  int fork_slot(int pc) const { return fork_slot_[pc]; }
+  int list(int parity) const { return lists_ + parity * list_size_; }
+  int slots(int parity) const { return slots_ + parity * slots_size_; }
+  int start_registers() const { return start_registers_; }
+  int best_registers() const { return best_registers_; }
+
+  int size() const { return size_; }
+  // Includes room for the stack of forked threads.
+  int stack_size() const {
+    return kCalleeSaveSize + size_ + fork_count_ * kSystemPointerSize;
+  }
+
+ private:
+  std::vector<int> visited_slot_;
+  std::vector<int> consume_slot_;
+  std::vector<int> fork_slot_;
+  int fork_count_ = 0;
+  int visited_;
+  int visited_count_;
+  int lists_;
+  int list_size_;
+  int slots_;
+  int slots_size_;
+  int start_registers_;
+  int best_registers_;
+  int size_;
+};
+
+class CodeGenerator {
+ public:
+  CodeGenerator(MacroAssembler* masm, Vector<const RegExpInstruction> bytecode,
+                int register_count, bool is_one_byte,
+                ExternalReference stack_limit)
+      : masm_(masm),
+        bytecode_(bytecode),
+        register_count_(register_count),
+        is_one_byte_(is_one_byte),
+        stack_limit_(stack_limit),
+        layout_(bytecode, register_count),
+        pc_labels_(bytecode.length()),
+        resume_labels_(bytecode.length()) {}
+
+  void Generate();
+
+ private:
+  MacroAssembler* masm() { return masm_; }
+
+  // Locals are addressed relative to rbp, since rsp moves.
+  int LocalOffset(int offset) const {
+    return offset - kCalleeSaveSize - layout_.size();
+  }
+  Operand Local(int offset) const { return Operand(rbp, LocalOffset(offset)); }
+  ScaleFactor CharacterScale() const {
+    return is_one_byte_ ? times_1 : times_2;
+  }
+  int CharacterSize() const { return is_one_byte_ ? 1 : 2; }
+
+  void GenerateEntry();
+  void GenerateSearch();
+  void GenerateInstruction(int pc);
+  void GenerateAssertion(RegExpAssertion::AssertionType type);
+  void GenerateStubs();
+  void GenerateExit();
+
+  // Whether a CONSUME_RANGE can consume a character of the subject, and
+  // whether it consumes any character.
+  bool CanConsume(RegExpInstruction::Uc16Range range) const {
+    return range.min <= range.max && (!is_one_byte_ || range.min <= 0xFF);
+  }
+  bool ConsumesAll(RegExpInstruction::Uc16Range range) const {
+    return range.min == 0 && range.max >= (is_one_byte_ ? 0xFF : 0xFFFF);
+  }
+
+  // Copies a register array, using rax and rcx.
+  void CopyRegisters(Register dst_base, int dst_offset, Register src_base,
+                     int src_offset);
+  // Fills the register array of the local at `offset`, using rcx.
+  void FillRegisters(int offset, int32_t value);
+  // Loads the character at the current position plus `offset` into rax,
+  // which must be within the subject.
+  void LoadCharacter(int offset);
+  // Jumps to `if_true` if the character in rax is a line terminator.
+  void CheckLineTerminator(Label* if_true);
+  // Sets rcx to 1 if the character at the current position plus `offset` is
+  // a word character, and to 0 otherwise or if it is outside the subject.
+  // Clobbers rax.
+  void LoadIsWordCharacter(int offset);
+  void CheckStackLimit(Label* if_hit, int space);
+
+  MacroAssembler* const masm_;
+  const Vector<const RegExpInstruction> bytecode_;
+  const int register_count_;
+  const bool is_one_byte_;
+  const ExternalReference stack_limit_;
+  const FrameLayout layout_;
+
+  std::vector<Label> pc_labels_;
+  // Stubs that resume threads blocked at CONSUME_RANGE, or that run threads
+  // forked at FORK.
+  std::vector<Label> resume_labels_;
+  Label search_start_;
+  Label thread_done_;
+  Label next_blocked_thread_;
+  Label step_done_;
+  Label search_done_;
+  Label return_match_count_;
+  Label return_retry_;
+  Label return_rax_;
+};
+
+#define __ masm()->
+
+void CodeGenerator::Generate() {
+  GenerateEntry();
+  GenerateSearch();
+  for (int pc = 0; pc < bytecode_.length(); ++pc) GenerateInstruction(pc);
+  GenerateStubs();
+  GenerateExit();
+}
+
+void CodeGenerator::GenerateEntry() {
+  __ pushq(rbp);
+  __ movq(rbp, rsp);
+#ifdef V8_TARGET_OS_WIN
+  // rsi and rdi are callee-save on Win64.
+  __ pushq(rsi);
+  __ pushq(rdi);
+#endif
+  __ pushq(rbx);
+  __ pushq(r12);
+  __ pushq(r13);
+  __ pushq(r14);
+  __ pushq(r15);
+
+  CheckStackLimit(&return_retry_, layout_.stack_size() - kCalleeSaveSize);
+  __ AllocateStackSpace(layout_.size());
+
+  // Load the arguments: start index, input start and end, output registers
+  // and their count.
+#ifdef V8_TARGET_OS_WIN
+  __ movsxlq(kPosition, rdx);
+  __ movq(kInputBase, r8);
+  __ movq(kInputLength, r9);
+  __ movq(rax, Operand(rbp, kRegisterOutput));
+  __ movsxlq(rcx, Operand(rbp, kNumOutputRegisters));
+#else
+  __ movsxlq(kPosition, rsi);
+  __ movq(kInputBase, rdx);
+  __ movq(kInputLength, rcx);
+  __ movq(rax, r8);
+  __ movsxlq(rcx, r9);
+#endif
+  __ movq(Local(FrameLayout::kOutput), rax);
+  __ movq(Local(FrameLayout::kOutputRegistersLeft), rcx);
+  __ Set(Local(FrameLayout::kMatchCount), 0);
+
+  // Input start points to the character at the start index.
+  __ leaq(rax, Operand(kPosition, CharacterScale(), 0));
+  __ subq(kInputBase, rax);
+  __ subq(kInputLength, kInputBase);
+  if (!is_one_byte_) __ sarq(kInputLength, Immediate(1));
+
+  // Clear the visited marks.
+  __ xorl(kGeneration, kGeneration);
+  for (int i = 0; i < layout_.visited_count(); ++i) {
+    __ movq(Local(layout_.visited() + i * kSystemPointerSize), Immediate(-1));
+  }
+
+  __ cmpq(rcx, Immediate(register_count_));
+  __ j(less, &return_match_count_);
+}
+
+void CodeGenerator::GenerateSearch() {
+  // Start a search at the current position with a single thread at pc 0.
+  __ bind(&search_start_);
+  __ incq(kGeneration);
+  __ Set(Local(FrameLayout::kHasMatch), 0);
+  FillRegisters(layout_.start_registers(), -1);
+  __ leaq(kThreadRegisters, Local(layout_.start_registers()));
+  __ leaq(kNewListEnd, Local(layout_.list(0)));
+  __ movq(Local(FrameLayout::kNewList), kNewListEnd);
+  __ leaq(kNewSlots, Local(layout_.slots(0)));
+  __ leaq(kOldSlots, Local(layout_.slots(1)));
+  __ xorl(kOldListNext, kOldListNext);
+  __ xorl(kOldListEnd, kOldListEnd);
+  __ jmp(&pc_labels_[0]);
+
+  // Run the next forked thread, or resume the next blocked one.
+  __ bind(&thread_done_);
+  __ leaq(rax, Local(0));
+  __ cmpq(rsp, rax);
+  Label no_forked_thread;
+  __ j(equal, &no_forked_thread, Label::kNear);
+  __ popq(rax);
+  __ jmp(rax);
+  __ bind(&no_forked_thread);
+
+  __ bind(&next_blocked_thread_);
+  __ cmpq(kOldListNext, kOldListEnd);
+  __ j(equal, &step_done_, Label::kNear);
+  __ movq(rax, Operand(kOldListNext, 0));
+  __ addq(kOldListNext, Immediate(kSystemPointerSize));
+  __ jmp(rax);
+
+  // All threads of this step have run, so advance to the next position unless
+  // there is no input or no thread left.  Threads with lower priority than a
+  // match have been dropped already.
+  __ bind(&step_done_);
+  __ movq(rax, Local(FrameLayout::kNewList));
+  __ cmpq(kNewListEnd, rax);
+  __ j(equal, &search_done_);
+  __ cmpq(kPosition, kInputLength);
+  __ j(equal, &search_done_);
+
+  if (is_one_byte_) {
+    __ movzxbl(kCurrentCharacter, Operand(kInputBase, kPosition, times_1, 0));
+  } else {
+    __ movzxwl(kCurrentCharacter, Operand(kInputBase, kPosition, times_2, 0));
+  }
+  __ incq(kPosition);
+  __ incq(kGeneration);
+
+  Label no_interrupt_check;
+  __ testl(kGeneration, Immediate(kInterruptCheckInterval - 1));
+  __ j(not_zero, &no_interrupt_check, Label::kNear);
+  CheckStackLimit(&return_retry_, 0);
+  __ bind(&no_interrupt_check);
+
+  // The threads blocked in this step become those of the last step.
+  __ movq(kOldListNext, Local(FrameLayout::kNewList));
+  __ movq(kOldListEnd, kNewListEnd);
+  Label other_list;
+  __ leaq(kNewListEnd, Local(layout_.list(0)));
+  __ cmpq(kNewListEnd, kOldListNext);
+  __ j(not_equal, &other_list, Label::kNear);
+  __ leaq(kNewListEnd, Local(layout_.list(1)));
+  __ bind(&other_list);
+  __ movq(Local(FrameLayout::kNewList), kNewListEnd);
+  __ xchgq(kNewSlots, kOldSlots);
+  __ jmp(&next_blocked_thread_);
+
+  // Copy the match to the output and search for the next one if there is
+  // room for it.
+  __ bind(&search_done_);
+  __ cmpq(Local(FrameLayout::kHasMatch), Immediate(0));
+  __ j(equal, &return_match_count_);
+  __ movq(r10, Local(FrameLayout::kOutput));
+  CopyRegisters(r10, 0, rbp, LocalOffset(layout_.best_registers()));
+  __ addq(Local(FrameLayout::kOutput),
+          Immediate(register_count_ * kInt32Size));
+  __ incq(Local(FrameLayout::kMatchCount));
+  __ movq(rax, Local(FrameLayout::kOutputRegistersLeft));
+  __ subq(rax, Immediate(register_count_));
+  __ movq(Local(FrameLayout::kOutputRegistersLeft), rax);
+  __ cmpq(rax, Immediate(register_count_));
+  __ j(less, &return_match_count_);
+
+  // Continue at the end of the match, but advance by one character after an
+  // empty match.
+  __ movsxlq(rax, Local(layout_.best_registers()));
+  __ movsxlq(kPosition, Local(layout_.best_registers() + kInt32Size));
+  __ cmpq(rax, kPosition);
+  __ j(not_equal, &search_start_);
+  __ cmpq(kPosition, kInputLength);
+  __ j(equal, &return_match_count_);
+  __ incq(kPosition);
+  __ jmp(&search_start_);
+}
+
+void CodeGenerator::GenerateInstruction(int pc) {
+  const RegExpInstruction& inst = bytecode_[pc];
+  __ bind(&pc_labels_[pc]);
+  if (layout_.visited_slot(pc) != -1) {
+    Operand visited = Local(layout_.visited_slot(pc));
+    __ cmpq(visited, kGeneration);
+    __ j(equal, &thread_done_);
+    __ movq(visited, kGeneration);
+  }
+
+  switch (inst.opcode) {
+    case RegExpInstruction::CONSUME_RANGE: {
+      if (!CanConsume(inst.payload.consume_range)) {
+        __ jmp(&thread_done_);
+        break;
+      }
+      CopyRegisters(kNewSlots, layout_.consume_slot(pc), kThreadRegisters, 0);
+      __ leaq(rax, Operand(&resume_labels_[pc]));
+      __ movq(Operand(kNewListEnd, 0), rax);
+      __ addq(kNewListEnd, Immediate(kSystemPointerSize));
+      __ jmp(&thread_done_);
+      break;
+    }
+    case RegExpInstruction::ASSERTION:
+      GenerateAssertion(inst.payload.assertion_type);
+      break;
+    case RegExpInstruction::FORK: {
+      CopyRegisters(rbp, LocalOffset(layout_.fork_slot(pc)), kThreadRegisters,
+                    0);
+      __ leaq(rax, Operand(&resume_labels_[pc]));
+      __ pushq(rax);
+      break;
+    }
+    case RegExpInstruction::JMP:
+      __ jmp(&pc_labels_[inst.payload.pc]);
+      break;
+    case RegExpInstruction::ACCEPT: {
+      // Drop all threads with lower priority than this one.
+      CopyRegisters(rbp, LocalOffset(layout_.best_registers()),
+                    kThreadRegisters, 0);
+      __ Set(Local(FrameLayout::kHasMatch), 1);
+      __ leaq(rsp, Local(0));
+      __ movq(kOldListNext, kOldListEnd);
+      __ jmp(&step_done_);
+      break;
+    }
+    case RegExpInstruction::SET_REGISTER_TO_CP:
+      __ movl(Operand(kThreadRegisters,
+                      inst.payload.register_index * kInt32Size),
+              kPosition);
+      break;
+    case RegExpInstruction::CLEAR_REGISTER:
+      __ movl(Operand(kThreadRegisters,
+                      inst.payload.register_index * kInt32Size),
+              Immediate(-1));
+      break;
+  }
+  // Other instructions fall through to the next one.
+}
+
+void CodeGenerator::GenerateAssertion(RegExpAssertion::AssertionType type) {
+  Label satisfied;
+  switch (type) {
+    case RegExpAssertion::START_OF_INPUT:
+      __ testq(kPosition, kPosition);
+      __ j(not_zero, &thread_done_);
+      break;
+    case RegExpAssertion::END_OF_INPUT:
+      __ cmpq(kPosition, kInputLength);
+      __ j(not_equal, &thread_done_);
+      break;
+    case RegExpAssertion::START_OF_LINE:
+      __ testq(kPosition, kPosition);
+      __ j(zero, &satisfied, Label::kNear);
+      LoadCharacter(-1);
+      CheckLineTerminator(&satisfied);
+      __ jmp(&thread_done_);
+      break;
+    case RegExpAssertion::END_OF_LINE:
+      __ cmpq(kPosition, kInputLength);
+      __ j(equal, &satisfied, Label::kNear);
+      LoadCharacter(0);
+      CheckLineTerminator(&satisfied);
+      __ jmp(&thread_done_);
+      break;
+    case RegExpAssertion::BOUNDARY:
+    case RegExpAssertion::NON_BOUNDARY:
+      LoadIsWordCharacter(-1);
+      __ movl(r10, rcx);
+      LoadIsWordCharacter(0);
+      __ cmpl(rcx, r10);
+      __ j(type == RegExpAssertion::BOUNDARY ? equal : not_equal,
+           &thread_done_);
+      break;
+  }
+  __ bind(&satisfied);
+}
+
+void CodeGenerator::GenerateStubs() {
+  for (int pc = 0; pc < bytecode_.length(); ++pc) {
+    const RegExpInstruction& inst = bytecode_[pc];
+    if (inst.opcode == RegExpInstruction::CONSUME_RANGE) {
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (!CanConsume(range)) continue;
+      __ bind(&resume_labels_[pc]);
+      if (range.min == range.max) {
+        __ cmpl(kCurrentCharacter, Immediate(range.min));
+        __ j(not_equal, &next_blocked_thread_);
+      } else if (!ConsumesAll(range)) {
+        __ leal(rax, Operand(kCurrentCharacter, -range.min));
+        __ cmpl(rax, Immediate(range.max - range.min));
+        __ j(above, &next_blocked_thread_);
+      }
+      __ leaq(kThreadRegisters, Operand(kOldSlots, layout_.consume_slot(pc)));
+      DCHECK_LT(pc + 1, bytecode_.length());
+      __ jmp(&pc_labels_[pc + 1]);
+    } else if (inst.opcode == RegExpInstruction::FORK) {
+      __ bind(&resume_labels_[pc]);
+      __ leaq(kThreadRegisters, Local(layout_.fork_slot(pc)));
+      __ jmp(&pc_labels_[inst.payload.pc]);
+    }
+  }
+}
+
+void CodeGenerator::GenerateExit() {
+  __ bind(&return_retry_);
+  __ Set(rax, NativeRegExpMacroAssembler::RETRY);
+  __ jmp(&return_rax_, Label::kNear);
+
+  __ bind(&return_match_count_);
+  __ movq(rax, Local(FrameLayout::kMatchCount));
+
+  __ bind(&return_rax_);
+  __ leaq(rsp, Operand(rbp, -kCalleeSaveSize));
+  __ popq(r15);
+  __ popq(r14);
+  __ popq(r13);
+  __ popq(r12);
+  __ popq(rbx);
+#ifdef V8_TARGET_OS_WIN
+  __ popq(rdi);
+  __ popq(rsi);
+#endif
+  __ popq(rbp);
+  __ ret(0);
+}
+
+void CodeGenerator::CopyRegisters(Register dst_base, int dst_offset,
+                                  Register src_base, int src_offset) {
+  const int size = register_count_ * kInt32Size;
+  if (register_count_ <= kMaxUnrolledRegisterCount) {
+    for (int i = 0; i < size; i += kSystemPointerSize) {
+      __ movq(rax, Operand(src_base, src_offset + i));
+      __ movq(Operand(dst_base, dst_offset + i), rax);
+    }
+    return;
+  }
+  Label loop;
+  __ xorl(rcx, rcx);
+  __ bind(&loop);
+  __ movq(rax, Operand(src_base, rcx, times_1, src_offset));
+  __ movq(Operand(dst_base, rcx, times_1, dst_offset), rax);
+  __ addq(rcx, Immediate(kSystemPointerSize));
+  __ cmpq(rcx, Immediate(size));
+  __ j(less, &loop, Label::kNear);
+}
+
+void CodeGenerator::FillRegisters(int offset, int32_t value) {
+  if (register_count_ <= kMaxUnrolledRegisterCount) {
+    for (int i = 0; i < register_count_; ++i) {
+      __ movl(Local(offset + i * kInt32Size), Immediate(value));
+    }
+    return;
+  }
+  Label loop;
+  __ xorl(rcx, rcx);
+  __ bind(&loop);
+  __ movl(Operand(rbp, rcx, times_1, LocalOffset(offset)), Immediate(value));
+  __ addq(rcx, Immediate(kInt32Size));
+  __ cmpq(rcx, Immediate(register_count_ * kInt32Size));
+  __ j(less, &loop, Label::kNear);
+}
+
+void CodeGenerator::LoadCharacter(int offset) {
+  Operand character(kInputBase, kPosition, CharacterScale(),
+                    offset * CharacterSize());
+  if (is_one_byte_) {
+    __ movzxbl(rax, character);
+  } else {
+    __ movzxwl(rax, character);
+  }
+}
+
+void CodeGenerator::CheckLineTerminator(Label* if_true) {
+  __ cmpl(rax, Immediate('\n'));
+  __ j(equal, if_true);
+  __ cmpl(rax, Immediate('\r'));
+  __ j(equal, if_true);
+  if (!is_one_byte_) {
+    // U+2028 and U+2029.
+    __ subl(rax, Immediate(0x2028));
+    __ cmpl(rax, Immediate(1));
+    __ j(below_equal, if_true);
+  }
+}
+
+void CodeGenerator::LoadIsWordCharacter(int offset) {
+  Label done, is_word;
+  __ xorl(rcx, rcx);
+  if (offset < 0) {
+    __ testq(kPosition, kPosition);
+    __ j(zero, &done, Label::kNear);
+  } else {
+    __ cmpq(kPosition, kInputLength);
+    __ j(equal, &done, Label::kNear);
+  }
+  LoadCharacter(offset);
+  // [0-9_a-zA-Z]
+  __ cmpl(rax, Immediate('_'));
+  __ j(equal, &is_word, Label::kNear);
+  __ subl(rax, Immediate('0'));
+  __ cmpl(rax, Immediate('9' - '0'));
+  __ j(below_equal, &is_word, Label::kNear);
+  __ addl(rax, Immediate('0'));
+  __ orl(rax, Immediate(0x20));
+  __ subl(rax, Immediate('a'));
+  __ cmpl(rax, Immediate('z' - 'a'));
+  __ j(above, &done, Label::kNear);
+  __ bind(&is_word);
+  __ movl(rcx, Immediate(1));
+  __ bind(&done);
+}
+
+void CodeGenerator::CheckStackLimit(Label* if_hit, int space) {
+  __ movq(rax, rsp);
+  __ Move(kScratchRegister, stack_limit_);
+  __ subq(rax, Operand(kScratchRegister, 0));
+  __ j(below_equal, if_hit);
+  if (space > 0) {
+    __ cmpq(rax, Immediate(space));
+    __ j(below, if_hit);
+  }
+}
+
+#undef __
+
+}  // namespace
+
+bool ExperimentalRegExpJit::CanCompile(Vector<const RegExpInstruction> bytecode,
+                                       int register_count_per_match) {
+  FrameLayout layout(bytecode, register_count_per_match);
+  return layout.stack_size() <= kMaxFrameSize;
+}
+
+Handle<Code> ExperimentalRegExpJit::Compile(Isolate* isolate,
+                                            Handle<ByteArray> bytecode,
+                                            int register_count_per_match,
+                                            bool is_one_byte,
+                                            Handle<String> source) {
+  std::vector<RegExpInstruction> program;
+  {
+    DisallowHeapAllocation no_gc;
+    const RegExpInstruction* begin =
+        reinterpret_cast<const RegExpInstruction*>(
+            bytecode->GetDataStartAddress());
+    program.assign(begin,
+                   begin + bytecode->length() / sizeof(RegExpInstruction));
+  }
+  DCHECK(CanCompile(VectorOf(program), register_count_per_match));
+
+  MacroAssembler masm(isolate, CodeObjectRequired::kNo,
+                      NewAssemblerBuffer(AssemblerBase::kDefaultBufferSize));
+  {
+    // The root register is used as a general purpose register.
+    NoRootArrayScope no_root_array(&masm);
+    FrameScope scope(&masm, StackFrame::MANUAL);
+    CodeGenerator generator(&masm, VectorOf(program), register_count_per_match,
+                            is_one_byte,
+                            ExternalReference::address_of_jslimit(isolate));
+    generator.Generate();
+  }
+
+  CodeDesc code_desc;
+  masm.GetCode(isolate, &code_desc);
+  Handle<Code> code =
+      Factory::CodeBuilder(isolate, code_desc, CodeKind::REGEXP).Build();
+  PROFILE(isolate,
+          RegExpCodeCreateEvent(Handle<AbstractCode>::cast(code), source));
+  return code;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_X64
@@ -11,6 +11,7 @@
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
 #include "src/regexp/regexp-macro-assembler.h"
+#include "src/regexp/regexp-prefilter.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/strings/unicode.h"
 
@@ -668,6 +669,52 @@ bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
   }
 }
 
+bool RegExpMacroAssemblerX64::AdvanceToPrefilterCandidate(
+    RegExpPrefilter* prefilter) {
+  Handle<ByteArray> table = prefilter->ToByteArray(isolate());
+
+  // Save important/volatile registers before calling C function. The current
+  // position is replaced by the result.
+#ifndef V8_TARGET_OS_WIN
+  // Caller save on Linux and callee save in Windows.
+  __ pushq(rsi);
+#endif
+  __ pushq(backtrack_stackpointer());
+
+  static const int num_arguments = 3;
+  __ PrepareCallCFunction(num_arguments);
+
+  // Put arguments into parameter registers. Parameters are
+  //   Address table - Start of the data of the prefilter table.
+  //   Address current - Address of current character position.
+  //   Address end - End of input.
+  // The order of the moves avoids overwriting rsi and rdi before they are
+  // read, for both the Win64 and the AMD64 calling convention.
+  __ leaq(rax, Operand(rsi, rdi, times_1, 0));
+  __ movq(arg_reg_3, rsi);
+  __ movq(arg_reg_2, rax);
+  __ Move(arg_reg_1, table);
+  __ addq(arg_reg_1, Immediate(ByteArray::kHeaderSize - kHeapObjectTag));
+
+  {  // NOLINT: Can't find a way to open this scope without confusing the
+     // linter.
+    AllowExternalCallThatCantCauseGC scope(&masm_);
+    ExternalReference find_candidate =
+        ExternalReference::re_prefilter_find_candidate();
+    __ CallCFunction(find_candidate, num_arguments);
+  }
+
+  // Restore original values, and set the current position to the candidate.
+  __ Move(code_object_pointer(), masm_.CodeObject());
+  __ popq(backtrack_stackpointer());
+#ifndef V8_TARGET_OS_WIN
+  __ popq(rsi);
+#endif
+  __ subq(rax, rsi);
+  __ movq(rdi, rax);
+  return true;
+}
+
 
 void RegExpMacroAssemblerX64::Fail() {
   STATIC_ASSERT(FAILURE == 0);  // Return value for failure is zero.
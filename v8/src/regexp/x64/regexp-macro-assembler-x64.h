@@ -53,6 +53,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   // the end of the string.
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match) override;
+  bool AdvanceToPrefilterCandidate(RegExpPrefilter* prefilter) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
   void GoTo(Label* label) override;
@@ -8,6 +8,7 @@
 #include "src/ast/ast-traversal-visitor.h"
 #include "src/ast/prettyprinter.h"
 #include "src/builtins/builtins.h"
+#include "src/codegen/compiler.h"
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
@@ -341,6 +342,11 @@ RUNTIME_FUNCTION(Runtime_BytecodeBudgetInterruptFromBytecode) {
     function->feedback_vector().set_invocation_count(1);
     return ReadOnlyRoots(isolate).undefined_value();
   }
+  if (FLAG_baseline_jit && !function->feedback_vector().has_baseline_code()) {
+    // Later calls of the function run the baseline code, the current
+    // activation stays in the interpreter.
+    Compiler::CompileBaseline(isolate, function);
+  }
   {
     SealHandleScope shs(isolate);
     isolate->counters()->runtime_profiler_ticks()->Increment();
@@ -369,6 +369,17 @@ bool EnsureFeedbackVector(Handle<JSFunction> function) {
 
 }  // namespace
 
+RUNTIME_FUNCTION(Runtime_CompileBaseline) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  if (!EnsureFeedbackVector(function)) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+  return isolate->heap()->ToBoolean(
+      Compiler::CompileBaseline(isolate, function));
+}
+
 RUNTIME_FUNCTION(Runtime_EnsureFeedbackVectorForFunction) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -0,0 +1,192 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/lz4-block-codec.h"
+
+#include <memory>
+
+#include "src/base/logging.h"
+#include "src/base/memory.h"
+#include "src/utils/memcopy.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Constants of the LZ4 block format.
+constexpr size_t kMinMatch = 4;
+constexpr size_t kLastLiterals = 5;
+constexpr size_t kMatchSearchLimit = 12;
+constexpr size_t kMaxOffset = 65535;
+constexpr unsigned kRunMask = 15;
+
+constexpr int kHashLog = 16;
+
+uint32_t Load32(const byte* p) {
+  return base::ReadUnalignedValue<uint32_t>(reinterpret_cast<Address>(p));
+}
+
+uint32_t Hash(uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32 - kHashLog);
+}
+
+// Writes the part of a length that does not fit into a token nibble.
+byte* WriteLength(byte* op, size_t length) {
+  while (length >= 255) {
+    *op++ = 255;
+    length -= 255;
+  }
+  *op++ = static_cast<byte>(length);
+  return op;
+}
+
+byte* WriteSequence(byte* op, const byte* literals, size_t literal_length,
+                    size_t offset, size_t match_length) {
+  byte* token = op++;
+  if (literal_length >= kRunMask) {
+    *token = kRunMask << 4;
+    op = WriteLength(op, literal_length - kRunMask);
+  } else {
+    *token = static_cast<byte>(literal_length << 4);
+  }
+  MemCopy(op, literals, literal_length);
+  op += literal_length;
+  if (match_length == 0) return op;  // The last sequence has no match.
+
+  DCHECK_LE(offset, kMaxOffset);
+  *op++ = static_cast<byte>(offset);
+  *op++ = static_cast<byte>(offset >> 8);
+  size_t length = match_length - kMinMatch;
+  if (length >= kRunMask) {
+    *token |= kRunMask;
+    op = WriteLength(op, length - kRunMask);
+  } else {
+    *token |= static_cast<byte>(length);
+  }
+  return op;
+}
+
+// Reads the rest of a length whose token nibble was saturated.
+bool ReadLength(const byte** ip, const byte* input_end, size_t* length) {
+  byte b;
+  do {
+    if (*ip >= input_end) return false;
+    b = *(*ip)++;
+    *length += b;
+  } while (b == 255);
+  return true;
+}
+
+}  // namespace
+
+// static
+size_t Lz4BlockCodec::CompressBound(size_t input_size) {
+  return input_size + input_size / 255 + 16;
+}
+
+// static
+size_t Lz4BlockCodec::Compress(const byte* input, size_t input_size,
+                               byte* output, size_t output_capacity) {
+  CHECK_GE(output_capacity, CompressBound(input_size));
+  byte* op = output;
+  size_t anchor = 0;
+
+  if (input_size > kMatchSearchLimit) {
+    // Positions of the most recent occurrence of each hashed 4-byte sequence.
+    std::unique_ptr<uint32_t[]> table(new uint32_t[size_t{1} << kHashLog]());
+    const size_t match_start_limit = input_size - kMatchSearchLimit;
+    const size_t match_end_limit = input_size - kLastLiterals;
+    size_t ip = 0;
+    while (ip < match_start_limit) {
+      uint32_t sequence = Load32(input + ip);
+      uint32_t hash = Hash(sequence);
+      size_t candidate = table[hash];
+      table[hash] = static_cast<uint32_t>(ip);
+      size_t offset = ip - candidate;
+      if (offset == 0 || offset > kMaxOffset ||
+          Load32(input + candidate) != sequence) {
+        // Skip ahead faster through incompressible data.
+        ip += 1 + ((ip - anchor) >> 6);
+        continue;
+      }
+      while (ip > anchor && candidate > 0 &&
+             input[ip - 1] == input[candidate - 1]) {
+        ip--;
+        candidate--;
+      }
+      size_t match_length = kMinMatch;
+      while (ip + match_length < match_end_limit &&
+             input[ip + match_length] == input[candidate + match_length]) {
+        match_length++;
+      }
+      op = WriteSequence(op, input + anchor, ip - anchor, offset,
+                         match_length);
+      ip += match_length;
+      anchor = ip;
+      if (ip < match_start_limit) {
+        table[Hash(Load32(input + ip - 2))] = static_cast<uint32_t>(ip - 2);
+      }
+    }
+  }
+
+  op = WriteSequence(op, input + anchor, input_size - anchor, 0, 0);
+  DCHECK_LE(static_cast<size_t>(op - output), output_capacity);
+  return op - output;
+}
+
+// static
+bool Lz4BlockCodec::Decompress(const byte* input, size_t input_size,
+                               byte* output, size_t output_size) {
+  const byte* ip = input;
+  const byte* const input_end = input + input_size;
+  byte* op = output;
+  byte* const output_end = output + output_size;
+
+  while (ip < input_end) {
+    const unsigned token = *ip++;
+
+    size_t literal_length = token >> 4;
+    if (literal_length == kRunMask &&
+        !ReadLength(&ip, input_end, &literal_length)) {
+      return false;
+    }
+    if (literal_length > static_cast<size_t>(input_end - ip) ||
+        literal_length > static_cast<size_t>(output_end - op)) {
+      return false;
+    }
+    MemCopy(op, ip, literal_length);
+    ip += literal_length;
+    op += literal_length;
+    if (ip == input_end) return op == output_end;
+
+    if (input_end - ip < 2) return false;
+    const size_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > static_cast<size_t>(op - output)) {
+      return false;
+    }
+
+    size_t match_length = token & kRunMask;
+    if (match_length == kRunMask &&
+        !ReadLength(&ip, input_end, &match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+    if (match_length > static_cast<size_t>(output_end - op)) return false;
+
+    const byte* match = op - offset;
+    if (offset >= match_length) {
+      MemCopy(op, match, match_length);
+      op += match_length;
+    } else {
+      // Overlapping matches repeat the last |offset| bytes.
+      for (byte* end = op + match_length; op < end;) *op++ = *match++;
+    }
+  }
+  return false;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -4,7 +4,15 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/snapshot/lz4-block-codec.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,83 +20,261 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// Compressed snapshot layout:
+// [0] codec
+// [1] uncompressed size
+// [2] number of chunks N
+// [3] compressed size of chunk 0
+// ...
+// ... compressed size of chunk N - 1
+// ... chunk 0 data
+// ... chunk 1 data
+// ...
+// Every chunk but the last holds kChunkSize bytes of uncompressed data. Chunks
+// are compressed independently so that they can be decompressed in parallel.
+constexpr uint32_t kCodecOffset = 0;
+constexpr uint32_t kUncompressedSizeOffset = kCodecOffset + kUInt32Size;
+constexpr uint32_t kNumChunksOffset = kUncompressedSizeOffset + kUInt32Size;
+constexpr uint32_t kFirstChunkSizeOffset = kNumChunksOffset + kUInt32Size;
+
+uint32_t GetHeaderValue(const byte* data, uint32_t offset) {
+  return base::ReadLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(data) + offset);
+}
+
+void SetHeaderValue(byte* data, uint32_t offset, uint32_t value) {
+  base::WriteLittleEndianValue(reinterpret_cast<Address>(data) + offset,
+                               value);
+}
+
+uint32_t NumberOfChunks(uint32_t uncompressed_size) {
+  return uncompressed_size == 0
+             ? 1
+             : (uncompressed_size + SnapshotCompression::kChunkSize - 1) /
+                   SnapshotCompression::kChunkSize;
+}
+
+size_t CompressBound(SnapshotCompression::Codec codec, uint32_t size) {
+  switch (codec) {
+    case SnapshotCompression::Codec::kZlib:
+      return compressBound(static_cast<uLong>(size));
+    case SnapshotCompression::Codec::kLz4:
+      return Lz4BlockCodec::CompressBound(size);
+  }
+  UNREACHABLE();
+}
+
+size_t CompressChunk(SnapshotCompression::Codec codec, const byte* input,
+                     uint32_t input_size, byte* output,
+                     size_t output_capacity) {
+  switch (codec) {
+    case SnapshotCompression::Codec::kZlib: {
+      static_assert(sizeof(Bytef) == 1, "");
+      uLongf compressed_size = static_cast<uLongf>(output_capacity);
+      CHECK_EQ(zlib_internal::CompressHelper(
+                   zlib_internal::ZRAW, bit_cast<Bytef*>(output),
+                   &compressed_size, bit_cast<const Bytef*>(input),
+                   static_cast<uLong>(input_size), Z_DEFAULT_COMPRESSION,
+                   nullptr, nullptr),
+               Z_OK);
+      return compressed_size;
+    }
+    case SnapshotCompression::Codec::kLz4:
+      return Lz4BlockCodec::Compress(input, input_size, output,
+                                     output_capacity);
+  }
+  UNREACHABLE();
+}
+
+void DecompressChunk(SnapshotCompression::Codec codec, const byte* input,
+                     uint32_t input_size, byte* output, uint32_t output_size) {
+  switch (codec) {
+    case SnapshotCompression::Codec::kZlib: {
+      uLongf uncompressed_size = output_size;
+      CHECK_EQ(zlib_internal::UncompressHelper(
+                   zlib_internal::ZRAW, bit_cast<Bytef*>(output),
+                   &uncompressed_size, bit_cast<const Bytef*>(input),
+                   static_cast<uLong>(input_size)),
+               Z_OK);
+      CHECK_EQ(output_size, uncompressed_size);
+      return;
+    }
+    case SnapshotCompression::Codec::kLz4:
+      CHECK(Lz4BlockCodec::Decompress(input, input_size, output, output_size));
+      return;
+  }
+  UNREACHABLE();
+}
+
+// Describes where a chunk lives in the compressed and the uncompressed data.
+struct Chunk {
+  const byte* input;
+  uint32_t input_size;
+  byte* output;
+  uint32_t output_size;
+};
+
+class DecompressionJob final : public JobTask {
+ public:
+  DecompressionJob(SnapshotCompression::Codec codec,
+                   const std::vector<Chunk>* chunks)
+      : codec_(codec), chunks_(chunks), remaining_chunks_(chunks->size()) {}
+
+  void Run(JobDelegate* delegate) override {
+    for (size_t i = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+         i < chunks_->size();
+         i = next_chunk_.fetch_add(1, std::memory_order_relaxed)) {
+      const Chunk& chunk = (*chunks_)[i];
+      DecompressChunk(codec_, chunk.input, chunk.input_size, chunk.output,
+                      chunk.output_size);
+      remaining_chunks_.fetch_sub(1, std::memory_order_relaxed);
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return remaining_chunks_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const SnapshotCompression::Codec codec_;
+  const std::vector<Chunk>* chunks_;
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<size_t> remaining_chunks_;
+};
+
+}  // namespace
+
+constexpr uint32_t SnapshotCompression::kChunkSize;
+
+// static
+bool SnapshotCompression::CodecFromString(const char* name,
+                                          Codec* codec_out) {
+  if (strcmp(name, "zlib") == 0) {
+    *codec_out = Codec::kZlib;
+    return true;
+  }
+  if (strcmp(name, "lz4") == 0) {
+    *codec_out = Codec::kLz4;
+    return true;
+  }
+  return false;
 }
 
+// static
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
+  Codec codec;
+  if (!CodecFromString(FLAG_snapshot_compression_codec, &codec)) {
+    FATAL("Unknown snapshot compression codec '%s'",
+          FLAG_snapshot_compression_codec);
+  }
+  return Compress(uncompressed_data, codec);
+}
+
+// static
+SnapshotData SnapshotCompression::Compress(
+    const SnapshotData* uncompressed_data, Codec codec) {
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
-  static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
+  const byte* input = uncompressed_data->RawData().begin();
+  const uint32_t payload_length =
       static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  const uint32_t num_chunks = NumberOfChunks(payload_length);
+  const uint32_t header_size = kFirstChunkSizeOffset + num_chunks * kUInt32Size;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  size_t max_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    max_size += CompressBound(codec, kChunkSize);
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(max_size));
 
   byte* compressed_data = const_cast<byte*>(snapshot_data.RawData().begin());
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
+  SetHeaderValue(compressed_data, kCodecOffset, static_cast<uint32_t>(codec));
+  SetHeaderValue(compressed_data, kUncompressedSizeOffset, payload_length);
+  SetHeaderValue(compressed_data, kNumChunksOffset, num_chunks);
 
-  CHECK_EQ(zlib_internal::CompressHelper(
-               zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-               &compressed_data_size,
-               bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-               input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-           Z_OK);
+  size_t compressed_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t chunk_start = i * kChunkSize;
+    uint32_t chunk_size = std::min(kChunkSize, payload_length - chunk_start);
+    size_t compressed_chunk_size =
+        CompressChunk(codec, input + chunk_start, chunk_size,
+                      compressed_data + compressed_size,
+                      max_size - compressed_size);
+    SetHeaderValue(compressed_data, kFirstChunkSizeOffset + i * kUInt32Size,
+                   static_cast<uint32_t>(compressed_chunk_size));
+    compressed_size += compressed_chunk_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(static_cast<uint32_t>(compressed_size));
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
 
+// static
 SnapshotData SnapshotCompression::Decompress(
     Vector<const byte> compressed_data) {
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef = bit_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  const byte* input = compressed_data.begin();
+  CHECK_GE(compressed_data.size(), kFirstChunkSizeOffset);
+  const uint32_t codec_id = GetHeaderValue(input, kCodecOffset);
+  CHECK_LE(codec_id, static_cast<uint32_t>(Codec::kLz4));
+  const Codec codec = static_cast<Codec>(codec_id);
+  const uint32_t uncompressed_payload_length =
+      GetHeaderValue(input, kUncompressedSizeOffset);
+  const uint32_t num_chunks = GetHeaderValue(input, kNumChunksOffset);
+  CHECK_EQ(num_chunks, NumberOfChunks(uncompressed_payload_length));
+  const uint32_t header_size = kFirstChunkSizeOffset + num_chunks * kUInt32Size;
+  CHECK_GE(compressed_data.size(), header_size);
 
   snapshot_data.AllocateData(uncompressed_payload_length);
+  byte* output = const_cast<byte*>(snapshot_data.RawData().begin());
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  std::vector<Chunk> chunks(num_chunks);
+  size_t chunk_offset = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    Chunk& chunk = chunks[i];
+    chunk.input_size =
+        GetHeaderValue(input, kFirstChunkSizeOffset + i * kUInt32Size);
+    CHECK_LE(chunk.input_size, compressed_data.size() - chunk_offset);
+    chunk.input = input + chunk_offset;
+    chunk.output = output + i * kChunkSize;
+    chunk.output_size =
+        std::min(kChunkSize, uncompressed_payload_length - i * kChunkSize);
+    chunk_offset += chunk.input_size;
+  }
+
+  if (num_chunks > 1 && FLAG_parallel_snapshot_decompression) {
+    V8::GetCurrentPlatform()
+        ->PostJob(v8::TaskPriority::kUserBlocking,
+                  std::make_unique<DecompressionJob>(codec, &chunks))
+        ->Join();
+  } else {
+    for (const Chunk& chunk : chunks) {
+      DecompressChunk(codec, chunk.input, chunk.input_size, chunk.output,
+                      chunk.output_size);
+    }
+  }
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
@@ -13,10 +13,28 @@ namespace internal {
 
 class SnapshotCompression : public AllStatic {
  public:
+  // The codec id is stored in the compressed data, so Decompress handles
+  // data compressed with any of them.
+  enum class Codec : uint32_t {
+    kZlib = 0,
+    kLz4 = 1,
+  };
+
+  // Compresses with the codec selected by --snapshot-compression-codec.
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
+  V8_EXPORT_PRIVATE static SnapshotData Compress(
+      const SnapshotData* uncompressed_data, Codec codec);
+  // Decompresses independently compressed chunks in parallel on worker
+  // threads, unless --no-parallel-snapshot-decompression is passed.
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       Vector<const byte> compressed_data);
+
+  V8_EXPORT_PRIVATE static bool CodecFromString(const char* name,
+                                                Codec* codec_out);
+
+  // Size of the uncompressed data in each chunk but the last.
+  static constexpr uint32_t kChunkSize = 256 * KB;
 };
 
 }  // namespace internal
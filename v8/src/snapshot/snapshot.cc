@@ -131,6 +131,18 @@ bool Snapshot::HasContextSnapshot(Isolate* isolate, size_t index) {
   return index < num_contexts;
 }
 
+// static
+void Snapshot::ForEachUncompressedSnapshotDataForTesting(
+    const v8::StartupData* blob,
+    const std::function<void(const SnapshotData&)>& callback) {
+  callback(MaybeDecompress(SnapshotImpl::ExtractStartupData(blob)));
+  callback(MaybeDecompress(SnapshotImpl::ExtractReadOnlyData(blob)));
+  uint32_t num_contexts = SnapshotImpl::ExtractNumContexts(blob);
+  for (uint32_t i = 0; i < num_contexts; i++) {
+    callback(MaybeDecompress(SnapshotImpl::ExtractContextData(blob, i)));
+  }
+}
+
 bool Snapshot::VersionIsValid(const v8::StartupData* data) {
   char version[SnapshotImpl::kVersionStringLength];
   memset(version, 0, SnapshotImpl::kVersionStringLength);
@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_SNAPSHOT_H_
 #define V8_SNAPSHOT_SNAPSHOT_H_
 
+#include <functional>
+
 #include "include/v8.h"  // For StartupData.
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -85,6 +87,12 @@ class Snapshot : public AllStatic {
   V8_EXPORT_PRIVATE static void SerializeDeserializeAndVerifyForTesting(
       Isolate* isolate, Handle<Context> default_context);
 
+  // Calls |callback| with the startup, read-only and context snapshot data in
+  // |blob|, decompressed in builds with snapshot compression.
+  V8_EXPORT_PRIVATE static void ForEachUncompressedSnapshotDataForTesting(
+      const v8::StartupData* blob,
+      const std::function<void(const SnapshotData&)>& callback);
+
   // ---------------- Helper methods ------------------------------------------
 
   static bool HasContextSnapshot(Isolate* isolate, size_t index);
@@ -115,8 +115,27 @@ class ReplacementStringBuilder {
 
 class IncrementalStringBuilder {
  public:
+  // Receives the parts of the result as they are completed, instead of
+  // having them accumulated into one string. This bounds the memory used by
+  // the builder to about the size of one part.
+  class Sink {
+   public:
+    virtual ~Sink() = default;
+    // Returns false to stop writing. The builder then reports overflow and
+    // drops any further parts.
+    virtual bool Write(Handle<String> part) = 0;
+  };
+
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // Must be called before anything is appended. With a sink, there is no
+  // limit on the length of the result, and Finish() returns the empty
+  // string, or an empty handle (without an exception) if the sink stopped.
+  void set_sink(Sink* sink) {
+    DCHECK_EQ(0, Length());
+    sink_ = sink;
+  }
+
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -177,6 +196,9 @@ class IncrementalStringBuilder {
 
   V8_INLINE bool HasOverflowed() const { return overflowed_; }
 
+  // Whether the sink asked to stop writing.
+  V8_INLINE bool SinkStopped() const { return overflowed_ && sink_ != nullptr; }
+
   int Length() const;
 
   // Change encoding to two-byte.
@@ -293,6 +315,7 @@ class IncrementalStringBuilder {
   static const int kIntToCStringBufferSize = 100;
 
   Isolate* isolate_;
+  Sink* sink_ = nullptr;
   String::Encoding encoding_;
   bool overflowed_;
   int part_length_;
@@ -246,6 +246,12 @@ int IncrementalStringBuilder::Length() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (sink_ != nullptr) {
+    if (!overflowed_ && new_part->length() > 0 && !sink_->Write(new_part)) {
+      overflowed_ = true;
+    }
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
@@ -279,6 +285,7 @@ MaybeHandle<String> IncrementalStringBuilder::Finish() {
   ShrinkCurrentPart();
   Accumulate(current_part());
   if (overflowed_) {
+    if (sink_ != nullptr) return MaybeHandle<String>();
     THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError(), String);
   }
   return accumulator();
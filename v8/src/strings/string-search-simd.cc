@@ -0,0 +1,190 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search-simd.h"
+
+#include "src/base/bits.h"
+#include "src/utils/simd-dispatch.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The loops below search subject[index, limit) for the first candidate
+// position. A pair candidate i also reads subject[i + distance].
+
+template <typename Char>
+int FindCharScalar(const Char* subject, int index, int limit, Char c) {
+  for (int i = index; i < limit; i++) {
+    if (subject[i] == c) return i;
+  }
+  return -1;
+}
+
+template <typename Char>
+int FindCharPairScalar(const Char* subject, int index, int limit, Char first,
+                       Char last, int distance) {
+  for (int i = index; i < limit; i++) {
+    if (subject[i] == first && subject[i + distance] == last) return i;
+  }
+  return -1;
+}
+
+#if V8_HOST_ARCH_X64
+
+// Returns a vector with every character set to {c}.
+template <typename Char>
+__m128i Splat(Char c) {
+  return sizeof(Char) == 1 ? _mm_set1_epi8(static_cast<char>(c))
+                           : _mm_set1_epi16(static_cast<int16_t>(c));
+}
+
+// Sets the characters that are equal in {x} and {y} to all ones.
+template <typename Char>
+__m128i Equal(__m128i x, __m128i y) {
+  return sizeof(Char) == 1 ? _mm_cmpeq_epi8(x, y) : _mm_cmpeq_epi16(x, y);
+}
+
+template <typename Char>
+__m128i Load(const Char* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+// Movemask sets one bit per byte, i.e. two bits per two-byte character.
+template <typename Char>
+int FirstIndex(int i, uint32_t mask) {
+  return i + base::bits::CountTrailingZeros(mask) / sizeof(Char);
+}
+
+template <typename Char>
+int FindCharSSE2(const Char* subject, int index, int limit, Char c) {
+  constexpr int kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  const __m128i needle = Splat(c);
+  int i = index;
+  for (; limit - i >= kCharsPerVector; i += kCharsPerVector) {
+    uint32_t mask = _mm_movemask_epi8(Equal<Char>(Load(subject + i), needle));
+    if (mask != 0) return FirstIndex<Char>(i, mask);
+  }
+  return FindCharScalar(subject, i, limit, c);
+}
+
+template <typename Char>
+int FindCharPairSSE2(const Char* subject, int index, int limit, Char first,
+                     Char last, int distance) {
+  constexpr int kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  const __m128i first_needle = Splat(first);
+  const __m128i last_needle = Splat(last);
+  int i = index;
+  for (; limit - i >= kCharsPerVector; i += kCharsPerVector) {
+    __m128i first_eq = Equal<Char>(Load(subject + i), first_needle);
+    __m128i last_eq = Equal<Char>(Load(subject + i + distance), last_needle);
+    uint32_t mask = _mm_movemask_epi8(_mm_and_si128(first_eq, last_eq));
+    if (mask != 0) return FirstIndex<Char>(i, mask);
+  }
+  return FindCharPairScalar(subject, i, limit, first, last, distance);
+}
+
+#endif  // V8_HOST_ARCH_X64
+
+#if V8_SIMD_DISPATCH
+
+template <typename Char>
+V8_TARGET_AVX2 __m256i Splat256(Char c) {
+  return sizeof(Char) == 1 ? _mm256_set1_epi8(static_cast<char>(c))
+                           : _mm256_set1_epi16(static_cast<int16_t>(c));
+}
+
+template <typename Char>
+V8_TARGET_AVX2 __m256i Equal256(__m256i x, __m256i y) {
+  return sizeof(Char) == 1 ? _mm256_cmpeq_epi8(x, y)
+                           : _mm256_cmpeq_epi16(x, y);
+}
+
+template <typename Char>
+V8_TARGET_AVX2 __m256i Load256(const Char* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+template <typename Char>
+V8_TARGET_AVX2 int FindCharAVX2(const Char* subject, int index, int limit,
+                                Char c) {
+  constexpr int kCharsPerVector = sizeof(__m256i) / sizeof(Char);
+  const __m256i needle = Splat256(c);
+  int i = index;
+  for (; limit - i >= kCharsPerVector; i += kCharsPerVector) {
+    uint32_t mask = static_cast<uint32_t>(
+        _mm256_movemask_epi8(Equal256<Char>(Load256(subject + i), needle)));
+    if (mask != 0) return FirstIndex<Char>(i, mask);
+  }
+  return FindCharSSE2(subject, i, limit, c);
+}
+
+template <typename Char>
+V8_TARGET_AVX2 int FindCharPairAVX2(const Char* subject, int index, int limit,
+                                    Char first, Char last, int distance) {
+  constexpr int kCharsPerVector = sizeof(__m256i) / sizeof(Char);
+  const __m256i first_needle = Splat256(first);
+  const __m256i last_needle = Splat256(last);
+  int i = index;
+  for (; limit - i >= kCharsPerVector; i += kCharsPerVector) {
+    __m256i first_eq = Equal256<Char>(Load256(subject + i), first_needle);
+    __m256i last_eq =
+        Equal256<Char>(Load256(subject + i + distance), last_needle);
+    uint32_t mask = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_and_si256(first_eq, last_eq)));
+    if (mask != 0) return FirstIndex<Char>(i, mask);
+  }
+  return FindCharPairSSE2(subject, i, limit, first, last, distance);
+}
+
+#endif  // V8_SIMD_DISPATCH
+
+}  // namespace
+
+// static
+template <typename Char>
+int StringSearchSimd::FindChar(Vector<const Char> subject, int index, Char c) {
+  DCHECK_LE(0, index);
+  const Char* chars = subject.begin();
+  int limit = subject.length();
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) return FindCharAVX2(chars, index, limit, c);
+#endif
+#if V8_HOST_ARCH_X64
+  return FindCharSSE2(chars, index, limit, c);
+#else
+  return FindCharScalar(chars, index, limit, c);
+#endif
+}
+
+// static
+template <typename Char>
+int StringSearchSimd::FindCharPair(Vector<const Char> subject, int index,
+                                   Char first, Char last, int distance) {
+  DCHECK_LE(0, index);
+  DCHECK_LE(0, distance);
+  const Char* chars = subject.begin();
+  int limit = subject.length() - distance;
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) {
+    return FindCharPairAVX2(chars, index, limit, first, last, distance);
+  }
+#endif
+#if V8_HOST_ARCH_X64
+  return FindCharPairSSE2(chars, index, limit, first, last, distance);
+#else
+  return FindCharPairScalar(chars, index, limit, first, last, distance);
+#endif
+}
+
+template int StringSearchSimd::FindChar(Vector<const uint8_t>, int, uint8_t);
+template int StringSearchSimd::FindChar(Vector<const uint16_t>, int, uint16_t);
+template int StringSearchSimd::FindCharPair(Vector<const uint8_t>, int,
+                                            uint8_t, uint8_t, int);
+template int StringSearchSimd::FindCharPair(Vector<const uint16_t>, int,
+                                            uint16_t, uint16_t, int);
+
+}  // namespace internal
+}  // namespace v8
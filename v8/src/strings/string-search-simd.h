@@ -0,0 +1,45 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SEARCH_SIMD_H_
+#define V8_STRINGS_STRING_SEARCH_SIMD_H_
+
+#include "src/common/globals.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized character filters for StringSearch. On x64 they compare 16
+// (SSE2) or 32 (AVX2, if the CPU and OS support it) bytes of the subject at
+// a time; elsewhere they are plain loops, and StringSearch sticks to its
+// scalar strategies.
+class V8_EXPORT_PRIVATE StringSearchSimd : public AllStatic {
+ public:
+#if V8_HOST_ARCH_X64
+  static constexpr bool kIsVectorized = true;
+#else
+  static constexpr bool kIsVectorized = false;
+#endif
+
+  // Longest pattern for which StringSearch filters candidate positions by
+  // the first and last character of the pattern. For longer patterns,
+  // Boyer-Moore skips more than a vector's worth of characters at a time.
+  static const int kMaxFilteredPatternLength = 32;
+
+  // Returns the first index i >= {index} with subject[i] == {c}, or -1.
+  template <typename Char>
+  static int FindChar(Vector<const Char> subject, int index, Char c);
+
+  // Returns the first index i >= {index} with subject[i] == {first} and
+  // subject[i + distance] == {last}, or -1 if there is none in {subject}.
+  template <typename Char>
+  static int FindCharPair(Vector<const Char> subject, int index, Char first,
+                          Char last, int distance);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SEARCH_SIMD_H_
@@ -6,6 +6,7 @@
 #define V8_STRINGS_STRING_SEARCH_H_
 
 #include "src/execution/isolate.h"
+#include "src/strings/string-search-simd.h"
 #include "src/utils/vector.h"
 
 namespace v8 {
@@ -65,11 +66,16 @@ class StringSearch : private StringSearchBase {
       }
     }
     int pattern_length = pattern_.length();
+    if (pattern_length == 1) {
+      strategy_ = &SingleCharSearch;
+      return;
+    }
+    if (StringSearchSimd::kIsVectorized &&
+        pattern_length <= StringSearchSimd::kMaxFilteredPatternLength) {
+      strategy_ = &FirstAndLastCharSearch;
+      return;
+    }
     if (pattern_length < kBMMinPatternLength) {
-      if (pattern_length == 1) {
-        strategy_ = &SingleCharSearch;
-        return;
-      }
       strategy_ = &LinearSearch;
       return;
     }
@@ -107,6 +113,10 @@ class StringSearch : private StringSearchBase {
   static int LinearSearch(StringSearch<PatternChar, SubjectChar>* search,
                           Vector<const SubjectChar> subject, int start_index);
 
+  static int FirstAndLastCharSearch(
+      StringSearch<PatternChar, SubjectChar>* search,
+      Vector<const SubjectChar> subject, int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            Vector<const SubjectChar> subject, int start_index);
 
@@ -196,6 +206,13 @@ inline int FindFirstCharacter(Vector<const PatternChar> pattern,
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
 
+  if (sizeof(SubjectChar) == 2 && StringSearchSimd::kIsVectorized) {
+    // Unlike memchr, this compares whole characters rather than one of
+    // their bytes.
+    return StringSearchSimd::FindChar(
+        subject.SubVector(0, max_n), index,
+        static_cast<SubjectChar>(pattern_first_char));
+  }
   if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
     // Special-case looking for the 0 char in other than one-byte strings.
     // memchr mostly fails in this case due to every other byte being 0 in text
@@ -283,6 +300,52 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   return -1;
 }
 
+//---------------------------------------------------------------------
+// First and last character filter search
+//---------------------------------------------------------------------
+
+// Vectorized search for short patterns: candidates are the positions where
+// both the first and the last character of the pattern match, which rules
+// out most positions even if both characters are common. If too many
+// candidates fail verification (e.g. for "aaaaaaab" in "aaaa...a"), long
+// enough patterns upgrade to BoyerMooreHorspool.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::FirstAndLastCharSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    Vector<const SubjectChar> subject, int index) {
+  Vector<const PatternChar> pattern = search->pattern_;
+  int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  DCHECK_LE(pattern_length, StringSearchSimd::kMaxFilteredPatternLength);
+  // The pattern fits into SubjectChar, or the constructor would have chosen
+  // FailSearch.
+  const SubjectChar first = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  // As in InitialSearch, badness counts the characters compared in vain,
+  // but the characters skipped by the filter earn some of it back.
+  const int min_badness = -10 - (pattern_length << 2);
+  int badness = min_badness;
+  int i = index;
+  while (true) {
+    int candidate = StringSearchSimd::FindCharPair(subject, i, first, last,
+                                                   pattern_length - 1);
+    if (candidate == -1) return -1;
+    if (pattern_length == 2 ||
+        CharCompare(pattern.begin() + 1, subject.begin() + candidate + 1,
+                    pattern_length - 2)) {
+      return candidate;
+    }
+    badness = Max(min_badness, badness - (candidate - i)) + pattern_length;
+    i = candidate + 1;
+    if (badness > 0 && pattern_length >= kBMMinPatternLength) {
+      search->PopulateBoyerMooreHorspoolTable();
+      search->strategy_ = &BoyerMooreHorspoolSearch;
+      return BoyerMooreHorspoolSearch(search, subject, i);
+    }
+  }
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
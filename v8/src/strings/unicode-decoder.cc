@@ -5,6 +5,7 @@
 #include "src/strings/unicode-decoder.h"
 
 #include "src/strings/unicode-inl.h"
+#include "src/strings/utf8-simd.h"
 #include "src/utils/memcopy.h"
 
 namespace v8 {
@@ -12,14 +13,23 @@ namespace internal {
 
 Utf8Decoder::Utf8Decoder(const Vector<const uint8_t>& chars)
     : encoding_(Encoding::kAscii),
-      non_ascii_start_(NonAsciiStart(chars.begin(), chars.length())),
+      non_ascii_start_(static_cast<int>(
+          Utf8Simd::AsciiPrefixLength(chars.begin(), chars.length()))),
+      valid_end_(non_ascii_start_),
       utf16_length_(non_ascii_start_) {
   if (non_ascii_start_ == chars.length()) return;
 
   const uint8_t* cursor = chars.begin() + non_ascii_start_;
   const uint8_t* end = chars.begin() + chars.length();
 
+  // The DFA is only needed from the first ill-formed sequence on.
+  size_t valid_length = Utf8Simd::ValidPrefixLength(cursor, end - cursor);
   bool is_one_byte = true;
+  utf16_length_ += static_cast<int>(
+      Utf8Simd::Utf16Length(cursor, valid_length, &is_one_byte));
+  cursor += valid_length;
+  valid_end_ += static_cast<int>(valid_length);
+
   uint32_t incomplete_char = 0;
   unibrow::Utf8::State state = unibrow::Utf8::State::kAccept;
 
@@ -48,10 +58,13 @@ void Utf8Decoder::Decode(Char* out, const Vector<const uint8_t>& data) {
 
   out += non_ascii_start_;
 
+  out = Utf8Simd::Decode(data.begin() + non_ascii_start_,
+                         valid_end_ - non_ascii_start_, out);
+
   uint32_t incomplete_char = 0;
   unibrow::Utf8::State state = unibrow::Utf8::State::kAccept;
 
-  const uint8_t* cursor = data.begin() + non_ascii_start_;
+  const uint8_t* cursor = data.begin() + valid_end_;
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
@@ -58,6 +58,8 @@ class V8_EXPORT_PRIVATE Utf8Decoder final {
   bool is_one_byte() const { return encoding_ <= Encoding::kLatin1; }
   int utf16_length() const { return utf16_length_; }
   int non_ascii_start() const { return non_ascii_start_; }
+  // End of the well-formed prefix, which is decoded without the DFA.
+  int valid_end() const { return valid_end_; }
 
   template <typename Char>
   V8_EXPORT_PRIVATE void Decode(Char* out, const Vector<const uint8_t>& data);
@@ -65,6 +67,7 @@ class V8_EXPORT_PRIVATE Utf8Decoder final {
  private:
   Encoding encoding_;
   int non_ascii_start_;
+  int valid_end_;
   int utf16_length_;
 };
 
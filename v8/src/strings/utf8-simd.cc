@@ -0,0 +1,452 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/utf8-simd.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+#include "src/flags/flags.h"
+#include "src/strings/unicode-decoder.h"
+#include "src/strings/unicode.h"
+#include "src/utils/memcopy.h"
+#include "src/utils/simd-dispatch.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+size_t AsciiPrefixLengthScalar(const uint8_t* chars, size_t index,
+                               size_t length) {
+  for (size_t i = index; i < length; i++) {
+    if (chars[i] > unibrow::Utf8::kMaxOneByteChar) return i;
+  }
+  return length;
+}
+
+// Returns the end of the longest prefix of chars[index, length) that consists
+// of well-formed UTF-8 sequences, following Table 3-7 of the Unicode
+// standard. This is also what the DFA of unibrow::Utf8 accepts.
+size_t ValidPrefixLengthScalar(const uint8_t* chars, size_t index,
+                               size_t length) {
+  size_t i = index;
+  while (i < length) {
+    uint8_t lead = chars[i];
+    if (lead <= unibrow::Utf8::kMaxOneByteChar) {
+      i++;
+      continue;
+    }
+    size_t sequence_length;
+    uint8_t min_second = 0x80;
+    uint8_t max_second = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      sequence_length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      sequence_length = 3;
+      if (lead == 0xE0) min_second = 0xA0;  // Overlong.
+      if (lead == 0xED) max_second = 0x9F;  // Surrogate.
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      sequence_length = 4;
+      if (lead == 0xF0) min_second = 0x90;  // Overlong.
+      if (lead == 0xF4) max_second = 0x8F;  // Above U+10FFFF.
+    } else {
+      return i;
+    }
+    if (length - i < sequence_length) return i;
+    if (chars[i + 1] < min_second || chars[i + 1] > max_second) return i;
+    for (size_t j = 2; j < sequence_length; j++) {
+      if ((chars[i + j] & 0xC0) != 0x80) return i;
+    }
+    i += sequence_length;
+  }
+  return i;
+}
+
+// Returns the start of the sequence that {index} is in the middle of, given
+// that chars[0, index) has been validated up to a possibly incomplete
+// sequence at its end, or {index} if it is at a sequence boundary.
+size_t SequenceStart(const uint8_t* chars, size_t index) {
+  for (size_t i = index; i > 0 && index - i < 3;) {
+    uint8_t c = chars[--i];
+    if ((c & 0xC0) == 0x80) continue;
+    size_t sequence_length = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    return i + sequence_length > index ? i : index;
+  }
+  return index;
+}
+
+size_t Utf16LengthScalar(const uint8_t* chars, size_t index, size_t length,
+                         bool* is_one_byte) {
+  size_t utf16_length = 0;
+  bool one_byte = true;
+  for (size_t i = index; i < length; i++) {
+    uint8_t c = chars[i];
+    // Continuation bytes don't start a character; four-byte sequences
+    // decode to a surrogate pair. Leads above 0xC3 encode U+0100 or higher.
+    utf16_length += ((c & 0xC0) != 0x80) + (c >= 0xF0);
+    one_byte = one_byte && c < 0xC4;
+  }
+  *is_one_byte = *is_one_byte && one_byte;
+  return utf16_length;
+}
+
+// Decodes the well-formed sequence at chars[index] and returns the index of
+// the next one.
+template <typename Char>
+V8_INLINE size_t DecodeSequence(const uint8_t* chars, size_t index,
+                                Char** out) {
+  uint32_t c = chars[index];
+  if (c <= unibrow::Utf8::kMaxOneByteChar) {
+    *((*out)++) = static_cast<Char>(c);
+    return index + 1;
+  }
+  if (c < 0xE0) {
+    *((*out)++) =
+        static_cast<Char>(((c & 0x1F) << 6) | (chars[index + 1] & 0x3F));
+    return index + 2;
+  }
+  DCHECK_EQ(2, sizeof(Char));
+  if (c < 0xF0) {
+    *((*out)++) = static_cast<Char>(((c & 0x0F) << 12) |
+                                    ((chars[index + 1] & 0x3F) << 6) |
+                                    (chars[index + 2] & 0x3F));
+    return index + 3;
+  }
+  uint32_t code_point = ((c & 0x07) << 18) | ((chars[index + 1] & 0x3F) << 12) |
+                        ((chars[index + 2] & 0x3F) << 6) |
+                        (chars[index + 3] & 0x3F);
+  *((*out)++) = static_cast<Char>(unibrow::Utf16::LeadSurrogate(code_point));
+  *((*out)++) = static_cast<Char>(unibrow::Utf16::TrailSurrogate(code_point));
+  return index + 4;
+}
+
+template <typename Char>
+Char* DecodeScalar(const uint8_t* chars, size_t index, size_t length,
+                   Char* out) {
+  for (size_t i = index; i < length;) i = DecodeSequence(chars, i, &out);
+  return out;
+}
+
+#if V8_HOST_ARCH_X64
+
+__m128i Load(const uint8_t* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+size_t AsciiPrefixLengthSSE2(const uint8_t* chars, size_t length) {
+  size_t i = 0;
+  for (; length - i >= sizeof(__m128i); i += sizeof(__m128i)) {
+    uint32_t mask = _mm_movemask_epi8(Load(chars + i));
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask);
+  }
+  return AsciiPrefixLengthScalar(chars, i, length);
+}
+
+size_t Utf16LengthSSE2(const uint8_t* chars, size_t length,
+                       bool* is_one_byte) {
+  // Compared as signed bytes, continuation bytes are below -64, leads of
+  // four-byte sequences are above -17 and leads above 0xC3 are above -61.
+  const __m128i continuation_limit = _mm_set1_epi8(-64);
+  const __m128i four_byte_limit = _mm_set1_epi8(-17);
+  const __m128i two_byte_limit = _mm_set1_epi8(-61);
+  const __m128i zero = _mm_setzero_si128();
+  size_t utf16_length = 0;
+  uint32_t non_latin1 = 0;
+  size_t i = 0;
+  for (; length - i >= sizeof(__m128i); i += sizeof(__m128i)) {
+    __m128i input = Load(chars + i);
+    __m128i negative = _mm_cmplt_epi8(input, zero);
+    uint32_t continuations =
+        _mm_movemask_epi8(_mm_cmplt_epi8(input, continuation_limit));
+    uint32_t four_byte_leads = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpgt_epi8(input, four_byte_limit), negative));
+    non_latin1 |= _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpgt_epi8(input, two_byte_limit), negative));
+    utf16_length += sizeof(__m128i) -
+                    base::bits::CountPopulation(continuations) +
+                    base::bits::CountPopulation(four_byte_leads);
+  }
+  *is_one_byte = non_latin1 == 0;
+  return utf16_length + Utf16LengthScalar(chars, i, length, is_one_byte);
+}
+
+template <typename Char>
+void StoreAscii(Char* out, __m128i input) {
+  if (sizeof(Char) == 1) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), input);
+  } else {
+    const __m128i zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm_unpacklo_epi8(input, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8),
+                     _mm_unpackhi_epi8(input, zero));
+  }
+}
+
+// Stores runs of 16 ASCII characters at once and decodes everything else one
+// sequence at a time.
+template <typename Char>
+Char* DecodeSSE2(const uint8_t* chars, size_t length, Char* out) {
+  size_t i = 0;
+  while (length - i >= sizeof(__m128i)) {
+    __m128i input = Load(chars + i);
+    uint32_t mask = _mm_movemask_epi8(input);
+    if (mask == 0) {
+      StoreAscii(out, input);
+      out += sizeof(__m128i);
+      i += sizeof(__m128i);
+      continue;
+    }
+    size_t ascii_length = base::bits::CountTrailingZeros(mask);
+    CopyChars(out, chars + i, ascii_length);
+    out += ascii_length;
+    i += ascii_length;
+    do {
+      i = DecodeSequence(chars, i, &out);
+    } while (i < length && chars[i] > unibrow::Utf8::kMaxOneByteChar);
+  }
+  return DecodeScalar(chars, i, length, out);
+}
+
+#endif  // V8_HOST_ARCH_X64
+
+#if V8_SIMD_DISPATCH
+
+// Validation follows "Validating UTF-8 In Less Than One Instruction Per Byte"
+// by John Keiser and Daniel Lemire. Each byte is classified by the high and
+// low nibble of the previous byte and by its own high nibble; the three
+// lookups have a bit in common only if the two bytes form an invalid pair.
+// The only pair that is valid in some positions, two continuation bytes, is
+// checked against whether the bytes two and three back start a longer
+// sequence.
+constexpr uint8_t kTooShort = 1 << 0;    // Lead not followed by continuation.
+constexpr uint8_t kTooLong = 1 << 1;     // ASCII followed by continuation.
+constexpr uint8_t kOverlong3 = 1 << 2;   // E0 80..9F
+constexpr uint8_t kTooLarge = 1 << 3;    // F4 90..BF, F5..FF
+constexpr uint8_t kSurrogate = 1 << 4;   // ED A0..BF
+constexpr uint8_t kOverlong2 = 1 << 5;   // C0, C1
+constexpr uint8_t kTooLarge1000 = 1 << 6;  // F5..FF 80..8F
+constexpr uint8_t kOverlong4 = 1 << 6;   // F0 80..8F
+constexpr uint8_t kTwoConts = 1 << 7;    // Continuation after continuation.
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+alignas(16) constexpr uint8_t kByte1High[16] = {
+    // 0_______: ASCII.
+    kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+    kTooLong,
+    // 10______: Continuation.
+    kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+    // 1100____, 1101____: Two-byte lead.
+    kTooShort | kOverlong2, kTooShort,
+    // 1110____: Three-byte lead.
+    kTooShort | kOverlong3 | kSurrogate,
+    // 1111____: Four-byte lead.
+    kTooShort | kTooLarge | kTooLarge1000 | kOverlong4};
+
+alignas(16) constexpr uint8_t kByte1Low[16] = {
+    // ____0000
+    kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+    // ____0001
+    kCarry | kOverlong2,
+    // ____001_
+    kCarry, kCarry,
+    // ____0100
+    kCarry | kTooLarge,
+    // ____0101 to ____1100
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+    // ____1101
+    kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+    // ____111_
+    kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000};
+
+alignas(16) constexpr uint8_t kByte2High[16] = {
+    // 0_______: ASCII.
+    kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+    kTooShort, kTooShort,
+    // 1000____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 |
+        kOverlong4,
+    // 1001____
+    kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+    // 101_____
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+    // 11______: Lead.
+    kTooShort, kTooShort, kTooShort, kTooShort};
+
+V8_TARGET_SSSE3 __m128i Lookup(const uint8_t* table, __m128i nibbles) {
+  return _mm_shuffle_epi8(Load(table), nibbles);
+}
+
+// Returns non-zero bytes where {input}, preceded by {prev_input}, is invalid.
+V8_TARGET_SSSE3 __m128i CheckSSSE3(__m128i input, __m128i prev_input) {
+  const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+  __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+  __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+  __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+  __m128i special_cases = _mm_and_si128(
+      _mm_and_si128(
+          Lookup(kByte1High,
+                 _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask)),
+          Lookup(kByte1Low, _mm_and_si128(prev1, nibble_mask))),
+      Lookup(kByte2High,
+             _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask)));
+  // Bytes two back of at least 0xE0 and three back of at least 0xF0 start
+  // sequences that need the byte to be a continuation.
+  __m128i must_be_continuation = _mm_and_si128(
+      _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                   _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))),
+      _mm_set1_epi8(static_cast<char>(0x80)));
+  return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+V8_TARGET_SSSE3 size_t ValidPrefixLengthSSSE3(const uint8_t* chars,
+                                              size_t length) {
+  __m128i prev_input = _mm_setzero_si128();
+  bool prev_is_ascii = true;
+  size_t i = 0;
+  for (; length - i >= sizeof(__m128i); i += sizeof(__m128i)) {
+    __m128i input = Load(chars + i);
+    bool is_ascii = _mm_movemask_epi8(input) == 0;
+    if (!is_ascii || !prev_is_ascii) {
+      __m128i error = CheckSSSE3(input, prev_input);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) !=
+          0xFFFF) {
+        break;
+      }
+    }
+    prev_input = input;
+    prev_is_ascii = is_ascii;
+  }
+  // Let the scalar loop find the exact end of the valid prefix in the block
+  // with an error, and deal with the remaining bytes.
+  return ValidPrefixLengthScalar(chars, SequenceStart(chars, i), length);
+}
+
+V8_TARGET_AVX2 __m256i Load256(const uint8_t* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+V8_TARGET_AVX2 __m256i Lookup256(const uint8_t* table, __m256i nibbles) {
+  return _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(Load(table)),
+                             nibbles);
+}
+
+V8_TARGET_AVX2 __m256i CheckAVX2(__m256i input, __m256i prev_input) {
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+  // Byte shifts work on 128-bit lanes, so shift in the upper half of
+  // {prev_input} and the lower half of {input}.
+  __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+  __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+  __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+  __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+  __m256i special_cases = _mm256_and_si256(
+      _mm256_and_si256(
+          Lookup256(kByte1High,
+                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask)),
+          Lookup256(kByte1Low, _mm256_and_si256(prev1, nibble_mask))),
+      Lookup256(kByte2High,
+                _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask)));
+  __m256i must_be_continuation = _mm256_and_si256(
+      _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+                      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80))),
+      _mm256_set1_epi8(static_cast<char>(0x80)));
+  return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+V8_TARGET_AVX2 size_t ValidPrefixLengthAVX2(const uint8_t* chars,
+                                            size_t length) {
+  __m256i prev_input = _mm256_setzero_si256();
+  bool prev_is_ascii = true;
+  size_t i = 0;
+  for (; length - i >= sizeof(__m256i); i += sizeof(__m256i)) {
+    __m256i input = Load256(chars + i);
+    bool is_ascii = _mm256_movemask_epi8(input) == 0;
+    if (!is_ascii || !prev_is_ascii) {
+      if (!_mm256_testz_si256(CheckAVX2(input, prev_input),
+                              _mm256_set1_epi8(-1))) {
+        break;
+      }
+    }
+    prev_input = input;
+    prev_is_ascii = is_ascii;
+  }
+  return ValidPrefixLengthScalar(chars, SequenceStart(chars, i), length);
+}
+
+V8_TARGET_AVX2 size_t AsciiPrefixLengthAVX2(const uint8_t* chars,
+                                            size_t length) {
+  size_t i = 0;
+  for (; length - i >= sizeof(__m256i); i += sizeof(__m256i)) {
+    uint32_t mask =
+        static_cast<uint32_t>(_mm256_movemask_epi8(Load256(chars + i)));
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask);
+  }
+  return i + AsciiPrefixLengthSSE2(chars + i, length - i);
+}
+
+#endif  // V8_SIMD_DISPATCH
+
+}  // namespace
+
+// static
+size_t Utf8Simd::AsciiPrefixLength(const uint8_t* chars, size_t length) {
+  // --no-utf8-simd leaves all non-ASCII input to the DFA.
+  if (!FLAG_utf8_simd) {
+    size_t ascii_length =
+        static_cast<size_t>(NonAsciiStart(chars, static_cast<int>(length)));
+    return std::min(ascii_length, length);
+  }
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) return AsciiPrefixLengthAVX2(chars, length);
+#endif
+#if V8_HOST_ARCH_X64
+  return AsciiPrefixLengthSSE2(chars, length);
+#else
+  return AsciiPrefixLengthScalar(chars, 0, length);
+#endif
+}
+
+// static
+size_t Utf8Simd::ValidPrefixLength(const uint8_t* chars, size_t length) {
+  if (!FLAG_utf8_simd) return 0;
+#if V8_SIMD_DISPATCH
+  if (SimdDispatch::has_avx2()) return ValidPrefixLengthAVX2(chars, length);
+  if (SimdDispatch::has_ssse3()) return ValidPrefixLengthSSSE3(chars, length);
+#endif
+  return ValidPrefixLengthScalar(chars, 0, length);
+}
+
+// static
+size_t Utf8Simd::Utf16Length(const uint8_t* chars, size_t length,
+                             bool* is_one_byte) {
+  DCHECK_EQ(length, ValidPrefixLengthScalar(chars, 0, length));
+#if V8_HOST_ARCH_X64
+  return Utf16LengthSSE2(chars, length, is_one_byte);
+#else
+  *is_one_byte = true;
+  return Utf16LengthScalar(chars, 0, length, is_one_byte);
+#endif
+}
+
+// static
+template <typename Char>
+Char* Utf8Simd::Decode(const uint8_t* chars, size_t length, Char* out) {
+  DCHECK_EQ(length, ValidPrefixLengthScalar(chars, 0, length));
+#if V8_HOST_ARCH_X64
+  return DecodeSSE2(chars, length, out);
+#else
+  return DecodeScalar(chars, 0, length, out);
+#endif
+}
+
+template uint8_t* Utf8Simd::Decode(const uint8_t*, size_t, uint8_t*);
+template uint16_t* Utf8Simd::Decode(const uint8_t*, size_t, uint16_t*);
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,46 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_UTF8_SIMD_H_
+#define V8_STRINGS_UTF8_SIMD_H_
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized UTF-8 validation and decoding for Utf8Decoder and the UTF-8
+// streaming character stream. On x64, ASCII runs are handled 16 (SSE2) or 32
+// (AVX2) bytes at a time, and validation uses the lookup-table algorithm of
+// Keiser and Lemire with SSSE3 or AVX2, as selected by SimdDispatch;
+// elsewhere these are scalar loops.
+//
+// Only well-formed input is decoded here. Callers decode the rest, i.e.
+// ill-formed and incomplete sequences, with the DFA of unibrow::Utf8, which
+// also takes care of replacing them with U+FFFD.
+class V8_EXPORT_PRIVATE Utf8Simd : public AllStatic {
+ public:
+  // Returns the number of leading ASCII bytes of {chars}.
+  static size_t AsciiPrefixLength(const uint8_t* chars, size_t length);
+
+  // Returns the length of the longest prefix of {chars} that consists of
+  // complete, well-formed UTF-8 sequences.
+  static size_t ValidPrefixLength(const uint8_t* chars, size_t length);
+
+  // Returns the number of UTF-16 code units that the well-formed UTF-8 in
+  // {chars} decodes to, and whether all of them are Latin-1 characters.
+  static size_t Utf16Length(const uint8_t* chars, size_t length,
+                            bool* is_one_byte);
+
+  // Decodes the well-formed UTF-8 in {chars} into {out} and returns the end
+  // of the output. One-byte output requires {chars} to be Latin-1 only, see
+  // {Utf16Length}.
+  template <typename Char>
+  static Char* Decode(const uint8_t* chars, size_t length, Char* out);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_UTF8_SIMD_H_
@@ -0,0 +1,27 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/utils/simd-dispatch.h"
+
+#include "src/base/cpu.h"
+#include "src/codegen/cpu-features.h"
+
+namespace v8 {
+namespace internal {
+
+bool SimdDispatch::has_ssse3_ = false;
+bool SimdDispatch::has_avx2_ = false;
+
+// static
+void SimdDispatch::InitializeOncePerProcess() {
+#if V8_SIMD_DISPATCH && V8_TARGET_ARCH_X64
+  // CpuFeatures takes care of checking that the OS saves the AVX registers
+  // and of --no-enable-ssse3 and --no-enable-avx.
+  has_ssse3_ = CpuFeatures::IsSupported(SSSE3);
+  has_avx2_ = CpuFeatures::IsSupported(AVX) && base::CPU().has_avx2();
+#endif
+}
+
+}  // namespace internal
+}  // namespace v8
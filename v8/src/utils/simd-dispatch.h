@@ -0,0 +1,46 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_UTILS_SIMD_DISPATCH_H_
+#define V8_UTILS_SIMD_DISPATCH_H_
+
+#include "src/common/globals.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#if defined(__clang__) || defined(__GNUC__)
+#include <immintrin.h>
+// Functions marked with these attributes are compiled for SSSE3 or AVX2 even
+// if the rest of V8 is not, and must only be called if SimdDispatch reports
+// that the CPU supports the instructions.
+#define V8_SIMD_DISPATCH 1
+#define V8_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define V8_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Selects the vector instructions used by the hand-vectorized string helpers
+// (e.g. JsonSimd). On x64 they use SSE2 unconditionally, and SSSE3 or AVX2
+// code compiled with the attributes above if the host supports it.
+class V8_EXPORT_PRIVATE SimdDispatch : public AllStatic {
+ public:
+  // Probes the host, after CpuFeatures::Probe. Until this is called, only
+  // the baseline instructions of the host architecture are used.
+  static void InitializeOncePerProcess();
+
+  static bool has_ssse3() { return has_ssse3_; }
+  static bool has_avx2() { return has_avx2_; }
+
+ private:
+  static bool has_ssse3_;
+  static bool has_avx2_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_UTILS_SIMD_DISPATCH_H_
@@ -277,6 +277,9 @@ class LiftoffCompiler {
     std::unique_ptr<ElseState> else_state;
     LiftoffAssembler::CacheState label_state;
     MovableLabel label;
+    // Position of the loop header, used to estimate the size of the loop body
+    // for the tiering budget.
+    WasmCodePosition loop_position = 0;
 
     MOVE_ONLY_NO_DEFAULT_CONSTRUCTOR(Control);
 
@@ -333,6 +336,11 @@ class LiftoffCompiler {
       return {{},           {}, WasmCode::kWasmStackGuard,     pos,
               regs_to_save, 0,  debug_sidetable_entry_builder, spilled_regs};
     }
+    static OutOfLineCode TierupCheck(WasmCodePosition pos,
+                                     LiftoffRegList regs_to_save) {
+      return {{}, {}, WasmCode::kWasmTriggerTierUp, pos, regs_to_save,
+              0,  {}, nullptr};
+    }
   };
 
   LiftoffCompiler(compiler::CallDescriptor* call_descriptor,
@@ -540,9 +548,38 @@ class LiftoffCompiler {
     return false;
   }
 
-  void TierUpFunction(FullDecoder* decoder) {
-    __ CallRuntimeStub(WasmCode::kWasmTriggerTierUp);
-    DefineSafepoint();
+  bool dynamic_tiering() const {
+    return FLAG_wasm_dynamic_tiering && for_debugging_ == kNoDebugging &&
+           env_->runtime_exception_support;
+  }
+
+  // Subtracts {budget_used} from the tiering budget of this function, and
+  // calls {WasmTriggerTierUp} out of line once the budget is used up.
+  void TierupCheck(WasmCodePosition position, int budget_used) {
+    if (!dynamic_tiering()) return;
+    DEBUG_CODE_COMMENT("tierup check");
+    LiftoffRegList pinned;
+    LiftoffRegister budget_array =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    LiftoffRegister budget = pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    out_of_line_code_.push_back(OutOfLineCode::TierupCheck(
+        position, __ cache_state()->used_registers));
+    OutOfLineCode& ool = out_of_line_code_.back();
+
+    LOAD_INSTANCE_FIELD(budget_array.gp(), TieringBudgetArray,
+                        kSystemPointerSize);
+    uint32_t offset =
+        kInt32Size * declared_function_index(env_->module, func_index_);
+    __ Load(budget, budget_array.gp(), no_reg, offset, LoadType::kI32Load,
+            pinned);
+    __ emit_i32_addi(budget.gp(), budget.gp(), -std::max(budget_used, 1));
+    __ Store(budget_array.gp(), no_reg, offset, budget, StoreType::kI32Store,
+             pinned);
+    // Extract the sign bit, so that the unary "unequal" (different from zero)
+    // jumps if the budget is negative.
+    __ emit_i32_shri(budget.gp(), budget.gp(), 31);
+    __ emit_cond_jump(kUnequal, ool.label.get(), kWasmI32, budget.gp());
+    __ bind(ool.continuation.get());
   }
 
   void TraceFunctionEntry(FullDecoder* decoder) {
@@ -650,44 +687,9 @@ class LiftoffCompiler {
     // is never a position of any instruction in the function.
     StackCheck(0);
 
-    if (FLAG_wasm_dynamic_tiering) {
-      // TODO(arobin): Avoid spilling registers unconditionally.
-      __ SpillAllRegisters();
-      DEBUG_CODE_COMMENT("dynamic tiering");
-      LiftoffRegList pinned;
-
-      // Get the number of calls array address.
-      LiftoffRegister array_address =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      LOAD_INSTANCE_FIELD(array_address.gp(), NumLiftoffFunctionCallsArray,
-                          kSystemPointerSize);
-
-      // Compute the correct offset in the array.
-      uint32_t offset =
-          kInt32Size * declared_function_index(env_->module, func_index_);
-
-      // Get the number of calls and update it.
-      LiftoffRegister old_number_of_calls =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      LiftoffRegister new_number_of_calls =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      __ Load(old_number_of_calls, array_address.gp(), no_reg, offset,
-              LoadType::kI32Load, pinned);
-      __ emit_i32_addi(new_number_of_calls.gp(), old_number_of_calls.gp(), 1);
-      __ Store(array_address.gp(), no_reg, offset, new_number_of_calls,
-               StoreType::kI32Store, pinned);
-
-      // Emit the runtime call if necessary.
-      Label no_tierup;
-      // Check if the number of calls is a power of 2.
-      __ emit_i32_and(old_number_of_calls.gp(), old_number_of_calls.gp(),
-                      new_number_of_calls.gp());
-      // Unary "unequal" means "different from zero".
-      __ emit_cond_jump(kUnequal, &no_tierup, kWasmI32,
-                        old_number_of_calls.gp());
-      TierUpFunction(decoder);
-      __ bind(&no_tierup);
-    }
+    // Each call uses up budget proportional to the size of the function. Like
+    // the stack check, this is associated with position 0.
+    TierupCheck(0, static_cast<int>(decoder->end() - decoder->start()));
 
     if (FLAG_trace_wasm) TraceFunctionEntry(decoder);
   }
@@ -697,6 +699,7 @@ class LiftoffCompiler {
         (std::string("out of line: ") + GetRuntimeStubName(ool->stub)).c_str());
     __ bind(ool->label.get());
     const bool is_stack_check = ool->stub == WasmCode::kWasmStackGuard;
+    const bool is_tierup = ool->stub == WasmCode::kWasmTriggerTierUp;
     const bool is_mem_out_of_bounds =
         ool->stub == WasmCode::kThrowWasmTrapMemOutOfBounds;
 
@@ -739,9 +742,9 @@ class LiftoffCompiler {
     if (V8_UNLIKELY(ool->debug_sidetable_entry_builder)) {
       ool->debug_sidetable_entry_builder->set_pc_offset(__ pc_offset());
     }
-    DCHECK_EQ(ool->continuation.get()->is_bound(), is_stack_check);
+    DCHECK_EQ(ool->continuation.get()->is_bound(), is_stack_check || is_tierup);
     if (!ool->regs_to_save.is_empty()) __ PopRegisters(ool->regs_to_save);
-    if (is_stack_check) {
+    if (is_stack_check || is_tierup) {
       if (V8_UNLIKELY(ool->spilled_registers != nullptr)) {
         DCHECK(for_debugging_);
         for (auto& entry : ool->spilled_registers->entries) {
@@ -867,6 +870,7 @@ class LiftoffCompiler {
 
     // Loop labels bind at the beginning of the block.
     __ bind(loop->label.get());
+    loop->loop_position = decoder->position();
 
     // Save the current cache state for the merge when jumping to this loop.
     loop->label_state.Split(*__ cache_state());
@@ -1934,7 +1938,17 @@ class LiftoffCompiler {
     __ jmp(target->label.get());
   }
 
-  void Br(FullDecoder* decoder, Control* target) { BrImpl(target); }
+  // Loop back edges use up budget proportional to the size of the loop body.
+  void LoopTierupCheck(FullDecoder* decoder, Control* target) {
+    if (!target->is_loop()) return;
+    TierupCheck(decoder->position(),
+                decoder->position() - target->loop_position);
+  }
+
+  void Br(FullDecoder* decoder, Control* target) {
+    LoopTierupCheck(decoder, target);
+    BrImpl(target);
+  }
 
   void BrOrRet(FullDecoder* decoder, uint32_t depth) {
     if (depth == decoder->control_depth() - 1) {
@@ -1951,6 +1965,9 @@ class LiftoffCompiler {
     if (depth != decoder->control_depth() - 1) {
       __ MaterializeMergedConstants(
           decoder->control_at(depth)->br_merge()->arity);
+      // The budget is checked before the condition, because the check must not
+      // change the cache state on only one of the two paths.
+      LoopTierupCheck(decoder, decoder->control_at(depth));
     }
 
     Label cont_false;
@@ -2021,6 +2038,20 @@ class LiftoffCompiler {
 
   void BrTable(FullDecoder* decoder, const BranchTableImmediate<validate>& imm,
                const Value& key) {
+    if (dynamic_tiering()) {
+      // Check the budget once, before the key is popped, if any of the
+      // targets is a loop.
+      BranchTableIterator<validate> target_iterator(decoder, imm);
+      while (target_iterator.has_next()) {
+        uint32_t depth = target_iterator.next();
+        if (depth == decoder->control_depth() - 1) continue;
+        Control* target = decoder->control_at(depth);
+        if (target->is_loop()) {
+          LoopTierupCheck(decoder, target);
+          break;
+        }
+      }
+    }
     LiftoffRegList pinned;
     LiftoffRegister value = pinned.set(__ PopToRegister());
     BranchTableIterator<validate> table_iterator(decoder, imm);
@@ -9,6 +9,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
+#include "src/base/bits.h"
 #include "src/base/enum-set.h"
 #include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
@@ -618,6 +619,9 @@ class CompilationStateImpl {
   }
 
   CompileMode compile_mode() const { return compile_mode_; }
+  // With dynamic tiering, functions are only compiled with the top tier once
+  // their Liftoff code found them to be hot, see {TriggerTierUp}.
+  bool dynamic_tiering() const { return dynamic_tiering_; }
   Counters* counters() const { return async_counters_.get(); }
   WasmFeatures* detected_features() { return &detected_features_; }
 
@@ -646,6 +650,7 @@ class CompilationStateImpl {
   NativeModule* const native_module_;
   std::weak_ptr<NativeModule> const native_module_weak_;
   const CompileMode compile_mode_;
+  const bool dynamic_tiering_;
   const std::shared_ptr<Counters> async_counters_;
 
   // Compilation error, atomically updated. This flag can be updated and read
@@ -941,7 +946,8 @@ class CompilationUnitBuilder {
     // down when the module is fully compiled. Synchronization would be pretty
     // difficult otherwise.
     baseline_units_.emplace_back(func_index, tiers.baseline_tier, kNoDebugging);
-    if (tiers.baseline_tier != tiers.top_tier) {
+    if (tiers.baseline_tier != tiers.top_tier &&
+        !compilation_state()->dynamic_tiering()) {
       tiering_units_.emplace_back(func_index, tiers.top_tier, kNoDebugging);
     }
   }
@@ -1132,7 +1138,8 @@ bool CompileLazy(Isolate* isolate, NativeModule* native_module,
   const bool lazy_module = IsLazyModule(module);
   if (GetCompileStrategy(module, enabled_features, func_index, lazy_module) ==
           CompileStrategy::kLazy &&
-      tiers.baseline_tier < tiers.top_tier) {
+      tiers.baseline_tier < tiers.top_tier &&
+      !compilation_state->dynamic_tiering()) {
     WasmCompilationUnit tiering_unit{func_index, tiers.top_tier, kNoDebugging};
     compilation_state->AddTopTierCompilationUnit(tiering_unit);
   }
@@ -1144,15 +1151,27 @@ void TriggerTierUp(Isolate* isolate, NativeModule* native_module,
                    int func_index) {
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
-  WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
-                                   kNoDebugging};
-
-  uint32_t* call_array = native_module->num_liftoff_function_calls_array();
-  int offset =
+  int declared_index =
       wasm::declared_function_index(native_module->module(), func_index);
 
-  size_t priority =
-      base::Relaxed_Load(reinterpret_cast<int*>(&call_array[offset]));
+  // Refill the budget, so that Liftoff code only calls back once per budget
+  // while the TurboFan code is not available yet.
+  base::Relaxed_Store(&native_module->tiering_budget_array()[declared_index],
+                      FLAG_wasm_tiering_budget);
+  isolate->counters()->wasm_tiering_budget_exhausted()->Increment();
+  if (native_module->HasCodeWithTier(func_index, ExecutionTier::kTurbofan)) {
+    return;
+  }
+
+  // The priority is the number of times the budget was used up. Only add a
+  // unit the first time, and when the priority doubled again (from 4 on), to
+  // move the function up in the queue without adding a unit per call.
+  int priority = native_module->IncreaseTierUpPriority(declared_index);
+  if (priority == 2 || !base::bits::IsPowerOfTwo(priority)) return;
+
+  isolate->counters()->wasm_dynamic_tier_up_units()->Increment();
+  WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
+                                   kNoDebugging};
   compilation_state->AddTopTierPriorityCompilationUnit(tiering_unit, priority);
 }
 
@@ -2720,6 +2739,8 @@ CompilationStateImpl::CompilationStateImpl(
                             native_module->module()->origin == kWasmOrigin
                         ? CompileMode::kTiering
                         : CompileMode::kRegular),
+      dynamic_tiering_(FLAG_wasm_dynamic_tiering &&
+                       native_module->module()->origin == kWasmOrigin),
       async_counters_(std::move(async_counters)),
       compilation_unit_queues_(native_module->num_functions()) {}
 
@@ -2768,10 +2789,11 @@ void CompilationStateImpl::InitializeCompilationProgress(
         GetCompileStrategy(module, enabled_features, func_index, lazy_module);
 
     bool required_for_baseline = strategy == CompileStrategy::kEager;
-    bool required_for_top_tier = strategy != CompileStrategy::kLazy;
-    DCHECK_EQ(required_for_top_tier,
-              strategy == CompileStrategy::kEager ||
-                  strategy == CompileStrategy::kLazyBaselineEagerTopTier);
+    // Compilation hints can still request eager top tier compilation with
+    // dynamic tiering.
+    bool required_for_top_tier =
+        strategy == CompileStrategy::kLazyBaselineEagerTopTier ||
+        (strategy == CompileStrategy::kEager && !dynamic_tiering_);
 
     // Count functions to complete baseline and top tier compilation.
     if (required_for_baseline) outstanding_baseline_units_++;
@@ -2793,7 +2815,8 @@ void CompilationStateImpl::InitializeCompilationProgress(
   DCHECK_IMPLIES(lazy_module, outstanding_baseline_units_ == 0);
   DCHECK_IMPLIES(lazy_module, outstanding_top_tier_functions_ == 0);
   DCHECK_LE(0, outstanding_baseline_units_);
-  DCHECK_LE(outstanding_baseline_units_, outstanding_top_tier_functions_);
+  DCHECK_IMPLIES(!dynamic_tiering_, outstanding_baseline_units_ <=
+                                        outstanding_top_tier_functions_);
   outstanding_baseline_units_ += num_import_wrappers;
   outstanding_export_wrappers_ = num_export_wrappers;
 
@@ -820,13 +820,12 @@ NativeModule::NativeModule(WasmEngine* engine, const WasmFeatures& enabled,
   if (module_->num_declared_functions > 0) {
     code_table_ =
         std::make_unique<WasmCode*[]>(module_->num_declared_functions);
-    num_liftoff_function_calls_ =
-        std::make_unique<uint32_t[]>(module_->num_declared_functions);
-
-    // Start counter at 4 to avoid runtime calls for smaller numbers.
-    constexpr int kCounterStart = 4;
-    std::fill_n(num_liftoff_function_calls_.get(),
-                module_->num_declared_functions, kCounterStart);
+    tiering_budgets_ =
+        std::make_unique<int32_t[]>(module_->num_declared_functions);
+    std::fill_n(tiering_budgets_.get(), module_->num_declared_functions,
+                FLAG_wasm_tiering_budget);
+    tier_up_priorities_ =
+        std::make_unique<std::atomic<int>[]>(module_->num_declared_functions);
   }
   code_allocator_.Init(this);
 }
@@ -1881,12 +1880,29 @@ void NativeModule::SampleCodeSize(
         counters->wasm_module_freed_code_size_percent()->AddSample(
             freed_percent);
       }
+      // With dynamic tiering, also sample how many functions were compiled
+      // with TurboFan. The rest would have been compiled eagerly otherwise.
+      if (FLAG_wasm_dynamic_tiering && module()->num_declared_functions > 0) {
+        int tiered_up_percent =
+            100 * NumDynamicallyTieredUpFunctions() /
+            static_cast<int>(module()->num_declared_functions);
+        counters->wasm_module_tiered_up_functions_percent()->AddSample(
+            tiered_up_percent);
+      }
       break;
     }
   }
   histogram->AddSample(code_size_mb);
 }
 
+int NativeModule::NumDynamicallyTieredUpFunctions() const {
+  int result = 0;
+  for (uint32_t i = 0; i < module_->num_declared_functions; ++i) {
+    if (tier_up_priorities_[i].load(std::memory_order_relaxed) > 0) ++result;
+  }
+  return result;
+}
+
 std::unique_ptr<WasmCode> NativeModule::AddCompiledCode(
     WasmCompilationResult result) {
   std::vector<std::unique_ptr<WasmCode>> code = AddCompiledCode({&result, 1});
@@ -667,10 +667,23 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Get or create the debug info for this NativeModule.
   DebugInfo* GetDebugInfo();
 
-  uint32_t* num_liftoff_function_calls_array() {
-    return num_liftoff_function_calls_.get();
+  // Per declared function budget that Liftoff code decrements on function
+  // entry and loop back edges when dynamic tiering is enabled. When the budget
+  // is used up, Liftoff code calls {TriggerTierUp}.
+  int32_t* tiering_budget_array() { return tiering_budgets_.get(); }
+
+  // Counts how often the function at {declared_function_index} used up its
+  // tiering budget and returns the new count.
+  int IncreaseTierUpPriority(int declared_function_index) {
+    return tier_up_priorities_[declared_function_index].fetch_add(
+               1, std::memory_order_relaxed) +
+           1;
   }
 
+  // Returns the number of functions that used up their tiering budget at
+  // least once.
+  int NumDynamicallyTieredUpFunctions() const;
+
  private:
   friend class WasmCode;
   friend class WasmCodeAllocator;
@@ -757,8 +770,10 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // A cache of the import wrappers, keyed on the kind and signature.
   std::unique_ptr<WasmImportWrapperCache> import_wrapper_cache_;
 
-  // Array to handle number of function calls.
-  std::unique_ptr<uint32_t[]> num_liftoff_function_calls_;
+  // Arrays for dynamic tiering, see {tiering_budget_array} and
+  // {IncreaseTierUpPriority}.
+  std::unique_ptr<int32_t[]> tiering_budgets_;
+  std::unique_ptr<std::atomic<int>[]> tier_up_priorities_;
 
   // This mutex protects concurrent calls to {AddCode} and friends.
   mutable base::Mutex allocation_mutex_;
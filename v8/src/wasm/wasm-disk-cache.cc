@@ -0,0 +1,230 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wasm-disk-cache.h"
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "include/v8-platform.h"
+#include "src/base/functional.h"
+#include "src/base/memory.h"
+#include "src/base/platform/platform.h"
+#include "src/codegen/cpu-features.h"
+#include "src/init/v8.h"
+#include "src/tracing/trace-event.h"
+#include "src/wasm/compilation-environment.h"
+#include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-serialization.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+#define TRACE_CACHE(...)                                 \
+  do {                                                   \
+    if (FLAG_trace_wasm_disk_cache) PrintF(__VA_ARGS__); \
+  } while (false)
+
+namespace {
+
+// Every entry starts with this header, followed by a copy of the wire bytes
+// (padded to a multiple of 8 bytes) and then the serialized module. The copy
+// is what tells entries apart; the hash only names the file.
+struct EntryHeader {
+  static constexpr uint32_t kMagic = 0x57444332;  // "WDC2"
+
+  uint32_t magic;
+  uint32_t padding;
+  uint64_t wire_bytes_length;
+  uint64_t wire_bytes_hash;
+};
+
+// This runs on every compilation, on modules of tens of megabytes, so hash
+// eight bytes at a time.
+uint64_t WireBytesHash(Vector<const uint8_t> bytes) {
+  size_t hash = bytes.size();
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= bytes.size(); i += sizeof(uint64_t)) {
+    uint64_t word = base::ReadUnalignedValue<uint64_t>(
+        reinterpret_cast<Address>(bytes.begin() + i));
+    hash = base::hash_combine(hash, base::hash_value(word));
+  }
+  for (; i < bytes.size(); i++) {
+    hash = base::hash_combine(hash, bytes[i]);
+  }
+  return hash;
+}
+
+size_t ModuleOffset(size_t wire_bytes_length) {
+  return sizeof(EntryHeader) + RoundUp<sizeof(uint64_t)>(wire_bytes_length);
+}
+
+std::string EntryPath(const std::string& directory, uint64_t hash,
+                      size_t length) {
+  char name[64];
+  base::OS::SNPrintF(name, sizeof(name), "/%016" PRIx64 "-%zx-%x.wasm", hash,
+                     length, CpuFeatures::SupportedFeatures());
+  return directory + name;
+}
+
+class StoreJob : public JobTask {
+ public:
+  StoreJob(WasmDiskCache* cache, std::weak_ptr<NativeModule> native_module)
+      : cache_(cache), native_module_(std::move(native_module)) {}
+
+  void Run(JobDelegate* delegate) override {
+    if (done_.exchange(true, std::memory_order_relaxed)) return;
+    if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      cache_->Store(native_module.get());
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return done_.load(std::memory_order_relaxed) ? 0 : 1;
+  }
+
+ private:
+  WasmDiskCache* const cache_;
+  const std::weak_ptr<NativeModule> native_module_;
+  std::atomic<bool> done_{false};
+};
+
+class StoreAfterTopTierCallback {
+ public:
+  StoreAfterTopTierCallback(WasmDiskCache* cache,
+                            std::weak_ptr<NativeModule> native_module)
+      : cache_(cache), native_module_(std::move(native_module)) {}
+
+  void operator()(CompilationEvent event) {
+    if (event != CompilationEvent::kFinishedTopTierCompilation) return;
+    if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      // The engine joins the job before it dies, and with it the cache.
+      native_module->engine()->ShepherdCompileJobHandle(
+          V8::GetCurrentPlatform()->PostJob(
+              TaskPriority::kBestEffort,
+              std::make_unique<StoreJob>(cache_, native_module_)));
+    }
+  }
+
+ private:
+  WasmDiskCache* cache_;
+  std::weak_ptr<NativeModule> native_module_;
+};
+
+}  // namespace
+
+WasmDiskCache::WasmDiskCache(const char* directory) : directory_(directory) {}
+
+std::string WasmDiskCache::EntryPath(Vector<const uint8_t> wire_bytes) const {
+  return wasm::EntryPath(directory_, WireBytesHash(wire_bytes),
+                         wire_bytes.size());
+}
+
+MaybeHandle<WasmModuleObject> WasmDiskCache::Load(
+    Isolate* isolate, Vector<const uint8_t> wire_bytes) {
+  TRACE_EVENT0("v8.wasm", "wasm.DiskCacheLoad");
+  uint64_t hash = WireBytesHash(wire_bytes);
+  std::string path = wasm::EntryPath(directory_, hash, wire_bytes.size());
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  size_t module_offset = ModuleOffset(wire_bytes.size());
+  if (!file || file->size() < module_offset) {
+    TRACE_CACHE("wasm disk cache: miss %s\n", path.c_str());
+    return {};
+  }
+  Vector<const uint8_t> data(static_cast<const uint8_t*>(file->memory()),
+                             file->size());
+  EntryHeader header = base::ReadUnalignedValue<EntryHeader>(
+      reinterpret_cast<Address>(data.begin()));
+  if (header.magic != EntryHeader::kMagic ||
+      header.wire_bytes_length != wire_bytes.size() ||
+      header.wire_bytes_hash != hash) {
+    TRACE_CACHE("wasm disk cache: invalid entry %s\n", path.c_str());
+    return {};
+  }
+  // Equal hashes and lengths do not make equal modules; only the full wire
+  // bytes do.
+  if (memcmp(data.begin() + sizeof(EntryHeader), wire_bytes.begin(),
+             wire_bytes.size()) != 0) {
+    TRACE_CACHE("wasm disk cache: collision %s\n", path.c_str());
+    return {};
+  }
+  // The deserializer copies everything it needs out of the mapping.
+  MaybeHandle<WasmModuleObject> result = DeserializeNativeModule(
+      isolate, data + module_offset, wire_bytes, {});
+  TRACE_CACHE("wasm disk cache: %s %s\n",
+              result.is_null() ? "stale entry" : "hit", path.c_str());
+  return result;
+}
+
+bool WasmDiskCache::Store(NativeModule* native_module) {
+  TRACE_EVENT0("v8.wasm", "wasm.DiskCacheStore");
+  Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
+  uint64_t hash = WireBytesHash(wire_bytes);
+  std::string path = wasm::EntryPath(directory_, hash, wire_bytes.size());
+  if (FILE* existing = base::OS::FOpen(path.c_str(), "rb")) {
+    // Another process, or an earlier module in this one, was faster.
+    fclose(existing);
+    return true;
+  }
+
+  // Keep the code alive while it is serialized on a background thread.
+  WasmCodeRefScope code_ref_scope;
+  for (uint32_t i = native_module->num_imported_functions();
+       i < native_module->num_functions(); i++) {
+    native_module->GetCode(i);
+  }
+  WasmSerializer serializer(native_module);
+  size_t module_size = serializer.GetSerializedNativeModuleSize();
+  size_t module_offset = ModuleOffset(wire_bytes.size());
+  size_t size = module_offset + module_size;
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[size]);
+  EntryHeader header = {EntryHeader::kMagic, 0, wire_bytes.size(), hash};
+  base::WriteUnalignedValue(reinterpret_cast<Address>(buffer.get()), header);
+  uint8_t* wire_bytes_copy = buffer.get() + sizeof(EntryHeader);
+  memcpy(wire_bytes_copy, wire_bytes.begin(), wire_bytes.size());
+  memset(wire_bytes_copy + wire_bytes.size(), 0,
+         module_offset - sizeof(EntryHeader) - wire_bytes.size());
+  if (!serializer.SerializeNativeModule(
+          {buffer.get() + module_offset, module_size})) {
+    TRACE_CACHE("wasm disk cache: cannot serialize %s\n", path.c_str());
+    return false;
+  }
+
+  // Write to a file of our own and rename it into place, so that readers
+  // never see a partially written entry.
+  std::string temp_path = path + "." +
+                          std::to_string(base::OS::GetCurrentProcessId()) +
+                          "." +
+                          std::to_string(base::OS::GetCurrentThreadId());
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (file == nullptr) return false;
+  bool success = fwrite(buffer.get(), 1, size, file) == size;
+  success = fclose(file) == 0 && success;
+  if (!success || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    base::OS::Remove(temp_path.c_str());
+    TRACE_CACHE("wasm disk cache: cannot write %s\n", path.c_str());
+    return false;
+  }
+  TRACE_CACHE("wasm disk cache: stored %s (%zu bytes)\n", path.c_str(), size);
+  return true;
+}
+
+void WasmDiskCache::StoreAfterTopTier(
+    const std::shared_ptr<NativeModule>& native_module) {
+  if (native_module->module()->origin != kWasmOrigin) return;
+  native_module->compilation_state()->AddCallback(
+      StoreAfterTopTierCallback{this, native_module});
+}
+
+#undef TRACE_CACHE
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,66 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_WASM_WASM_DISK_CACHE_H_
+#define V8_WASM_WASM_DISK_CACHE_H_
+
+#include <memory>
+#include <string>
+
+#include "src/handles/maybe-handles.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class WasmModuleObject;
+
+namespace wasm {
+
+class NativeModule;
+
+// Caches fully tiered-up (TurboFan) native modules in a directory, so that
+// later processes can skip Liftoff and TurboFan compilation of the same wire
+// bytes. Entries are files named after a hash of the wire bytes and the
+// supported CPU features; their contents are the output of {WasmSerializer},
+// preceded by a header and a full copy of the wire bytes, which is compared
+// before anything is deserialized. Entries are written to a temporary file
+// first and then renamed, so that concurrent processes never see partial
+// entries. Entries that do not match (a different V8 version, different
+// flags, or a hash collision) are ignored and eventually overwritten.
+class V8_EXPORT_PRIVATE WasmDiskCache {
+ public:
+  // The directory must exist.
+  explicit WasmDiskCache(const char* directory);
+  WasmDiskCache(const WasmDiskCache&) = delete;
+  WasmDiskCache& operator=(const WasmDiskCache&) = delete;
+
+  // Returns the module compiled from {wire_bytes} by an earlier process, or
+  // an empty handle if there is no usable entry. Must be called in a
+  // HandleScope and with a context entered, like {DeserializeNativeModule}.
+  MaybeHandle<WasmModuleObject> Load(Isolate* isolate,
+                                     Vector<const uint8_t> wire_bytes);
+
+  // Writes the current code of {native_module} to the cache, unless the
+  // cache already has an entry for it. Returns false if the module cannot be
+  // serialized, e.g. because not all of its functions are TurboFan code.
+  bool Store(NativeModule* native_module);
+
+  // Stores {native_module} on a background thread once top-tier compilation
+  // finished. Does not keep the module alive.
+  void StoreAfterTopTier(const std::shared_ptr<NativeModule>& native_module);
+
+  // The path of the entry for {wire_bytes}.
+  std::string EntryPath(Vector<const uint8_t> wire_bytes) const;
+
+ private:
+  const std::string directory_;
+};
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_WASM_DISK_CACHE_H_
@@ -23,6 +23,7 @@
 #include "src/wasm/module-instantiate.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-debug.h"
+#include "src/wasm/wasm-disk-cache.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
 
@@ -387,7 +388,11 @@ struct WasmEngine::NativeModuleInfo {
   int8_t num_code_gcs_triggered = 0;
 };
 
-WasmEngine::WasmEngine() : code_manager_(FLAG_wasm_max_code_space * MB) {}
+WasmEngine::WasmEngine() : code_manager_(FLAG_wasm_max_code_space * MB) {
+  if (FLAG_wasm_disk_cache_dir != nullptr) {
+    disk_cache_ = std::make_unique<WasmDiskCache>(FLAG_wasm_disk_cache_dir);
+  }
+}
 
 WasmEngine::~WasmEngine() {
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
@@ -496,6 +501,11 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
     const ModuleWireBytes& bytes) {
   TRACE_EVENT0("v8.wasm", "wasm.SyncCompile");
+  Handle<WasmModuleObject> cached_module;
+  if (MaybeLoadFromDiskCache(isolate, enabled, bytes.module_bytes())
+          .ToHandle(&cached_module)) {
+    return cached_module;
+  }
   ModuleResult result = DecodeWasmModule(
       enabled, bytes.start(), bytes.end(), false, kWasmOrigin,
       isolate->counters(), isolate->metrics_recorder(),
@@ -589,6 +599,15 @@ void WasmEngine::AsyncCompile(
     const ModuleWireBytes& bytes, bool is_shared,
     const char* api_method_name_for_errors) {
   TRACE_EVENT0("v8.wasm", "wasm.AsyncCompile");
+  // Shared bytes could be modified concurrently, so only unshared bytes are
+  // looked up in the disk cache.
+  Handle<WasmModuleObject> cached_module;
+  if (!is_shared &&
+      MaybeLoadFromDiskCache(isolate, enabled, bytes.module_bytes())
+          .ToHandle(&cached_module)) {
+    resolver->OnCompilationSucceeded(cached_module);
+    return;
+  }
   if (!FLAG_wasm_async_compilation) {
     // Asynchronous compilation disabled; fall back on synchronous compilation.
     ErrorThrower thrower(isolate, api_method_name_for_errors);
@@ -633,6 +652,15 @@ void WasmEngine::AsyncCompile(
   job->Start();
 }
 
+MaybeHandle<WasmModuleObject> WasmEngine::MaybeLoadFromDiskCache(
+    Isolate* isolate, const WasmFeatures& enabled,
+    Vector<const uint8_t> wire_bytes) {
+  if (!disk_cache_) return {};
+  // Deserialization uses the features of the isolate.
+  if (!(enabled == WasmFeatures::FromIsolate(isolate))) return {};
+  return disk_cache_->Load(isolate, wire_bytes);
+}
+
 std::shared_ptr<StreamingDecoder> WasmEngine::StartStreamingCompilation(
     Isolate* isolate, const WasmFeatures& enabled, Handle<Context> context,
     const char* api_method_name,
@@ -1106,7 +1134,10 @@ bool WasmEngine::UpdateNativeModuleCache(
   auto prev = native_module->get();
   *native_module = native_module_cache_.Update(*native_module, error);
 
-  if (prev == native_module->get()) return true;
+  if (prev == native_module->get()) {
+    if (!error && disk_cache_) disk_cache_->StoreAfterTopTier(*native_module);
+    return true;
+  }
 
   bool recompile_module = false;
   {
@@ -39,6 +39,7 @@ class GdbServer;
 
 class AsyncCompileJob;
 class ErrorThrower;
+class WasmDiskCache;
 struct ModuleWireBytes;
 class WasmFeatures;
 
@@ -358,6 +359,11 @@ class V8_EXPORT_PRIVATE WasmEngine {
       Handle<Context> context, const char* api_method_name,
       std::shared_ptr<CompilationResultResolver> resolver);
 
+  // Returns the module for {wire_bytes} from the disk cache, if enabled.
+  MaybeHandle<WasmModuleObject> MaybeLoadFromDiskCache(
+      Isolate* isolate, const WasmFeatures& enabled,
+      Vector<const uint8_t> wire_bytes);
+
   void TriggerGC(int8_t gc_sequence_index);
 
   // Remove an isolate from the outstanding isolates of the current GC. Returns
@@ -372,6 +378,9 @@ class V8_EXPORT_PRIVATE WasmEngine {
   WasmCodeManager code_manager_;
   AccountingAllocator allocator_;
 
+  // Set if --wasm-disk-cache-dir is given; not modified after construction.
+  std::unique_ptr<WasmDiskCache> disk_cache_;
+
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
   // Implements a GDB-remote stub for WebAssembly debugging.
   std::unique_ptr<gdb_server::GdbServer> gdb_server_;
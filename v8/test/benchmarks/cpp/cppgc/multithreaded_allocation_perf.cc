@@ -0,0 +1,97 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <vector>
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/thread-local-heap.h"
+#include "src/base/platform/platform.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+using MultithreadedAllocate = testing::BenchmarkWithHeap;
+
+class TinyObject final : public cppgc::GarbageCollected<TinyObject> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+};
+
+class SmallObject final : public cppgc::GarbageCollected<SmallObject> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[96];
+};
+
+template <typename Object>
+class AllocatingThread final : public v8::base::Thread {
+ public:
+  AllocatingThread(cppgc::Heap* heap, size_t num_objects)
+      : Thread(Options("cppgc allocating thread")),
+        heap_(heap),
+        num_objects_(num_objects) {}
+
+  void Run() final {
+    auto thread_local_heap = cppgc::ThreadLocalHeap::Create(heap_);
+    for (size_t i = 0; i < num_objects_; ++i) {
+      benchmark::DoNotOptimize(cppgc::MakeGarbageCollected<Object>(
+          thread_local_heap->GetAllocationHandle()));
+    }
+  }
+
+ private:
+  cppgc::Heap* const heap_;
+  const size_t num_objects_;
+};
+
+// Each iteration lets st.range(0) threads allocate kObjectsPerThread objects
+// each on their ThreadLocalHeap, which measures allocation throughput including
+// contention on free lists and the page backend. The garbage is collected
+// between iterations, outside of the measured time.
+template <typename Object>
+void AllocateOnThreads(cppgc::Heap& heap, benchmark::State& st) {
+  static constexpr size_t kObjectsPerThread = 100000;
+  const size_t num_threads = static_cast<size_t>(st.range(0));
+  for (auto _ : st) {
+    std::vector<std::unique_ptr<AllocatingThread<Object>>> threads;
+    for (size_t i = 0; i < num_threads; ++i) {
+      threads.push_back(std::make_unique<AllocatingThread<Object>>(
+          &heap, kObjectsPerThread));
+      CHECK(threads.back()->Start());
+    }
+    for (auto& thread : threads) thread->Join();
+    st.PauseTiming();
+    Heap::From(&heap)->CollectGarbage(Heap::Config::PreciseAtomicConfig());
+    st.ResumeTiming();
+  }
+  st.SetItemsProcessed(st.iterations() * num_threads * kObjectsPerThread);
+  st.SetBytesProcessed(st.iterations() * num_threads * kObjectsPerThread *
+                       sizeof(Object));
+}
+
+BENCHMARK_DEFINE_F(MultithreadedAllocate, Tiny)(benchmark::State& st) {
+  AllocateOnThreads<TinyObject>(heap(), st);
+}
+BENCHMARK_REGISTER_F(MultithreadedAllocate, Tiny)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(MultithreadedAllocate, Small)(benchmark::State& st) {
+  AllocateOnThreads<SmallObject>(heap(), st);
+}
+BENCHMARK_REGISTER_F(MultithreadedAllocate, Small)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,109 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/base/platform/time.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace platform {
+namespace {
+
+constexpr int kTasksPerIteration = 1024;
+constexpr int kFanOut = 32;
+
+double RealTime() {
+  return base::TimeTicks::HighResolutionNow().ToInternalValue() /
+         static_cast<double>(base::Time::kMicrosecondsPerSecond);
+}
+
+// Counts down a shared budget of tasks and signals |done| when it reaches
+// zero. Optionally posts |children| more tasks to the runner it runs on, which
+// exercises posting from worker threads.
+class CountDownTask : public Task {
+ public:
+  CountDownTask(DefaultWorkerThreadsTaskRunner* runner,
+                std::atomic<int>* remaining, base::Semaphore* done,
+                int children)
+      : runner_(runner),
+        remaining_(remaining),
+        done_(done),
+        children_(children) {}
+
+  void Run() override {
+    for (int i = 0; i < children_; ++i) {
+      runner_->PostTaskWithPriority(
+          std::make_unique<CountDownTask>(runner_, remaining_, done_, 0),
+          static_cast<TaskPriority>(i % 3));
+    }
+    if (remaining_->fetch_sub(1) == 1) done_->Signal();
+  }
+
+ private:
+  DefaultWorkerThreadsTaskRunner* runner_;
+  std::atomic<int>* remaining_;
+  base::Semaphore* done_;
+  int children_;
+};
+
+// Posts all tasks from the benchmark thread and waits for them to run.
+template <WorkerThreadsTaskScheduling scheduling>
+void PostFromMainThread(benchmark::State& state) {
+  DefaultWorkerThreadsTaskRunner runner(static_cast<uint32_t>(state.range(0)),
+                                        RealTime, scheduling);
+  base::Semaphore done(0);
+  for (auto _ : state) {
+    std::atomic<int> remaining{kTasksPerIteration};
+    for (int i = 0; i < kTasksPerIteration; ++i) {
+      runner.PostTask(
+          std::make_unique<CountDownTask>(&runner, &remaining, &done, 0));
+    }
+    done.Wait();
+  }
+  runner.Terminate();
+  state.SetItemsProcessed(state.iterations() * kTasksPerIteration);
+}
+
+// Posts a few root tasks which fan out into many tasks from worker threads.
+template <WorkerThreadsTaskScheduling scheduling>
+void PostFromWorkerThreads(benchmark::State& state) {
+  constexpr int kRoots = kTasksPerIteration / (kFanOut + 1);
+  constexpr int kTotal = kRoots * (kFanOut + 1);
+  DefaultWorkerThreadsTaskRunner runner(static_cast<uint32_t>(state.range(0)),
+                                        RealTime, scheduling);
+  base::Semaphore done(0);
+  for (auto _ : state) {
+    std::atomic<int> remaining{kTotal};
+    for (int i = 0; i < kRoots; ++i) {
+      runner.PostTask(std::make_unique<CountDownTask>(&runner, &remaining,
+                                                      &done, kFanOut));
+    }
+    done.Wait();
+  }
+  runner.Terminate();
+  state.SetItemsProcessed(state.iterations() * kTotal);
+}
+
+#define WORKER_THREADS_BENCHMARK(Name, Scheduling)                    \
+  BENCHMARK_TEMPLATE(Name, WorkerThreadsTaskScheduling::Scheduling) \
+      ->RangeMultiplier(2)                                            \
+      ->Range(1, 64)                                                  \
+      ->UseRealTime()
+
+WORKER_THREADS_BENCHMARK(PostFromMainThread, kSharedQueue);
+WORKER_THREADS_BENCHMARK(PostFromMainThread, kWorkStealing);
+WORKER_THREADS_BENCHMARK(PostFromWorkerThreads, kSharedQueue);
+WORKER_THREADS_BENCHMARK(PostFromWorkerThreads, kWorkStealing);
+
+#undef WORKER_THREADS_BENCHMARK
+
+}  // namespace
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,114 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "src/flags/flags.h"
+#include "src/snapshot/snapshot-compression.h"
+#include "src/snapshot/snapshot.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Codec = SnapshotCompression::Codec;
+
+void InitializeV8() {
+  static std::unique_ptr<v8::Platform> platform = [] {
+    std::unique_ptr<v8::Platform> platform = platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform.get());
+    v8::V8::Initialize();
+    return platform;
+  }();
+  USE(platform);
+}
+
+const char* CodecName(Codec codec) {
+  return codec == Codec::kZlib ? "zlib" : "lz4";
+}
+
+// Creates a snapshot blob with one default context. In builds with snapshot
+// compression, its parts are compressed with --snapshot-compression-codec.
+v8::StartupData CreateSnapshotBlob() {
+  v8::SnapshotCreator creator;
+  {
+    v8::Isolate* isolate = creator.GetIsolate();
+    v8::HandleScope handle_scope(isolate);
+    creator.SetDefaultContext(v8::Context::New(isolate));
+  }
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+}
+
+// Decompresses the startup, read-only and context snapshot data compressed
+// with |codec|, sequentially or on worker threads depending on the benchmark
+// argument.
+template <Codec codec>
+void Decompress(benchmark::State& state) {
+  InitializeV8();
+  v8::StartupData blob = CreateSnapshotBlob();
+  // Compress the serializer payloads, not the blob: in builds with snapshot
+  // compression, the parts of the blob are compressed already.
+  std::vector<SnapshotData> compressed_parts;
+  size_t uncompressed_bytes = 0;
+  size_t compressed_bytes = 0;
+  Snapshot::ForEachUncompressedSnapshotDataForTesting(
+      &blob, [&](const SnapshotData& data) {
+        uncompressed_bytes += data.RawData().size();
+        compressed_parts.push_back(SnapshotCompression::Compress(&data, codec));
+        compressed_bytes += compressed_parts.back().RawData().size();
+      });
+  delete[] blob.data;
+
+  FLAG_parallel_snapshot_decompression = state.range(0) != 0;
+  for (auto _ : state) {
+    for (const SnapshotData& compressed : compressed_parts) {
+      SnapshotData decompressed =
+          SnapshotCompression::Decompress(compressed.RawData());
+      benchmark::DoNotOptimize(decompressed.RawData().begin());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+  state.counters["compressed_bytes"] = static_cast<double>(compressed_bytes);
+}
+
+// Measures isolate and context creation from a snapshot blob whose parts are
+// compressed with |codec|, which includes decompressing them.
+template <Codec codec>
+void IsolateStartup(benchmark::State& state) {
+  InitializeV8();
+  FLAG_snapshot_compression_codec = CodecName(codec);
+  v8::StartupData blob = CreateSnapshotBlob();
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.snapshot_blob = &blob;
+  create_params.array_buffer_allocator = allocator.get();
+  FLAG_parallel_snapshot_decompression = state.range(0) != 0;
+  for (auto _ : state) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      benchmark::DoNotOptimize(*v8::Context::New(isolate));
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+}
+
+BENCHMARK_TEMPLATE(Decompress, Codec::kZlib)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK_TEMPLATE(Decompress, Codec::kLz4)->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK_TEMPLATE(IsolateStartup, Codec::kZlib)
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(IsolateStartup, Codec::kLz4)->Arg(0)->Arg(1)->UseRealTime();
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
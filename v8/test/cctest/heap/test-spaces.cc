@@ -44,6 +44,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -229,6 +230,40 @@ TEST(MemoryAllocator) {
   // OldSpace's destructor will tear down the space and free up all pages.
 }
 
+TEST(HugePageBackedOldSpacePages) {
+  // An empty range probes whether the OS accepts the huge page advice at all.
+  Isolate* isolate = CcTest::i_isolate();
+  if (!isolate->page_allocator()->AdviseHugePages(nullptr, 0)) return;
+  // Declared first, so that the flag stays set while the space is torn down.
+  FlagScope<bool> huge_pages(&FLAG_huge_pages, true);
+  Heap* heap = isolate->heap();
+
+  TestMemoryAllocatorScope test_allocator_scope(isolate, heap->MaxReserved(),
+                                                0);
+  MemoryAllocator* memory_allocator = test_allocator_scope.allocator();
+
+  OldSpace faked_space(heap);
+  Page* first_page = memory_allocator->AllocatePage(
+      faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+      NOT_EXECUTABLE);
+  faked_space.memory_chunk_list().PushBack(first_page);
+  Page* second_page = memory_allocator->AllocatePage(
+      faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+      NOT_EXECUTABLE);
+
+  // Both pages are packed into the same huge page.
+  CHECK_EQ(RoundDown(first_page->address(), MemoryAllocator::kHugePageSize),
+           RoundDown(second_page->address(), MemoryAllocator::kHugePageSize));
+  CHECK_EQ(2 * static_cast<size_t>(Page::kPageSize),
+           memory_allocator->HugePageBackedSize());
+
+  memory_allocator->Free<MemoryAllocator::kFull>(second_page);
+  CHECK_EQ(static_cast<size_t>(Page::kPageSize),
+           memory_allocator->HugePageBackedSize());
+
+  // OldSpace's destructor will tear down the space and free up all pages.
+}
+
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
   size_t page_size = MemoryAllocator::GetCommitPageSize();
@@ -38,6 +38,7 @@
 #endif
 
 #include "include/v8-fast-api-calls.h"
+#include "include/v8-profiler.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
 #include "src/base/overflowing-math.h"
@@ -21159,6 +21160,113 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class JSONStringStream : public v8::OutputStream {
+ public:
+  explicit JSONStringStream(int chunk_size, int abort_countdown = -1)
+      : chunk_size_(chunk_size), abort_countdown_(abort_countdown) {}
+  void EndOfStream() override { ++eos_signaled_; }
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteAsciiChunk(char* buffer, int size) override {
+    CHECK_EQ(0, eos_signaled_);
+    CHECK_GT(size, 0);
+    CHECK_LE(size, chunk_size_);
+    if (abort_countdown_ > 0) --abort_countdown_;
+    if (abort_countdown_ == 0) return kAbort;
+    data_.append(buffer, size);
+    return kContinue;
+  }
+
+  const std::string& data() const { return data_; }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  std::string data_;
+  int chunk_size_;
+  int abort_countdown_;
+  int eos_signaled_ = 0;
+};
+
+void CheckJSONStringifyToStream(v8::Local<v8::Context> context,
+                                const char* source, const char* gap) {
+  v8::Isolate* isolate = context->GetIsolate();
+  Local<Value> value = CompileRun(source);
+  Local<String> gap_string = gap ? v8_str(gap) : Local<String>();
+  v8::String::Utf8Value expected(
+      isolate,
+      v8::JSON::Stringify(context, value, gap_string).ToLocalChecked());
+  for (int chunk_size : {1, 3, 4, 7, 1024}) {
+    JSONStringStream stream(chunk_size);
+    CHECK(v8::JSON::StringifyToStream(context, value, &stream, gap_string)
+              .FromJust());
+    CHECK_EQ(1, stream.eos_signaled());
+    CHECK_EQ(std::string(*expected, expected.length()), stream.data());
+  }
+}
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  CheckJSONStringifyToStream(context.local(), "({x: 42, y: [1, 'a', null]})",
+                             nullptr);
+  CheckJSONStringifyToStream(context.local(), "({x: 42, y: [1, 'a', null]})",
+                             "  ");
+  CheckJSONStringifyToStream(context.local(), "'\\u00e9\\u1234\\ud83d\\ude00'",
+                             nullptr);
+  // Surrogate pairs in the gap may be split across parts of the output.
+  CheckJSONStringifyToStream(context.local(), "[[1], [2, 3]]",
+                             "\xf0\x9f\x98\x80");
+  // Lone surrogates are escaped.
+  CheckJSONStringifyToStream(context.local(), "['\\ud83d', '\\ude00x']",
+                             nullptr);
+  // Outputs much larger than the builder's parts.
+  CheckJSONStringifyToStream(
+      context.local(),
+      "Array.from({length: 20000},"
+      "           (_, i) => ({i, s: 'x\\u1234'.repeat(i % 7)}))",
+      nullptr);
+}
+
+THREADED_TEST(JSONStringifyToStreamFailures) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  // No JSON representation.
+  JSONStringStream undefined_stream(16);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), v8::Undefined(isolate),
+                                     &undefined_stream)
+             .FromJust());
+  CHECK_EQ(0, undefined_stream.eos_signaled());
+
+  // Exceptions are propagated.
+  {
+    v8::TryCatch try_catch(isolate);
+    JSONStringStream throwing_stream(16);
+    Local<Value> value =
+        CompileRun("[1, 2, {toJSON() { throw new Error('boom'); }}]");
+    CHECK(v8::JSON::StringifyToStream(context.local(), value, &throwing_stream)
+              .IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK_EQ(0, throwing_stream.eos_signaled());
+  }
+
+  // The stream aborts after two chunks; the rest is not serialized.
+  Local<Value> value = CompileRun(
+      "var calls = 0;"
+      "Array.from({length: 100000}, () => ({toJSON() { return ++calls; }}))");
+  JSONStringStream aborting_stream(16, 3);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), value, &aborting_stream)
+             .FromJust());
+  CHECK_EQ(0, aborting_stream.eos_signaled());
+  CHECK_EQ(size_t{32}, aborting_stream.data().size());
+  CHECK_LT(CompileRun("calls")->Int32Value(context.local()).FromJust(),
+           100000);
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -23641,6 +23749,27 @@ TEST(StreamingBiggerScript) {
   RunStreamingTest(chunks);
 }
 
+TEST(StreamingScriptWithParallelEagerCompile) {
+  // Tests that the eager inner functions compiled on worker threads, including
+  // asm.js modules, which are compiled by the streaming thread, are merged into
+  // the script when it is finalized.
+  i::FLAG_finalize_streaming_on_background = true;
+  i::FLAG_parallel_streaming_compile = true;
+  const char* chunk1 =
+      "var a = (function() {\n"
+      "  return (function() { return 6; })();\n"
+      "})();\n"
+      "var b = (function(x) { return x + 1; })(a);\n";
+  const char* chunk2 =
+      "var m = (function Module() {\n"
+      "  'use asm';\n"
+      "  function f() { return 13; }\n"
+      "  return { f: f };\n"
+      "})();\n"
+      "m.f() == a + b ? 13 : 0;\n";
+  const char* chunks[] = {chunk1, chunk2, nullptr};
+  RunStreamingTest(chunks);
+}
 
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
@@ -0,0 +1,175 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "src/base/utils/random-number-generator.h"
+#include "src/numbers/bigint-arithmetic.h"
+#include "test/cctest/cctest.h"
+
+namespace v8 {
+namespace internal {
+namespace test_bigint {
+
+using digit_t = BigIntArithmetic::digit_t;
+using Digits = std::vector<digit_t>;
+
+Digits RandomDigits(int length) {
+  base::RandomNumberGenerator* rng = CcTest::random_number_generator();
+  Digits digits(length);
+  for (digit_t& d : digits) {
+    rng->NextBytes(&d, sizeof(d));
+  }
+  // Make some digits extreme, to exercise carries and borrows.
+  for (int i = 0; i < length / 8; i++) {
+    digits[rng->NextInt(length)] = rng->NextBool() ? 0 : ~digit_t{0};
+  }
+  if (digits[length - 1] == 0) digits[length - 1] = 1;
+  return digits;
+}
+
+// Reference implementation: schoolbook multiplication.
+Digits MultiplyReference(const Digits& x, const Digits& y) {
+  Digits z(x.size() + y.size(), 0);
+  for (size_t i = 0; i < x.size(); i++) {
+    digit_t carry = 0;
+    for (size_t j = 0; j < y.size(); j++) {
+      digit_t high;
+      digit_t low = BigIntArithmetic::digit_mul(x[i], y[j], &high);
+      digit_t new_carry = 0;
+      z[i + j] = BigIntArithmetic::digit_add(z[i + j], low, &new_carry);
+      z[i + j] = BigIntArithmetic::digit_add(z[i + j], carry, &new_carry);
+      carry = high + new_carry;
+    }
+    z[i + y.size()] = carry;
+  }
+  return z;
+}
+
+// Returns -1, 0 or 1 depending on whether x < y, x == y or x > y.
+int Compare(const Digits& x, const Digits& y) {
+  size_t length = std::max(x.size(), y.size());
+  for (size_t i = length; i-- > 0;) {
+    digit_t xi = i < x.size() ? x[i] : 0;
+    digit_t yi = i < y.size() ? y[i] : 0;
+    if (xi != yi) return xi < yi ? -1 : 1;
+  }
+  return 0;
+}
+
+Digits Add(const Digits& x, const Digits& y) {
+  Digits z(std::max(x.size(), y.size()) + 1, 0);
+  digit_t carry = 0;
+  for (size_t i = 0; i + 1 < z.size(); i++) {
+    digit_t new_carry = 0;
+    digit_t sum = BigIntArithmetic::digit_add(i < x.size() ? x[i] : 0,
+                                              i < y.size() ? y[i] : 0,
+                                              &new_carry);
+    z[i] = BigIntArithmetic::digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  z.back() = carry;
+  return z;
+}
+
+void CheckMultiply(int x_length, int y_length) {
+  Digits x = RandomDigits(x_length);
+  Digits y = RandomDigits(y_length);
+  Digits z(x_length + y_length);
+  CHECK(BigIntArithmetic().Multiply(VectorOf(z), VectorOf(x), VectorOf(y)));
+  CHECK_EQ(0, Compare(z, MultiplyReference(x, y)));
+}
+
+TEST(BigIntMultiply) {
+  const int kLengths[] = {1,   2,   33,  34,  35,  67,  100,
+                          192, 193, 250, 400, 601, 1000};
+  for (int x_length : kLengths) {
+    for (int y_length : kLengths) {
+      if (y_length > x_length) continue;
+      CheckMultiply(x_length, y_length);
+    }
+  }
+}
+
+void CheckDivide(int a_length, int b_length) {
+  Digits a = RandomDigits(a_length);
+  Digits b = RandomDigits(b_length);
+  Digits q(a_length - b_length + 1);
+  Digits r(b_length);
+  CHECK(BigIntArithmetic().Divide(VectorOf(q), VectorOf(r), VectorOf(a),
+                                  VectorOf(b)));
+  // 0 <= r < b, and q * b + r == a.
+  CHECK_LT(Compare(r, b), 0);
+  CHECK_EQ(0, Compare(Add(MultiplyReference(q, b), r), a));
+  // Either output can be omitted.
+  Digits q_only(q.size());
+  CHECK(BigIntArithmetic().Divide(VectorOf(q_only), Vector<digit_t>(),
+                                  VectorOf(a), VectorOf(b)));
+  CHECK_EQ(0, Compare(q_only, q));
+  Digits r_only(r.size());
+  CHECK(BigIntArithmetic().Divide(Vector<digit_t>(), VectorOf(r_only),
+                                  VectorOf(a), VectorOf(b)));
+  CHECK_EQ(0, Compare(r_only, r));
+}
+
+TEST(BigIntDivide) {
+  const int kDivisorLengths[] = {1, 2, 56, 57, 58, 100, 131, 300};
+  const int kQuotientLengths[] = {0, 1, 57, 64, 200, 513};
+  for (int b_length : kDivisorLengths) {
+    for (int q_length : kQuotientLengths) {
+      CheckDivide(b_length + q_length, b_length);
+    }
+  }
+}
+
+// Checks the divide-and-conquer paths against the schoolbook paths of the
+// builtins, whose results can be verified with simple identities.
+TEST(BigIntToStringAndFromString) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* kRadixes[] = {"2", "7", "10", "16", "36"};
+  for (int bits : {64, 2000, 3000, 20000, 70000}) {
+    for (const char* radix : kRadixes) {
+      ScopedVector<char> source(1024);
+      // 10^k - 1 consists of k nines, and round trips through the string.
+      SNPrintF(source,
+               "(function() {"
+               "  let x = (1n << %dn) / 3n + 1n;"
+               "  let s = x.toString(%s);"
+               "  let prefix = {2: '0b', 16: '0x', 10: ''}[%s];"
+               "  if (prefix !== undefined && BigInt(prefix + s) !== x) {"
+               "    return false;"
+               "  }"
+               "  let k = s.length;"
+               "  let nines = 10n ** BigInt(k) - 1n;"
+               "  return nines.toString() === '9'.repeat(k) &&"
+               "      BigInt('9'.repeat(k)) === nines &&"
+               "      (-x).toString(%s) === '-' + s;"
+               "})()",
+               bits, radix, radix, radix);
+      CHECK(CompileRun(source.begin())->IsTrue());
+    }
+  }
+}
+
+TEST(BigIntOperatorsLarge) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CHECK(CompileRun("(function() {"
+                   "  let a = 7n ** 5000n + 12345n;"
+                   "  let b = -(3n ** 4000n) - 1n;"
+                   "  let p = a * b;"
+                   "  if (p / b !== a || p % b !== 0n || p / a !== b) {"
+                   "    return false;"
+                   "  }"
+                   "  let q = a / b, r = a % b;"
+                   "  return q * b + r === a && r >= 0n && r < -b;"
+                   "})()")
+            ->IsTrue());
+}
+
+}  // namespace test_bigint
+}  // namespace internal
+}  // namespace v8
@@ -3703,6 +3703,107 @@ TEST(DynamicResamplingWithBaseInterval) {
   profiles->StopProfiling("5us");
 }
 
+namespace {
+
+class CollectingWindowSink : public v8::CpuProfileWindowSink {
+ public:
+  void WriteProfileWindow(const uint8_t* data, size_t size) override {
+    windows_.emplace_back(data, data + size);
+  }
+
+  const std::vector<std::vector<uint8_t>>& windows() const {
+    return windows_;
+  }
+
+ private:
+  std::vector<std::vector<uint8_t>> windows_;
+};
+
+}  // namespace
+
+// Tests that a continuous profile passes gzip-compressed windows to its sink
+// while it runs, and keeps sampling when regular profiles stop.
+TEST(ContinuousProfilingWritesWindows) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(R"(
+    function start(duration) {
+      const end = Date.now() + duration;
+      let val = 1;
+      while (Date.now() < end) val = (val * 2) % 3;
+      return val;
+    }
+  )");
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  CollectingWindowSink sink;
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(env->GetIsolate());
+  i::CpuProfiler* iprofiler = reinterpret_cast<i::CpuProfiler*>(profiler);
+  CHECK(profiler->StartContinuousProfiling(
+      &sink, v8::ContinuousCpuProfilingOptions(20, 1000, 100)));
+  CHECK(!profiler->StartContinuousProfiling(&sink));
+
+  v8::Local<v8::String> profile_name = v8_str("regular");
+  profiler->StartProfiling(profile_name);
+  profiler->StopProfiling(profile_name)->Delete();
+  CHECK(iprofiler->is_profiling());
+
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 100)};
+  function->Call(env.local(), env->Global(), arraysize(args), args)
+      .ToLocalChecked();
+  profiler->StopContinuousProfiling();
+  CHECK(!iprofiler->is_profiling());
+  profiler->Dispose();
+
+  // At least one window was finished by a sample, and the last one on stop.
+  CHECK_LE(2u, sink.windows().size());
+  for (const std::vector<uint8_t>& window : sink.windows()) {
+    CHECK_LE(2u, window.size());
+    CHECK_EQ(0x1f, window[0]);
+    CHECK_EQ(0x8b, window[1]);
+  }
+}
+
+// Tests that the call tree of a window does not grow beyond its node limit.
+TEST(ContinuousProfileBoundsWindowTree) {
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+
+  CodeMap code_map;
+  CollectingWindowSink sink;
+  ContinuousCpuProfile profile(isolate, &code_map, &sink,
+                               v8::ContinuousCpuProfilingOptions(1000, 2, 0));
+  CodeEntry outer(i::CodeEventListener::FUNCTION_TAG, "outer");
+  CodeEntry middle(i::CodeEventListener::FUNCTION_TAG, "middle");
+  CodeEntry inner(i::CodeEventListener::FUNCTION_TAG, "inner");
+  base::TimeTicks now = base::TimeTicks::HighResolutionNow();
+
+  // Only outer and middle fit, so the tick is attributed to middle.
+  ProfileStackTrace deep_path = {{&inner, 0}, {&middle, 0}, {&outer, 0}};
+  profile.AddPath(now, deep_path, v8::CpuProfileNode::kNoLineNumberInfo,
+                  base::TimeDelta(), true);
+  CHECK_EQ(2u, profile.window_node_count());
+  CHECK_EQ(1u, profile.window_truncated_samples());
+  ProfileNode* outer_node = profile.window_tree()->root()->FindChild(&outer);
+  CHECK(outer_node);
+  const ProfileNode* middle_node = outer_node->FindChild(&middle);
+  CHECK(middle_node);
+  CHECK_EQ(1u, middle_node->self_ticks());
+
+  ProfileStackTrace path = {{&middle, 0}, {&outer, 0}};
+  profile.AddPath(now, path, v8::CpuProfileNode::kNoLineNumberInfo,
+                  base::TimeDelta(), true);
+  CHECK_EQ(1u, profile.window_truncated_samples());
+  CHECK_EQ(2u, middle_node->self_ticks());
+
+  profile.FinishWindow(now + base::TimeDelta::FromMilliseconds(1), true);
+  CHECK_EQ(1u, sink.windows().size());
+  CHECK_EQ(0u, profile.window_node_count());
+  CHECK_EQ(0u, profile.window_truncated_samples());
+}
+
 // Tests that functions compiled after a started profiler is stopped are still
 // visible when the profiler is started again. (https://crbug.com/v8/9151)
 TEST(Bug9151StaleCodeEntries) {
@@ -30,6 +30,8 @@
 #include <ctype.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "src/init/v8.h"
 
@@ -47,6 +49,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/collector.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 using i::AllocationTraceNode;
 using i::AllocationTraceTree;
@@ -1200,6 +1203,150 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+class BinarySnapshotReader {
+ public:
+  explicit BinarySnapshotReader(i::Vector<char> data) : data_(data) {}
+
+  char ReadByte() {
+    CHECK_LT(pos_, data_.length());
+    return data_[pos_++];
+  }
+
+  uint64_t ReadVarint() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos_, data_.length());
+      uint8_t byte = static_cast<uint8_t>(data_[pos_++]);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return value;
+    }
+  }
+
+  std::string ReadString() {
+    size_t length = static_cast<size_t>(ReadVarint());
+    CHECK_LE(pos_ + static_cast<int>(length), data_.length());
+    std::string result(data_.begin() + pos_, length);
+    pos_ += static_cast<int>(length);
+    return result;
+  }
+
+  bool AtEnd() const { return pos_ == data_.length(); }
+
+ private:
+  i::Vector<char> data_;
+  int pos_ = 0;
+};
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('binary \\u0101 string');");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+
+  BinarySnapshotReader reader(data);
+  for (char c : {'V', '8', 'H', 'S'}) CHECK_EQ(c, reader.ReadByte());
+  CHECK_EQ(i::HeapSnapshotBinarySerializer::kVersion, reader.ReadVarint());
+  const uint64_t node_count = reader.ReadVarint();
+  const uint64_t edge_count = reader.ReadVarint();
+  CHECK_EQ(static_cast<uint64_t>(snapshot->GetNodesCount()), node_count);
+  const uint64_t trace_function_count = reader.ReadVarint();
+  CHECK_EQ(0u, trace_function_count);
+
+  std::vector<uint64_t> name_ids;
+  uint64_t total_edge_count = 0;
+  for (uint64_t i = 0; i < node_count; ++i) {
+    uint64_t fields[7];
+    for (uint64_t& field : fields) field = reader.ReadVarint();
+    const v8::HeapGraphNode* node =
+        snapshot->GetNodeById(static_cast<v8::SnapshotObjectId>(fields[2]));
+    CHECK_NOT_NULL(node);
+    CHECK_EQ(static_cast<uint64_t>(node->GetType()), fields[0]);
+    CHECK_EQ(node->GetShallowSize(), fields[3]);
+    CHECK_EQ(static_cast<uint64_t>(node->GetChildrenCount()), fields[4]);
+    name_ids.push_back(fields[1]);
+    total_edge_count += fields[4];
+  }
+  CHECK_EQ(edge_count, total_edge_count);
+  for (uint64_t i = 0; i < edge_count; ++i) {
+    reader.ReadVarint();
+    reader.ReadVarint();
+    CHECK_LT(reader.ReadVarint(), node_count);
+  }
+  CHECK_EQ(0u, reader.ReadVarint());  // No trace tree.
+  const uint64_t sample_count = reader.ReadVarint();
+  for (uint64_t i = 0; i < sample_count * 2; ++i) reader.ReadVarint();
+  const uint64_t location_count = reader.ReadVarint();
+  for (uint64_t i = 0; i < location_count * 4; ++i) reader.ReadVarint();
+  const uint64_t string_count = reader.ReadVarint();
+  std::vector<std::string> strings;
+  for (uint64_t i = 0; i < string_count; ++i) {
+    strings.push_back(reader.ReadString());
+  }
+  CHECK(reader.AtEnd());
+  CHECK_EQ(std::string("<dummy>"), strings[0]);
+  bool found = false;
+  for (uint64_t name_id : name_ids) {
+    CHECK_LT(name_id, string_count);
+    if (strings[name_id] == "binary \xC4\x81 string") found = true;
+  }
+  CHECK(found);
+}
+
+TEST(HeapSnapshotBinarySerializationIsDeterministic) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  // Create enough nodes and edges to get several chunks.
+  CompileRun(
+      "var list = null;\n"
+      "for (var i = 0; i < 50000; i++) list = {next: list, value: i};");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  i::FlagScope<bool> parallel(&i::FLAG_heap_snapshot_parallel_serialization,
+                              true);
+  TestJSONStream parallel_stream;
+  snapshot->Serialize(&parallel_stream, v8::HeapSnapshot::kBinary);
+  i::FLAG_heap_snapshot_parallel_serialization = false;
+  TestJSONStream sequential_stream;
+  snapshot->Serialize(&sequential_stream, v8::HeapSnapshot::kBinary);
+
+  CHECK_EQ(sequential_stream.size(), parallel_stream.size());
+  i::ScopedVector<char> parallel_data(parallel_stream.size());
+  parallel_stream.WriteTo(parallel_data);
+  i::ScopedVector<char> sequential_data(sequential_stream.size());
+  sequential_stream.WriteTo(sequential_data);
+  CHECK_EQ(0, memcmp(parallel_data.begin(), sequential_data.begin(),
+                     parallel_data.length()));
+}
+
+TEST(HeapSnapshotBinarySerializationAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  TestJSONStream stream(5);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -4037,6 +4184,105 @@ TEST(SamplingHeapProfilerSampleDuringDeopt) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSurvivalTracking) {
+  if (i::FLAG_single_generation) return;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+  CompileRun(
+      "var retained = [];"
+      "for (var i = 0; i < 1024; ++i) retained.push({a: i});");
+  // Survivors of two scavenges are promoted.
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CcTest::CollectAllGarbage();
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  bool found_promoted = false;
+  for (const v8::AllocationProfile::Sample& sample : profile->GetSamples()) {
+    CHECK_LE(0, sample.age_ms);
+    if (sample.promoted) {
+      CHECK_LT(0u, sample.scavenges_survived);
+      found_promoted = true;
+    }
+    if (sample.scavenges_survived == 2) {
+      CHECK_EQ(1u, sample.mark_compacts_survived);
+    }
+  }
+  CHECK(found_promoted);
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
+TEST(SamplingHeapProfilerDelta) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+  CompileRun(
+      "var retained = [];"
+      "function allocate() {"
+      "  for (var i = 0; i < 1024; ++i) retained.push({a: i});"
+      "}"
+      "allocate();");
+
+  std::unordered_set<uint32_t> node_ids;
+  std::unordered_set<uint64_t> live_sample_ids;
+  auto apply_delta = [&](v8::AllocationProfileDelta* delta) {
+    CHECK(delta);
+    for (const auto& new_node : delta->GetNewNodes()) {
+      CHECK(new_node.parent_node_id == 0 ||
+            node_ids.count(new_node.parent_node_id));
+      CHECK(node_ids.insert(new_node.node.node_id).second);
+    }
+    for (const auto& sample : delta->GetAllocatedSamples()) {
+      CHECK_EQ(1, node_ids.count(sample.node_id));
+      CHECK(live_sample_ids.insert(sample.sample_id).second);
+    }
+    for (uint64_t sample_id : delta->GetFreedSampleIds()) {
+      CHECK_EQ(1, live_sample_ids.erase(sample_id));
+    }
+  };
+
+  std::unique_ptr<v8::AllocationProfileDelta> first(
+      heap_profiler->GetAllocationProfileDelta());
+  apply_delta(first.get());
+  CHECK(!first->GetAllocatedSamples().empty());
+  CHECK(first->GetFreedSampleIds().empty());
+  const char* names[] = {"", "allocate"};
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(FindAllocationProfileNode(env->GetIsolate(), profile.get(),
+                                  ArrayVector(names)));
+
+  // Nothing happened since the first report.
+  std::unique_ptr<v8::AllocationProfileDelta> second(
+      heap_profiler->GetAllocationProfileDelta());
+  apply_delta(second.get());
+  CHECK(second->GetFreedSampleIds().empty());
+
+  // Freeing the objects reports the samples of the first report as freed,
+  // without resetting the profile.
+  CompileRun("retained = []; allocate();");
+  CcTest::CollectAllGarbage();
+  std::unique_ptr<v8::AllocationProfileDelta> third(
+      heap_profiler->GetAllocationProfileDelta());
+  apply_delta(third.get());
+  CHECK(!third->GetFreedSampleIds().empty());
+  CHECK(!third->GetAllocatedSamples().empty());
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(WeakReference) {
   v8::Isolate* isolate = CcTest::isolate();
   i::Isolate* i_isolate = CcTest::i_isolate();
@@ -356,6 +356,23 @@ TEST(CodeMapMoveAndDeleteCode) {
   CHECK_EQ(entry3, code_map.FindEntry(ToAddress(0x1750)));
 }
 
+TEST(CodeMapRetireUsedEntries) {
+  CodeMap code_map;
+  CodeEntry* entry1 = new CodeEntry(i::CodeEventListener::FUNCTION_TAG, "aaa");
+  CodeEntry* entry2 = new CodeEntry(i::CodeEventListener::FUNCTION_TAG, "bbb");
+  code_map.AddCode(ToAddress(0x1500), entry1, 0x200);
+  code_map.AddCode(ToAddress(0x1700), entry2, 0x100);
+  entry1->mark_used();
+  // Only the used entry outlives its code.
+  CodeEntry* entry3 = new CodeEntry(i::CodeEventListener::FUNCTION_TAG, "ccc");
+  code_map.AddCode(ToAddress(0x1500), entry3, 0x300);
+  CHECK_EQ(entry3, code_map.FindEntry(ToAddress(0x1700)));
+  CHECK_EQ(1u, code_map.retired_entries_count());
+  code_map.ReleaseRetiredEntries();
+  CHECK_EQ(0u, code_map.retired_entries_count());
+  CHECK_EQ(entry3, code_map.FindEntry(ToAddress(0x1500)));
+}
+
 TEST(CodeMapClear) {
   CodeMap code_map;
   CodeEntry* entry1 = new CodeEntry(i::CodeEventListener::FUNCTION_TAG, "aaa");
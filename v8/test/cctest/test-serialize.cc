@@ -400,11 +400,42 @@ UNINITIALIZED_TEST(SnapshotCompression) {
       i::SnapshotCompression::Decompress(compressed.RawData());
   CHECK_EQ(context_blob, decompressed.RawData());
 
+  for (auto codec : {i::SnapshotCompression::Codec::kZlib,
+                     i::SnapshotCompression::Codec::kLz4}) {
+    SnapshotData compressed_with_codec =
+        i::SnapshotCompression::Compress(&original_snapshot_data, codec);
+    CHECK_LT(compressed_with_codec.RawData().size(), context_blob.size());
+    SnapshotData decompressed_with_codec =
+        i::SnapshotCompression::Decompress(compressed_with_codec.RawData());
+    CHECK_EQ(context_blob, decompressed_with_codec.RawData());
+  }
+
   startup_blob.Dispose();
   read_only_blob.Dispose();
   context_blob.Dispose();
 }
 
+UNINITIALIZED_TEST(SnapshotCompressionMultipleChunks) {
+  // Enough data for several chunks, the last of which is partially filled.
+  const int kSize = 3 * i::SnapshotCompression::kChunkSize + 1234;
+  std::vector<byte> data(kSize);
+  for (int i = 0; i < kSize; i++) data[i] = static_cast<byte>(i * i >> 7);
+  Vector<const byte> payload(data.data(), kSize);
+  SnapshotData original_snapshot_data(payload);
+
+  for (bool parallel : {false, true}) {
+    FLAG_parallel_snapshot_decompression = parallel;
+    for (auto codec : {i::SnapshotCompression::Codec::kZlib,
+                       i::SnapshotCompression::Codec::kLz4}) {
+      SnapshotData compressed =
+          i::SnapshotCompression::Compress(&original_snapshot_data, codec);
+      SnapshotData decompressed =
+          i::SnapshotCompression::Decompress(compressed.RawData());
+      CHECK_EQ(payload, decompressed.RawData());
+    }
+  }
+}
+
 UNINITIALIZED_TEST(ContextSerializerContext) {
   DisableAlwaysOpt();
   Vector<const byte> startup_blob;
@@ -4,12 +4,18 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-disk-cache.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
@@ -23,6 +29,12 @@
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
 
+#if V8_OS_WIN
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace wasm {
@@ -349,6 +361,164 @@ TEST(TierDownAfterDeserialization) {
   CHECK_EQ(ExecutionTier::kLiftoff, liftoff_code->tier());
 }
 
+namespace {
+
+// A fresh directory for cache entries, removed again at the end of the test.
+// The directory must be empty by then.
+class TempCacheDirectory {
+ public:
+  TempCacheDirectory() {
+#if V8_OS_WIN
+    const char* base = getenv("TEMP");
+#else
+    const char* base = getenv("TMPDIR");
+#endif
+    char name[64];
+    base::OS::SNPrintF(name, sizeof(name), "/v8-wasm-disk-cache-%d",
+                       base::OS::GetCurrentProcessId());
+    path_ = std::string(base != nullptr ? base : "/tmp") + name;
+#if V8_OS_WIN
+    CHECK_EQ(0, _mkdir(path_.c_str()));
+#else
+    CHECK_EQ(0, mkdir(path_.c_str(), 0700));
+#endif
+  }
+
+  ~TempCacheDirectory() {
+#if V8_OS_WIN
+    CHECK_EQ(0, _rmdir(path_.c_str()));
+#else
+    CHECK_EQ(0, rmdir(path_.c_str()));
+#endif
+  }
+
+  const char* path() const { return path_.c_str(); }
+
+ private:
+  std::string path_;
+};
+
+// Compiles {wire_bytes} and stores the tiered-up module in {cache}, in a
+// separate isolate which takes the module down with it, so that later loads
+// have to deserialize the entry.
+void CompileAndStore(WasmDiskCache* cache, Vector<const uint8_t> wire_bytes) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator =
+      CcTest::i_isolate()->array_buffer_allocator();
+  v8::Isolate* store_v8_isolate = v8::Isolate::New(create_params);
+  Isolate* store_isolate = reinterpret_cast<Isolate*>(store_v8_isolate);
+  std::weak_ptr<NativeModule> weak_native_module;
+  {
+    HandleScope scope(store_isolate);
+    v8::Local<v8::Context> context = v8::Context::New(store_v8_isolate);
+    v8::Context::Scope context_scope(context);
+    ErrorThrower thrower(store_isolate, "");
+    Handle<WasmModuleObject> module_object =
+        store_isolate->wasm_engine()
+            ->SyncCompile(store_isolate,
+                          WasmFeatures::FromIsolate(store_isolate), &thrower,
+                          ModuleWireBytes(wire_bytes))
+            .ToHandleChecked();
+    weak_native_module = module_object->shared_native_module();
+    NativeModule* native_module = module_object->native_module();
+    native_module->compilation_state()->WaitForTopTierFinished();
+    CHECK(cache->Store(native_module));
+    // An existing entry is left alone.
+    CHECK(cache->Store(native_module));
+  }
+  store_v8_isolate->Dispose();
+  // Background tasks may hold on to the module for a little longer.
+  for (int i = 0; weak_native_module.lock(); i++) {
+    CHECK_LT(i, 1000);
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(10));
+  }
+}
+
+std::vector<uint8_t> ReadFile(const std::string& path) {
+  std::vector<uint8_t> contents;
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  CHECK_NOT_NULL(file);
+  uint8_t buffer[4096];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    contents.insert(contents.end(), buffer, buffer + read);
+  }
+  fclose(file);
+  return contents;
+}
+
+void WriteFile(const std::string& path, const std::vector<uint8_t>& contents) {
+  FILE* file = base::OS::FOpen(path.c_str(), "wb");
+  CHECK_NOT_NULL(file);
+  CHECK_EQ(contents.size(), fwrite(contents.data(), 1, contents.size(), file));
+  CHECK_EQ(0, fclose(file));
+}
+
+}  // namespace
+
+TEST(DiskCacheRoundTrip) {
+  CcTest::InitIsolateOnce();
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer buffer(&zone);
+  WasmSerializationTest::BuildWireBytes(&zone, &buffer);
+  Vector<const uint8_t> wire_bytes(buffer.begin(), buffer.size());
+  TempCacheDirectory directory;
+  WasmDiskCache cache(directory.path());
+  std::string path = cache.EntryPath(wire_bytes);
+  CompileAndStore(&cache, wire_bytes);
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(CcTest::isolate());
+  v8::Context::Scope context_scope(context);
+  Handle<WasmModuleObject> module_object;
+  CHECK(cache.Load(isolate, wire_bytes).ToHandle(&module_object));
+  {
+    WasmCodeRefScope code_ref_scope;
+    CHECK_EQ(ExecutionTier::kTurbofan,
+             module_object->native_module()->GetCode(0)->tier());
+  }
+
+  // Entries for other wire bytes are not used, even under the same name.
+  std::vector<uint8_t> other_bytes(wire_bytes.begin(), wire_bytes.end());
+  other_bytes.back() ^= 1;
+  std::string other_path = cache.EntryPath(VectorOf(other_bytes));
+  CHECK_EQ(0, std::rename(path.c_str(), other_path.c_str()));
+  CHECK(cache.Load(isolate, VectorOf(other_bytes)).is_null());
+  CHECK(base::OS::Remove(other_path.c_str()));
+  CHECK(cache.Load(isolate, wire_bytes).is_null());
+}
+
+TEST(DiskCacheHashCollision) {
+  CcTest::InitIsolateOnce();
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer buffer(&zone);
+  WasmSerializationTest::BuildWireBytes(&zone, &buffer);
+  Vector<const uint8_t> wire_bytes(buffer.begin(), buffer.size());
+  TempCacheDirectory directory;
+  WasmDiskCache cache(directory.path());
+  std::string path = cache.EntryPath(wire_bytes);
+  CompileAndStore(&cache, wire_bytes);
+
+  // Make the entry look like it belongs to other wire bytes with the same
+  // hash and length, by changing its copy of the wire bytes.
+  std::vector<uint8_t> contents = ReadFile(path);
+  auto copy = std::search(contents.begin(), contents.end(), wire_bytes.begin(),
+                          wire_bytes.end());
+  CHECK(copy != contents.end());
+  *(copy + wire_bytes.size() - 1) ^= 1;
+  WriteFile(path, contents);
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(CcTest::isolate());
+  v8::Context::Scope context_scope(context);
+  CHECK(cache.Load(isolate, wire_bytes).is_null());
+  CHECK(base::OS::Remove(path.c_str()));
+}
+
 }  // namespace test_wasm_serialization
 }  // namespace wasm
 }  // namespace internal
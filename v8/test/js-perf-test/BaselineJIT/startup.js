@@ -0,0 +1,44 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Many short-lived functions that are hot for a moment, like the code that
+// runs during application startup in the Octane CodeLoad and Typescript
+// benchmarks. Each run evaluates fresh source so nothing is shared between
+// iterations.
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test)
+      ]);
+}
+
+addBenchmark('Fresh-Functions', freshFunctions);
+addBenchmark('Fresh-Module-Pattern', freshModulePattern);
+
+let counter = 0;
+
+function freshFunctions() {
+  const source =
+      `(function(n) {
+         function step(x, i) { return (x * 31 + i) & 0xffff; }
+         let x = ${counter++};
+         for (let i = 0; i < n; i++) x = step(x, i);
+         return x;
+       })`;
+  return eval(source)(2000);
+}
+
+function freshModulePattern() {
+  const source =
+      `(function() {
+         const exports = {};
+         let state = ${counter++};
+         exports.next = function() { state = (state * 17 + 3) % 1021; };
+         exports.get = function() { return state; };
+         for (let i = 0; i < 2000; i++) exports.next();
+         return exports.get();
+       })`;
+  return eval(source)();
+}
@@ -0,0 +1,60 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Code that stays in the unoptimized tiers, compared with and without
+// --baseline-jit.
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test)
+      ]);
+}
+
+addBenchmark('Arithmetic-Loop', arithmeticLoop);
+addBenchmark('Property-Access', propertyAccess);
+addBenchmark('Calls', calls);
+addBenchmark('Closures', closures);
+
+function arithmeticLoop() {
+  let sum = 0;
+  for (let i = 0; i < 10000; i++) {
+    sum = (sum + i * 3 - (i >> 1)) | 0;
+    if (sum % 7 === 0) sum ^= i;
+  }
+  return sum;
+}
+
+function propertyAccess() {
+  const point = {x: 1, y: 2};
+  const values = [1, 2, 3, 4, 5, 6, 7, 8];
+  for (let i = 0; i < 10000; i++) {
+    point.x = point.y + values[i & 7];
+    point.y = point.x - 1;
+  }
+  return point.x;
+}
+
+function add(a, b) {
+  return a + b;
+}
+
+function calls() {
+  const receiver = {add: add};
+  let result = 0;
+  for (let i = 0; i < 10000; i++) {
+    result = add(result, i) - receiver.add(i, 1);
+  }
+  return result;
+}
+
+function closures() {
+  let count = 0;
+  for (let i = 0; i < 1000; i++) {
+    const increment = () => count++;
+    increment();
+    increment();
+  }
+  return count;
+}
@@ -9,6 +9,8 @@ const TEST_ITERATIONS = 1000;
 const SLOW_TEST_ITERATIONS = 50;
 const BITS_CASES = [32, 64, 128, 256, 512, 1024, 2048, 4096, 8192];
 const RANDOM_BIGINTS_MAX_BITS = 64 * 100;
+// Operand sizes for operations whose cost grows superlinearly.
+const LARGE_BITS_CASES = [2048, 8192, 32768, 131072];
 
 
 function RandomHexDigit(allow_zero) {
@@ -0,0 +1,59 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+"use strict";
+
+load('bigint-util.js');
+
+let a = 0n;
+let b = 0n;
+
+// This dummy ensures that the feedback for benchmark.run() in the Measure
+// function from base.js is not monomorphic, thereby preventing the benchmarks
+// below from being inlined. This ensures consistent behavior and comparable
+// results.
+new BenchmarkSuite('Prevent-Inline-Dummy', [10000], [
+  new Benchmark('Prevent-Inline-Dummy', true, false, 0, () => {})
+]);
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`Divide-${d}`, [1000], [
+    new Benchmark(`Divide-${d}`, true, false, 0, TestDivide,
+      () => SetUpTestDivide(d))
+  ]);
+});
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`Remainder-${d}`, [1000], [
+    new Benchmark(`Remainder-${d}`, true, false, 0, TestRemainder,
+      () => SetUpTestDivide(d))
+  ]);
+});
+
+
+// Divides a 2*bits dividend by a bits divisor.
+function SetUpTestDivide(bits) {
+  a = RandomBigIntWithBits(2 * bits);
+  b = RandomBigIntWithBits(bits);
+}
+
+
+function TestDivide() {
+  let quotient = 0n;
+  for (let i = 0; i < SLOW_TEST_ITERATIONS; ++i) {
+    quotient = a / b;
+  }
+  return quotient;
+}
+
+
+function TestRemainder() {
+  let remainder = 0n;
+  for (let i = 0; i < SLOW_TEST_ITERATIONS; ++i) {
+    remainder = a % b;
+  }
+  return remainder;
+}
@@ -0,0 +1,53 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+"use strict";
+
+load('bigint-util.js');
+
+let a = 0n;
+let b = 0n;
+
+// This dummy ensures that the feedback for benchmark.run() in the Measure
+// function from base.js is not monomorphic, thereby preventing the benchmarks
+// below from being inlined. This ensures consistent behavior and comparable
+// results.
+new BenchmarkSuite('Prevent-Inline-Dummy', [10000], [
+  new Benchmark('Prevent-Inline-Dummy', true, false, 0, () => {})
+]);
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`Multiply-${d}`, [1000], [
+    new Benchmark(`Multiply-${d}`, true, false, 0, TestMultiply,
+      () => SetUpTestMultiply(d))
+  ]);
+});
+
+
+new BenchmarkSuite('Multiply-Unbalanced', [1000], [
+  new Benchmark('Multiply-Unbalanced', true, false, 0, TestMultiply,
+    () => SetUpTestMultiplyUnbalanced())
+]);
+
+
+function SetUpTestMultiply(bits) {
+  a = RandomBigIntWithBits(bits);
+  b = RandomBigIntWithBits(bits);
+}
+
+
+function SetUpTestMultiplyUnbalanced() {
+  a = RandomBigIntWithBits(131072);
+  b = RandomBigIntWithBits(8192);
+}
+
+
+function TestMultiply() {
+  let product = 0n;
+  for (let i = 0; i < SLOW_TEST_ITERATIONS; ++i) {
+    product = a * b;
+  }
+  return product;
+}
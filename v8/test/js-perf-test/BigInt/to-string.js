@@ -0,0 +1,62 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+"use strict";
+
+load('bigint-util.js');
+
+let a = 0n;
+let s = "";
+
+// This dummy ensures that the feedback for benchmark.run() in the Measure
+// function from base.js is not monomorphic, thereby preventing the benchmarks
+// below from being inlined. This ensures consistent behavior and comparable
+// results.
+new BenchmarkSuite('Prevent-Inline-Dummy', [10000], [
+  new Benchmark('Prevent-Inline-Dummy', true, false, 0, () => {})
+]);
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`ToString-${d}`, [1000], [
+    new Benchmark(`ToString-${d}`, true, false, 0, TestToString,
+      () => SetUpTestToString(d))
+  ]);
+});
+
+
+LARGE_BITS_CASES.forEach((d) => {
+  new BenchmarkSuite(`FromString-${d}`, [1000], [
+    new Benchmark(`FromString-${d}`, true, false, 0, TestFromString,
+      () => SetUpTestFromString(d))
+  ]);
+});
+
+
+function SetUpTestToString(bits) {
+  a = RandomBigIntWithBits(bits);
+}
+
+
+function SetUpTestFromString(bits) {
+  s = RandomBigIntWithBits(bits).toString();
+}
+
+
+function TestToString() {
+  let result = "";
+  for (let i = 0; i < SLOW_TEST_ITERATIONS; ++i) {
+    result = a.toString();
+  }
+  return result;
+}
+
+
+function TestFromString() {
+  let result = 0n;
+  for (let i = 0; i < SLOW_TEST_ITERATIONS; ++i) {
+    result = BigInt(s);
+  }
+  return result;
+}
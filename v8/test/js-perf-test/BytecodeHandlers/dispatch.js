@@ -0,0 +1,71 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Bytecode sequences that pay for a dispatch per bytecode unless they are
+// fused into superinstructions (--ignition-superinstructions).
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test)
+      ]);
+}
+
+addBenchmark('Loop-LessThan', LoopLessThan);
+addBenchmark('Loop-GreaterThan', LoopGreaterThan);
+addBenchmark('Register-Add', RegisterAdd);
+addBenchmark('Register-Sub', RegisterSub);
+addBenchmark('StrictEquals-Branch', StrictEqualsBranch);
+
+// TestLessThan; JumpIfFalse
+function LoopLessThan() {
+  let count = 0;
+  for (let i = 0; i < 1000; ++i) {
+    for (let j = 0; j < 100; ++j) count++;
+  }
+  return count;
+}
+
+// TestGreaterThan; JumpIfFalse
+function LoopGreaterThan() {
+  let count = 0;
+  for (let i = 1000; i > 0; --i) {
+    for (let j = 100; j > 0; --j) count++;
+  }
+  return count;
+}
+
+// Ldar; Add; Star
+function RegisterAdd() {
+  let a = 1, b = 2, c = 3;
+  for (let i = 0; i < 10000; ++i) {
+    c = a + b; a = b + c; b = c + a;
+    c = a + b; a = b + c; b = c + a;
+    a = 1; b = 2;
+  }
+  return c;
+}
+
+// Ldar; Sub; Star
+function RegisterSub() {
+  let a = 1, b = 2, c = 3;
+  for (let i = 0; i < 10000; ++i) {
+    c = a - b; a = b - c; b = c - a;
+    c = a - b; a = b - c; b = c - a;
+    a = 1; b = 2;
+  }
+  return c;
+}
+
+// TestEqualStrict; JumpIfFalse
+function StrictEqualsBranch() {
+  let a = 1, b = 2, count = 0;
+  for (let i = 0; i < 10000; ++i) {
+    if (a === b) count++;
+    if (b === a) count++;
+    if (a === a) count++;
+    if (b === b) count++;
+  }
+  return count;
+}
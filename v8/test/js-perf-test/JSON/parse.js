@@ -0,0 +1,68 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Payloads of different shapes, each a few hundred KB, to exercise the
+// string, whitespace and number scanning of JSON.parse.
+
+const kRecords = 2000;
+
+function Word(i) {
+  const syllables = ['ka', 'lo', 'mi', 'nu', 'pe', 'ra', 'si', 'to'];
+  let word = '';
+  do {
+    word += syllables[i % syllables.length];
+    i = Math.floor(i / syllables.length);
+  } while (i > 0);
+  return word;
+}
+
+function Sentence(i, words) {
+  let result = [];
+  for (let j = 0; j < words; j++) result.push(Word(i * 31 + j * 7));
+  return result.join(' ');
+}
+
+function Records() {
+  let records = [];
+  for (let i = 0; i < kRecords; i++) {
+    records.push({
+      id: i,
+      name: Word(i),
+      email: Word(i * 13) + '@example.com',
+      active: i % 3 == 0,
+      score: i * 1.25,
+      tags: [Word(i + 1), Word(i + 2), Word(i + 3)],
+      address: {street: Sentence(i, 3), city: Word(i * 7), zip: 10000 + i}
+    });
+  }
+  return records;
+}
+
+// Many small objects, as in typical API responses.
+const kMinified = JSON.stringify(Records());
+// The same data, indented as by JSON.stringify(..., null, 2).
+const kPrettyPrinted = JSON.stringify(Records(), null, 2);
+// Long string values, as in documents or log messages.
+const kLongStrings = JSON.stringify(
+    Array.from({length: 200}, (_, i) => Sentence(i, 200)));
+// Strings with escapes that have to be unescaped.
+const kEscapedStrings = JSON.stringify(Array.from(
+    {length: 2000}, (_, i) => `"${Word(i)}"\n\t\\${Sentence(i, 20)} `));
+// Strings that need two bytes per character.
+const kTwoByteStrings = JSON.stringify(Array.from(
+    {length: 200}, (_, i) => Sentence(i, 100) + '\u03bb\u4e2d'));
+// Numbers only.
+const kNumbers = JSON.stringify(
+    Array.from({length: 50000}, (_, i) => i % 2 ? i * 1001 : i / 7));
+
+function CreateParseSuite(name, payload) {
+  createSuite(name, 1000, () => JSON.parse(payload), () => {});
+}
+
+CreateParseSuite('ParseMinified', kMinified);
+CreateParseSuite('ParsePrettyPrinted', kPrettyPrinted);
+CreateParseSuite('ParseLongStrings', kLongStrings);
+CreateParseSuite('ParseEscapedStrings', kEscapedStrings);
+CreateParseSuite('ParseTwoByteStrings', kTwoByteStrings);
+CreateParseSuite('ParseNumbers', kNumbers);
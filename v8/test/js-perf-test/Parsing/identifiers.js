@@ -0,0 +1,50 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("ShortIdentifiers", [1000], [
+  new Benchmark("ShortIdentifiers", false, true, iterations, Run, ShortIdentifiersSetup)
+]);
+
+new BenchmarkSuite("LongIdentifiers", [1000], [
+  new Benchmark("LongIdentifiers", false, true, iterations, Run, LongIdentifiersSetup)
+]);
+
+new BenchmarkSuite("IndentedCode", [1000], [
+  new Benchmark("IndentedCode", false, true, iterations, Run, IndentedCodeSetup)
+]);
+
+function ShortIdentifiersSetup() {
+  code = "";
+  for (let i = 0; i < 600; i++) {
+    code += "if (a" + i + " || b) { let c = a" + i + "; }\n";
+  }
+  code = "(function(b) { var " + "a, ".repeat(10) + "a0; " + code + "})";
+  %FlattenString(code);
+}
+
+function LongIdentifiersSetup() {
+  code = "";
+  for (let i = 0; i < 600; i++) {
+    code += "var aRatherLongIdentifierNameForTheScanner_" + i +
+        " = anotherRatherLongIdentifierName$ForTheScanner;\n";
+  }
+  code = "(function() {" + code + "})";
+  %FlattenString(code);
+}
+
+function IndentedCodeSetup() {
+  code = "";
+  for (let i = 0; i < 600; i++) {
+    code += " ".repeat(24) + "a = b +\n" + " ".repeat(28) + "c;\n\n";
+  }
+  code = "(function(a, b, c) {" + code + "})";
+  %FlattenString(code);
+}
+
+function Run() {
+  if (code == undefined) {
+    throw new Error("No test data");
+  }
+  eval(code);
+}
@@ -10,6 +10,7 @@ let code;
 
 load("comments.js");
 load("strings.js");
+load("identifiers.js");
 load("arrowfunctions.js")
 
 var success = true;
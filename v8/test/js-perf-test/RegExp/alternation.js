@@ -0,0 +1,10 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("base.js");
+load("base_alternation.js");
+
+createAlternationSuite("Alternation10", 10);
+createAlternationSuite("Alternation100", 100);
+createAlternationSuite("Alternation1000", 1000);
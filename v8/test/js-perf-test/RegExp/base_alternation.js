@@ -0,0 +1,73 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches for alternations of many literals, like /error|fatal|panic|.../,
+// over text that mostly doesn't contain them. Without a prefilter, Irregexp
+// tries the alternatives at every position.
+
+load("base.js");
+
+var str;
+var re;
+
+// Deterministic words of 5 to 9 lowercase letters.
+function createWords(count, seed) {
+  let state = seed;
+  function next() {
+    state = (state * 16807) % 2147483647;
+    return state;
+  }
+  const words = [];
+  for (let i = 0; i < count; i++) {
+    const length = 5 + next() % 5;
+    let word = "";
+    for (let j = 0; j < length; j++) {
+      word += String.fromCharCode(97 + next() % 26);
+    }
+    words.push(word);
+  }
+  return words;
+}
+
+// About 40KB of other words, with a few of the literals in the second half.
+function createText(literals) {
+  const words = createWords(5000, 7);
+  for (let i = 0; i < 10; i++) {
+    words[2500 + i * 250] = literals[(i * 7) % literals.length];
+  }
+  return words.join(" ");
+}
+
+function Test() {
+  re.test(str);
+}
+
+function MatchGlobal() {
+  str.match(re);
+}
+
+function ReplaceGlobal() {
+  str.replace(re, "<$&>");
+}
+
+const alternationBenchmarks = [
+  [Test, ""],
+  [MatchGlobal, "g"],
+  [ReplaceGlobal, "g"],
+];
+
+function createAlternationSuite(name, count) {
+  const literals = createWords(count, 1);
+  const source = literals.join("|");
+  const text = createText(literals);
+  return new BenchmarkSuite(
+    name, [1000],
+    alternationBenchmarks.map(([bench, flags]) => {
+      const setup = () => {
+        re = new RegExp(source, flags);
+        str = text;
+      };
+      return new Benchmark(bench.name, false, false, 0, bench, setup);
+    }));
+}
@@ -0,0 +1,63 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches of the kind that log processing runs over long lines, to compare
+// the experimental linear-time engine (the 'l' flag) with Irregexp.  Needs
+// --enable-experimental-regexp-engine.
+
+load("base.js");
+
+var str;
+var re;
+
+function createLog() {
+  const lines = [];
+  for (let i = 0; i < 100; i++) {
+    const time = `2020-10-${10 + i % 20} 12:${10 + i % 50}:${10 + i % 37}`;
+    const message = i % 50 == 49
+        ? `ERROR request ${i} failed: timeout after ${i * 3}ms`
+        : `INFO request ${i} completed in ${i % 13}ms`;
+    lines.push(`${time} [worker-${i % 7}] ${message}`);
+  }
+  return lines.join("; ");
+}
+
+function Exec() {
+  re.exec(str);
+}
+
+function Test() {
+  re.test(str);
+}
+
+function MatchGlobal() {
+  str.match(re);
+}
+
+function ReplaceGlobal() {
+  str.replace(re, "<$1>");
+}
+
+const logScanBenchmarks = [
+  [Exec, "Capture", "ERROR request (\\d+) failed: (\\w+)", ""],
+  [Test, "Search", "timeout after \\d+ms", ""],
+  [Test, "NoMatch", "FATAL|panic|worker-9", ""],
+  [Test, "Alternation", "(?:ERROR|WARN)[^;]*timeout", ""],
+  [MatchGlobal, "Global", "\\[worker-[0-3]\\]", "g"],
+  [ReplaceGlobal, "ReplaceGlobal", "in (\\d+)ms", "g"],
+];
+
+function createLogScanSuite(name, extraFlags) {
+  const log = createLog();
+  return new BenchmarkSuite(
+    name, [1000],
+    logScanBenchmarks.map(([bench, setupName, source, flags]) => {
+      const setup = () => {
+        re = new RegExp(source, flags + extraFlags);
+        str = log;
+      };
+      return new Benchmark(`${bench.name}/${setupName}`, false, false, 1000,
+                           bench, setup);
+    }));
+}
@@ -0,0 +1,9 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("base.js");
+load("base_log_scan.js");
+
+createLogScanSuite("IrregexpLogScan", "");
+createLogScanSuite("LinearLogScan", "l");
@@ -0,0 +1,80 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the startup cost of a large bundle. The suites run d8 with
+// --streaming-compile, so that the script of a worker is compiled on a
+// background thread, and every run starts a new worker on the bundle.
+
+load('../base.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-StreamingCompile(Score): ' + result);
+}
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+const kModuleCount = 64;
+
+// A synthetic bundle in the shape emitted by module bundlers: every module is
+// an eagerly compiled IIFE whose helpers are compiled lazily. Each module
+// depends on the previous one so that they all have to run.
+function module(i) {
+  return `
+var module${i} = (function(dep) {
+  'use strict';
+  function parse(input) {
+    const result = [];
+    for (let i = 0; i < input.length; i++) {
+      const c = input.charCodeAt(i);
+      if (c === 44) continue;
+      result.push(c + ${i} + dep.offset);
+    }
+    return result;
+  }
+  function format(values) {
+    return values.map(function(v) {
+      return String.fromCharCode(v & 0x7f);
+    }).join('');
+  }
+  class Store {
+    constructor() { this.items = new Map(); }
+    set(key, value) { this.items.set(key, value); return this; }
+    get(key) { return this.items.get(key); }
+  }
+  const store = new Store();
+  store.set('seed', (function() {
+    let x = ${i};
+    for (let i = 0; i < 16; i++) x = (x * 31 + i) & 0xffff;
+    return x;
+  })());
+  return { parse, format, store, offset: dep.offset + 1 };
+})(module${i - 1});
+`;
+}
+
+let bundle = 'var module0 = { offset: 0 };\n';
+for (let i = 1; i <= kModuleCount; i++) bundle += module(i);
+bundle += `postMessage(module${kModuleCount}.offset);\n`;
+
+function loadBundle() {
+  const worker = new Worker(bundle, {type: 'string'});
+  const result = worker.getMessage();
+  worker.terminate();
+  if (result !== kModuleCount) throw new Error('Unexpected bundle result');
+}
+
+new BenchmarkSuite('Bundle', [1000], [
+  new Benchmark('Bundle', false, false, 0, loadBundle)
+]);
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
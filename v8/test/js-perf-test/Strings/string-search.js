@@ -0,0 +1,92 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches in a log of a few hundred KB, for patterns of different lengths
+// and frequencies, in one-byte and two-byte subjects.
+
+function CreateSuite(name, fn) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, true, false, 0, fn),
+  ]);
+}
+
+CreateSuite('IndexOfShortPattern', IndexOfShortPattern);
+CreateSuite('IndexOfMediumPattern', IndexOfMediumPattern);
+CreateSuite('IndexOfLongPattern', IndexOfLongPattern);
+CreateSuite('IncludesMissingPattern', IncludesMissingPattern);
+CreateSuite('IndexOfTwoByteSubject', IndexOfTwoByteSubject);
+CreateSuite('IndexOfTwoByteChar', IndexOfTwoByteChar);
+CreateSuite('SplitLines', SplitLines);
+CreateSuite('SplitLinesTwoByte', SplitLinesTwoByte);
+CreateSuite('SplitFields', SplitFields);
+
+const kLines = 4000;
+const kLevels = ['DEBUG', 'INFO', 'INFO', 'INFO', 'WARN', 'ERROR'];
+const kPaths = ['/api/v1/users', '/api/v1/orders', '/static/app.js',
+                '/api/v2/search', '/healthz'];
+
+function Log(user_suffix) {
+  let lines = [];
+  for (let i = 0; i < kLines; i++) {
+    const level = kLevels[i % kLevels.length];
+    const path = kPaths[(i * 7) % kPaths.length];
+    lines.push(`2020-06-${10 + i % 20}T12:${10 + i % 50}:${10 + i % 49}Z ` +
+               `${level} [worker-${i % 8}] ${path} status=${200 + i % 3} ` +
+               `duration_ms=${(i * 37) % 1000} user=u${i}${user_suffix} ` +
+               `request_id=${(i * 2654435761 % 4294967296).toString(16)}`);
+  }
+  // Use Array.join to create a flat string.
+  return lines.join('\n');
+}
+
+const log = Log('');
+const two_byte_log = Log('\u00e9\u4e16');
+const last_line = log.substring(log.lastIndexOf('\n') + 1);
+const two_byte_last_line =
+    two_byte_log.substring(two_byte_log.lastIndexOf('\n') + 1);
+
+function CountMatches(subject, pattern) {
+  let count = 0;
+  for (let i = subject.indexOf(pattern); i != -1;
+       i = subject.indexOf(pattern, i + 1)) {
+    count++;
+  }
+  return count;
+}
+
+function IndexOfShortPattern() {
+  return CountMatches(log, 'ERR');
+}
+
+function IndexOfMediumPattern() {
+  return CountMatches(log, 'status=202');
+}
+
+function IndexOfLongPattern() {
+  return log.indexOf(last_line.substring(0, 32));
+}
+
+function IncludesMissingPattern() {
+  return log.includes('status=500') || log.includes('timeout');
+}
+
+function IndexOfTwoByteSubject() {
+  return two_byte_log.indexOf(two_byte_last_line.substring(0, 24));
+}
+
+function IndexOfTwoByteChar() {
+  return CountMatches(two_byte_log, '\u4e16');
+}
+
+function SplitLines() {
+  return log.split('\n').length;
+}
+
+function SplitLinesTwoByte() {
+  return two_byte_log.split('\n').length;
+}
+
+function SplitFields() {
+  return log.split(' user=').length;
+}
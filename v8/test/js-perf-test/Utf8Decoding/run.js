@@ -0,0 +1,50 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures UTF-8 decoding of text in several scripts. read() creates its
+// string with String::NewFromUtf8, and load() streams the script through
+// the UTF-8 character stream of the scanner when d8 runs with
+// --streaming-compile. The suites compare the vectorized decoder with the
+// DFA, see --utf8-simd.
+
+load('../base.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-Utf8Decoding(Score): ' + result);
+}
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+function addReadBenchmark(name, file) {
+  const length = read(file).length;
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, function() {
+      if (read(file).length !== length) throw new Error('Unexpected length');
+    })
+  ]);
+}
+
+addReadBenchmark('Read-ASCII', 'ascii.txt');
+addReadBenchmark('Read-Latin1', 'latin1.txt');
+addReadBenchmark('Read-Cyrillic', 'cyrillic.txt');
+addReadBenchmark('Read-CJK', 'cjk.txt');
+addReadBenchmark('Read-Emoji', 'emoji.txt');
+
+new BenchmarkSuite('Load-Script', [1000], [
+  new Benchmark('Load-Script', false, false, 0, function() {
+    load('script.js');
+    if (messages.length === 0) throw new Error('Script did not run');
+  })
+]);
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
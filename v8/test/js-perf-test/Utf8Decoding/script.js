@@ -0,0 +1,551 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+var messages = [];
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
+
+// Übersetzungen für die Benutzeroberfläche — 中文 / русский / français.
+messages.push({ de: 'Schließen', ru: 'Закрыть', zh: '关闭', fr: 'Fermer ✕' });
@@ -0,0 +1,158 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --baseline-jit --no-opt
+
+// Baseline code has to agree with the interpreter. Each function is run once
+// in the interpreter, compiled with %CompileBaseline and run again. On
+// architectures without a baseline compiler %CompileBaseline returns false
+// and the functions keep running in the interpreter.
+
+function check(f, ...args) {
+  const expected = f(...args);
+  %CompileBaseline(f);
+  assertEquals(expected, f(...args));
+  assertEquals(expected, f(...args));
+}
+
+(function TestArithmetic() {
+  function f(a, b) {
+    let x = a + b * 3 - (a / 2);
+    x = x % 7 + (b ** 2);
+    x = (x | 1) ^ (a & 0xff);
+    x = (x << 2) >> 1;
+    return [x >>> 0, -x, ~x, x + 1, x - 1];
+  }
+  check(f, 5, 9);
+  check(f, 1.5, -2);
+  check(f, 'a', 2);
+  check(f, 2n, 3n);
+})();
+
+(function TestComparisons() {
+  function f(a, b) {
+    return [a == b, a === b, a < b, a > b, a <= b, a >= b, !a, a == null,
+            a === undefined, a === null, typeof a];
+  }
+  check(f, 1, 2);
+  check(f, '1', 1);
+  check(f, null, undefined);
+  check(f, {}, {});
+})();
+
+(function TestLoops() {
+  function f(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+      if (i % 3 == 0) continue;
+      sum += i;
+      if (sum > 1e6) break;
+    }
+    let j = n;
+    while (j) j--;
+    do { j++; } while (j < 10);
+    return sum + j;
+  }
+  check(f, 0);
+  check(f, 100);
+  check(f, 100000);
+})();
+
+(function TestPropertiesAndGlobals() {
+  globalThis.baselineGlobal = 1;
+  function f(o, key) {
+    o.x = o.y + 1;
+    o[key] = o.x * 2;
+    baselineGlobal = baselineGlobal + o[key];
+    return [o.x, o[key], baselineGlobal];
+  }
+  check(f, {y: 1}, 'z');
+  check(f, {y: 'a'}, 0);
+  check(f, [1, 2], 1);
+})();
+
+(function TestCalls() {
+  function add(a, b) { return a + b; }
+  const o = {
+    v: 10,
+    get() { return this.v; },
+    sum(a, b, c) { return this.v + a + b + c; },
+  };
+  function f() {
+    return [add(1, 2), add(1), add(1, 2, 3), o.get(), o.sum(1, 2, 3),
+            add.call(o, 4, 5), Math.max(1, 2, 3, 4, 5)];
+  }
+  check(f);
+})();
+
+(function TestClosuresAndContexts() {
+  function f(n) {
+    let count = 0;
+    const increments = [];
+    for (let i = 0; i < n; i++) {
+      increments.push(() => count += i);
+    }
+    increments.forEach(g => g());
+    return count;
+  }
+  check(f, 10);
+
+  function counter() {
+    let c = 0;
+    return function() { return ++c; };
+  }
+  check(() => { const next = counter(); next(); return next(); });
+})();
+
+(function TestExceptions() {
+  function thrower(x) {
+    if (x) throw new Error('boom');
+    return 1;
+  }
+  function f(x) {
+    let result = 0;
+    try {
+      result = thrower(x);
+    } catch (e) {
+      result = e.message;
+    } finally {
+      result += '!';
+    }
+    return result;
+  }
+  check(f, false);
+  check(f, true);
+
+  function g(o) { return o.x.y; }
+  %CompileBaseline(g);
+  assertEquals(1, g({x: {y: 1}}));
+  assertThrows(() => g({}), TypeError);
+})();
+
+(function TestUnsupportedBytecodes() {
+  // Spreads, literals and for-in continue in the interpreter.
+  function f(o) {
+    const keys = [];
+    for (const k in o) keys.push(k);
+    return [...keys, {a: 1}.a, `${keys.length}`];
+  }
+  check(f, {x: 1, y: 2});
+})();
+
+(function TestResumableFunctionsAreNotCompiled() {
+  function* gen() { yield 1; }
+  async function af() { await 1; }
+  assertFalse(%CompileBaseline(gen));
+  assertFalse(%CompileBaseline(af));
+  assertEquals(1, gen().next().value);
+})();
+
+(function TestTierUpFromBudget() {
+  function hot(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) sum += i;
+    return sum;
+  }
+  for (let i = 0; i < 100; i++) assertEquals(4950, hot(100));
+})();
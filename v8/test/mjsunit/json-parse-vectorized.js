@@ -0,0 +1,52 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The JSON parser scans strings and whitespace up to 32 bytes at a time.
+// Check special characters at every position around the vector boundaries,
+// in one-byte and two-byte source strings.
+
+const kMaxLength = 70;
+
+function Payload(length) {
+  let s = '';
+  for (let i = 0; i < length; i++) {
+    s += String.fromCharCode(97 + i % 26);
+  }
+  return s;
+}
+
+for (const suffix of ['', '\u1234']) {
+  for (let length = 0; length < kMaxLength; length++) {
+    const payload = Payload(length) + suffix;
+
+    // Plain strings.
+    assertEquals(payload, JSON.parse(`"${payload}"`));
+
+    // Escapes and control characters at every position.
+    for (let i = 0; i <= length; i++) {
+      const head = payload.substring(0, i);
+      const tail = payload.substring(i);
+      assertEquals(head + '"' + tail, JSON.parse(`"${head}\\"${tail}"`));
+      assertEquals(head + '\n' + tail, JSON.parse(`"${head}\\n${tail}"`));
+      assertEquals(head + '\u00e9' + tail,
+                   JSON.parse(`"${head}\\u00e9${tail}"`));
+      assertThrows(() => JSON.parse(`"${head}\n${tail}"`), SyntaxError);
+      assertThrows(() => JSON.parse(`"${head}\x1f${tail}"`), SyntaxError);
+    }
+
+    // Unterminated strings.
+    assertThrows(() => JSON.parse(`"${payload}`), SyntaxError);
+
+    // Characters that only look like terminators in one of their bytes.
+    assertEquals(payload + '\u0122\u015c',
+                 JSON.parse(`"${payload}\u0122\u015c"`));
+
+    // Whitespace runs of every length.
+    const whitespace = ' \t\r\n'.repeat(length).substring(0, length);
+    assertEquals([payload], JSON.parse(
+        `${whitespace}[${whitespace}"${payload}"${whitespace}]${whitespace}`));
+    assertThrows(() => JSON.parse(`[${whitespace}\u00a0"${payload}"]`),
+                 SyntaxError);
+  }
+}
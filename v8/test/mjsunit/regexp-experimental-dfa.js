@@ -0,0 +1,55 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-dfa
+
+// The experimental engine finds matches in long subjects with a lazy dfa
+// and only runs the nfa for captures.  Its results must agree with the
+// backtracking engine.
+
+const kPadding = 'xyz_0 9\n'.repeat(20);
+
+function Test(source, flags, subject) {
+  const linear = new RegExp(source, flags + 'l');
+  const backtracking = new RegExp(source, flags);
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(linear));
+
+  assertEquals(backtracking.exec(subject), linear.exec(subject));
+  assertEquals(backtracking.lastIndex, linear.lastIndex);
+  assertEquals(subject.match(backtracking), subject.match(linear));
+  assertEquals(subject.replace(backtracking, '[$&]'),
+               subject.replace(linear, '[$&]'));
+  if (flags.includes('g')) {
+    assertEquals([...subject.matchAll(backtracking)].map(m => [...m]),
+                 [...subject.matchAll(linear)].map(m => [...m]));
+  }
+}
+
+const kPatterns = [
+  'abc', 'abc|..|[a-c]{10,}', 'a+?b', 'a+b', '(a|ab)(c|bcd)', 'x*', 'z?',
+  '\\d+', '[^a-z]+', '(\\w+)@(\\w+)\\.com', '^\\w+', '\\w+$', '^$', '\\b\\w',
+  '\\B\\w+\\B', 'error: (\\d+)', '(?:a|b)*c', '.*', '[\\s\\S]{3}$',
+  'foo|bar|baz', '(f)(o)(o)|(b)(a)(r)', '\\n[a-z]', '\u0101+\u0102'
+];
+
+const kSubjects = [
+  kPadding,
+  kPadding + 'abcccccccccccccccccc',
+  'ab abd aaab abc ' + kPadding + 'aaaab',
+  kPadding + 'user@example.com, other@host.com',
+  kPadding + 'error: 42\nwarning\nerror: 7',
+  kPadding + 'foo bar baz qux',
+  'foo\n' + kPadding + 'bar\n',
+  kPadding + '\u0101\u0101\u0102 abc \u0102',
+  kPadding.repeat(20) + 'abcbcd',
+];
+
+for (const source of kPatterns) {
+  for (const flags of ['', 'g', 'm', 'gm', 'y', 'gs']) {
+    for (const subject of kSubjects) {
+      Test(source, flags, subject);
+    }
+  }
+}
@@ -0,0 +1,58 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-jit --regexp-tier-up
+// Flags: --regexp-tier-up-ticks=1
+
+// Experimental regexps tier up to native code after their first execution.
+// Native code must agree with the backtracking engine, both when called from
+// JavaScript and from the runtime (global replace and matchAll).
+
+function Test(source, flags, subject) {
+  const linear = new RegExp(source, flags + 'l');
+  const backtracking = new RegExp(source, flags);
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(linear));
+
+  // Run every operation twice, so that the second run uses native code.
+  for (let i = 0; i < 2; i++) {
+    linear.lastIndex = backtracking.lastIndex = 0;
+    assertEquals(backtracking.exec(subject), linear.exec(subject));
+    assertEquals(backtracking.lastIndex, linear.lastIndex);
+    assertEquals(backtracking.test(subject), linear.test(subject));
+    assertEquals(subject.match(backtracking), subject.match(linear));
+    assertEquals(subject.replace(backtracking, '[$&]'),
+                 subject.replace(linear, '[$&]'));
+    if (flags.includes('g')) {
+      assertEquals([...subject.matchAll(backtracking)].map(m => [...m]),
+                   [...subject.matchAll(linear)].map(m => [...m]));
+    }
+  }
+}
+
+const kPatterns = [
+  'abc', 'a+?b', 'a+b', '(a|ab)(c|bcd)', 'x*', 'z?', '\\d+', '[^a-z]+',
+  '(\\w+)@(\\w+)\\.com', '^\\w+', '\\w+$', '^$', '\\b\\w', '\\B\\w+\\B',
+  '(?:a|b)*c', '.*', '[\\s\\S]{3}$', 'foo|bar|baz', '\\n[a-z]',
+  '(a)(b)(c)(d)(e)(f)(g)(h)(i)', '(a*)(b*)c', '\u0101+\u0102'
+];
+
+const kSubjects = [
+  '',
+  'abc',
+  'ab abd aaab abc aaaab',
+  'user@example.com, other@host.com',
+  'foo\nbar\nbaz qux 42',
+  'abcdefghi abcdefgh aabbc',
+  '\u0101\u0101\u0102 abc \u0102',
+  'xyz_0 9\n'.repeat(200) + 'abcbcd',
+];
+
+for (const source of kPatterns) {
+  for (const flags of ['', 'g', 'm', 'gm', 'y', 'gs']) {
+    for (const subject of kSubjects) {
+      Test(source, flags, subject);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefilter --no-regexp-tier-up
+
+// Unanchored regexps whose matches start with one of a set of literals skip
+// ahead to the positions where one of them starts. The matches must be the
+// same as when trying every position.
+
+// Returns the leftmost match of the literals, preferring earlier literals at
+// the same position, like a disjunction of the literals.
+function FindLiteral(literals, subject, start) {
+  for (let i = start; i < subject.length; i++) {
+    for (const literal of literals) {
+      if (subject.startsWith(literal, i)) return [i, literal];
+    }
+  }
+  return null;
+}
+
+function Words(count, seed) {
+  let state = seed;
+  const words = [];
+  for (let i = 0; i < count; i++) {
+    let word = '';
+    for (let j = 0; j < 3 + i % 4; j++) {
+      state = (state * 16807) % 2147483647;
+      word += String.fromCharCode(97 + state % 26);
+    }
+    words.push(word);
+  }
+  return words;
+}
+
+function TestLiterals(literals, subject) {
+  const re = new RegExp(literals.join('|'), 'g');
+  let expected = [];
+  for (let found = FindLiteral(literals, subject, 0); found != null;
+       found = FindLiteral(literals, subject, found[0] + found[1].length)) {
+    expected.push(found[1]);
+  }
+  assertEquals(expected, subject.match(re) || []);
+
+  const first = FindLiteral(literals, subject, 0);
+  const match = new RegExp(literals.join('|')).exec(subject);
+  if (first == null) {
+    assertNull(match);
+  } else {
+    assertEquals(first[0], match.index);
+    assertEquals(first[1], match[0]);
+  }
+}
+
+for (const count of [3, 10, 64, 65, 100, 1000]) {
+  const literals = Words(count, count);
+  const text = Words(500, 12345).join(' ');
+  TestLiterals(literals, text);
+  TestLiterals(literals, text + literals[count - 1]);
+  TestLiterals(literals, literals[0] + text + literals[count >> 1]);
+  TestLiterals(literals, 'ሴ' + text + literals[1] + 'ሴ');
+  TestLiterals(literals, literals.join(''));
+  TestLiterals(literals, literals.join('Ā'));
+  TestLiterals(literals, '');
+  TestLiterals(literals, literals[2].substring(1));
+}
+
+// Literals with two-byte characters cannot match one-byte subjects.
+TestLiterals(['abĀ', 'cdā', 'efĂ', 'gh'], 'ab cd ef gh');
+TestLiterals(['abĀ', 'cdā', 'efĂ'], 'x cdā ef');
+TestLiterals(['耀a', '胿b', 'ÿc', 'ǿd'],
+             '耀b ÿc 胿b ǿd');
+
+// Literals followed by more of the regexp.
+assertEquals(['bar12', 'foo12', 'baz3'],
+             'foo bar12 foo12 baz3'.match(/(?:foo|bar|baz)\d+/g));
+assertEquals(['error: 42', 'fatal: 7'],
+             'ok: 1 error: 42 warn: 3 fatal: 7'.match(
+                 /(?:error|fatal|panic): \d+/g));
+assertEquals(['abxyz', 'efxyz'],
+             'abxy cdxyq abxyz efxyz'.match(/(?:ab|cd|ef)xyz/g));
+assertEquals(['Error', 'error', 'Fatal'],
+             'Error error ERROR Fatal'.match(/[Ee]rror|[Ff]atal|panic/g));
+
+// Captures, assertions and lookarounds.
+assertEquals(['fatal x', 'fatal', 'x'],
+             [...'error fatal x'.match(/\b(error|fatal|panic) (x)/)]);
+assertEquals(['panic'], 'xpanic panic'.match(/\b(?:error|fatal|panic)/g));
+assertEquals(['panic', 'panic'],
+             'xpanic panic'.match(/(?:error|fatal|panic)/g));
+assertEquals(['fatal'], 'xfatal yfatal'.match(/(?<=y)(?:error|fatal|panic)/g));
+assertEquals(['def', 'ghi', 'abc'],
+             'xabc def\nghi\nabc'.match(/^abc|def|ghi/gm));
+assertEquals(null, 'xabc'.match(/^abc|^def|^ghi/));
+
+// Sticky and anchored regexps don't search.
+const sticky = /abc|def|ghi/y;
+sticky.lastIndex = 1;
+assertNull(sticky.exec('xxdef'));
+sticky.lastIndex = 2;
+assertEquals('def', sticky.exec('xxdef')[0]);
+
+// Global matching restarts after the previous match.
+const global = /aaa|aab|aac/g;
+assertEquals(['aaa', 'aaa'], 'aaaaaaa'.match(global));
+assertEquals('<aab>c<aac>', 'aabcaac'.replace(global, '<$&>'));
+global.lastIndex = 3;
+assertEquals(4, global.exec('aabcaac').index);
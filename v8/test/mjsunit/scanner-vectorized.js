@@ -0,0 +1,88 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --scanner-simd
+
+// The scanner skips identifier parts, whitespace and string literal bodies
+// up to 16 code units at a time. Check special characters at every position
+// around the vector boundaries, in one-byte and two-byte sources, and tokens
+// that span several blocks of the character stream.
+
+const kMaxLength = 70;
+
+function Payload(length) {
+  let s = '';
+  for (let i = 0; i < length; i++) {
+    s += String.fromCharCode(97 + i % 26);
+  }
+  return s;
+}
+
+for (const suffix of ['', '// \u1234']) {
+  for (let length = 1; length < kMaxLength; length++) {
+    const name = Payload(length);
+    assertEquals(length, eval(`var ${name} = ${length}; ${name}` + suffix));
+    // Digits, '_' and '$' are identifier parts too.
+    const mixed = name.slice(0, -1) + '_$9'[length % 3];
+    assertEquals(length, eval(`var ${mixed} = ${length}; ${mixed}` + suffix));
+    // Non-ASCII and escaped identifier parts go to the slow path.
+    for (const part of ['\xe9', '\u1234', '\\u0062']) {
+      const slow = name.slice(0, length >> 1) + part + name.slice(length >> 1);
+      assertEquals(length, eval(`var ${slow} = ${length}; ${slow}` + suffix));
+    }
+    // Followed directly by punctuation.
+    assertEquals(length + 1, eval(`var ${name}=${length};${name}+1` + suffix));
+  }
+
+  // Keywords and identifiers that start with a keyword.
+  assertEquals(1, eval('if(1)1;else 2' + suffix));
+  assertEquals(2, eval('var iff = 2; iff' + suffix));
+  assertEquals(3, eval('var instanceofx = 3; instanceofx' + suffix));
+  assertThrows(() => eval('var instanceof = 4' + suffix), SyntaxError);
+  assertThrows(() => eval('var \\u0069f = 5' + suffix), SyntaxError);
+
+  for (let length = 0; length < kMaxLength; length++) {
+    for (let i = 0; i <= length; i++) {
+      const space = ' \t\v\f'[i % 4].repeat(i);
+      const rest = ' '.repeat(length - i);
+      assertEquals(1, eval(`(() => { return${space} ${rest}1 })()` + suffix));
+      // A line terminator anywhere in the whitespace triggers ASI.
+      for (const terminator of ['\n', '\r', '\u2028']) {
+        assertEquals(undefined, eval(
+            `(() => { return${space}${terminator}${rest}1 })()` + suffix));
+      }
+      // Non-ASCII whitespace in the middle of a run.
+      assertEquals(1, eval(`(() => { return${space}\u00a0${rest}1 })()`));
+    }
+  }
+
+  for (let length = 0; length < kMaxLength; length++) {
+    const payload = Payload(length);
+    for (let i = 0; i < length; i++) {
+      const head = payload.slice(0, i);
+      const tail = payload.slice(i + 1);
+      for (const c of ['\'', '\xff', '\u0100', '\u2028', '\uffff']) {
+        assertEquals(head + c + tail, eval(`"${head}${c}${tail}"` + suffix));
+      }
+      assertEquals(head + '"' + tail, eval(`'${head}"${tail}'` + suffix));
+      assertEquals(head + '\n' + tail, eval(`"${head}\\n${tail}"` + suffix));
+      assertEquals(head + tail, eval(`"${head}\\\n${tail}"` + suffix));
+      assertThrows(() => eval(`"${head}\n${tail}"` + suffix), SyntaxError);
+      assertThrows(() => eval(`"${head}\r${tail}"` + suffix), SyntaxError);
+      assertThrows(() => eval(`"${head}${tail}` + suffix), SyntaxError);
+    }
+  }
+}
+
+// Tokens that span several blocks of the character stream.
+const kLongLength = 10000;
+const longName = Payload(kLongLength);
+assertEquals(
+    kLongLength, eval(`var ${longName} = ${kLongLength}; ${longName}`));
+assertEquals(longName, eval(`"${longName}"`));
+assertEquals(longName + '\u1234', eval(`"${longName}\u1234"`));
+const longSpace = ' '.repeat(kLongLength);
+assertEquals(undefined,
+             eval(`(() => { return${longSpace}\n${longSpace}1 })()`));
+assertEquals(1, eval(`(() => { return${longSpace}1 })()`));
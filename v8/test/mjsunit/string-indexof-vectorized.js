@@ -0,0 +1,72 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched for by comparing up to 32 subject bytes at a
+// time with the first and the last character of the pattern. Check matches
+// at every position around the vector boundaries, in one-byte and two-byte
+// subjects, and patterns that defeat the filter.
+
+function IndexOfReference(subject, pattern, start) {
+  outer: for (let i = start; i + pattern.length <= subject.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[i + j] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+function Filler(length) {
+  return 'xy'.repeat(length).substring(0, length);
+}
+
+for (const suffix of ['', '\u1234']) {
+  for (const pattern_length of [1, 2, 3, 7, 15, 16, 17, 31, 32, 33]) {
+    const pattern = 'a' + 'bc'.repeat(pattern_length).substring(
+        0, pattern_length - 2) + (pattern_length > 1 ? 'd' : '');
+    assertEquals(pattern_length, pattern.length);
+    // The first and the last character match, but the pattern does not.
+    const near_miss = 'a' + 'z'.repeat(Math.max(0, pattern_length - 2)) + 'd';
+    for (let position = 0; position < 70; position++) {
+      const subject = Filler(position) + pattern + Filler(40) + suffix;
+      assertEquals(position, subject.indexOf(pattern));
+      assertTrue(subject.includes(pattern));
+      assertEquals(-1, subject.indexOf(pattern, position + 1));
+      assertEquals(IndexOfReference(subject, near_miss, 0),
+                   subject.indexOf(near_miss));
+      // Truncated matches at the end of the subject.
+      const truncated = Filler(position) + pattern.substring(0,
+          pattern_length - 1) + suffix;
+      assertEquals(-1, truncated.indexOf(pattern));
+    }
+  }
+}
+
+// Two-byte characters whose bytes match the pattern's characters.
+assertEquals(-1, '\u6161\u6262\u6100'.indexOf('a'));
+assertEquals(-1, '\u6161\u6262\u6100'.indexOf('ab'));
+assertEquals(2, '\u6161\u6262a'.indexOf('a'));
+assertEquals(3, '\u0100a\u0100\0\u0100'.indexOf('\0'));
+assertEquals(1, '\u0100a\u0100\0\u0100'.indexOf('a\u0100\0'));
+
+// Patterns whose first and last characters are everywhere, which makes
+// long enough patterns switch to Boyer-Moore-Horspool.
+for (const subject of ['a'.repeat(1000) + 'b', '\u1234' + 'a'.repeat(1000)]) {
+  for (let length = 2; length <= 33; length++) {
+    const pattern = 'a'.repeat(length - 1) + 'b';
+    const repeated = 'a'.repeat(length);
+    assertEquals(IndexOfReference(subject, pattern, 0),
+                 subject.indexOf(pattern));
+    assertEquals(IndexOfReference(subject, repeated, 500),
+                 subject.indexOf(repeated, 500));
+    assertEquals(Math.floor(1000 / length),
+                 subject.split(repeated).length - 1);
+  }
+}
+
+// Split on short separators.
+const log = Array.from({length: 100}, (_, i) => `line ${i}: \u00e9v\u00e9nt`);
+assertEquals(log, log.join('\n').split('\n'));
+assertEquals(log, log.join(' || ').split(' || '));
+assertEquals(log, log.join('\r\n').split('\r\n'));
@@ -3,36 +3,51 @@
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
-// Flags: --no-wasm-tier-up --no-stress-opt
+// Flags: --wasm-tiering-budget=100 --no-stress-opt
 
 load('test/mjsunit/wasm/wasm-module-builder.js');
 
-const num_iterations = 4;
-const num_functions = 2;
-
 const builder = new WasmModuleBuilder();
-for (let i = 0; i < num_functions; ++i) {
-  let kFunction = builder.addFunction('f' + i, kSig_i_v)
-    .addBody(wasmI32Const(i))
-    .exportAs('f' + i)
+builder.addFunction('f0', kSig_i_v).addBody(wasmI32Const(0)).exportFunc();
+builder.addFunction('f1', kSig_i_v).addBody(wasmI32Const(1)).exportFunc();
+builder.addFunction('loop', kSig_v_i)
+    .addBody([
+      kExprLoop, kWasmStmt,
+        kExprLocalGet, 0,
+        kExprI32Const, 1,
+        kExprI32Sub,
+        kExprLocalTee, 0,
+        kExprBrIf, 0,
+      kExprEnd,
+    ])
+    .exportFunc();
+const instance = builder.instantiate();
+
+// TurboFan compiles hot functions on a background thread. Waits for the
+// tier-up, but gives up after a while instead of timing out the test.
+function waitForTierUp(func) {
+  const deadline = Date.now() + 10000;
+  while (%IsLiftoffFunction(func) && Date.now() < deadline) {}
+  assertFalse(%IsLiftoffFunction(func));
 }
 
-let instance = builder.instantiate();
-
-for (let i = 0; i < num_iterations - 1; ++i) {
+(function TestCallsUseUpBudget() {
+  print(arguments.callee.name);
+  // Dynamic tiering does not compile functions with TurboFan eagerly.
   instance.exports.f0();
-  instance.exports.f1();
-}
+  assertTrue(%IsLiftoffFunction(instance.exports.f0));
 
-assertTrue(%IsLiftoffFunction(instance.exports.f0));
-assertTrue(%IsLiftoffFunction(instance.exports.f1));
+  // Each call uses up budget proportional to the size of the function.
+  for (let i = 0; i < 100; ++i) instance.exports.f1();
 
-instance.exports.f1();
+  waitForTierUp(instance.exports.f1);
+  assertTrue(%IsLiftoffFunction(instance.exports.f0));
+})();
 
-// Busy waiting until the function is tiered up.
-while (true) {
-  if (!%IsLiftoffFunction(instance.exports.f1)) {
-    break;
-  }
-}
-assertTrue(%IsLiftoffFunction(instance.exports.f0));
+(function TestLoopBackEdgesUseUpBudget() {
+  print(arguments.callee.name);
+  // A single call runs enough iterations to use up the budget.
+  instance.exports.loop(1000);
+
+  waitForTierUp(instance.exports.loop);
+})();
@@ -64,6 +64,45 @@ class BlockingCompilationJob : public OptimizedCompilationJob {
   base::Semaphore semaphore_;
 };
 
+class RecordingCompilationJob : public OptimizedCompilationJob {
+ public:
+  RecordingCompilationJob(Isolate* isolate, Handle<JSFunction> function,
+                          bool* disposed)
+      : OptimizedCompilationJob(&info_, "RecordingCompilationJob",
+                                State::kReadyToExecute),
+        shared_(function->shared(), isolate),
+        zone_(isolate->allocator(), ZONE_NAME),
+        info_(&zone_, isolate, shared_, function, CodeKind::TURBOFAN),
+        disposed_(disposed) {}
+  ~RecordingCompilationJob() override { *disposed_ = true; }
+  RecordingCompilationJob(const RecordingCompilationJob&) = delete;
+  RecordingCompilationJob& operator=(const RecordingCompilationJob&) = delete;
+
+  // OptimiziedCompilationJob implementation.
+  Status PrepareJobImpl(Isolate* isolate) override { UNREACHABLE(); }
+  Status ExecuteJobImpl(RuntimeCallStats* stats,
+                        LocalIsolate* local_isolate) override {
+    return SUCCEEDED;
+  }
+  Status FinalizeJobImpl(Isolate* isolate) override { return SUCCEEDED; }
+
+ private:
+  Handle<SharedFunctionInfo> shared_;
+  Zone zone_;
+  OptimizedCompilationInfo info_;
+  bool* disposed_;
+};
+
+Handle<JSFunction> CompileWithInvocationCount(Handle<JSFunction> function,
+                                              int invocation_count) {
+  IsCompiledScope is_compiled_scope;
+  CHECK(Compiler::Compile(function, Compiler::CLEAR_EXCEPTION,
+                          &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
+  function->feedback_vector().set_invocation_count(invocation_count);
+  return function;
+}
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -97,5 +136,40 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, HotJobDisplacesColdJob) {
+  SaveFlags save_flags;
+  FLAG_concurrent_recompilation_queue_length = 1;
+  FLAG_block_concurrent_recompilation = true;
+  Handle<JSFunction> cold = CompileWithInvocationCount(
+      RunJS<JSFunction>("(function cold() {})"), 10);
+  Handle<JSFunction> warm = CompileWithInvocationCount(
+      RunJS<JSFunction>("(function warm() {})"), 20);
+  Handle<JSFunction> hot = CompileWithInvocationCount(
+      RunJS<JSFunction>("(function hot() {})"), 100);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  bool warm_disposed = false;
+  dispatcher.QueueForOptimization(
+      new RecordingCompilationJob(i_isolate(), warm, &warm_disposed));
+  ASSERT_FALSE(dispatcher.IsQueueAvailable());
+
+  // A colder job has to wait, a hotter one takes the place of the waiting
+  // job.
+  bool cold_disposed = false;
+  RecordingCompilationJob cold_job(i_isolate(), cold, &cold_disposed);
+  ASSERT_FALSE(dispatcher.IsQueueAvailable(cold_job.compilation_info()));
+  bool hot_disposed = false;
+  RecordingCompilationJob* hot_job =
+      new RecordingCompilationJob(i_isolate(), hot, &hot_disposed);
+  ASSERT_TRUE(dispatcher.IsQueueAvailable(hot_job->compilation_info()));
+  dispatcher.QueueForOptimization(hot_job);
+  ASSERT_TRUE(warm_disposed);
+  ASSERT_FALSE(hot_disposed);
+  ASSERT_FALSE(dispatcher.IsQueueAvailable(cold_job.compilation_info()));
+
+  dispatcher.Stop();
+  ASSERT_TRUE(hot_disposed);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -172,8 +172,9 @@ TEST_F(ConcurrentSweeperTest, BackgroundSweepOfNormalPage) {
   FinishSweeping();
 
   // Check that finalizable objects are swept and put into the freelist of the
-  // corresponding space.
-  EXPECT_TRUE(FreeListContains(space, {unmarked_object}));
+  // corresponding space. Sweeping moves pages of the nursery to the old
+  // generation.
+  EXPECT_TRUE(FreeListContains(page->space(), {unmarked_object}));
 }
 
 TEST_F(ConcurrentSweeperTest, BackgroundSweepOfLargePage) {
@@ -99,6 +99,16 @@ struct SpaceTrait<
 
 namespace internal {
 
+namespace {
+#if defined(CPPGC_YOUNG_GENERATION)
+constexpr RawHeap::RegularSpaceType kRegularSpaceType =
+    RawHeap::RegularSpaceType::kNursery;
+#else
+constexpr RawHeap::RegularSpaceType kRegularSpaceType =
+    RawHeap::RegularSpaceType::kNormal1;
+#endif
+}  // namespace
+
 TEST_F(TestWithHeapWithCustomSpaces, AllocateOnCustomSpaces) {
   auto* regular =
       MakeGarbageCollected<RegularGCed>(GetHeap()->GetAllocationHandle());
@@ -110,7 +120,7 @@ TEST_F(TestWithHeapWithCustomSpaces, AllocateOnCustomSpaces) {
             NormalPage::FromPayload(custom1)->space()->index());
   EXPECT_EQ(RawHeap::kNumberOfRegularSpaces + 1,
             NormalPage::FromPayload(custom2)->space()->index());
-  EXPECT_EQ(static_cast<size_t>(RawHeap::RegularSpaceType::kNormal1),
+  EXPECT_EQ(static_cast<size_t>(kRegularSpaceType),
             NormalPage::FromPayload(regular)->space()->index());
 }
 
@@ -126,7 +136,7 @@ TEST_F(TestWithHeapWithCustomSpaces,
             NormalPage::FromPayload(custom1)->space()->index());
   EXPECT_EQ(RawHeap::kNumberOfRegularSpaces,
             NormalPage::FromPayload(custom2)->space()->index());
-  EXPECT_EQ(static_cast<size_t>(RawHeap::RegularSpaceType::kNormal1),
+  EXPECT_EQ(static_cast<size_t>(kRegularSpaceType),
             NormalPage::FromPayload(regular)->space()->index());
 }
 
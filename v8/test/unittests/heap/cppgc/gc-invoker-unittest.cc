@@ -108,6 +108,42 @@ TEST(GCInvokerTest, ConservativeGCIsInvokedAsPreciseGCViaPlatform) {
   platform.RunAllForegroundTasks();
 }
 
+TEST(GCInvokerTest, MinorGCIsAlwaysInvokedAsPreciseGCViaPlatform) {
+  testing::TestPlatform platform;
+  MockGarbageCollector gc;
+  GCInvoker invoker(&gc, &platform,
+                    cppgc::Heap::StackSupport::kSupportsConservativeStackScan);
+  EXPECT_CALL(gc, epoch).WillRepeatedly(::testing::Return(0));
+  EXPECT_CALL(
+      gc,
+      CollectGarbage(::testing::AllOf(
+          ::testing::Field(&GarbageCollector::Config::collection_type,
+                           GarbageCollector::Config::CollectionType::kMinor),
+          ::testing::Field(
+              &GarbageCollector::Config::stack_state,
+              GarbageCollector::Config::StackState::kNoHeapPointers))));
+  invoker.CollectGarbage(
+      GarbageCollector::Config::MinorConservativeAtomicConfig());
+  platform.RunAllForegroundTasks();
+}
+
+TEST(GCInvokerTest, GCIsScheduledAgainAfterSkippedTask) {
+  testing::TestPlatform platform;
+  MockGarbageCollector gc;
+  GCInvoker invoker(&gc, &platform,
+                    cppgc::Heap::StackSupport::kNoConservativeStackScan);
+  // The first task is skipped because a GC happened in the meantime.
+  EXPECT_CALL(gc, epoch)
+      .WillOnce(::testing::Return(0))
+      .WillOnce(::testing::Return(1))
+      .WillRepeatedly(::testing::Return(1));
+  EXPECT_CALL(gc, CollectGarbage).Times(1);
+  invoker.CollectGarbage(GarbageCollector::Config::ConservativeAtomicConfig());
+  platform.RunAllForegroundTasks();
+  invoker.CollectGarbage(GarbageCollector::Config::ConservativeAtomicConfig());
+  platform.RunAllForegroundTasks();
+}
+
 TEST(GCInvokerTest, IncrementalGCIsStarted) {
   // Since StartIncrementalGarbageCollection doesn't scan the stack, support for
   // conservative stack scanning should not matter.
@@ -141,5 +141,21 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+TEST(HeapGrowingTest, MinorGCInvoked) {
+  StatsCollector stats_collector;
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  // Leave room for the young generation before a major GC is due.
+  constraints.initial_heap_size_bytes = 10 * HeapGrowing::kYoungGenerationLimit;
+  HeapGrowing growing(&gc, &stats_collector, constraints);
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(
+                      &GarbageCollector::Config::collection_type,
+                      GarbageCollector::Config::CollectionType::kMinor)));
+  FakeAllocate(&stats_collector, HeapGrowing::kYoungGenerationLimit + 1);
+}
+#endif
+
 }  // namespace internal
 }  // namespace cppgc
@@ -36,6 +36,18 @@ class GCed : public GarbageCollected<GCed<Size>> {
   char array[Size];
 };
 
+// The space that objects of a size class are allocated in. With young
+// generation, objects of all sizes below the large object threshold start out
+// in the nursery.
+RawHeap::RegularSpaceType InitialSpace(RawHeap::RegularSpaceType size_class) {
+#if defined(CPPGC_YOUNG_GENERATION)
+  USE(size_class);
+  return RawHeap::RegularSpaceType::kNursery;
+#else
+  return size_class;
+#endif
+}
+
 }  // namespace
 
 TEST_F(PageTest, SpaceIndexing) {
@@ -55,29 +67,33 @@ TEST_F(PageTest, PredefinedSpaces) {
   {
     auto* gced = MakeGarbageCollected<GCed<1>>(GetAllocationHandle());
     BaseSpace* space = NormalPage::FromPayload(gced)->space();
-    EXPECT_EQ(heap.Space(SpaceType::kNormal1), space);
-    EXPECT_EQ(0u, space->index());
+    const SpaceType type = InitialSpace(SpaceType::kNormal1);
+    EXPECT_EQ(heap.Space(type), space);
+    EXPECT_EQ(static_cast<size_t>(type), space->index());
     EXPECT_FALSE(space->is_large());
   }
   {
     auto* gced = MakeGarbageCollected<GCed<32>>(GetAllocationHandle());
     BaseSpace* space = NormalPage::FromPayload(gced)->space();
-    EXPECT_EQ(heap.Space(SpaceType::kNormal2), space);
-    EXPECT_EQ(1u, space->index());
+    const SpaceType type = InitialSpace(SpaceType::kNormal2);
+    EXPECT_EQ(heap.Space(type), space);
+    EXPECT_EQ(static_cast<size_t>(type), space->index());
     EXPECT_FALSE(space->is_large());
   }
   {
     auto* gced = MakeGarbageCollected<GCed<64>>(GetAllocationHandle());
     BaseSpace* space = NormalPage::FromPayload(gced)->space();
-    EXPECT_EQ(heap.Space(SpaceType::kNormal3), space);
-    EXPECT_EQ(2u, space->index());
+    const SpaceType type = InitialSpace(SpaceType::kNormal3);
+    EXPECT_EQ(heap.Space(type), space);
+    EXPECT_EQ(static_cast<size_t>(type), space->index());
     EXPECT_FALSE(space->is_large());
   }
   {
     auto* gced = MakeGarbageCollected<GCed<128>>(GetAllocationHandle());
     BaseSpace* space = NormalPage::FromPayload(gced)->space();
-    EXPECT_EQ(heap.Space(SpaceType::kNormal4), space);
-    EXPECT_EQ(3u, space->index());
+    const SpaceType type = InitialSpace(SpaceType::kNormal4);
+    EXPECT_EQ(heap.Space(type), space);
+    EXPECT_EQ(static_cast<size_t>(type), space->index());
     EXPECT_FALSE(space->is_large());
   }
   {
@@ -85,7 +101,7 @@ TEST_F(PageTest, PredefinedSpaces) {
         GetAllocationHandle());
     BaseSpace* space = NormalPage::FromPayload(gced)->space();
     EXPECT_EQ(heap.Space(SpaceType::kLarge), space);
-    EXPECT_EQ(4u, space->index());
+    EXPECT_EQ(static_cast<size_t>(SpaceType::kLarge), space->index());
     EXPECT_TRUE(space->is_large());
   }
 }
@@ -106,7 +122,7 @@ TEST_F(PageTest, NormalPageIndexing) {
   }
 
   const RawHeap& heap = GetRawHeap();
-  const BaseSpace* space = heap.Space(SpaceType::kNormal1);
+  const BaseSpace* space = heap.Space(InitialSpace(SpaceType::kNormal1));
   EXPECT_EQ(kExpectedNumberOfPages, space->size());
 
   size_t page_n = 0;
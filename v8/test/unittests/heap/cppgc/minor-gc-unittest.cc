@@ -7,7 +7,10 @@
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/persistent.h"
 #include "src/heap/cppgc/heap-object-header.h"
+#include "src/heap/cppgc/heap-page.h"
+#include "src/heap/cppgc/heap-space.h"
 #include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/stats-collector.h"
 #include "test/unittests/heap/cppgc/tests.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -102,6 +105,81 @@ TYPED_TEST(MinorGCTestForType, MinorCollection) {
   EXPECT_EQ(65u, TestFixture::DestructedObjects());
 }
 
+TEST_F(MinorGCTest, YoungObjectsAreAllocatedInNursery) {
+  RawHeap& raw_heap = Heap::From(GetHeap())->raw_heap();
+  const BaseSpace* nursery =
+      raw_heap.Space(RawHeap::RegularSpaceType::kNursery);
+  const BaseSpace* old_space =
+      raw_heap.Space(RawHeap::RegularSpaceType::kNormal4);
+
+  Persistent<Small> p = MakeGarbageCollected<Small>(GetAllocationHandle());
+  EXPECT_EQ(nursery, BasePage::FromPayload(p.Get())->space());
+  EXPECT_EQ(1u, nursery->size());
+
+  // Surviving objects are promoted together with their page.
+  CollectMinor();
+  EXPECT_EQ(old_space, BasePage::FromPayload(p.Get())->space());
+  EXPECT_EQ(0u, nursery->size());
+  EXPECT_EQ(0u, DestructedObjects());
+}
+
+TEST_F(MinorGCTest, NurseryReusesMemoryOfOldGeneration) {
+  RawHeap& raw_heap = Heap::From(GetHeap())->raw_heap();
+  const BaseSpace* nursery =
+      raw_heap.Space(RawHeap::RegularSpaceType::kNursery);
+
+  Persistent<Small> first = MakeGarbageCollected<Small>(GetAllocationHandle());
+  for (size_t i = 0; i < 64; ++i) {
+    MakeGarbageCollected<Small>(GetAllocationHandle());
+  }
+  Persistent<Small> last = MakeGarbageCollected<Small>(GetAllocationHandle());
+  BasePage* page = BasePage::FromPayload(first.Get());
+  CollectMinor();
+  EXPECT_EQ(64u, DestructedObjects());
+
+  // The memory freed by the minor GC is reused by the nursery, which then
+  // owns the page until the next GC.
+  Small* reused = MakeGarbageCollected<Small>(GetAllocationHandle());
+  EXPECT_EQ(page, BasePage::FromPayload(reused));
+  EXPECT_EQ(nursery, page->space());
+
+  CollectMinor();
+  EXPECT_EQ(65u, DestructedObjects());
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(first.Get()).IsFree());
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(last.Get()).IsFree());
+
+  first.Release();
+  last.Release();
+  CollectMajor();
+  EXPECT_EQ(67u, DestructedObjects());
+}
+
+TEST_F(MinorGCTest, ClearedRememberedSlotIsIgnored) {
+  Persistent<Small> old = MakeGarbageCollected<Small>(GetAllocationHandle());
+  CollectMinor();
+
+  old->next = MakeGarbageCollected<Small>(GetAllocationHandle());
+  EXPECT_EQ(1u, Heap::From(GetHeap())->remembered_slots().size());
+  old->next = nullptr;
+
+  CollectMinor();
+  EXPECT_EQ(1u, DestructedObjects());
+}
+
+TEST_F(MinorGCTest, MinorGCStatistics) {
+  const StatsCollector* stats = Heap::From(GetHeap())->stats_collector();
+  const size_t count_before = stats->minor_gc_statistics().count;
+  const size_t promoted_bytes_before =
+      stats->minor_gc_statistics().promoted_bytes;
+
+  Persistent<Small> p = MakeGarbageCollected<Small>(GetAllocationHandle());
+  CollectMinor();
+  CollectMinor();
+
+  EXPECT_EQ(count_before + 2, stats->minor_gc_statistics().count);
+  EXPECT_LT(promoted_bytes_before, stats->minor_gc_statistics().promoted_bytes);
+}
+
 TYPED_TEST(MinorGCTestForType, StickyBits) {
   using Type = typename TestFixture::Type;
 
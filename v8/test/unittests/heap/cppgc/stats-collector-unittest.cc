@@ -101,6 +101,37 @@ TEST_F(StatsCollectorTest, AllocatedObjectSizeAllocateAfterMarking) {
   EXPECT_EQ(2 * kMinReportedSize, stats.allocated_object_size());
 }
 
+TEST_F(StatsCollectorTest, MinorGCAddsToPreviousMarkedBytes) {
+  stats.NotifyMarkingStarted(CollectionType::kMajor);
+  stats.NotifyMarkingCompleted(kMinReportedSize);
+  stats.NotifySweepingCompleted();
+  stats.NotifyMarkingStarted(CollectionType::kMinor);
+  FakeAllocate(2 * kMinReportedSize);
+  stats.NotifyMarkingCompleted(kMinReportedSize);
+  EXPECT_EQ(2 * kMinReportedSize, stats.allocated_object_size());
+  auto event = stats.NotifySweepingCompleted();
+  EXPECT_EQ(CollectionType::kMinor, event.collection_type);
+  EXPECT_EQ(2 * kMinReportedSize, event.marked_bytes);
+  EXPECT_EQ(2 * kMinReportedSize, stats.allocated_object_size());
+}
+
+TEST_F(StatsCollectorTest, MinorGCStatistics) {
+  stats.NotifyMarkingStarted(CollectionType::kMajor);
+  stats.NotifyMarkingCompleted(kMinReportedSize);
+  stats.NotifySweepingCompleted();
+  EXPECT_EQ(0u, stats.minor_gc_statistics().count);
+  for (size_t i = 1; i <= 3; ++i) {
+    stats.NotifyMarkingStarted(CollectionType::kMinor);
+    stats.NotifyMarkingCompleted(kMinReportedSize);
+    auto event = stats.NotifySweepingCompleted();
+    const auto& minor_stats = stats.minor_gc_statistics();
+    EXPECT_EQ(i, minor_stats.count);
+    EXPECT_EQ(i * kMinReportedSize, minor_stats.promoted_bytes);
+    EXPECT_LE(event.marking_time + event.sweeping_time, minor_stats.max_pause);
+    EXPECT_LE(minor_stats.max_pause, minor_stats.total_pause);
+  }
+}
+
 class MockAllocationObserver : public StatsCollector::AllocationObserver {
  public:
   MOCK_METHOD(void, AllocatedObjectSizeIncreased, (size_t), (override));
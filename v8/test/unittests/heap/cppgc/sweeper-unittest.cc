@@ -85,14 +85,15 @@ TEST_F(SweeperTest, DontSweepMarkedNormalObject) {
   auto* object = MakeGarbageCollected<Type>(GetAllocationHandle());
   MarkObject(object);
   BasePage* page = BasePage::FromPayload(object);
-  BaseSpace* space = page->space();
 
   EXPECT_EQ(0u, g_destructor_callcount);
 
   Sweep();
 
   EXPECT_EQ(0u, g_destructor_callcount);
-  // Check that page is returned back to the space.
+  // Check that page is returned back to the space. Sweeping moves pages of the
+  // nursery to the old generation, so the space is looked up afterwards.
+  BaseSpace* space = page->space();
   EXPECT_NE(space->end(), std::find(space->begin(), space->end(), page));
   EXPECT_NE(nullptr, GetBackend()->Lookup(reinterpret_cast<Address>(object)));
 }
@@ -200,18 +201,21 @@ TEST_F(SweeperTest, CoalesceFreeListEntries) {
       HeapObjectHeader::FromPayload(object3).GetSize();
 
   const BasePage* page = BasePage::FromPayload(object2);
-  const FreeList& freelist = NormalPageSpace::From(page->space())->free_list();
+  auto freelist = [page]() -> const FreeList& {
+    // Sweeping may move the page from the nursery to the old generation.
+    return NormalPageSpace::From(page->space())->free_list();
+  };
 
   const FreeList::Block coalesced_block = {
       object2_start, static_cast<size_t>(object3_end - object2_start)};
 
   EXPECT_EQ(0u, g_destructor_callcount);
-  EXPECT_FALSE(freelist.Contains(coalesced_block));
+  EXPECT_FALSE(freelist().Contains(coalesced_block));
 
   Sweep();
 
   EXPECT_EQ(2u, g_destructor_callcount);
-  EXPECT_TRUE(freelist.Contains(coalesced_block));
+  EXPECT_TRUE(freelist().Contains(coalesced_block));
 }
 
 namespace {
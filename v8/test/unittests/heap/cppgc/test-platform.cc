@@ -29,6 +29,15 @@ void TestPlatform::RunAllForegroundTasks() {
   }
 }
 
+void TestPlatform::RunAllForegroundTasksUntilEmpty() {
+  while (v8::platform::PumpMessageLoop(v8_platform_.get(), kNoIsolate)) {
+  }
+  if (GetForegroundTaskRunner()->IdleTasksEnabled()) {
+    v8::platform::RunIdleTasks(v8_platform_.get(), kNoIsolate,
+                               std::numeric_limits<double>::max());
+  }
+}
+
 TestPlatform::DisableBackgroundTasksScope::DisableBackgroundTasksScope(
     TestPlatform* platform)
     : platform_(platform) {
@@ -30,6 +30,9 @@ class TestPlatform : public DefaultPlatform {
       std::unique_ptr<cppgc::JobTask> job_task) final;
 
   void RunAllForegroundTasks();
+  // Unlike RunAllForegroundTasks(), also runs the tasks that are posted while
+  // the queue is drained.
+  void RunAllForegroundTasksUntilEmpty();
 
  private:
   bool AreBackgroundTasksDisabled() const {
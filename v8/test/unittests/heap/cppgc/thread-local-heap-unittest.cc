@@ -0,0 +1,163 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/thread-local-heap.h"
+
+#include <atomic>
+#include <functional>
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/cross-thread-persistent.h"
+#include "include/cppgc/member.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/heap/cppgc/heap-page.h"
+#include "src/heap/cppgc/stats-collector.h"
+#include "src/heap/cppgc/thread-local-heap.h"
+#include "test/unittests/heap/cppgc/tests.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace cppgc {
+namespace internal {
+
+namespace {
+
+struct GCed final : GarbageCollected<GCed> {
+  static std::atomic<size_t> destructor_call_count;
+  ~GCed() { destructor_call_count++; }
+  void Trace(cppgc::Visitor* visitor) const { visitor->Trace(next); }
+  Member<GCed> next;
+};
+std::atomic<size_t> GCed::destructor_call_count{0};
+
+class Runner final : public v8::base::Thread {
+ public:
+  template <typename Callback>
+  explicit Runner(Callback callback)
+      : Thread(v8::base::Thread::Options("ThreadLocalHeap Thread")),
+        callback_(callback) {}
+
+  void Run() final { callback_(); }
+
+ private:
+  std::function<void()> callback_;
+};
+
+class ThreadLocalHeapTest : public testing::TestWithHeap {
+ public:
+  ThreadLocalHeapTest() { GCed::destructor_call_count = 0; }
+};
+
+}  // namespace
+
+TEST_F(ThreadLocalHeapTest, AllocateOnDifferentThread) {
+  static constexpr size_t kNumObjects = 1000;
+  subtle::CrossThreadPersistent<GCed> list;
+  {
+    Runner runner([this, &list]() {
+      auto thread_local_heap = cppgc::ThreadLocalHeap::Create(GetHeap());
+      for (size_t i = 0; i < kNumObjects; ++i) {
+        GCed* object = MakeGarbageCollected<GCed>(
+            thread_local_heap->GetAllocationHandle());
+        object->next = list.Get();
+        list = object;
+      }
+    });
+    EXPECT_TRUE(runner.Start());
+    runner.Join();
+  }
+  size_t length = 0;
+  for (GCed* object = list.Get(); object; object = object->next.Get()) {
+    EXPECT_EQ(Heap::From(GetHeap()), BasePage::FromPayload(object)->heap());
+    ++length;
+  }
+  EXPECT_EQ(kNumObjects, length);
+  PreciseGC();
+  EXPECT_EQ(0u, GCed::destructor_call_count);
+  list.Clear();
+  PreciseGC();
+  EXPECT_EQ(kNumObjects, GCed::destructor_call_count);
+}
+
+TEST_F(ThreadLocalHeapTest, GarbageCollectionStopsRunningThread) {
+  static constexpr size_t kNumGCs = 5;
+  std::atomic<bool> done{false};
+  v8::base::Semaphore started(0);
+  subtle::CrossThreadPersistent<GCed> retained;
+  {
+    Runner runner([this, &done, &started, &retained]() {
+      auto thread_local_heap = cppgc::ThreadLocalHeap::Create(GetHeap());
+      retained =
+          MakeGarbageCollected<GCed>(thread_local_heap->GetAllocationHandle());
+      started.Signal();
+      while (!done.load(std::memory_order_relaxed)) {
+        MakeGarbageCollected<GCed>(thread_local_heap->GetAllocationHandle());
+        thread_local_heap->Safepoint();
+      }
+    });
+    EXPECT_TRUE(runner.Start());
+    started.Wait();
+    for (size_t i = 0; i < kNumGCs; ++i) PreciseGC();
+    done.store(true, std::memory_order_relaxed);
+    runner.Join();
+  }
+  EXPECT_LT(0u, GCed::destructor_call_count);
+  const size_t destructed_objects = GCed::destructor_call_count;
+  EXPECT_TRUE(retained);
+  retained.Clear();
+  PreciseGC();
+  EXPECT_LT(destructed_objects, GCed::destructor_call_count);
+}
+
+TEST_F(ThreadLocalHeapTest, ParkedThreadDoesNotBlockGarbageCollection) {
+  v8::base::Semaphore parked(0);
+  v8::base::Semaphore resume(0);
+  subtle::CrossThreadPersistent<GCed> retained;
+  {
+    Runner runner([this, &parked, &resume, &retained]() {
+      auto thread_local_heap = cppgc::ThreadLocalHeap::Create(GetHeap());
+      MakeGarbageCollected<GCed>(thread_local_heap->GetAllocationHandle());
+      {
+        cppgc::ThreadLocalHeap::ParkedScope parked_scope(*thread_local_heap);
+        parked.Signal();
+        resume.Wait();
+      }
+      // The buffer was given up while the thread was parked.
+      retained =
+          MakeGarbageCollected<GCed>(thread_local_heap->GetAllocationHandle());
+    });
+    EXPECT_TRUE(runner.Start());
+    parked.Wait();
+    PreciseGC();
+    EXPECT_EQ(1u, GCed::destructor_call_count);
+    resume.Signal();
+    runner.Join();
+  }
+  PreciseGC();
+  EXPECT_EQ(1u, GCed::destructor_call_count);
+  EXPECT_TRUE(retained);
+}
+
+TEST_F(ThreadLocalHeapTest, AllocationIsAccountedOnOwningThread) {
+  const size_t allocated_before =
+      Heap::From(GetHeap())->stats_collector()->allocated_object_size();
+  {
+    Runner runner([this]() {
+      auto thread_local_heap = cppgc::ThreadLocalHeap::Create(GetHeap());
+      // Exceed the threshold below which allocations are not reported.
+      for (size_t i = 0;
+           i * sizeof(GCed) <= StatsCollector::kAllocationThresholdBytes; ++i) {
+        MakeGarbageCollected<GCed>(thread_local_heap->GetAllocationHandle());
+      }
+    });
+    EXPECT_TRUE(runner.Start());
+    runner.Join();
+  }
+  GetPlatform().RunAllForegroundTasksUntilEmpty();
+  EXPECT_LT(allocated_before,
+            Heap::From(GetHeap())->stats_collector()->allocated_object_size());
+}
+
+}  // namespace internal
+}  // namespace cppgc
@@ -537,6 +537,27 @@ TEST_F(GCTracerTest, RecordScavengerHistograms) {
   GcHistogram::CleanUp();
 }
 
+TEST_F(GCTracerTest, ScavengeTaskWork) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  EXPECT_EQ(0.0, tracer->AverageOldToNewPages());
+  tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  // One of four tasks did half of the work.
+  tracer->AddScavengeTaskWork(4, 10, 1000, 500);
+  EXPECT_EQ(4, tracer->current_.scavenge_tasks);
+  EXPECT_EQ(10u, tracer->current_.old_to_new_pages);
+  EXPECT_DOUBLE_EQ(2.0, tracer->current_.scavenge_task_imbalance);
+  tracer->Stop(SCAVENGER);
+  tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  // No work at all is spread evenly.
+  tracer->AddScavengeTaskWork(2, 20, 0, 0);
+  EXPECT_DOUBLE_EQ(1.0, tracer->current_.scavenge_task_imbalance);
+  tracer->Stop(SCAVENGER);
+  EXPECT_DOUBLE_EQ(15.0, tracer->AverageOldToNewPages());
+}
+
 TEST_F(GCTracerTest, RecordGCSumHistograms) {
   if (FLAG_stress_incremental_marking) return;
   isolate()->SetCreateHistogramFunction(&GcHistogram::CreateHistogram);
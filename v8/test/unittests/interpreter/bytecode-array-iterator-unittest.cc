@@ -6,9 +6,11 @@
 
 #include "src/interpreter/bytecode-array-builder.h"
 #include "src/interpreter/bytecode-array-iterator.h"
+#include "src/interpreter/bytecode-label.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/smi.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/interpreter/bytecode-utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -274,6 +276,73 @@ TEST_F(BytecodeArrayIteratorTest, IteratesBytecodeArray) {
   CHECK(iterator.done());
 }
 
+TEST_F(BytecodeArrayIteratorTest, IteratesSuperinstructions) {
+  // The builder's writer only fuses bytecodes if the flag is set when it is
+  // created.
+  FlagScope<bool> superinstructions(&FLAG_ignition_superinstructions, true);
+  FeedbackVectorSpec feedback_spec(zone());
+  BytecodeArrayBuilder builder(zone(), 3, 3, &feedback_spec);
+  Register reg_0(0);
+  Register reg_1(1);
+  BytecodeLabel label;
+
+  builder.LoadAccumulatorWithRegister(reg_0)
+      .BinaryOperation(Token::Value::ADD, reg_1, 1)
+      .CompareOperation(Token::Value::LT, reg_0, 2)
+      .JumpIfFalse(BytecodeArrayBuilder::ToBooleanMode::kAlreadyBoolean,
+                   &label)
+      .LoadAccumulatorWithRegister(reg_1)
+      .Bind(&label)
+      .Return();
+
+  Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray(isolate());
+  int add_offset = Bytecodes::Size(Bytecode::kLdar, OperandScale::kSingle);
+  int compare_offset =
+      add_offset + Bytecodes::Size(Bytecode::kAdd, OperandScale::kSingle);
+  int jump_offset = compare_offset + Bytecodes::Size(Bytecode::kTestLessThan,
+                                                     OperandScale::kSingle);
+  EXPECT_EQ(bytecode_array->get(0), Bytecodes::ToByte(Bytecode::kLdarAdd));
+  EXPECT_EQ(bytecode_array->get(compare_offset),
+            Bytecodes::ToByte(Bytecode::kTestLessThanJumpIfFalse));
+
+  // The superinstructions are reported as the bytecodes they were fused from,
+  // and the bytecodes they were fused with keep their own offsets.
+  BytecodeArrayIterator iterator(bytecode_array);
+  EXPECT_EQ(iterator.current_bytecode(), Bytecode::kLdar);
+  EXPECT_EQ(iterator.current_offset(), 0);
+  EXPECT_EQ(iterator.current_bytecode_size(), add_offset);
+  EXPECT_EQ(iterator.GetRegisterOperand(0).index(), reg_0.index());
+  iterator.Advance();
+
+  EXPECT_EQ(iterator.current_bytecode(), Bytecode::kAdd);
+  EXPECT_EQ(iterator.current_offset(), add_offset);
+  EXPECT_EQ(iterator.GetRegisterOperand(0).index(), reg_1.index());
+  EXPECT_EQ(iterator.GetIndexOperand(1), 1u);
+  iterator.Advance();
+
+  EXPECT_EQ(iterator.current_bytecode(), Bytecode::kTestLessThan);
+  EXPECT_EQ(iterator.current_offset(), compare_offset);
+  EXPECT_EQ(iterator.GetRegisterOperand(0).index(), reg_0.index());
+  EXPECT_EQ(iterator.GetIndexOperand(1), 2u);
+  iterator.Advance();
+
+  EXPECT_EQ(iterator.current_bytecode(), Bytecode::kJumpIfFalse);
+  EXPECT_EQ(iterator.current_offset(), jump_offset);
+  int return_offset =
+      jump_offset +
+      Bytecodes::Size(Bytecode::kJumpIfFalse, OperandScale::kSingle) +
+      Bytecodes::Size(Bytecode::kLdar, OperandScale::kSingle);
+  EXPECT_EQ(iterator.GetJumpTargetOffset(), return_offset);
+  iterator.Advance();
+
+  EXPECT_EQ(iterator.current_bytecode(), Bytecode::kLdar);
+  iterator.Advance();
+  EXPECT_EQ(iterator.current_bytecode(), Bytecode::kReturn);
+  EXPECT_EQ(iterator.current_offset(), return_offset);
+  iterator.Advance();
+  CHECK(iterator.done());
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
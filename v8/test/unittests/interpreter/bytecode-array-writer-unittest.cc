@@ -8,6 +8,7 @@
 #include "src/codegen/source-position-table.h"
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-array-writer.h"
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-node.h"
@@ -52,6 +53,10 @@ class BytecodeArrayWriterUnittest : public TestWithIsolateAndZone {
   void WriteJumpLoop(Bytecode bytecode, BytecodeLoopHeader* loop_header,
                      int depth, BytecodeSourceInfo info = BytecodeSourceInfo());
 
+  void set_fuse_superinstructions(bool fuse) {
+    writer()->fuse_superinstructions_ = fuse;
+  }
+
   BytecodeArrayWriter* writer() { return &bytecode_array_writer_; }
   ZoneVector<unsigned char>* bytecodes() { return writer()->bytecodes(); }
   SourcePositionTableBuilder* source_position_table_builder() {
@@ -293,6 +298,62 @@ TEST_F(BytecodeArrayWriterUnittest, ElideNoneffectfulBytecodes) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, FuseSuperinstructions) {
+  set_fuse_superinstructions(true);
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 */ B(LdarAdd), R8(1),
+      /*  2 */ B(Add), R8(2), U8(1),
+      /*  5 */ B(Star), R8(3),
+      /*  7 */ B(TestLessThanJumpIfFalse), R8(3), U8(2),
+      /* 10 */ B(JumpIfFalse), U8(11),
+      /* 12 */ B(Wide), B(Ldar), R16(300),
+      /* 16 */ B(Add), R8(2), U8(1),
+      /* 19 */ B(Ldar), R8(1),
+      /* 21 */ B(Sub), R8(2), U8(3),
+      /* 24 */ B(Return),
+      // clang-format on
+  };
+
+  BytecodeLabel label;
+  Write(Bytecode::kLdar, Register(1).ToOperand());
+  Write(Bytecode::kAdd, Register(2).ToOperand(), 1);
+  Write(Bytecode::kStar, Register(3).ToOperand());
+  Write(Bytecode::kTestLessThan, Register(3).ToOperand(), 2);
+  WriteJump(Bytecode::kJumpIfFalse, &label);
+  // Not fused as the Ldar needs a scaling prefix.
+  Write(Bytecode::kLdar, Register(300).ToOperand());
+  Write(Bytecode::kAdd, Register(2).ToOperand(), 1);
+  // Not fused as the Sub starts a basic block.
+  Write(Bytecode::kLdar, Register(1).ToOperand());
+  writer()->BindLabel(&label);
+  Write(Bytecode::kSub, Register(2).ToOperand(), 3);
+  Write(Bytecode::kReturn);
+
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+
+  // The iterator sees through superinstructions.
+  Handle<BytecodeArray> bytecode_array =
+      writer()->ToBytecodeArray(isolate(), 0, 0, factory()->empty_byte_array());
+  BytecodeArrayIterator iterator(bytecode_array);
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kLdar);
+  CHECK_EQ(iterator.GetRegisterOperand(0).index(), 1);
+  iterator.Advance();
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kAdd);
+  CHECK_EQ(iterator.current_offset(), 2);
+  iterator.Advance();
+  iterator.Advance();
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kTestLessThan);
+  iterator.Advance();
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kJumpIfFalse);
+  CHECK_EQ(iterator.GetJumpTargetOffset(), 21);
+}
+
 TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   static const uint8_t expected_bytes[] = {
       // clang-format off
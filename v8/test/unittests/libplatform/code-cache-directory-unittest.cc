@@ -0,0 +1,183 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/v8-code-cache.h"
+#include "src/base/platform/platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+constexpr uint32_t kVersionTag = 0x1234;
+
+}  // namespace
+
+// Not in an anonymous namespace, so that CodeCacheDirectory can befriend it.
+class CodeCacheDirectoryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    char name[64];
+    base::OS::SNPrintF(name, sizeof(name), "v8-code-cache-test-%d-%d",
+                       base::OS::GetCurrentProcessId(), next_id_++);
+    path_ = ::testing::TempDir() + name;
+  }
+
+  void TearDown() override {
+    // Shrinking to zero bytes removes every entry.
+    std::unique_ptr<CodeCacheDirectory> cache =
+        CodeCacheDirectory::Open(path(), 0, kVersionTag);
+    if (cache) cache->Trim();
+  }
+
+  const char* path() const { return path_.c_str(); }
+
+  static std::string EntryPath(CodeCacheDirectory* cache, const char* source) {
+    return cache->EntryPath(source, strlen(source));
+  }
+
+ private:
+  static int next_id_;
+  std::string path_;
+};
+
+int CodeCacheDirectoryTest::next_id_ = 0;
+
+namespace {
+
+std::vector<uint8_t> MakeData(size_t length, uint8_t seed) {
+  std::vector<uint8_t> data(length);
+  for (size_t i = 0; i < length; i++) data[i] = static_cast<uint8_t>(seed + i);
+  return data;
+}
+
+bool EntryEquals(CodeCacheDirectory::Entry* entry,
+                 const std::vector<uint8_t>& data) {
+  return entry != nullptr && entry->length() == static_cast<int>(data.size()) &&
+         memcmp(entry->data(), data.data(), data.size()) == 0;
+}
+
+std::vector<char> ReadFile(const std::string& path) {
+  std::vector<char> contents;
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  if (file == nullptr) return contents;
+  char buffer[256];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    contents.insert(contents.end(), buffer, buffer + read);
+  }
+  fclose(file);
+  return contents;
+}
+
+bool WriteFile(const std::string& path, const std::vector<char>& contents) {
+  FILE* file = base::OS::FOpen(path.c_str(), "wb");
+  if (file == nullptr) return false;
+  bool ok = fwrite(contents.data(), 1, contents.size(), file) ==
+            contents.size();
+  return fclose(file) == 0 && ok;
+}
+
+}  // namespace
+
+TEST_F(CodeCacheDirectoryTest, StoreAndLookup) {
+  const char source[] = "function f() { return 42; }";
+  std::vector<uint8_t> data = MakeData(100, 1);
+  {
+    std::unique_ptr<CodeCacheDirectory> cache =
+        CodeCacheDirectory::Open(path(), 1 << 20, kVersionTag);
+    ASSERT_TRUE(cache);
+    EXPECT_EQ(nullptr, cache->Lookup(source, strlen(source)));
+    EXPECT_TRUE(
+        cache->Store(source, strlen(source), data.data(), data.size()));
+  }
+  // Entries persist across instances, like across processes.
+  std::unique_ptr<CodeCacheDirectory> cache =
+      CodeCacheDirectory::Open(path(), 1 << 20, kVersionTag);
+  ASSERT_TRUE(cache);
+  std::unique_ptr<CodeCacheDirectory::Entry> entry =
+      cache->Lookup(source, strlen(source));
+  EXPECT_TRUE(EntryEquals(entry.get(), data));
+  // A different source misses.
+  EXPECT_EQ(nullptr, cache->Lookup(source, strlen(source) - 1));
+}
+
+TEST_F(CodeCacheDirectoryTest, VersionTagMismatch) {
+  const char source[] = "var x = 1;";
+  std::vector<uint8_t> data = MakeData(64, 2);
+  std::unique_ptr<CodeCacheDirectory> cache =
+      CodeCacheDirectory::Open(path(), 1 << 20, kVersionTag);
+  ASSERT_TRUE(cache);
+  EXPECT_TRUE(cache->Store(source, strlen(source), data.data(), data.size()));
+
+  std::unique_ptr<CodeCacheDirectory> other_version =
+      CodeCacheDirectory::Open(path(), 1 << 20, kVersionTag + 1);
+  ASSERT_TRUE(other_version);
+  EXPECT_EQ(nullptr, other_version->Lookup(source, strlen(source)));
+}
+
+TEST_F(CodeCacheDirectoryTest, Remove) {
+  const char source[] = "var y = 2;";
+  std::vector<uint8_t> data = MakeData(64, 3);
+  std::unique_ptr<CodeCacheDirectory> cache =
+      CodeCacheDirectory::Open(path(), 1 << 20, kVersionTag);
+  ASSERT_TRUE(cache);
+  EXPECT_TRUE(cache->Store(source, strlen(source), data.data(), data.size()));
+  cache->Remove(source, strlen(source));
+  EXPECT_EQ(nullptr, cache->Lookup(source, strlen(source)));
+  EXPECT_EQ(0u, cache->size_in_bytes());
+}
+
+TEST_F(CodeCacheDirectoryTest, EvictsWhenFull) {
+  const char* sources[] = {"a()", "b()", "c()", "d()"};
+  std::vector<uint8_t> data = MakeData(1000, 4);
+  // Room for about two entries.
+  std::unique_ptr<CodeCacheDirectory> cache =
+      CodeCacheDirectory::Open(path(), 2100, kVersionTag);
+  ASSERT_TRUE(cache);
+  for (const char* source : sources) {
+    EXPECT_TRUE(cache->Store(source, strlen(source), data.data(), data.size()));
+    EXPECT_LE(cache->size_in_bytes(), 2100u);
+  }
+  // The most recent entry survives eviction.
+  EXPECT_TRUE(EntryEquals(cache->Lookup(sources[3], strlen(sources[3])).get(),
+                          data));
+  int hits = 0;
+  for (const char* source : sources) {
+    if (cache->Lookup(source, strlen(source))) hits++;
+  }
+  EXPECT_EQ(2, hits);
+}
+
+TEST_F(CodeCacheDirectoryTest, HashCollision) {
+  // Simulates a script whose source hash and length collide with those of a
+  // cached script, by changing the source stored in the entry in place.
+  const char source[] = "var z = 3;";
+  std::vector<uint8_t> data = MakeData(64, 5);
+  std::unique_ptr<CodeCacheDirectory> cache =
+      CodeCacheDirectory::Open(path(), 1 << 20, kVersionTag);
+  ASSERT_TRUE(cache);
+  EXPECT_TRUE(cache->Store(source, strlen(source), data.data(), data.size()));
+  ASSERT_TRUE(cache->Lookup(source, strlen(source)));
+
+  std::string entry_path = EntryPath(cache.get(), source);
+  std::vector<char> contents = ReadFile(entry_path);
+  auto stored_source = std::search(contents.begin(), contents.end(), source,
+                                   source + strlen(source));
+  ASSERT_NE(contents.end(), stored_source);
+  stored_source[strlen("var ")] = 'w';
+  ASSERT_TRUE(WriteFile(entry_path, contents));
+
+  EXPECT_EQ(nullptr, cache->Lookup(source, strlen(source)));
+}
+
+}  // namespace platform
+}  // namespace v8
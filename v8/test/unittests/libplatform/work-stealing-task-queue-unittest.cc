@@ -0,0 +1,149 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/work-stealing-task-queue.h"
+
+#include <atomic>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/libplatform/default-worker-threads-task-runner.h"
+#include "testing/gmock/include/gmock/gmock.h"
+
+using testing::IsNull;
+
+namespace v8 {
+namespace platform {
+namespace work_stealing_task_queue_unittest {
+
+namespace {
+
+struct MockTask : public Task {
+  MOCK_METHOD(void, Run, (), (override));
+};
+
+class CountingTask : public Task {
+ public:
+  CountingTask(std::atomic<int>* counter, base::Semaphore* done, int total)
+      : counter_(counter), done_(done), total_(total) {}
+
+  void Run() override {
+    if (counter_->fetch_add(1) + 1 == total_) done_->Signal();
+  }
+
+ private:
+  std::atomic<int>* counter_;
+  base::Semaphore* done_;
+  int total_;
+};
+
+double fake_time = 0.0;
+double FakeTime() { return fake_time; }
+
+class WorkerQueueThread final : public base::Thread {
+ public:
+  WorkerQueueThread(WorkStealingTaskQueue* queue, int worker_id)
+      : Thread(Options("libplatform WorkerQueueThread")),
+        queue_(queue),
+        worker_id_(worker_id) {}
+
+  void Run() override { EXPECT_THAT(queue_->GetNext(worker_id_), IsNull()); }
+
+ private:
+  WorkStealingTaskQueue* queue_;
+  int worker_id_;
+};
+
+}  // namespace
+
+TEST(WorkStealingTaskQueueTest, Basic) {
+  WorkStealingTaskQueue queue(1, FakeTime);
+  std::unique_ptr<Task> task(new MockTask());
+  Task* ptr = task.get();
+  queue.Append(std::move(task), TaskPriority::kUserVisible);
+  EXPECT_EQ(ptr, queue.GetNext(0).get());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+TEST(WorkStealingTaskQueueTest, HigherPriorityFirst) {
+  WorkStealingTaskQueue queue(1, FakeTime);
+  std::unique_ptr<Task> best_effort(new MockTask());
+  std::unique_ptr<Task> user_visible(new MockTask());
+  std::unique_ptr<Task> user_blocking(new MockTask());
+  Task* best_effort_ptr = best_effort.get();
+  Task* user_visible_ptr = user_visible.get();
+  Task* user_blocking_ptr = user_blocking.get();
+  queue.Append(std::move(best_effort), TaskPriority::kBestEffort);
+  queue.Append(std::move(user_visible), TaskPriority::kUserVisible);
+  queue.Append(std::move(user_blocking), TaskPriority::kUserBlocking);
+  EXPECT_EQ(user_blocking_ptr, queue.GetNext(0).get());
+  EXPECT_EQ(user_visible_ptr, queue.GetNext(0).get());
+  EXPECT_EQ(best_effort_ptr, queue.GetNext(0).get());
+  queue.Terminate();
+}
+
+TEST(WorkStealingTaskQueueTest, StealsFromOtherWorkers) {
+  WorkStealingTaskQueue queue(4, FakeTime);
+  std::unique_ptr<Task> tasks[4];
+  Task* ptrs[4];
+  for (int i = 0; i < 4; ++i) {
+    tasks[i].reset(new MockTask());
+    ptrs[i] = tasks[i].get();
+    // Tasks posted from outside the pool are distributed round-robin.
+    queue.Append(std::move(tasks[i]), TaskPriority::kUserVisible);
+  }
+  // Worker 0 takes its own task first and then steals the others in order.
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(ptrs[i], queue.GetNext(0).get());
+  }
+  queue.Terminate();
+}
+
+TEST(WorkStealingTaskQueueTest, DelayedTask) {
+  fake_time = 0.0;
+  WorkStealingTaskQueue queue(1, FakeTime);
+  std::unique_ptr<Task> delayed(new MockTask());
+  std::unique_ptr<Task> immediate(new MockTask());
+  Task* delayed_ptr = delayed.get();
+  Task* immediate_ptr = immediate.get();
+  queue.AppendDelayed(std::move(delayed), 10.0);
+  queue.Append(std::move(immediate), TaskPriority::kBestEffort);
+  EXPECT_EQ(immediate_ptr, queue.GetNext(0).get());
+  fake_time = 10.0;
+  EXPECT_EQ(delayed_ptr, queue.GetNext(0).get());
+  queue.Terminate();
+}
+
+TEST(WorkStealingTaskQueueTest, TerminateMultipleReaders) {
+  WorkStealingTaskQueue queue(2, FakeTime);
+  WorkerQueueThread thread1(&queue, 0);
+  WorkerQueueThread thread2(&queue, 1);
+  CHECK(thread1.Start());
+  CHECK(thread2.Start());
+  queue.Terminate();
+  thread1.Join();
+  thread2.Join();
+}
+
+TEST(WorkStealingTaskQueueTest, TaskRunnerRunsAllTasks) {
+  constexpr int kTasks = 1000;
+  DefaultWorkerThreadsTaskRunner runner(
+      4, FakeTime, WorkerThreadsTaskScheduling::kWorkStealing);
+  std::atomic<int> counter{0};
+  base::Semaphore done(0);
+  for (int i = 0; i < kTasks; ++i) {
+    runner.PostTaskWithPriority(
+        std::make_unique<CountingTask>(&counter, &done, kTasks),
+        static_cast<TaskPriority>(i % 3));
+  }
+  done.Wait();
+  runner.Terminate();
+  EXPECT_EQ(kTasks, counter.load());
+}
+
+}  // namespace work_stealing_task_queue_unittest
+}  // namespace platform
+}  // namespace v8
@@ -108,6 +108,40 @@ TEST(UnicodeTest, SurrogateOverrunsBuffer) {
   CHECK_EQ(output_utf16[0], 0x00);
 }
 
+TEST(UnicodeTest, Utf8DecoderVsIncrementalDecodingOfLongInputs) {
+  // Utf8Decoder decodes the well-formed prefix of its input a vector at a
+  // time. Check that it still agrees with the DFA about ill-formed and
+  // truncated sequences at any position of inputs spanning several vectors.
+  const std::vector<byte> text = {
+      'a',  'b',  ' ',  0xC3, 0xA9,  // U+00E9
+      0xD0, 0x96,                    // U+0416
+      0xE4, 0xB8, 0xAD,              // U+4E2D
+      0xF0, 0x9F, 0x98, 0x80,        // U+1F600
+  };
+  const byte ill_formed[] = {0x80, 0xBF, 0xC0, 0xC3, 0xE0,
+                             0xED, 0xF0, 0xF4, 0xF5, 0xFF};
+  std::vector<byte> bytes;
+  while (bytes.size() < 100) {
+    bytes.insert(bytes.end(), text.begin(), text.end());
+  }
+
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    std::vector<std::vector<byte>> inputs;
+    inputs.emplace_back(bytes.begin(), bytes.begin() + i);
+    for (byte b : ill_formed) {
+      inputs.push_back(bytes);
+      inputs.back()[i] = b;
+    }
+    for (const std::vector<byte>& input : inputs) {
+      std::vector<unibrow::uchar> output_incremental;
+      DecodeIncrementally(input, &output_incremental);
+      std::vector<unibrow::uchar> output_utf16;
+      DecodeUtf16(input, &output_utf16);
+      EXPECT_EQ(output_incremental, output_utf16);
+    }
+  }
+}
+
 TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   // Unfortunately, V8 has two UTF-8 decoders. This test checks that they
   // produce the same result. This test was inspired by
@@ -348,6 +348,21 @@ TEST(Torque, ConditionalFields) {
                            HasSubstr("aligned"));
 }
 
+TEST(Torque, VoidFieldAtSlotBoundary) {
+  // The padding starts a new slot with both 4 and 8 byte tagged values. When
+  // it is compiled out, it must not be given a slot of its own.
+  ExpectSuccessfulCompilation(R"(
+  @generateBodyDescriptor
+  extern class VoidFieldTest extends HeapObject {
+    a: int32;
+    b: int32;
+    @if(TRUE_FOR_TESTING) padding: void;
+    @ifnot(TRUE_FOR_TESTING) padding: uint32;
+    c: Smi;
+  }
+  )");
+}
+
 TEST(Torque, ConstexprLetBindingDoesNotCrash) {
   ExpectFailingCompilation(
       R"(@export macro FooBar() { let foo = 0; check(foo >= 0); })",
@@ -0,0 +1,221 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Converts a heap snapshot serialized with v8::HeapSnapshot::kBinary to the
+// JSON format understood by the DevTools frontend. The format is described
+// near v8::HeapSnapshot::Serialize in include/v8-profiler.h.
+//
+// Usage:
+//
+// $ out/x64.release/d8 tools/heap-snapshot-to-json.js -- snapshot.bin \
+//     > snapshot.heapsnapshot
+
+(function(global) {
+  'use strict';
+
+  const kMagic = 'V8HS';
+  const kVersion = 1;
+  const kNodeFieldsCount = 7;
+  const kEdgeFieldsCount = 3;
+  const kTraceFunctionInfoFieldsCount = 6;
+  // Number of array elements printed per write() call.
+  const kWriteBatchSize = 4096;
+
+  const kMeta = {
+    node_fields: ['type', 'name', 'id', 'self_size', 'edge_count',
+                  'trace_node_id', 'detachedness'],
+    node_types: [['hidden', 'array', 'string', 'object', 'code', 'closure',
+                  'regexp', 'number', 'native', 'synthetic',
+                  'concatenated string', 'sliced string', 'symbol', 'bigint'],
+                 'string', 'number', 'number', 'number', 'number', 'number'],
+    edge_fields: ['type', 'name_or_index', 'to_node'],
+    edge_types: [['context', 'element', 'property', 'internal', 'hidden',
+                  'shortcut', 'weak'],
+                 'string_or_number', 'node'],
+    trace_function_info_fields: ['function_id', 'name', 'script_name',
+                                 'script_id', 'line', 'column'],
+    trace_node_fields: ['id', 'function_info_index', 'count', 'size',
+                        'children'],
+    sample_fields: ['timestamp_us', 'last_assigned_id'],
+    location_fields: ['object_index', 'script_id', 'line', 'column'],
+  };
+
+  class Reader {
+    constructor(buffer) {
+      this.bytes = new Uint8Array(buffer);
+      this.pos = 0;
+    }
+
+    readByte() {
+      if (this.pos >= this.bytes.length) {
+        throw new Error('Unexpected end of snapshot');
+      }
+      return this.bytes[this.pos++];
+    }
+
+    readVarint() {
+      let value = 0;
+      for (let scale = 1;; scale *= 128) {
+        const byte = this.readByte();
+        value += (byte & 0x7F) * scale;
+        if (!(byte & 0x80)) return value;
+      }
+    }
+
+    readString() {
+      const length = this.readVarint();
+      const end = this.pos + length;
+      if (end > this.bytes.length) {
+        throw new Error('Unexpected end of snapshot');
+      }
+      const result = decodeUtf8(this.bytes, this.pos, end);
+      this.pos = end;
+      return result;
+    }
+  }
+
+  // Invalid sequences are replaced by '?', like the JSON serializer does.
+  function decodeUtf8(bytes, start, end) {
+    const codes = [];
+    let i = start;
+    while (i < end) {
+      const byte = bytes[i++];
+      let length = 0;
+      let code = 0;
+      if (byte < 0x80) {
+        codes.push(byte);
+        continue;
+      } else if ((byte & 0xE0) === 0xC0) {
+        length = 1;
+        code = byte & 0x1F;
+      } else if ((byte & 0xF0) === 0xE0) {
+        length = 2;
+        code = byte & 0x0F;
+      } else if ((byte & 0xF8) === 0xF0) {
+        length = 3;
+        code = byte & 0x07;
+      } else {
+        codes.push(0x3F);
+        continue;
+      }
+      if (i + length > end) {
+        codes.push(0x3F);
+        break;
+      }
+      let valid = true;
+      for (let j = 0; j < length; j++) {
+        const continuation = bytes[i + j];
+        if ((continuation & 0xC0) !== 0x80) valid = false;
+        code = (code << 6) | (continuation & 0x3F);
+      }
+      if (!valid || code > 0x10FFFF) {
+        codes.push(0x3F);
+        continue;
+      }
+      i += length;
+      if (code >= 0x10000) {
+        code -= 0x10000;
+        codes.push(0xD800 + (code >> 10), 0xDC00 + (code & 0x3FF));
+      } else {
+        codes.push(code);
+      }
+    }
+    let result = '';
+    for (let j = 0; j < codes.length; j += kWriteBatchSize) {
+      result += String.fromCharCode.apply(
+          null, codes.slice(j, j + kWriteBatchSize));
+    }
+    return result;
+  }
+
+  // Prints |count| array elements produced by |next|, separated by commas.
+  function writeArray(count, next) {
+    let batch = [];
+    let separator = '';
+    for (let i = 0; i < count; i++) {
+      batch.push(next(i));
+      if (batch.length === kWriteBatchSize || i + 1 === count) {
+        write(separator + batch.join(','));
+        separator = ',';
+        batch = [];
+      }
+    }
+  }
+
+  function readFields(reader, count) {
+    const fields = [];
+    for (let i = 0; i < count; i++) fields.push(reader.readVarint());
+    return fields;
+  }
+
+  function readTraceNode(reader) {
+    const fields = readFields(reader, 4);
+    const childrenCount = reader.readVarint();
+    const children = [];
+    for (let i = 0; i < childrenCount; i++) {
+      children.push(...readTraceNode(reader));
+    }
+    fields.push(children);
+    return fields;
+  }
+
+  function convert(buffer) {
+    const reader = new Reader(buffer);
+    for (let i = 0; i < kMagic.length; i++) {
+      if (reader.readByte() !== kMagic.charCodeAt(i)) {
+        throw new Error('Not a binary heap snapshot');
+      }
+    }
+    const version = reader.readVarint();
+    if (version !== kVersion) {
+      throw new Error(`Unsupported binary heap snapshot version ${version}`);
+    }
+    const nodeCount = reader.readVarint();
+    const edgeCount = reader.readVarint();
+    const traceFunctionCount = reader.readVarint();
+
+    write('{"snapshot":{"meta":' + JSON.stringify(kMeta));
+    write(`,"node_count":${nodeCount},"edge_count":${edgeCount}`);
+    write(`,"trace_function_count":${traceFunctionCount}},\n`);
+
+    write('"nodes":[');
+    writeArray(nodeCount,
+               () => readFields(reader, kNodeFieldsCount).join(','));
+    write('],\n"edges":[');
+    writeArray(edgeCount, () => {
+      const fields = readFields(reader, kEdgeFieldsCount);
+      // Edges refer to nodes by ordinal in the binary format.
+      fields[2] *= kNodeFieldsCount;
+      return fields.join(',');
+    });
+    write('],\n"trace_function_infos":[');
+    writeArray(
+        traceFunctionCount,
+        () => readFields(reader, kTraceFunctionInfoFieldsCount).join(','));
+    write('],\n"trace_tree":');
+    const hasTraceTree = reader.readVarint();
+    write(JSON.stringify(hasTraceTree ? readTraceNode(reader) : []));
+    write(',\n"samples":[');
+    writeArray(reader.readVarint(), () => readFields(reader, 2).join(','));
+    write('],\n"locations":[');
+    writeArray(reader.readVarint(), () => {
+      const fields = readFields(reader, 4);
+      fields[0] *= kNodeFieldsCount;
+      return fields.join(',');
+    });
+    write('],\n"strings":[');
+    writeArray(reader.readVarint(),
+               () => '\n' + JSON.stringify(reader.readString()));
+    write(']}\n');
+    if (reader.pos !== reader.bytes.length) {
+      throw new Error('Unexpected data after the end of snapshot');
+    }
+  }
+
+  if (global.arguments.length !== 1) {
+    print('Usage: d8 tools/heap-snapshot-to-json.js -- <binary snapshot>');
+    quit(1);
+  }
+  convert(readbuffer(global.arguments[0]));
+})(this);